@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Start of Arduino_GFX setting
+ *
+ * Arduino_GFX try to find the settings depends on selected board in Arduino IDE
+ * Or you can define the display dev kit not in the board list
+ * Defalult pin list for non display dev kit:
+ * Arduino Nano, Micro and more: CS:  9, DC:  8, RST:  7, BL:  6, SCK: 13, MOSI: 11, MISO: 12
+ * ESP32 various dev board     : CS:  5, DC: 27, RST: 33, BL: 22, SCK: 18, MOSI: 23, MISO: nil
+ * ESP32-C3 various dev board  : CS:  7, DC:  2, RST:  1, BL:  3, SCK:  4, MOSI:  6, MISO: nil
+ * ESP32-S2 various dev board  : CS: 34, DC: 38, RST: 33, BL: 21, SCK: 36, MOSI: 35, MISO: nil
+ * ESP32-S3 various dev board  : CS: 40, DC: 41, RST: 42, BL: 48, SCK: 36, MOSI: 35, MISO: nil
+ * ESP8266 various dev board   : CS: 15, DC:  4, RST:  2, BL:  5, SCK: 14, MOSI: 13, MISO: 12
+ * Raspberry Pi Pico dev board : CS: 17, DC: 27, RST: 26, BL: 28, SCK: 18, MOSI: 19, MISO: 16
+ * RTL8720 BW16 old patch core : CS: 18, DC: 17, RST:  2, BL: 23, SCK: 19, MOSI: 21, MISO: 20
+ * RTL8720_BW16 Official core  : CS:  9, DC:  8, RST:  6, BL:  3, SCK: 10, MOSI: 12, MISO: 11
+ * RTL8722 dev board           : CS: 18, DC: 17, RST: 22, BL: 23, SCK: 13, MOSI: 11, MISO: 12
+ * RTL8722_mini dev board      : CS: 12, DC: 14, RST: 15, BL: 13, SCK: 11, MOSI:  9, MISO: 10
+ * Seeeduino XIAO dev board    : CS:  3, DC:  2, RST:  1, BL:  0, SCK:  8, MOSI: 10, MISO:  9
+ * Teensy 4.1 dev board        : CS: 39, DC: 41, RST: 40, BL: 22, SCK: 13, MOSI: 11, MISO: 12
+ ******************************************************************************/
+#include <Arduino_GFX_Library.h>
+
+#define GFX_BL DF_GFX_BL // default backlight pin, you may replace DF_GFX_BL to actual backlight pin
+
+/* More dev device declaration: https://github.com/moononournation/Arduino_GFX/wiki/Dev-Device-Declaration */
+#if defined(DISPLAY_DEV_KIT)
+Arduino_GFX *gfx = create_default_Arduino_GFX();
+#else /* !defined(DISPLAY_DEV_KIT) */
+
+/* More data bus class: https://github.com/moononournation/Arduino_GFX/wiki/Data-Bus-Class */
+Arduino_DataBus *bus = create_default_Arduino_DataBus();
+
+/* More display class: https://github.com/moononournation/Arduino_GFX/wiki/Display-Class */
+Arduino_GFX *gfx = new Arduino_ILI9341(bus, DF_GFX_RST, 0 /* rotation */, false /* IPS */);
+
+#endif /* !defined(DISPLAY_DEV_KIT) */
+/*******************************************************************************
+ * End of Arduino_GFX setting
+ ******************************************************************************/
+
+// left half aliased, right half anti-aliased against the known background
+void drawHalf(int16_t x0, bool aa)
+{
+  int16_t w = gfx->width() / 2;
+  for (int16_t i = 0; i <= 6; ++i)
+  {
+    if (aa)
+    {
+      gfx->drawLine(x0 + 4, 10, x0 + 4 + (i * (w - 8)) / 6, 60, CYAN, BLACK);
+    }
+    else
+    {
+      gfx->drawLine(x0 + 4, 10, x0 + 4 + (i * (w - 8)) / 6, 60, CYAN);
+    }
+  }
+
+  int16_t cx = x0 + w / 2;
+  if (aa)
+  {
+    gfx->fillCircle(cx, 100, 28, ORANGE, BLACK);
+    gfx->drawCircle(cx, 100, 34, WHITE, BLACK);
+    gfx->fillRoundRect(x0 + 8, 146, w - 16, 40, 12, DARKGREEN, BLACK);
+    gfx->drawRoundRect(x0 + 4, 142, w - 8, 48, 16, GREEN, BLACK);
+  }
+  else
+  {
+    gfx->fillCircle(cx, 100, 28, ORANGE);
+    gfx->drawCircle(cx, 100, 34, WHITE);
+    gfx->fillRoundRect(x0 + 8, 146, w - 16, 40, 12, DARKGREEN);
+    gfx->drawRoundRect(x0 + 4, 142, w - 8, 48, 16, GREEN);
+  }
+
+  // text enlarged by setTextSize() gets smooth edges instead of blocks
+  gfx->setTextAntiAlias(aa);
+  gfx->setTextSize(4);
+  gfx->setTextColor(WHITE, BLACK);
+  gfx->setCursor(x0 + 8, 200);
+  gfx->print("Ag");
+  gfx->setTextAntiAlias(false);
+}
+
+void setup(void)
+{
+  Serial.begin(115200);
+  // Serial.setDebugOutput(true);
+  // while(!Serial);
+  Serial.println("Arduino_GFX Anti-Aliased example");
+
+#ifdef GFX_EXTRA_PRE_INIT
+  GFX_EXTRA_PRE_INIT();
+#endif
+
+  // Init Display
+  if (!gfx->begin())
+  {
+    Serial.println("gfx->begin() failed!");
+  }
+  gfx->fillScreen(BLACK);
+
+#ifdef GFX_BL
+  pinMode(GFX_BL, OUTPUT);
+  digitalWrite(GFX_BL, HIGH);
+#endif
+
+  unsigned long start = micros();
+  drawHalf(0, false);
+  unsigned long aliased = micros() - start;
+  start = micros();
+  drawHalf(gfx->width() / 2, true);
+  unsigned long smooth = micros() - start;
+  Serial.printf("aliased: %lu us, anti-aliased: %lu us\n", aliased, smooth);
+
+  // 4 bpp fonts: make a GFXfont at 4 times the size with fontconvert, turn
+  // it into coverage with tools/gfx_font4.py, then
+  // #include "FreeSans12pt4b.h"
+  // gfx->setFont(&FreeSans12pt4b, 4);
+  // gfx->setTextColor(WHITE, BLACK); // or no background on a canvas
+}
+
+void loop()
+{
+}
@@ -0,0 +1,196 @@
+/*
+  Async pixel pipeline benchmark.
+
+  Measures the raw pixel transfer rate of the data bus and how much band
+  rendering the CPU gets done while the previous band is still on the wire:
+    blocking  render band -> writePixels()  -> render next band ...
+    async     render band -> submitPixels() -> render next band while it is sent
+
+  On ESP32-S3 Arduino_ESP32SPI feeds the SPI peripheral by DMA for runs of at
+  least ESP32SPI_DMA_THRESHOLD pixels; other buses fall back to blocking
+  writes and both columns should read the same.
+*/
+
+/*******************************************************************************
+ * Start of Arduino_GFX setting
+ ******************************************************************************/
+#include <Arduino_GFX_Library.h>
+
+#define GFX_BL DF_GFX_BL // default backlight pin, you may replace DF_GFX_BL to actual backlight pin
+
+Arduino_DataBus *bus = create_default_Arduino_DataBus();
+Arduino_TFT *gfx = new Arduino_ST7789(bus, DF_GFX_RST, 0 /* rotation */, true /* IPS */);
+/*******************************************************************************
+ * End of Arduino_GFX setting
+ ******************************************************************************/
+
+#ifdef ESP32
+#undef F
+#define F(s) (s)
+#endif
+
+#ifdef ESP32SPI_DMA_PIXELS
+#define BAND_PIXELS ESP32SPI_DMA_PIXELS // one band fits one staging buffer
+#else
+#define BAND_PIXELS 2048
+#endif
+
+int16_t w, h, bandLines;
+uint16_t *band;
+uint16_t frame = 0;
+
+static inline uint32_t micros_start() __attribute__((always_inline));
+static inline uint32_t micros_start()
+{
+  uint8_t oms = millis();
+  while ((uint8_t)millis() == oms)
+    ;
+  return micros();
+}
+
+// stand-in for real drawing work, a moving plasma-ish pattern
+void renderBand(int16_t y0, int16_t lines)
+{
+  uint16_t *p = band;
+  for (int16_t y = y0; y < y0 + lines; y++)
+  {
+    for (int16_t x = 0; x < w; x++)
+    {
+      uint8_t v = (uint8_t)(x * x + y * y + (frame << 2)) ^ (uint8_t)(x + y + frame);
+      *p++ = RGB565(v, 255 - v, (x + frame) & 0xFF);
+    }
+  }
+}
+
+uint32_t testRenderOnly()
+{
+  uint32_t start = micros_start();
+  for (int16_t y = 0; y < h; y += bandLines)
+  {
+    renderBand(y, min(bandLines, (int16_t)(h - y)));
+  }
+  frame++;
+  return micros() - start;
+}
+
+uint32_t testBlocking()
+{
+  uint32_t start = micros_start();
+  gfx->startWrite();
+  gfx->writeAddrWindow(0, 0, w, h);
+  for (int16_t y = 0; y < h; y += bandLines)
+  {
+    int16_t lines = min(bandLines, (int16_t)(h - y));
+    renderBand(y, lines);
+    bus->writePixels(band, (uint32_t)w * lines);
+    bus->waitFence(bus->fence()); // writePixels() may leave its tail running
+  }
+  gfx->endWrite();
+  frame++;
+  return micros() - start;
+}
+
+uint32_t testAsync()
+{
+  uint32_t start = micros_start();
+  gfx->startWrite();
+  gfx->writeAddrWindow(0, 0, w, h);
+  uint32_t fence = 0;
+  for (int16_t y = 0; y < h; y += bandLines)
+  {
+    int16_t lines = min(bandLines, (int16_t)(h - y));
+    renderBand(y, lines); // overlaps with the band submitted last time round
+    fence = bus->submitPixels(band, (uint32_t)w * lines);
+  }
+  bus->waitFence(fence);
+  gfx->endWrite();
+  frame++;
+  return micros() - start;
+}
+
+uint32_t testFillScreen()
+{
+  uint32_t start = micros_start();
+  gfx->fillScreen(RGB565_BLACK);
+  gfx->fillScreen(RGB565_RED);
+  gfx->fillScreen(RGB565_GREEN);
+  gfx->fillScreen(RGB565_BLUE);
+  return (micros() - start) / 4;
+}
+
+void serialOut(const char *item, uint32_t usec)
+{
+  float mbps = (float)w * h * 2 / usec; // bytes per usec == MB/s
+  Serial.print(item);
+  Serial.print(usec);
+  Serial.print(F("\t"));
+  Serial.print(mbps);
+  Serial.println(F(" MB/s"));
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  // Serial.setDebugOutput(true);
+  // while(!Serial);
+  Serial.println("Arduino_GFX AsyncPixelsBenchmark example!");
+
+#ifdef GFX_EXTRA_PRE_INIT
+  GFX_EXTRA_PRE_INIT();
+#endif
+
+  // Init Display
+  if (!gfx->begin())
+  // if (!gfx->begin(80000000)) /* specify data bus speed */
+  {
+    Serial.println("gfx->begin() failed!");
+  }
+  gfx->fillScreen(RGB565_BLACK);
+
+#ifdef GFX_BL
+  pinMode(GFX_BL, OUTPUT);
+  digitalWrite(GFX_BL, HIGH);
+#endif
+
+  w = gfx->width();
+  h = gfx->height();
+  bandLines = max(1, BAND_PIXELS / w);
+  band = (uint16_t *)malloc((uint32_t)w * bandLines * 2);
+  if (!band)
+  {
+    Serial.println(F("band buffer malloc failed!"));
+  }
+}
+
+void loop()
+{
+  if (!band)
+  {
+    delay(1000);
+    return;
+  }
+
+  Serial.println(F("Benchmark\tmicro-secs\trate"));
+
+  serialOut(F("Screen fill\t"), testFillScreen());
+
+  uint32_t usecRender = testRenderOnly();
+  Serial.print(F("Render only\t"));
+  Serial.println(usecRender);
+
+  uint32_t usecBlocking = testBlocking();
+  serialOut(F("Blocking frame\t"), usecBlocking);
+
+  uint32_t usecAsync = testAsync();
+  serialOut(F("Async frame\t"), usecAsync);
+
+  // share of the render time hidden behind the transfer
+  int32_t hidden = (int32_t)usecBlocking - (int32_t)usecAsync;
+  Serial.print(F("CPU overlap\t"));
+  Serial.print(usecRender ? (100 * max(hidden, (int32_t)0) / (int32_t)usecRender) : 0);
+  Serial.println(F(" %"));
+
+  Serial.println(F("Done!"));
+
+  delay(5000);
+}
@@ -0,0 +1,231 @@
+/*
+  Display list benchmark.
+
+  Runs a selection of the PDQgraphicstest scenes twice:
+    direct        every primitive goes to the display as it is drawn
+    display list  primitives are recorded by Arduino_Canvas_DisplayList and
+                  flush() sends the screen band by band
+  The display list time includes the flush(). The last scene redraws a
+  mostly static dashboard where only a counter changes, so flush() only
+  sends the bands the counter touches.
+*/
+
+/*******************************************************************************
+ * Start of Arduino_GFX setting
+ ******************************************************************************/
+#include <Arduino_GFX_Library.h>
+
+#define GFX_BL DF_GFX_BL // default backlight pin, you may replace DF_GFX_BL to actual backlight pin
+
+Arduino_DataBus *bus = create_default_Arduino_DataBus();
+Arduino_GFX *gfx = new Arduino_ST7789(bus, DF_GFX_RST, 0 /* rotation */, true /* IPS */);
+/*******************************************************************************
+ * End of Arduino_GFX setting
+ ******************************************************************************/
+
+#ifdef ESP32
+#undef F
+#define F(s) (s)
+#endif
+
+Arduino_Canvas_DisplayList *dl;
+int16_t w, h, n, cx, cy;
+uint16_t frame = 0;
+
+static inline uint32_t micros_start() __attribute__((always_inline));
+static inline uint32_t micros_start()
+{
+  uint8_t oms = millis();
+  while ((uint8_t)millis() == oms)
+    ;
+  return micros();
+}
+
+void sceneText(Arduino_GFX *g)
+{
+  g->fillScreen(RGB565_BLACK);
+  g->setCursor(0, 0);
+  g->setTextSize(1);
+  g->setTextColor(RGB565_WHITE, RGB565_BLACK);
+  g->println(F("Hello World!"));
+  g->setTextSize(2);
+  g->setTextColor(RGB565_RED);
+  g->print(F("RED "));
+  g->setTextColor(RGB565_GREEN);
+  g->print(F("GREEN "));
+  g->setTextColor(RGB565_BLUE);
+  g->println(F("BLUE"));
+  g->setTextSize(1);
+  g->setTextColor(RGB565_NAVY, RGB565_WHITE);
+  g->println(F("my foonting turlingdromes."));
+  g->setTextColor(RGB565_DARKGREEN, RGB565_WHITE);
+  g->println(F("And hooptiously drangle me"));
+  g->setTextColor(RGB565_DARKCYAN, RGB565_WHITE);
+  g->println(F("with crinkly bindlewurdles,"));
+  for (uint8_t s = 2; s <= 4; s++)
+  {
+    g->setTextSize(s);
+    g->setTextColor(RGB565_ORANGE);
+    g->println(F("Size"));
+  }
+}
+
+void sceneLines(Arduino_GFX *g)
+{
+  g->fillScreen(RGB565_BLACK);
+  for (int16_t x2 = 0; x2 < w; x2 += 6)
+  {
+    g->drawLine(0, 0, x2, h - 1, RGB565_BLUE);
+  }
+  for (int16_t y2 = 0; y2 < h; y2 += 6)
+  {
+    g->drawLine(w - 1, 0, 0, y2, RGB565_BLUE);
+  }
+}
+
+void sceneFastLines(Arduino_GFX *g)
+{
+  g->fillScreen(RGB565_BLACK);
+  for (int16_t y = 0; y < h; y += 5)
+  {
+    g->drawFastHLine(0, y, w, RGB565_RED);
+  }
+  for (int16_t x = 0; x < w; x += 5)
+  {
+    g->drawFastVLine(x, 0, h, RGB565_BLUE);
+  }
+}
+
+void sceneRects(Arduino_GFX *g)
+{
+  g->fillScreen(RGB565_BLACK);
+  for (int16_t i = n; i > 0; i -= 6)
+  {
+    g->fillRect(cx - i / 2, cy - i / 2, i, i, g->color565(i, i, 0));
+  }
+  for (int16_t i = 2; i < n; i += 6)
+  {
+    g->drawRect(cx - i / 2, cy - i / 2, i, i, RGB565_GREEN);
+  }
+}
+
+void sceneCircles(Arduino_GFX *g)
+{
+  g->fillScreen(RGB565_BLACK);
+  for (int16_t x = 10; x < w; x += 20)
+  {
+    for (int16_t y = 10; y < h; y += 20)
+    {
+      g->fillCircle(x, y, 10, RGB565_MAGENTA);
+      g->drawCircle(x, y, 10, RGB565_WHITE);
+    }
+  }
+}
+
+void sceneDashboard(Arduino_GFX *g)
+{
+  g->fillScreen(RGB565_DARKGREY);
+  g->fillRoundRect(8, 8, w - 16, 40, 6, RGB565_NAVY);
+  g->setTextSize(2);
+  g->setTextColor(RGB565_WHITE);
+  g->setCursor(16, 20);
+  g->print(F("Dashboard"));
+  for (int16_t i = 0; i < 4; i++)
+  {
+    g->drawRoundRect(8, 60 + i * 30, w - 16, 24, 4, RGB565_LIGHTGREY);
+  }
+  g->setTextColor(RGB565_YELLOW, RGB565_DARKGREY);
+  g->setCursor(16, h - 24);
+  g->print(frame);
+}
+
+uint32_t runDirect(void (*scene)(Arduino_GFX *))
+{
+  uint32_t start = micros_start();
+  scene(gfx);
+  return micros() - start;
+}
+
+uint32_t runDisplayList(void (*scene)(Arduino_GFX *))
+{
+  uint32_t start = micros_start();
+  dl->clear();
+  scene(dl);
+  dl->flush();
+  return micros() - start;
+}
+
+void serialOut(const char *item, void (*scene)(Arduino_GFX *))
+{
+  uint32_t usecDirect = runDirect(scene);
+  uint32_t usecList = runDisplayList(scene);
+  Serial.print(item);
+  Serial.print(usecDirect);
+  Serial.print(F("\t"));
+  Serial.print(usecList);
+  Serial.print(F("\t"));
+  Serial.println(dl->commandCount());
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  // Serial.setDebugOutput(true);
+  // while(!Serial);
+  Serial.println("Arduino_GFX DisplayListBenchmark example!");
+
+#ifdef GFX_EXTRA_PRE_INIT
+  GFX_EXTRA_PRE_INIT();
+#endif
+
+  // Init Display
+  if (!gfx->begin())
+  // if (!gfx->begin(80000000)) /* specify data bus speed */
+  {
+    Serial.println("gfx->begin() failed!");
+  }
+  gfx->fillScreen(RGB565_BLACK);
+
+#ifdef GFX_BL
+  pinMode(GFX_BL, OUTPUT);
+  digitalWrite(GFX_BL, HIGH);
+#endif
+
+  w = gfx->width();
+  h = gfx->height();
+  n = min(w, h);
+  cx = w / 2;
+  cy = h / 2;
+
+  dl = new Arduino_Canvas_DisplayList(w, h, gfx);
+  if (!dl->begin(GFX_SKIP_OUTPUT_BEGIN))
+  {
+    Serial.println(F("display list begin() failed!"));
+  }
+}
+
+void loop()
+{
+  Serial.println(F("Benchmark\tdirect us\tlist us\tcommands"));
+
+  serialOut(F("Text\t\t"), sceneText);
+  serialOut(F("Lines\t\t"), sceneLines);
+  serialOut(F("Horiz/Vert Lines"), sceneFastLines);
+  serialOut(F("Rectangles\t"), sceneRects);
+  serialOut(F("Circles\t\t"), sceneCircles);
+
+  // first dashboard frame sends every band, the next ones only what changed
+  dl->invalidate();
+  serialOut(F("Dashboard\t"), sceneDashboard);
+  frame++;
+  serialOut(F("Dashboard again\t"), sceneDashboard);
+  frame++;
+
+  if (dl->overflowed())
+  {
+    Serial.println(F("display list overflowed, some commands were dropped"));
+  }
+  Serial.println(F("Done!"));
+
+  delay(5000);
+}
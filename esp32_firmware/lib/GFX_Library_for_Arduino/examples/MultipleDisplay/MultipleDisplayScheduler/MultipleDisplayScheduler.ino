@@ -0,0 +1,97 @@
+/*
+  Two displays on their own SPI hosts refreshed by Arduino_DisplayScheduler.
+
+  The main display animates at 30 fps with priority, a small status display
+  redraws a clock at 5 fps. The scheduler sends each canvas in DMA bands, so
+  one panel's transfer runs while the other one renders, and the status
+  display never costs the main one a frame. Per display frame stats are
+  printed every 2 seconds.
+*/
+
+/*******************************************************************************
+ * Start of Arduino_GFX setting
+ ******************************************************************************/
+#include <Arduino_GFX_Library.h>
+
+/* main display on FSPI */
+Arduino_DataBus *bus1 = new Arduino_ESP32SPI(4 /* DC */, 5 /* CS */, 6 /* SCK */, 7 /* MOSI */, GFX_NOT_DEFINED /* MISO */, FSPI /* spi_num */);
+Arduino_TFT *gfx1 = new Arduino_ST7789(bus1, 8 /* RST */, 0 /* rotation */, true /* IPS */);
+
+/* status display on HSPI */
+Arduino_DataBus *bus2 = new Arduino_ESP32SPI(15 /* DC */, 16 /* CS */, 17 /* SCK */, 18 /* MOSI */, GFX_NOT_DEFINED /* MISO */, HSPI /* spi_num */);
+Arduino_TFT *gfx2 = new Arduino_ST7789(bus2, 21 /* RST */, 0 /* rotation */, true /* IPS */, 240 /* width */, 240 /* height */, 0 /* col offset 1 */, 0 /* row offset 1 */, 0 /* col offset 2 */, 80 /* row offset 2 */);
+/*******************************************************************************
+ * End of Arduino_GFX setting
+ ******************************************************************************/
+
+Arduino_Canvas *canvas1 = new Arduino_Canvas(240, 320, gfx1);
+Arduino_Canvas *canvas2 = new Arduino_Canvas(240, 240, gfx2);
+Arduino_DisplayScheduler scheduler;
+int8_t main_id, status_id;
+uint32_t frame = 0;
+unsigned long next_report = 0;
+
+void renderMain(Arduino_GFX *gfx, void *arg)
+{
+  gfx->fillScreen(RGB565_BLACK);
+  int16_t x = (frame * 3) % gfx->width();
+  int16_t y = (frame * 2) % gfx->height();
+  gfx->fillCircle(x, y, 30, RGB565_ORANGE);
+  gfx->fillRect(gfx->width() - x, gfx->height() - y, 40, 40, RGB565_CYAN);
+  ++frame;
+}
+
+void renderStatus(Arduino_GFX *gfx, void *arg)
+{
+  unsigned long s = millis() / 1000;
+  gfx->fillScreen(RGB565_NAVY);
+  gfx->setTextColor(RGB565_WHITE);
+  gfx->setTextSize(4);
+  gfx->setCursor(30, 100);
+  gfx->printf("%02lu:%02lu", (s / 60) % 60, s % 60);
+}
+
+void report(const char *name, int8_t id)
+{
+  const scheduler_stats_t *s = scheduler.stats(id);
+  Serial.printf("%s\t%lu frames\t%lu dropped\t%.1f fps\trender %lu us\tframe avg %lu us\tmax %lu us\n",
+                name, (unsigned long)s->frames, (unsigned long)s->dropped,
+                s->intervalUs ? (1000000.0 / s->intervalUs) : 0.0,
+                (unsigned long)s->renderUs, (unsigned long)s->avgFrameUs, (unsigned long)s->maxFrameUs);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  // Serial.setDebugOutput(true);
+  // while(!Serial);
+  Serial.println("Arduino_GFX MultipleDisplayScheduler example!");
+
+#ifdef GFX_EXTRA_PRE_INIT
+  GFX_EXTRA_PRE_INIT();
+#endif
+
+  if (!canvas1->begin())
+  {
+    Serial.println("canvas1->begin() failed!");
+  }
+  if (!canvas2->begin())
+  {
+    Serial.println("canvas2->begin() failed!");
+  }
+
+  main_id = scheduler.add(canvas1, gfx1, bus1, renderMain, nullptr, 30 /* fps */, 1 /* priority */);
+  status_id = scheduler.add(canvas2, gfx2, bus2, renderStatus, nullptr, 5 /* fps */);
+}
+
+void loop()
+{
+  scheduler.run();
+
+  if (millis() >= next_report)
+  {
+    next_report = millis() + 2000;
+    report("main", main_id);
+    report("status", status_id);
+  }
+}
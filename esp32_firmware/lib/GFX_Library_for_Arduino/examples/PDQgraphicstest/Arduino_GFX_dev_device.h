@@ -166,7 +166,8 @@ Arduino_RGB_Display *gfx = new Arduino_RGB_Display(
 //     8 /* B0 */, 3 /* B1 */, 46 /* B2 */, 9 /* B3 */, 1 /* B4 */,
 //     0 /* hsync_polarity */, 8 /* hsync_front_porch */, 4 /* hsync_pulse_width */, 8 /* hsync_back_porch */,
 //     0 /* vsync_polarity */, 8 /* vsync_front_porch */, 4 /* vsync_pulse_width */, 8 /* vsync_back_porch */,
-//     1 /* pclk_active_neg */, 16000000 /* prefer_speed */);
+//     1 /* pclk_active_neg */, 16000000 /* prefer_speed */, false /* useBigEndian */,
+//     0 /* de_idle_high */, 0 /* pclk_idle_high */, 10 /* bounce_buffer_lines */);
 // Arduino_RGB_Display *gfx = new Arduino_RGB_Display(
 //     800 /* width */, 480 /* height */, rgbpanel, 0 /* rotation */, true /* auto_flush */);
 // option 3:
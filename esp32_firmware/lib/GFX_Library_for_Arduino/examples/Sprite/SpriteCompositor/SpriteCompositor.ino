@@ -0,0 +1,150 @@
+/*
+  Sprite compositor example.
+
+  A static dashboard is drawn once into an Arduino_Canvas that is used as the
+  compositor background. Two alpha blended sprites move over it: a marker
+  bouncing around the screen and a countdown ring. Every update() only sends
+  the areas the sprites left or entered, the dashboard under them is restored
+  from the canvas.
+*/
+
+/*******************************************************************************
+ * Start of Arduino_GFX setting
+ ******************************************************************************/
+#include <Arduino_GFX_Library.h>
+
+#define GFX_BL DF_GFX_BL // default backlight pin, you may replace DF_GFX_BL to actual backlight pin
+
+Arduino_DataBus *bus = create_default_Arduino_DataBus();
+Arduino_GFX *gfx = new Arduino_ST7789(bus, DF_GFX_RST, 0 /* rotation */, true /* IPS */);
+/*******************************************************************************
+ * End of Arduino_GFX setting
+ ******************************************************************************/
+
+#define MARKER_SIZE 16
+#define RING_SIZE 64
+
+Arduino_Canvas *background;
+Arduino_Compositor *compositor;
+Arduino_Sprite *marker;
+Arduino_Sprite *ring;
+int16_t w, h;
+int16_t mx = 0, my = 0, dx = 3, dy = 2;
+uint32_t frames = 0, pixels = 0, lastReport = 0;
+
+void drawDashboard()
+{
+  background->fillScreen(RGB565_DARKGREY);
+  background->fillRoundRect(8, 8, w - 16, 40, 6, RGB565_NAVY);
+  background->setTextSize(2);
+  background->setTextColor(RGB565_WHITE);
+  background->setCursor(16, 20);
+  background->print("Dashboard");
+  for (int16_t i = 0; i < 4; i++)
+  {
+    background->drawRoundRect(8, 60 + i * 30, w - 16, 24, 4, RGB565_LIGHTGREY);
+  }
+}
+
+void drawRing(uint8_t seconds)
+{
+  int16_t r = RING_SIZE / 2;
+  ring->clear();
+  // translucent disc with an opaque arc showing the time left
+  ring->setDrawAlpha(96);
+  ring->fillCircle(r, r, r - 1, RGB565_BLACK);
+  ring->setDrawAlpha(255);
+  ring->fillArc(r, r, r - 1, r - 6, 270, 270 + seconds * 6, RGB565_ORANGE);
+  ring->setTextSize(2);
+  ring->setTextColor(RGB565_WHITE);
+  ring->setCursor(seconds < 10 ? r - 6 : r - 12, r - 7);
+  ring->print(seconds);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  // Serial.setDebugOutput(true);
+  // while(!Serial);
+  Serial.println("Arduino_GFX SpriteCompositor example!");
+
+#ifdef GFX_EXTRA_PRE_INIT
+  GFX_EXTRA_PRE_INIT();
+#endif
+
+  // Init Display
+  if (!gfx->begin())
+  // if (!gfx->begin(80000000)) /* specify data bus speed */
+  {
+    Serial.println("gfx->begin() failed!");
+  }
+
+#ifdef GFX_BL
+  pinMode(GFX_BL, OUTPUT);
+  digitalWrite(GFX_BL, HIGH);
+#endif
+
+  w = gfx->width();
+  h = gfx->height();
+
+  background = new Arduino_Canvas(w, h, gfx);
+  compositor = new Arduino_Compositor(gfx, w, h);
+  marker = new Arduino_Sprite(MARKER_SIZE, MARKER_SIZE);
+  ring = new Arduino_Sprite(RING_SIZE, RING_SIZE);
+  if ((!background->begin(GFX_SKIP_OUTPUT_BEGIN)) || (!compositor->begin(GFX_SKIP_OUTPUT_BEGIN)) || (!marker->begin()) || (!ring->begin()))
+  {
+    Serial.println("out of memory!");
+    while (1)
+      ;
+  }
+
+  drawDashboard();
+  compositor->setBackground(background->getFramebuffer());
+
+  // soft edged marker: opaque core, fading rings around it
+  for (int16_t r = MARKER_SIZE / 2; r > 0; r--)
+  {
+    marker->setDrawAlpha(32 + (MARKER_SIZE / 2 - r) * 223 / (MARKER_SIZE / 2 - 1));
+    marker->fillCircle(MARKER_SIZE / 2, MARKER_SIZE / 2, r, RGB565_RED);
+  }
+
+  ring->moveTo(w - RING_SIZE - 8, h - RING_SIZE - 8);
+  drawRing(60);
+
+  compositor->addSprite(ring);
+  compositor->addSprite(marker);
+}
+
+void loop()
+{
+  mx += dx;
+  my += dy;
+  if ((mx < 0) || (mx > w - MARKER_SIZE))
+  {
+    dx = -dx;
+  }
+  if ((my < 0) || (my > h - MARKER_SIZE))
+  {
+    dy = -dy;
+  }
+  marker->moveTo(mx, my);
+
+  uint8_t seconds = 60 - ((millis() / 1000) % 60);
+  static uint8_t lastSeconds = 0;
+  if (seconds != lastSeconds)
+  {
+    drawRing(seconds);
+    lastSeconds = seconds;
+  }
+
+  pixels += compositor->update();
+  frames++;
+
+  if (millis() - lastReport >= 1000)
+  {
+    Serial.printf("%u fps, %u pixels per frame\n", frames, frames ? pixels / frames : 0);
+    frames = 0;
+    pixels = 0;
+    lastReport = millis();
+  }
+}
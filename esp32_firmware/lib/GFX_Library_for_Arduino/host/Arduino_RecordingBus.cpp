@@ -0,0 +1,370 @@
+#include "Arduino_RecordingBus.h"
+
+Arduino_RecordingBus::Arduino_RecordingBus(int16_t gram_w, int16_t gram_h)
+    : _gramW(gram_w), _gramH(gram_h)
+{
+  _gram = (uint16_t *)calloc((size_t)_gramW * _gramH, sizeof(uint16_t));
+  _speed = SPI_DEFAULT_FREQ;
+  _dataMode = 0;
+  resetStats();
+}
+
+Arduino_RecordingBus::~Arduino_RecordingBus()
+{
+  if (_gram)
+  {
+    free(_gram);
+  }
+}
+
+bool Arduino_RecordingBus::begin(int32_t speed, int8_t dataMode)
+{
+  _speed = (speed == GFX_NOT_DEFINED) ? SPI_DEFAULT_FREQ : speed;
+  _dataMode = dataMode;
+  return _gram != nullptr;
+}
+
+void Arduino_RecordingBus::beginWrite()
+{
+  ++_stats.calls;
+  ++_stats.transactions;
+}
+
+void Arduino_RecordingBus::endWrite()
+{
+  ++_stats.calls;
+}
+
+void Arduino_RecordingBus::writeCommand(uint8_t c)
+{
+  ++_stats.calls;
+  startCommand(c);
+}
+
+void Arduino_RecordingBus::writeCommand16(uint16_t c)
+{
+  ++_stats.calls;
+  ++_stats.commands; // both bytes go out with DC low
+  startCommand(c);
+}
+
+void Arduino_RecordingBus::writeCommandBytes(uint8_t *data, uint32_t len)
+{
+  ++_stats.calls;
+  while (len--)
+  {
+    startCommand(*data++);
+  }
+}
+
+void Arduino_RecordingBus::write(uint8_t d)
+{
+  ++_stats.calls;
+  dataByte(d);
+}
+
+void Arduino_RecordingBus::write16(uint16_t d)
+{
+  ++_stats.calls;
+  dataByte(d >> 8);
+  dataByte(d);
+}
+
+void Arduino_RecordingBus::writeRepeat(uint16_t p, uint32_t len)
+{
+  ++_stats.calls;
+  if (((_cmd == RECORDING_BUS_RAMWR) || (_cmd == RECORDING_BUS_RAMWRC)) && !_pixelHalf)
+  {
+    _stats.dataBytes += len * 2;
+    storeRepeat(p, len);
+    return;
+  }
+  while (len--)
+  {
+    dataByte(p >> 8);
+    dataByte(p);
+  }
+}
+
+void Arduino_RecordingBus::writeBytes(uint8_t *data, uint32_t len)
+{
+  ++_stats.calls;
+  if (((_cmd == RECORDING_BUS_RAMWR) || (_cmd == RECORDING_BUS_RAMWRC)) && !_pixelHalf && !((uintptr_t)data & 1))
+  {
+    // bytes in memory order, so each pixel is big endian in memory
+    _stats.dataBytes += len & ~1UL;
+    storePixels((const uint16_t *)data, len >> 1, true);
+    data += len & ~1UL;
+    len &= 1;
+  }
+  while (len--)
+  {
+    dataByte(*data++);
+  }
+}
+
+void Arduino_RecordingBus::writePixels(uint16_t *data, uint32_t len)
+{
+  ++_stats.calls;
+  if (((_cmd == RECORDING_BUS_RAMWR) || (_cmd == RECORDING_BUS_RAMWRC)) && !_pixelHalf)
+  {
+    _stats.dataBytes += len * 2;
+    storePixels(data, len, false);
+    return;
+  }
+  while (len--)
+  {
+    dataByte(*data >> 8);
+    dataByte(*data++);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief   Stop rendering into the frame memory model, only count
+    @param   enable  false to skip the model, true to resume it
+*/
+/**************************************************************************/
+void Arduino_RecordingBus::setModel(bool enable)
+{
+  _model = enable;
+}
+
+void Arduino_RecordingBus::resetStats()
+{
+  memset(&_stats, 0, sizeof(_stats));
+  memset(_histogram, 0, sizeof(_histogram));
+}
+
+/**************************************************************************/
+/*!
+    @brief   Time the counted bytes take on a serial bus, one bit per clock
+    @param   speed  Bus clock in Hz, the begin() speed if not defined
+    @return  Microseconds on the wire, rounded up
+*/
+/**************************************************************************/
+uint32_t Arduino_RecordingBus::wireMicros(int32_t speed)
+{
+  if (speed == GFX_NOT_DEFINED)
+  {
+    speed = _speed;
+  }
+  uint64_t bits = (uint64_t)wireBytes() * 8;
+  return (uint32_t)((bits * 1000000 + speed - 1) / speed);
+}
+
+void Arduino_RecordingBus::clearGram(uint16_t color)
+{
+  if (_gram)
+  {
+    for (int32_t i = 0; i < (int32_t)_gramW * _gramH; ++i)
+    {
+      _gram[i] = color;
+    }
+  }
+}
+
+uint16_t Arduino_RecordingBus::pixel(int16_t x, int16_t y)
+{
+  if ((!_gram) || (x < 0) || (y < 0) || (x >= _gramW) || (y >= _gramH))
+  {
+    return 0;
+  }
+  return _gram[(int32_t)y * _gramW + x];
+}
+
+/**************************************************************************/
+/*!
+    @brief   64-bit FNV-1a of the frame memory, for golden image checks
+*/
+/**************************************************************************/
+uint64_t Arduino_RecordingBus::hash()
+{
+  uint64_t h = 0xcbf29ce484222325ULL;
+  if (_gram)
+  {
+    for (int32_t i = 0; i < (int32_t)_gramW * _gramH; ++i)
+    {
+      h = (h ^ (_gram[i] & 0xFF)) * 0x100000001b3ULL;
+      h = (h ^ (_gram[i] >> 8)) * 0x100000001b3ULL;
+    }
+  }
+  return h;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Write the frame memory as a binary PPM, colors expanded to 8 bits
+    @param   path  Output file
+    @return  false if the file could not be written
+*/
+/**************************************************************************/
+bool Arduino_RecordingBus::savePPM(const char *path)
+{
+  FILE *f = fopen(path, "wb");
+  if (!f)
+  {
+    return false;
+  }
+  fprintf(f, "P6\n%d %d\n255\n", _gramW, _gramH);
+  for (int32_t i = 0; i < (int32_t)_gramW * _gramH; ++i)
+  {
+    uint16_t c = _gram ? _gram[i] : 0;
+    uint8_t rgb[3] = {
+        (uint8_t)(((c >> 8) & 0xF8) | (c >> 13)),
+        (uint8_t)(((c >> 3) & 0xFC) | ((c >> 9) & 0x03)),
+        (uint8_t)(((c << 3) & 0xF8) | ((c >> 2) & 0x07))};
+    fwrite(rgb, 1, 3, f);
+  }
+  return fclose(f) == 0;
+}
+
+void Arduino_RecordingBus::startCommand(uint16_t c)
+{
+  ++_stats.commands;
+  ++_histogram[c & 0xFF];
+  _cmd = c;
+  _paramCount = 0;
+  _pixelHalf = false;
+  switch (c)
+  {
+  case RECORDING_BUS_CASET:
+    ++_stats.caset;
+    break;
+  case RECORDING_BUS_RASET:
+    ++_stats.raset;
+    break;
+  case RECORDING_BUS_RAMWR:
+    ++_stats.ramwr;
+    _col = _xs;
+    _row = _ys;
+    break;
+  case RECORDING_BUS_RAMWRC:
+    ++_stats.ramwr;
+    break;
+  case RECORDING_BUS_INVOFF:
+    _inverted = false;
+    break;
+  case RECORDING_BUS_INVON:
+    _inverted = true;
+    break;
+  }
+}
+
+void Arduino_RecordingBus::dataByte(uint8_t d)
+{
+  ++_stats.dataBytes;
+  switch (_cmd)
+  {
+  case RECORDING_BUS_CASET:
+  case RECORDING_BUS_RASET:
+    if (_paramCount < 4)
+    {
+      _param[_paramCount++] = d;
+      if (_paramCount == 4)
+      {
+        uint16_t s = (_param[0] << 8) | _param[1];
+        uint16_t e = (_param[2] << 8) | _param[3];
+        if (_cmd == RECORDING_BUS_CASET)
+        {
+          _xs = s;
+          _xe = e;
+        }
+        else
+        {
+          _ys = s;
+          _ye = e;
+        }
+      }
+    }
+    break;
+  case RECORDING_BUS_MADCTL:
+    if (_paramCount++ == 0)
+    {
+      _madctl = d;
+    }
+    break;
+  case RECORDING_BUS_RAMWR:
+  case RECORDING_BUS_RAMWRC:
+    if (_pixelHalf)
+    {
+      _pixelHalf = false;
+      storePixel((_pixelMsb << 8) | d);
+    }
+    else
+    {
+      _pixelMsb = d;
+      _pixelHalf = true;
+    }
+    break;
+  }
+}
+
+// Write at the pointer and advance it column first, wrapping inside the window.
+// MV exchanges the window axes, then MX and MY mirror the frame memory axes.
+void Arduino_RecordingBus::storePixel(uint16_t p)
+{
+  ++_stats.pixels;
+  if (_model && _gram)
+  {
+    int32_t pc = _col, pr = _row;
+    if (_madctl & RECORDING_BUS_MADCTL_MV)
+    {
+      pc = _row;
+      pr = _col;
+    }
+    if (_madctl & RECORDING_BUS_MADCTL_MX)
+    {
+      pc = _gramW - 1 - pc;
+    }
+    if (_madctl & RECORDING_BUS_MADCTL_MY)
+    {
+      pr = _gramH - 1 - pr;
+    }
+    if ((pc >= 0) && (pr >= 0) && (pc < _gramW) && (pr < _gramH))
+    {
+      _gram[pr * _gramW + pc] = p;
+    }
+    else
+    {
+      ++_stats.clipped;
+    }
+  }
+
+  if (_col >= _xe)
+  {
+    _col = _xs;
+    _row = (_row >= _ye) ? _ys : (_row + 1);
+  }
+  else
+  {
+    ++_col;
+  }
+}
+
+void Arduino_RecordingBus::storePixels(const uint16_t *data, uint32_t len, bool swap)
+{
+  if (!_model)
+  {
+    _stats.pixels += len;
+    return;
+  }
+  while (len--)
+  {
+    uint16_t p = *data++;
+    storePixel(swap ? ((p >> 8) | (p << 8)) : p);
+  }
+}
+
+void Arduino_RecordingBus::storeRepeat(uint16_t p, uint32_t len)
+{
+  if (!_model)
+  {
+    _stats.pixels += len;
+    return;
+  }
+  while (len--)
+  {
+    storePixel(p);
+  }
+}
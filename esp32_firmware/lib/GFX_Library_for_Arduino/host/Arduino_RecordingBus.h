@@ -0,0 +1,105 @@
+#ifndef _ARDUINO_RECORDINGBUS_H_
+#define _ARDUINO_RECORDINGBUS_H_
+
+#include "Arduino_DataBus.h"
+
+#define RECORDING_BUS_GRAM_WIDTH 240  // ST7789 frame memory
+#define RECORDING_BUS_GRAM_HEIGHT 320
+
+// MIPI DCS commands the panel model understands
+#define RECORDING_BUS_INVOFF 0x20
+#define RECORDING_BUS_INVON 0x21
+#define RECORDING_BUS_CASET 0x2A
+#define RECORDING_BUS_RASET 0x2B
+#define RECORDING_BUS_RAMWR 0x2C
+#define RECORDING_BUS_MADCTL 0x36
+#define RECORDING_BUS_RAMWRC 0x3C
+
+#define RECORDING_BUS_MADCTL_MY 0x80
+#define RECORDING_BUS_MADCTL_MX 0x40
+#define RECORDING_BUS_MADCTL_MV 0x20
+
+typedef struct
+{
+  uint32_t transactions; ///< beginWrite() calls
+  uint32_t calls;        ///< bus method calls, a measure of per-call overhead
+  uint32_t commands;     ///< command bytes, each starts a new command
+  uint32_t dataBytes;    ///< bytes sent with DC high
+  uint32_t caset;        ///< column address changes
+  uint32_t raset;        ///< row address changes
+  uint32_t ramwr;        ///< RAMWR and RAMWRC commands
+  uint32_t pixels;       ///< pixels that reached the frame memory model
+  uint32_t clipped;      ///< pixels written outside the frame memory
+} recording_bus_stats_t;
+
+/*!
+  Arduino_DataBus for host builds. Nothing leaves the process: every call is
+  counted, and the byte stream is fed to a model of a MIPI DCS panel with
+  16-bit pixels (CASET, RASET, RAMWR, RAMWRC and MADCTL) so the frame memory
+  can be compared pixel by pixel after drawing. setModel(false) keeps only the
+  counters, for benchmarks that should not pay for the model.
+*/
+class Arduino_RecordingBus : public Arduino_DataBus
+{
+public:
+  Arduino_RecordingBus(int16_t gram_w = RECORDING_BUS_GRAM_WIDTH, int16_t gram_h = RECORDING_BUS_GRAM_HEIGHT);
+  ~Arduino_RecordingBus();
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED, int8_t dataMode = GFX_NOT_DEFINED) override;
+  void beginWrite() override;
+  void endWrite() override;
+  void writeCommand(uint8_t c) override;
+  void writeCommand16(uint16_t c) override;
+  void writeCommandBytes(uint8_t *data, uint32_t len) override;
+  void write(uint8_t d) override;
+  void write16(uint16_t d) override;
+  void writeRepeat(uint16_t p, uint32_t len) override;
+  void writeBytes(uint8_t *data, uint32_t len) override;
+  void writePixels(uint16_t *data, uint32_t len) override;
+
+  void setModel(bool enable);
+  void resetStats();
+  const recording_bus_stats_t &stats() { return _stats; }
+  uint32_t commandCount(uint8_t c) { return _histogram[c]; }
+  uint32_t wireBytes() { return _stats.commands + _stats.dataBytes; }
+  uint32_t wireMicros(int32_t speed = GFX_NOT_DEFINED);
+
+  void clearGram(uint16_t color = 0);
+  uint16_t *gram() { return _gram; }
+  int16_t gramWidth() { return _gramW; }
+  int16_t gramHeight() { return _gramH; }
+  uint16_t pixel(int16_t x, int16_t y);
+  uint8_t madctl() { return _madctl; }
+  bool inverted() { return _inverted; }
+  uint64_t hash();
+  bool savePPM(const char *path);
+
+protected:
+  void startCommand(uint16_t c);
+  void dataByte(uint8_t d);
+  void storePixel(uint16_t p);
+  void storePixels(const uint16_t *data, uint32_t len, bool swap);
+  void storeRepeat(uint16_t p, uint32_t len);
+
+  uint16_t *_gram = nullptr;
+  int16_t _gramW, _gramH;
+  bool _model = true;
+
+  recording_bus_stats_t _stats;
+  uint32_t _histogram[256];
+
+  // DCS state
+  uint16_t _cmd = 0;
+  uint8_t _param[4];
+  uint8_t _paramCount = 0;
+  uint8_t _pixelMsb = 0;
+  bool _pixelHalf = false; // first byte of a pixel is in _pixelMsb
+  uint16_t _xs = 0, _xe = 0, _ys = 0, _ye = 0;
+  uint16_t _col = 0, _row = 0; // write pointer in window coordinates
+  uint8_t _madctl = 0;
+  bool _inverted = false;
+
+private:
+};
+
+#endif // _ARDUINO_RECORDINGBUS_H_
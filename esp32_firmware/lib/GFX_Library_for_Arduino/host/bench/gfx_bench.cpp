@@ -0,0 +1,296 @@
+/*
+ * Primitive benchmark: every primitive of the PDQgraphicstest set runs on an
+ * Arduino_ST7789 over Arduino_RecordingBus with the panel model off, so the
+ * time is the library's CPU cost plus a counting bus. Next to the time, the
+ * bus counters give what a call puts on the wire, which does not depend on
+ * the host and can be compared between commits exactly.
+ *
+ *   gfx_bench [--iterations n] [--speed hz] [--csv] [filter]
+ *
+ * --iterations  calls per primitive, by default enough for about 20 ms
+ * --speed       SPI clock for the wire time column, 40 MHz by default
+ * --csv         comma separated output
+ * filter        only run primitives whose name contains this
+ */
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Arduino_GFX.h"
+#include "Arduino_RecordingBus.h"
+#include "canvas/Arduino_Canvas.h"
+#include "canvas/Arduino_Canvas_DisplayList.h"
+#include "canvas/Arduino_Canvas_Tiled.h"
+#include "display/Arduino_ST7789.h"
+
+#include "FreeSansBold10pt7b.h"
+#include "asset_fixture.h"
+
+#define BENCH_TARGET_NS 20000000.0 // auto iterations aim at this much time per primitive
+
+typedef struct
+{
+  const char *name;
+  std::function<void()> run;
+} bench_t;
+
+static Arduino_RecordingBus *bus;
+static Arduino_ST7789 *tft;
+static Arduino_Canvas *canvas;
+static Arduino_Canvas_Tiled *tiled;
+static Arduino_Canvas_DisplayList *dl;
+
+static uint16_t rgb_bitmap[64 * 64];
+static uint8_t gray_bitmap[64 * 64];
+static uint8_t rgb24_bitmap[64 * 64 * 3];
+static uint8_t mono_bitmap[(64 / 8) * 64];
+
+static void make_bitmaps()
+{
+  for (int i = 0; i < 64 * 64; ++i)
+  {
+    rgb_bitmap[i] = (uint16_t)(i * 2654435761u >> 16);
+    gray_bitmap[i] = (uint8_t)(i * 7);
+    rgb24_bitmap[i * 3] = (uint8_t)i;
+    rgb24_bitmap[i * 3 + 1] = (uint8_t)(i >> 4);
+    rgb24_bitmap[i * 3 + 2] = (uint8_t)(i * 3);
+  }
+  for (int i = 0; i < (int)sizeof(mono_bitmap); ++i)
+  {
+    mono_bitmap[i] = (uint8_t)(0x5A ^ (i * 29));
+  }
+}
+
+static std::vector<bench_t> benches()
+{
+  Arduino_GFX *g = tft;
+  return {
+      {"fillScreen", [g]
+       { g->fillScreen(RGB565_BLUE); }},
+      {"fillRect 100x100", [g]
+       { g->fillRect(70, 110, 100, 100, RGB565_RED); }},
+      {"drawPixel", [g]
+       { g->drawPixel(120, 160, RGB565_WHITE); }},
+      {"drawFastHLine 200", [g]
+       { g->drawFastHLine(20, 100, 200, RGB565_GREEN); }},
+      {"drawFastVLine 200", [g]
+       { g->drawFastVLine(100, 60, 200, RGB565_GREEN); }},
+      {"drawLine diagonal", [g]
+       { g->drawLine(0, 0, 239, 319, RGB565_YELLOW); }},
+      {"drawLine shallow", [g]
+       { g->drawLine(0, 150, 239, 170, RGB565_YELLOW); }},
+      {"drawLine shallow anti-alias", [g]
+       { g->drawLine(0, 150, 239, 170, RGB565_YELLOW, RGB565_BLACK); }},
+      {"drawRect 100x100", [g]
+       { g->drawRect(70, 110, 100, 100, RGB565_CYAN); }},
+      {"drawCircle r50", [g]
+       { g->drawCircle(120, 160, 50, RGB565_WHITE); }},
+      {"drawCircle r50 anti-aliased", [g]
+       { g->drawCircle(120, 160, 50, RGB565_WHITE, RGB565_BLACK); }},
+      {"fillCircle r50", [g]
+       { g->fillCircle(120, 160, 50, RGB565_MAGENTA); }},
+      {"fillCircle r50 anti-aliased", [g]
+       { g->fillCircle(120, 160, 50, RGB565_MAGENTA, RGB565_BLACK); }},
+      {"drawRoundRect", [g]
+       { g->drawRoundRect(40, 80, 160, 120, 12, RGB565_WHITE); }},
+      {"fillRoundRect", [g]
+       { g->fillRoundRect(40, 80, 160, 120, 12, RGB565_NAVY); }},
+      {"fillRoundRect anti-aliased", [g]
+       { g->fillRoundRect(40, 80, 160, 120, 12, RGB565_NAVY, RGB565_BLACK); }},
+      {"drawTriangle", [g]
+       { g->drawTriangle(120, 40, 20, 280, 220, 280, RGB565_ORANGE); }},
+      {"fillTriangle", [g]
+       { g->fillTriangle(120, 40, 20, 280, 220, 280, RGB565_ORANGE); }},
+      {"drawEllipse", [g]
+       { g->drawEllipse(120, 160, 100, 60, RGB565_GREENYELLOW); }},
+      {"fillEllipse", [g]
+       { g->fillEllipse(120, 160, 100, 60, RGB565_DARKGREEN); }},
+      {"drawArc", [g]
+       { g->drawArc(120, 160, 80, 60, 30.0, 300.0, RGB565_RED); }},
+      {"fillArc", [g]
+       { g->fillArc(120, 160, 80, 60, 30.0, 300.0, RGB565_RED); }},
+      {"fillArc anti-aliased", [g]
+       { g->fillArc(120, 160, 80, 60, 30.0, 300.0, RGB565_RED, RGB565_BLACK); }},
+      {"text glcd size 1", [g]
+       {
+         g->setFont();
+         g->setTextSize(1);
+         g->setTextColor(RGB565_WHITE);
+         g->setCursor(10, 10);
+         g->print("Hello World!");
+       }},
+      {"text glcd size 1 bg", [g]
+       {
+         g->setFont();
+         g->setTextSize(1);
+         g->setTextColor(RGB565_WHITE, RGB565_BLACK);
+         g->setCursor(10, 10);
+         g->print("Hello World!");
+       }},
+      {"text glcd size 3", [g]
+       {
+         g->setFont();
+         g->setTextSize(3);
+         g->setTextColor(RGB565_WHITE);
+         g->setCursor(10, 10);
+         g->print("Hello World!");
+       }},
+      {"text glcd size 3 bg", [g]
+       {
+         g->setFont();
+         g->setTextSize(3);
+         g->setTextColor(RGB565_WHITE, RGB565_BLACK);
+         g->setCursor(10, 10);
+         g->print("Hello World!");
+       }},
+      {"text glcd size 3 bg smooth", [g]
+       {
+         g->setFont();
+         g->setTextSize(3);
+         g->setTextAntiAlias(true);
+         g->setTextColor(RGB565_WHITE, RGB565_BLACK);
+         g->setCursor(10, 10);
+         g->print("Hello World!");
+         g->setTextAntiAlias(false);
+       }},
+      {"text GFXfont", [g]
+       {
+         g->setFont(&FreeSansBold10pt7b);
+         g->setTextSize(1);
+         g->setTextColor(RGB565_WHITE);
+         g->setCursor(10, 40);
+         g->print("Hello World!");
+         g->setFont();
+       }},
+      {"drawBitmap 64x64", [g]
+       { g->drawBitmap(20, 20, mono_bitmap, 64, 64, RGB565_WHITE, RGB565_BLACK); }},
+      {"drawGrayscaleBitmap 64x64", [g]
+       { g->drawGrayscaleBitmap(20, 20, gray_bitmap, 64, 64); }},
+      {"draw16bitRGBBitmap 64x64", [g]
+       { g->draw16bitRGBBitmap(20, 20, rgb_bitmap, 64, 64); }},
+      {"draw24bitRGBBitmap 64x64", [g]
+       { g->draw24bitRGBBitmap(20, 20, rgb24_bitmap, 64, 64); }},
+      {"drawAsset 67x45", [g]
+       { g->drawAsset(20, 20, asset_smooth, sizeof(asset_smooth)); }},
+      {"Canvas flush", []
+       { canvas->flush(); }},
+      {"Canvas flushQuad", []
+       { canvas->flushQuad(); }},
+      {"Canvas flush rotation 2", []
+       { canvas->flushTransformed(GFX_SCALE_1, 2); }},
+      {"Canvas_Tiled 10x10 + flush", []
+       {
+         tiled->fillRect(100, 100, 10, 10, RGB565_RED);
+         tiled->flush();
+       }},
+      {"DisplayList 10x10 + flush", []
+       {
+         dl->fillRect(100, 100, 10, 10, RGB565_RED);
+         dl->flush();
+       }},
+  };
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t iterations = 0;
+  int32_t speed = 40000000;
+  bool csv = false;
+  const char *filter = nullptr;
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string a = argv[i];
+    if ((a == "--iterations") && (i + 1 < argc))
+    {
+      iterations = strtoul(argv[++i], nullptr, 0);
+    }
+    else if ((a == "--speed") && (i + 1 < argc))
+    {
+      speed = strtol(argv[++i], nullptr, 0);
+    }
+    else if (a == "--csv")
+    {
+      csv = true;
+    }
+    else if (a[0] != '-')
+    {
+      filter = argv[i];
+    }
+    else
+    {
+      fprintf(stderr, "usage: %s [--iterations n] [--speed hz] [--csv] [filter]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  make_bitmaps();
+  bus = new Arduino_RecordingBus();
+  tft = new Arduino_ST7789(bus, GFX_NOT_DEFINED, 0, true);
+  if (!tft->begin(speed))
+  {
+    fprintf(stderr, "begin() failed\n");
+    return 1;
+  }
+  canvas = new Arduino_Canvas(240, 320, tft);
+  tiled = new Arduino_Canvas_Tiled(240, 320, tft);
+  dl = new Arduino_Canvas_DisplayList(240, 320, tft);
+  if ((!canvas->begin(GFX_SKIP_OUTPUT_BEGIN)) || (!tiled->begin(GFX_SKIP_OUTPUT_BEGIN)) || (!dl->begin(GFX_SKIP_OUTPUT_BEGIN)))
+  {
+    fprintf(stderr, "canvas begin() failed\n");
+    return 1;
+  }
+  bus->setModel(false);
+
+  if (csv)
+  {
+    printf("primitive,ns_per_call,bytes,commands,windows,ramwr,pixels,bus_calls,wire_us\n");
+  }
+  else
+  {
+    printf("%-28s %12s %10s %8s %8s %6s %8s %9s %9s\n", "primitive", "ns/call", "bytes", "commands",
+           "windows", "ramwr", "pixels", "bus calls", "wire us");
+  }
+
+  for (const bench_t &b : benches())
+  {
+    if (filter && !strstr(b.name, filter))
+    {
+      continue;
+    }
+
+    // one untimed call settles caches and the driver's address window
+    b.run();
+    bus->resetStats();
+    b.run();
+    recording_bus_stats_t s = bus->stats();
+    uint32_t wire = bus->wireMicros(speed);
+
+    uint32_t n = iterations;
+    if (!n)
+    {
+      auto t0 = std::chrono::steady_clock::now();
+      b.run();
+      double once = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+      n = (uint32_t)max(1.0, min(1000000.0, BENCH_TARGET_NS / max(once, 1.0)));
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < n; ++i)
+    {
+      b.run();
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+
+    if (csv)
+    {
+      printf("%s,%.1f,%u,%u,%u,%u,%u,%u,%u\n", b.name, ns, s.commands + s.dataBytes, s.commands,
+             s.caset + s.raset, s.ramwr, s.pixels, s.calls, wire);
+    }
+    else
+    {
+      printf("%-28s %12.1f %10u %8u %8u %6u %8u %9u %9u\n", b.name, ns, s.commands + s.dataBytes, s.commands,
+             s.caset + s.raset, s.ramwr, s.pixels, s.calls, wire);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,163 @@
+#include <Arduino.h>
+
+#include <stdarg.h>
+
+#include <chrono>
+
+static const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+static unsigned long delay_total = 0;
+
+HardwareSerial Serial;
+
+unsigned long millis()
+{
+  return micros() / 1000;
+}
+
+unsigned long micros()
+{
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start_time)
+      .count();
+}
+
+// there is no panel to wait for, reset and init sequences run at once
+void delay(unsigned long ms)
+{
+  delay_total += ms;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  (void)us;
+}
+
+void yield()
+{
+}
+
+unsigned long host_delay_total()
+{
+  return delay_total;
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+  (void)pin;
+  (void)val;
+}
+
+int digitalRead(uint8_t pin)
+{
+  (void)pin;
+  return LOW;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+  return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+  return fwrite(buffer, 1, size, stdout);
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--)
+  {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::write(const char *str)
+{
+  return str ? write((const uint8_t *)str, strlen(str)) : 0;
+}
+
+size_t Print::print(const __FlashStringHelper *s)
+{
+  return write(reinterpret_cast<const char *>(s));
+}
+
+size_t Print::print(const String &s)
+{
+  return write(s.c_str());
+}
+
+size_t Print::print(const char *s)
+{
+  return write(s);
+}
+
+size_t Print::print(char c)
+{
+  return write((uint8_t)c);
+}
+
+size_t Print::print(long n, int base)
+{
+  if ((base == DEC) && (n < 0))
+  {
+    return print('-') + print((unsigned long)-n, base);
+  }
+  return print((unsigned long)n, base);
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+  char buf[8 * sizeof(long) + 1];
+  char *p = buf + sizeof(buf) - 1;
+  *p = 0;
+  if (base < 2)
+  {
+    base = DEC;
+  }
+  do
+  {
+    unsigned long d = n % base;
+    n /= base;
+    *--p = (d < 10) ? ('0' + d) : ('A' + d - 10);
+  } while (n);
+  return write(p);
+}
+
+size_t Print::print(double n, int digits)
+{
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%.*f", digits, n);
+  return write(buf);
+}
+
+size_t Print::println(void)
+{
+  return write("\r\n");
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (len < 0)
+  {
+    return 0;
+  }
+  return write((const uint8_t *)buf, min((size_t)len, sizeof(buf) - 1));
+}
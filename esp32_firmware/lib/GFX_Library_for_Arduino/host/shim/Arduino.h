@@ -0,0 +1,81 @@
+/*
+ * Minimal Arduino core for building Arduino_GFX on a desktop host.
+ * Only what the core, the canvases and the ST7789 driver use is here.
+ */
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define PI 3.1415926535897932384626433832795
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+// flash is ordinary memory here, the pgm_read_*() fallbacks in Arduino_GFX.h
+// read it directly; pgm_read_dword() is left to them on purpose, it also reads
+// font pointers and has to be pointer sized
+#define PROGMEM
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+// milliseconds passed to delay(), which returns at once on the host
+unsigned long host_delay_total();
+
+class String
+{
+public:
+  String(const char *s = "") : _s(s ? s : "") {}
+  const char *c_str() const { return _s; }
+  unsigned int length() const { return strlen(_s); }
+  char charAt(unsigned int i) const { return _s[i]; }
+
+private:
+  const char *_s;
+};
+
+#include "Print.h"
+
+class HardwareSerial : public Print
+{
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  operator bool() { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif // _HOST_ARDUINO_H_
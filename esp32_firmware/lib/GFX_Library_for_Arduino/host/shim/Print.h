@@ -0,0 +1,48 @@
+/*
+ * Minimal Arduino Print class for the host build.
+ */
+#ifndef _HOST_PRINT_H_
+#define _HOST_PRINT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+class __FlashStringHelper;
+class String;
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print
+{
+public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *str);
+  size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+
+  size_t print(const __FlashStringHelper *s);
+  size_t print(const String &s);
+  size_t print(const char *s);
+  size_t print(char c);
+  size_t print(unsigned char n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(long n, int base = DEC);
+  size_t print(unsigned long n, int base = DEC);
+  size_t print(double n, int digits = 2);
+
+  size_t println(void);
+  template <typename T>
+  size_t println(T v) { return print(v) + println(); }
+  template <typename T>
+  size_t println(T v, int arg) { return print(v, arg) + println(); }
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+#endif // _HOST_PRINT_H_
@@ -0,0 +1,17 @@
+/*
+ * SPI constants some display drivers refer to, there is no SPI on the host.
+ */
+#ifndef _HOST_SPI_H_
+#define _HOST_SPI_H_
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+#define MSBFIRST 1
+#define LSBFIRST 0
+
+#endif // _HOST_SPI_H_
@@ -0,0 +1,412 @@
+// made by make_asset_fixture.py, do not edit
+#pragma once
+
+// 67x45 rgb565, 2356 bytes
+const uint8_t asset_smooth[] PROGMEM = {
+    0x47, 0x41, 0x01, 0x00, 0x43, 0x00, 0x2D, 0x00, 0x66, 0x8E, 0xFF, 0x04, 0x40, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x10,
+    0x00, 0x80, 0x7A, 0x3B, 0x8E, 0xD2, 0xFB, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x3B, 0x8E, 0xFF, 0x30, 0x00, 0x80, 0x7A, 0x3B, 0x8E, 0xD3,
+    0xFB, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x3B, 0x8E, 0xFF, 0x50, 0x00, 0x80, 0x7B, 0x3B, 0x8E, 0xD4, 0xEA, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x70, 0x00, 0x6B,
+    0x7A, 0x3B, 0x8E, 0xD5, 0xEB, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x91, 0x00, 0x80, 0x7A, 0x3B, 0x8E, 0xD6, 0xDA, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0xFF, 0xE0,
+    0x07, 0x8E, 0xFF, 0xB1, 0x00, 0x80, 0x7A, 0x3B, 0x8E, 0xD7, 0xDA, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x3B, 0x8E, 0xFF, 0xD1, 0x00, 0x80,
+    0x7B, 0x3B, 0x8E, 0xD8, 0xC9, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0xF1, 0x00, 0x6B, 0x7A, 0x3B, 0x8E, 0xD9, 0xCA, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0xFF, 0xE0,
+    0x07, 0x8E, 0xFF, 0x12, 0x01, 0x80, 0x7A, 0x3B, 0x8E, 0xDA, 0xB9, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x3B, 0x8E, 0xFF, 0x32, 0x01, 0x80,
+    0x7A, 0x3B, 0x8E, 0xDB, 0xB9, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x3B, 0x8E, 0xFF, 0x52, 0x01, 0x80, 0x7B, 0x3B, 0x8E, 0xDC, 0xA8, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x3B, 0x8E,
+    0xFF, 0x72, 0x01, 0x6B, 0x7A, 0x3B, 0x8E, 0xDD, 0xA9, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x93, 0x01, 0x80, 0x7A, 0x3B,
+    0x8E, 0xDE, 0x98, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0xFF, 0xE0, 0x07, 0x8E, 0xFF, 0xB3, 0x01, 0x80, 0x7A, 0x3B, 0x8E, 0xDF, 0x98, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x3B, 0x8E,
+    0xFF, 0xD3, 0x01, 0x80, 0x7B, 0x3B, 0x8E, 0xFF, 0xE7, 0x41, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0xFF, 0xE0, 0x07, 0x8E, 0xFF, 0xF3, 0x01,
+    0x6B, 0x7A, 0xFF, 0x04, 0x02, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x10, 0xC2, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0xFF, 0x24, 0x02, 0x80, 0x7A,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0xFF, 0xE0, 0x07,
+    0x8E, 0xFF, 0x30, 0xC2, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0xFF, 0x44, 0x02, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x3B, 0x8E, 0xFF, 0x50, 0xC2, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0xFF,
+    0x64, 0x02, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0xFF, 0xE0, 0x07, 0x8E, 0xFF, 0x70, 0xC2, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0xFF, 0x85, 0x02, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0xFF, 0xE0, 0x07, 0x8E,
+    0xFF, 0x91, 0xC2, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0xFF, 0xA5, 0x02, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x3B, 0x8E, 0xFF, 0xB1, 0xC2, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0xFF, 0xC5,
+    0x02, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x3B, 0x8E, 0xFF, 0xD1, 0xC2, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0xFF, 0xE5, 0x02, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0xFF, 0xE0, 0x07, 0x8E, 0xFF, 0xF1, 0xC2,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A,
+    0x6B, 0x7A, 0xFF, 0x06, 0x03, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x12, 0xC3, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0xFF, 0x26, 0x03, 0x80, 0x7A,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x3B, 0x8E, 0xFF,
+    0x32, 0xC3, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A,
+    0x6B, 0x7A, 0x80, 0x7A, 0xFF, 0x46, 0x03, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x3B, 0x8E, 0xFF, 0x52, 0xC3, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0xFF, 0x66, 0x03,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0xFF,
+    0xE0, 0x07, 0x8E, 0xFF, 0x72, 0xC3, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0xFF, 0x87, 0x03, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0xFF, 0xE0, 0x07, 0x8E, 0xFF, 0x93,
+    0xC3, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0xFF, 0xA7, 0x03, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x3B, 0x8E, 0xFF, 0xB3, 0xC3, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0xFF, 0xC7, 0x03, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0xFF, 0xE0,
+    0x07, 0x8E, 0xFF, 0xD3, 0xC3, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0xFF, 0xE7, 0x03, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0xF3, 0xC3, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0xFF, 0x08, 0x04, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x10, 0x84, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x81, 0xFF, 0x28, 0x04, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x3B, 0x8E, 0xFF, 0x30, 0x84, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x3B, 0x81,
+    0xFF, 0x48, 0x04, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x3B, 0x8E, 0xFF, 0x50, 0x84, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0xFF, 0xE0, 0x07, 0x81, 0xFF, 0x68, 0x04, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0xFF, 0xE0, 0x07, 0x8E,
+    0xFF, 0x70, 0x84, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x3B, 0x81, 0xFF, 0x89, 0x04, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x91, 0x84, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x81, 0xFF, 0xA9, 0x04, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0xFF, 0xE0,
+    0x07, 0x8E, 0xFF, 0xB1, 0x84, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0xFF, 0xE0, 0x07, 0x81, 0xFF, 0xC9, 0x04, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x3B, 0x8E, 0xFF, 0xD1, 0x84, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x3B, 0x81,
+    0xFF, 0xE9, 0x04, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0xF1, 0x84, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x3B, 0x81, 0xFF, 0x0A, 0x05, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x12, 0x85, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x81,
+    0xFF, 0x2A, 0x05, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x3B, 0x8E, 0xFF, 0x32, 0x85, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0xFF, 0xE0, 0x07, 0x81, 0xFF, 0x4A, 0x05, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x3B, 0x8E, 0xFF, 0x52,
+    0x85, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x3B, 0x81, 0xFF, 0x6A, 0x05, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x72, 0x85, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x3B, 0x81, 0xFF, 0x8B, 0x05, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x93,
+    0x85, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0xFF, 0xE0, 0x07, 0x81,
+};
+
+// 90x20 palette, 1134 bytes
+const uint8_t asset_indexed[] PROGMEM = {
+    0x47, 0x41, 0x01, 0x01, 0x5A, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x1F, 0x00, 0xE0, 0x07, 0x00,
+    0xF8, 0xFF, 0xFF, 0x07, 0x80, 0x04, 0x06, 0x80, 0x03, 0x06, 0x80, 0x02, 0x06, 0x80, 0x01, 0x06,
+    0x80, 0x00, 0x06, 0x80, 0x04, 0x06, 0x80, 0x03, 0x06, 0x80, 0x02, 0x06, 0x80, 0x01, 0x06, 0x80,
+    0x00, 0x06, 0x82, 0x04, 0x04, 0x00, 0x01, 0x81, 0x01, 0x00, 0x02, 0x83, 0x04, 0x04, 0x01, 0x04,
+    0x03, 0x82, 0x03, 0x01, 0x03, 0x04, 0x81, 0x01, 0x02, 0x04, 0x80, 0x01, 0x07, 0x80, 0x00, 0x03,
+    0x83, 0x01, 0x00, 0x00, 0x04, 0x02, 0x81, 0x01, 0x04, 0x01, 0x80, 0x03, 0x01, 0x81, 0x01, 0x03,
+    0x02, 0x83, 0x02, 0x02, 0x01, 0x02, 0x03, 0x80, 0x01, 0x07, 0x80, 0x00, 0x04, 0x83, 0x01, 0x04,
+    0x04, 0x00, 0x03, 0x83, 0x01, 0x00, 0x00, 0x04, 0x02, 0x81, 0x01, 0x04, 0x01, 0x80, 0x03, 0x01,
+    0x81, 0x01, 0x03, 0x02, 0x83, 0x02, 0x02, 0x01, 0x02, 0x03, 0x80, 0x01, 0x07, 0x80, 0x00, 0x04,
+    0x81, 0x01, 0x04, 0x04, 0x82, 0x01, 0x04, 0x03, 0x03, 0x83, 0x01, 0x03, 0x03, 0x02, 0x02, 0x81,
+    0x01, 0x02, 0x01, 0x80, 0x01, 0x06, 0x83, 0x00, 0x00, 0x01, 0x00, 0x03, 0x84, 0x04, 0x01, 0x00,
+    0x01, 0x00, 0x04, 0x81, 0x01, 0x04, 0x04, 0x81, 0x01, 0x03, 0x04, 0x82, 0x01, 0x03, 0x02, 0x03,
+    0x83, 0x01, 0x02, 0x02, 0x01, 0x06, 0x80, 0x00, 0x01, 0x81, 0x01, 0x00, 0x02, 0x83, 0x04, 0x04,
+    0x01, 0x04, 0x03, 0x82, 0x03, 0x01, 0x03, 0x04, 0x81, 0x01, 0x02, 0x04, 0x80, 0x01, 0x07, 0x80,
+    0x00, 0x03, 0x85, 0x01, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x82, 0x01, 0x00, 0x04, 0x03, 0x83,
+    0x01, 0x04, 0x04, 0x03, 0x02, 0x81, 0x01, 0x03, 0x01, 0x80, 0x02, 0x01, 0x81, 0x01, 0x02, 0x02,
+    0x80, 0x01, 0x06, 0x82, 0x00, 0x01, 0x00, 0x04, 0x81, 0x01, 0x04, 0x04, 0x81, 0x01, 0x03, 0x04,
+    0x82, 0x01, 0x03, 0x02, 0x03, 0x83, 0x01, 0x02, 0x02, 0x01, 0x06, 0x80, 0x00, 0x01, 0x81, 0x01,
+    0x00, 0x02, 0x80, 0x04, 0x02, 0x81, 0x01, 0x04, 0x03, 0x82, 0x00, 0x01, 0x00, 0x04, 0x81, 0x01,
+    0x02, 0x04, 0x81, 0x01, 0x03, 0x04, 0x82, 0x01, 0x03, 0x00, 0x03, 0x83, 0x01, 0x00, 0x00, 0x01,
+    0x06, 0x80, 0x03, 0x01, 0x81, 0x01, 0x03, 0x02, 0x83, 0x04, 0x04, 0x01, 0x04, 0x03, 0x80, 0x01,
+    0x07, 0x80, 0x02, 0x04, 0x81, 0x01, 0x04, 0x04, 0x84, 0x01, 0x04, 0x00, 0x00, 0x04, 0x02, 0x81,
+    0x01, 0x04, 0x01, 0x80, 0x00, 0x01, 0x81, 0x01, 0x00, 0x02, 0x83, 0x02, 0x02, 0x01, 0x02, 0x03,
+    0x82, 0x03, 0x01, 0x03, 0x04, 0x81, 0x01, 0x00, 0x04, 0x80, 0x01, 0x07, 0x80, 0x03, 0x03, 0x83,
+    0x01, 0x03, 0x03, 0x04, 0x02, 0x81, 0x01, 0x04, 0x01, 0x80, 0x01, 0x06, 0x83, 0x02, 0x02, 0x01,
+    0x02, 0x03, 0x82, 0x04, 0x01, 0x04, 0x04, 0x82, 0x01, 0x00, 0x04, 0x06, 0x80, 0x00, 0x06, 0x80,
+    0x02, 0x06, 0x80, 0x03, 0x06, 0x80, 0x00, 0x06, 0x80, 0x01, 0x06, 0x80, 0x03, 0x06, 0x80, 0x04,
+    0x06, 0x80, 0x01, 0x06, 0x80, 0x02, 0x06, 0x80, 0x04, 0x06, 0x82, 0x00, 0x00, 0x04, 0x01, 0x81,
+    0x01, 0x04, 0x02, 0x83, 0x00, 0x00, 0x01, 0x00, 0x03, 0x82, 0x02, 0x01, 0x02, 0x04, 0x81, 0x01,
+    0x03, 0x04, 0x81, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00, 0x01, 0x06, 0x80, 0x03, 0x02, 0x81, 0x01,
+    0x03, 0x01, 0x80, 0x04, 0x01, 0x81, 0x01, 0x04, 0x02, 0x80, 0x01, 0x06, 0x82, 0x02, 0x01, 0x02,
+    0x04, 0x81, 0x01, 0x04, 0x04, 0x83, 0x01, 0x00, 0x00, 0x04, 0x03, 0x83, 0x01, 0x04, 0x04, 0x00,
+    0x02, 0x81, 0x01, 0x00, 0x01, 0x80, 0x02, 0x01, 0x81, 0x01, 0x02, 0x02, 0x83, 0x03, 0x03, 0x01,
+    0x03, 0x03, 0x82, 0x00, 0x01, 0x00, 0x04, 0x80, 0x01, 0x06, 0x80, 0x03, 0x04, 0x82, 0x01, 0x03,
+    0x04, 0x03, 0x83, 0x01, 0x04, 0x04, 0x01, 0x06, 0x80, 0x02, 0x01, 0x81, 0x01, 0x02, 0x02, 0x83,
+    0x04, 0x04, 0x01, 0x04, 0x03, 0x84, 0x00, 0x01, 0x03, 0x01, 0x03, 0x04, 0x81, 0x01, 0x02, 0x04,
+    0x81, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00, 0x04, 0x03, 0x81, 0x01, 0x04, 0x04, 0x81, 0x01, 0x04,
+    0x01, 0x80, 0x03, 0x01, 0x81, 0x01, 0x03, 0x02, 0x80, 0x01, 0x06, 0x82, 0x00, 0x01, 0x00, 0x04,
+    0x81, 0x01, 0x00, 0x04, 0x81, 0x01, 0x04, 0x04, 0x82, 0x01, 0x04, 0x02, 0x03, 0x85, 0x01, 0x02,
+    0x02, 0x01, 0x01, 0x03, 0x04, 0x82, 0x01, 0x03, 0x02, 0x03, 0x83, 0x01, 0x02, 0x02, 0x00, 0x02,
+    0x81, 0x01, 0x00, 0x01, 0x80, 0x04, 0x01, 0x81, 0x01, 0x04, 0x04, 0x81, 0x01, 0x04, 0x03, 0x82,
+    0x03, 0x01, 0x03, 0x04, 0x80, 0x01, 0x06, 0x80, 0x00, 0x04, 0x81, 0x01, 0x00, 0x04, 0x83, 0x01,
+    0x00, 0x00, 0x04, 0x02, 0x81, 0x01, 0x04, 0x01, 0x80, 0x02, 0x01, 0x81, 0x01, 0x02, 0x02, 0x85,
+    0x01, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x82, 0x02, 0x01, 0x02, 0x04, 0x81, 0x01, 0x00, 0x04,
+    0x81, 0x01, 0x04, 0x04, 0x81, 0x01, 0x04, 0x04, 0x83, 0x01, 0x04, 0x04, 0x03, 0x02, 0x81, 0x01,
+    0x03, 0x01, 0x80, 0x01, 0x06, 0x83, 0x00, 0x00, 0x01, 0x00, 0x04, 0x81, 0x01, 0x00, 0x04, 0x81,
+    0x01, 0x04, 0x04, 0x81, 0x01, 0x02, 0x04, 0x84, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x81, 0x01,
+    0x03, 0x01, 0x80, 0x02, 0x01, 0x81, 0x01, 0x02, 0x02, 0x83, 0x00, 0x00, 0x01, 0x00, 0x03, 0x82,
+    0x04, 0x01, 0x04, 0x04, 0x81, 0x01, 0x04, 0x04, 0x81, 0x01, 0x03, 0x04, 0x82, 0x01, 0x03, 0x01,
+    0x06, 0x80, 0x00, 0x02, 0x81, 0x01, 0x00, 0x04, 0x81, 0x01, 0x00, 0x02, 0x83, 0x04, 0x04, 0x01,
+    0x04, 0x03, 0x82, 0x02, 0x01, 0x02, 0x04, 0x82, 0x01, 0x01, 0x03, 0x06, 0x80, 0x02, 0x06, 0x80,
+    0x00, 0x06, 0x80, 0x04, 0x0E, 0x80, 0x03, 0x06, 0x80, 0x01, 0x06, 0x80, 0x00, 0x0E, 0x80, 0x04,
+    0x06, 0x80, 0x02, 0x06, 0x82, 0x01, 0x01, 0x02, 0x01, 0x81, 0x01, 0x02, 0x02, 0x83, 0x03, 0x03,
+    0x01, 0x03, 0x03, 0x82, 0x04, 0x01, 0x04, 0x04, 0x81, 0x01, 0x00, 0x04, 0x81, 0x01, 0x03, 0x04,
+    0x82, 0x01, 0x03, 0x04, 0x03, 0x83, 0x01, 0x04, 0x04, 0x00, 0x02, 0x81, 0x01, 0x00, 0x01, 0x80,
+    0x01, 0x06, 0x83, 0x04, 0x04, 0x01, 0x04, 0x03, 0x82, 0x00, 0x01, 0x00, 0x04, 0x80, 0x01, 0x06,
+    0x80, 0x02, 0x05, 0x83, 0x01, 0x02, 0x02, 0x03, 0x02, 0x81, 0x01, 0x03, 0x01, 0x80, 0x04, 0x01,
+    0x81, 0x01, 0x04, 0x02, 0x83, 0x00, 0x00, 0x01, 0x00, 0x03, 0x82, 0x03, 0x01, 0x03, 0x04, 0x81,
+    0x01, 0x04, 0x04, 0x81, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00, 0x01, 0x06, 0x80, 0x04, 0x02, 0x81,
+    0x01, 0x04, 0x01, 0x80, 0x00, 0x01, 0x81, 0x01, 0x00, 0x02, 0x80, 0x01, 0x06, 0x84, 0x02, 0x01,
+    0x02, 0x01, 0x02, 0x04, 0x81, 0x01, 0x03, 0x04, 0x81, 0x01, 0x04, 0x04, 0x82, 0x01, 0x04, 0x00,
+    0x03, 0x83, 0x01, 0x00, 0x00, 0x03, 0x02, 0x81, 0x01, 0x03, 0x01, 0x80, 0x04, 0x01, 0x81, 0x01,
+    0x04, 0x02, 0x83, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80, 0x01, 0x07, 0x80, 0x04, 0x04, 0x81, 0x01,
+    0x00, 0x04, 0x82, 0x01, 0x00, 0x01, 0x06, 0x80, 0x02, 0x06, 0x82, 0x01, 0x02, 0x03, 0x03, 0x83,
+    0x01, 0x03, 0x03, 0x04, 0x02, 0x81, 0x01, 0x04, 0x01, 0x80, 0x00, 0x01, 0x81, 0x01, 0x00, 0x02,
+    0x83, 0x03, 0x03, 0x01, 0x03, 0x03, 0x82, 0x04, 0x01, 0x04, 0x04, 0x81, 0x01, 0x00, 0x04, 0x80,
+    0x01, 0x07, 0x80, 0x04, 0x03, 0x83, 0x01, 0x04, 0x04, 0x00, 0x02, 0x81, 0x01, 0x00, 0x01, 0x80,
+    0x01, 0x06, 0x80, 0x02, 0x02, 0x81, 0x01, 0x02, 0x03, 0x82, 0x03, 0x01, 0x03, 0x04, 0x81, 0x01,
+    0x04, 0x04, 0x81, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00, 0x03, 0x03, 0x83, 0x01, 0x03, 0x03, 0x04,
+    0x02, 0x81, 0x01, 0x04, 0x01, 0x80, 0x00, 0x01, 0x81, 0x01, 0x00, 0x02, 0x80, 0x01, 0x06, 0x82,
+    0x04, 0x01, 0x04, 0x04, 0x81, 0x01, 0x00, 0x04, 0x80, 0x01, 0x07, 0x81, 0x02, 0x02,
+};
+
+// 30x17 raw, 1028 bytes
+const uint8_t asset_noise[] PROGMEM = {
+    0x47, 0x41, 0x01, 0x02, 0x1E, 0x00, 0x11, 0x00, 0x16, 0xDC, 0x14, 0x30, 0x12, 0x84, 0x0F, 0xD8,
+    0x0D, 0x2C, 0x0B, 0x80, 0x09, 0xD4, 0x06, 0x28, 0x04, 0x7C, 0x02, 0xD0, 0x00, 0x24, 0xFD, 0x77,
+    0xFB, 0xCB, 0xF9, 0x1F, 0xF7, 0x73, 0xF4, 0xC7, 0xF2, 0x1B, 0xF0, 0x6F, 0xEE, 0xC3, 0xEB, 0x17,
+    0xE9, 0x6B, 0xE7, 0xBF, 0xE5, 0x13, 0xE3, 0x67, 0xE0, 0xBB, 0xDE, 0x0F, 0xDC, 0x63, 0xDA, 0xB7,
+    0xD7, 0x0B, 0xD5, 0x5F, 0xE4, 0x85, 0xE1, 0xD9, 0xDF, 0x2D, 0xDD, 0x81, 0xDB, 0xD5, 0xD8, 0x29,
+    0xD6, 0x7D, 0xD4, 0xD1, 0xD2, 0x25, 0xCF, 0x79, 0xCD, 0xCD, 0xCB, 0x21, 0xC9, 0x75, 0xC7, 0xC9,
+    0xC4, 0x1D, 0xC2, 0x71, 0xC0, 0xC5, 0xBE, 0x19, 0xBB, 0x6D, 0xB9, 0xC1, 0xB7, 0x15, 0xB5, 0x69,
+    0xB2, 0xBD, 0xB0, 0x11, 0xAE, 0x65, 0xAC, 0xB9, 0xA9, 0x0D, 0xA7, 0x61, 0xA5, 0xB5, 0xA3, 0x09,
+    0xB1, 0x2F, 0xAF, 0x83, 0xAD, 0xD7, 0xAB, 0x2B, 0xA8, 0x7F, 0xA6, 0xD3, 0xA4, 0x27, 0xA2, 0x7B,
+    0x9F, 0xCF, 0x9D, 0x23, 0x9B, 0x77, 0x99, 0xCB, 0x96, 0x1F, 0x94, 0x73, 0x92, 0xC7, 0x90, 0x1B,
+    0x8D, 0x6F, 0x8B, 0xC3, 0x89, 0x17, 0x87, 0x6B, 0x85, 0xBF, 0x82, 0x13, 0x80, 0x67, 0x7E, 0xBB,
+    0x7C, 0x0F, 0x79, 0x63, 0x77, 0xB7, 0x75, 0x0B, 0x73, 0x5F, 0x70, 0xB3, 0x7F, 0xD9, 0x7D, 0x2D,
+    0x7A, 0x81, 0x78, 0xD5, 0x76, 0x29, 0x74, 0x7D, 0x71, 0xD1, 0x6F, 0x25, 0x6D, 0x79, 0x6B, 0xCD,
+    0x69, 0x21, 0x66, 0x75, 0x64, 0xC9, 0x62, 0x1D, 0x60, 0x71, 0x5D, 0xC5, 0x5B, 0x19, 0x59, 0x6D,
+    0x57, 0xC1, 0x54, 0x15, 0x52, 0x69, 0x50, 0xBD, 0x4E, 0x11, 0x4B, 0x65, 0x49, 0xB9, 0x47, 0x0D,
+    0x45, 0x61, 0x42, 0xB5, 0x40, 0x09, 0x3E, 0x5D, 0x4D, 0x83, 0x4A, 0xD7, 0x48, 0x2B, 0x46, 0x7F,
+    0x44, 0xD3, 0x41, 0x27, 0x3F, 0x7B, 0x3D, 0xCF, 0x3B, 0x23, 0x38, 0x77, 0x36, 0xCB, 0x34, 0x1F,
+    0x32, 0x73, 0x2F, 0xC7, 0x2D, 0x1B, 0x2B, 0x6F, 0x29, 0xC3, 0x27, 0x17, 0x24, 0x6B, 0x22, 0xBF,
+    0x20, 0x13, 0x1E, 0x67, 0x1B, 0xBB, 0x19, 0x0F, 0x17, 0x63, 0x15, 0xB7, 0x12, 0x0B, 0x10, 0x5F,
+    0x0E, 0xB3, 0x0C, 0x07, 0x1A, 0x2D, 0x18, 0x81, 0x16, 0xD5, 0x14, 0x29, 0x11, 0x7D, 0x0F, 0xD1,
+    0x0D, 0x25, 0x0B, 0x79, 0x08, 0xCD, 0x06, 0x21, 0x04, 0x75, 0x02, 0xC9, 0xFF, 0x1C, 0xFD, 0x70,
+    0xFB, 0xC4, 0xF9, 0x18, 0xF6, 0x6C, 0xF4, 0xC0, 0xF2, 0x14, 0xF0, 0x68, 0xED, 0xBC, 0xEB, 0x10,
+    0xE9, 0x64, 0xE7, 0xB8, 0xE4, 0x0C, 0xE2, 0x60, 0xE0, 0xB4, 0xDE, 0x08, 0xDC, 0x5C, 0xD9, 0xB0,
+    0xE8, 0xD6, 0xE6, 0x2A, 0xE3, 0x7E, 0xE1, 0xD2, 0xDF, 0x26, 0xDD, 0x7A, 0xDA, 0xCE, 0xD8, 0x22,
+    0xD6, 0x76, 0xD4, 0xCA, 0xD1, 0x1E, 0xCF, 0x72, 0xCD, 0xC6, 0xCB, 0x1A, 0xC9, 0x6E, 0xC6, 0xC2,
+    0xC4, 0x16, 0xC2, 0x6A, 0xC0, 0xBE, 0xBD, 0x12, 0xBB, 0x66, 0xB9, 0xBA, 0xB7, 0x0E, 0xB4, 0x62,
+    0xB2, 0xB6, 0xB0, 0x0A, 0xAE, 0x5E, 0xAB, 0xB2, 0xA9, 0x06, 0xA7, 0x5A, 0xB6, 0x80, 0xB3, 0xD4,
+    0xB1, 0x28, 0xAF, 0x7C, 0xAD, 0xD0, 0xAA, 0x24, 0xA8, 0x78, 0xA6, 0xCC, 0xA4, 0x20, 0xA1, 0x74,
+    0x9F, 0xC8, 0x9D, 0x1C, 0x9B, 0x70, 0x98, 0xC4, 0x96, 0x18, 0x94, 0x6C, 0x92, 0xC0, 0x8F, 0x14,
+    0x8D, 0x68, 0x8B, 0xBC, 0x89, 0x10, 0x87, 0x64, 0x84, 0xB8, 0x82, 0x0C, 0x80, 0x60, 0x7E, 0xB4,
+    0x7B, 0x08, 0x79, 0x5C, 0x77, 0xB0, 0x75, 0x04, 0x83, 0x2A, 0x81, 0x7E, 0x7F, 0xD2, 0x7C, 0x26,
+    0x7A, 0x7A, 0x78, 0xCE, 0x76, 0x22, 0x73, 0x76, 0x71, 0xCA, 0x6F, 0x1E, 0x6D, 0x72, 0x6B, 0xC6,
+    0x68, 0x1A, 0x66, 0x6E, 0x64, 0xC2, 0x62, 0x16, 0x5F, 0x6A, 0x5D, 0xBE, 0x5B, 0x12, 0x59, 0x66,
+    0x56, 0xBA, 0x54, 0x0E, 0x52, 0x62, 0x50, 0xB6, 0x4D, 0x0A, 0x4B, 0x5E, 0x49, 0xB2, 0x47, 0x06,
+    0x44, 0x5A, 0x42, 0xAE, 0x51, 0xD4, 0x4F, 0x28, 0x4C, 0x7C, 0x4A, 0xD0, 0x48, 0x24, 0x46, 0x78,
+    0x43, 0xCC, 0x41, 0x20, 0x3F, 0x74, 0x3D, 0xC8, 0x3A, 0x1C, 0x38, 0x70, 0x36, 0xC4, 0x34, 0x18,
+    0x31, 0x6C, 0x2F, 0xC0, 0x2D, 0x14, 0x2B, 0x68, 0x29, 0xBC, 0x26, 0x10, 0x24, 0x64, 0x22, 0xB8,
+    0x20, 0x0C, 0x1D, 0x60, 0x1B, 0xB4, 0x19, 0x08, 0x17, 0x5C, 0x14, 0xB0, 0x12, 0x04, 0x10, 0x58,
+    0x1E, 0x7E, 0x1C, 0xD2, 0x1A, 0x26, 0x18, 0x7A, 0x15, 0xCE, 0x13, 0x22, 0x11, 0x76, 0x0F, 0xCA,
+    0x0D, 0x1E, 0x0A, 0x72, 0x08, 0xC6, 0x06, 0x1A, 0x04, 0x6E, 0x01, 0xC2, 0xFF, 0x15, 0xFD, 0x69,
+    0xFB, 0xBD, 0xF8, 0x11, 0xF6, 0x65, 0xF4, 0xB9, 0xF2, 0x0D, 0xEF, 0x61, 0xED, 0xB5, 0xEB, 0x09,
+    0xE9, 0x5D, 0xE6, 0xB1, 0xE4, 0x05, 0xE2, 0x59, 0xE0, 0xAD, 0xDE, 0x01, 0xEC, 0x27, 0xEA, 0x7B,
+    0xE8, 0xCF, 0xE5, 0x23, 0xE3, 0x77, 0xE1, 0xCB, 0xDF, 0x1F, 0xDC, 0x73, 0xDA, 0xC7, 0xD8, 0x1B,
+    0xD6, 0x6F, 0xD3, 0xC3, 0xD1, 0x17, 0xCF, 0x6B, 0xCD, 0xBF, 0xCB, 0x13, 0xC8, 0x67, 0xC6, 0xBB,
+    0xC4, 0x0F, 0xC2, 0x63, 0xBF, 0xB7, 0xBD, 0x0B, 0xBB, 0x5F, 0xB9, 0xB3, 0xB6, 0x07, 0xB4, 0x5B,
+    0xB2, 0xAF, 0xB0, 0x03, 0xAD, 0x57, 0xAB, 0xAB, 0xBA, 0xD1, 0xB7, 0x25, 0xB5, 0x79, 0xB3, 0xCD,
+    0xB1, 0x21, 0xAF, 0x75, 0xAC, 0xC9, 0xAA, 0x1D, 0xA8, 0x71, 0xA6, 0xC5, 0xA3, 0x19, 0xA1, 0x6D,
+    0x9F, 0xC1, 0x9D, 0x15, 0x9A, 0x69, 0x98, 0xBD, 0x96, 0x11, 0x94, 0x65, 0x91, 0xB9, 0x8F, 0x0D,
+    0x8D, 0x61, 0x8B, 0xB5, 0x88, 0x09, 0x86, 0x5D, 0x84, 0xB1, 0x82, 0x05, 0x80, 0x59, 0x7D, 0xAD,
+    0x7B, 0x01, 0x79, 0x55, 0x87, 0x7B, 0x85, 0xCF, 0x83, 0x23, 0x81, 0x77, 0x7E, 0xCB, 0x7C, 0x1F,
+    0x7A, 0x73, 0x78, 0xC7, 0x75, 0x1B, 0x73, 0x6F, 0x71, 0xC3, 0x6F, 0x17, 0x6D, 0x6B, 0x6A, 0xBF,
+    0x68, 0x13, 0x66, 0x67, 0x64, 0xBB, 0x61, 0x0F, 0x5F, 0x63, 0x5D, 0xB7, 0x5B, 0x0B, 0x58, 0x5F,
+    0x56, 0xB3, 0x54, 0x07, 0x52, 0x5B, 0x4F, 0xAF, 0x4D, 0x03, 0x4B, 0x57, 0x49, 0xAB, 0x46, 0xFF,
+    0x55, 0x25, 0x53, 0x79, 0x51, 0xCD, 0x4E, 0x21, 0x4C, 0x75, 0x4A, 0xC9, 0x48, 0x1D, 0x45, 0x71,
+    0x43, 0xC5, 0x41, 0x19, 0x3F, 0x6D, 0x3C, 0xC1, 0x3A, 0x15, 0x38, 0x69, 0x36, 0xBD, 0x33, 0x11,
+    0x31, 0x65, 0x2F, 0xB9, 0x2D, 0x0D, 0x2A, 0x61, 0x28, 0xB5, 0x26, 0x09, 0x24, 0x5D, 0x22, 0xB1,
+    0x1F, 0x05, 0x1D, 0x59, 0x1B, 0xAD, 0x19, 0x01, 0x16, 0x55, 0x14, 0xA9, 0x23, 0xCF, 0x20, 0x23,
+    0x1E, 0x77, 0x1C, 0xCB, 0x1A, 0x1F, 0x17, 0x73, 0x15, 0xC7, 0x13, 0x1B, 0x11, 0x6F, 0x0F, 0xC3,
+    0x0C, 0x17, 0x0A, 0x6B, 0x08, 0xBF, 0x06, 0x13, 0x03, 0x67, 0x01, 0xBB, 0xFF, 0x0E, 0xFD, 0x62,
+    0xFA, 0xB6, 0xF8, 0x0A, 0xF6, 0x5E, 0xF4, 0xB2, 0xF1, 0x06, 0xEF, 0x5A, 0xED, 0xAE, 0xEB, 0x02,
+    0xE8, 0x56, 0xE6, 0xAA, 0xE4, 0xFE, 0xE2, 0x52, 0xF0, 0x78, 0xEE, 0xCC, 0xEC, 0x20, 0xEA, 0x74,
+    0xE7, 0xC8, 0xE5, 0x1C, 0xE3, 0x70, 0xE1, 0xC4, 0xDE, 0x18, 0xDC, 0x6C, 0xDA, 0xC0, 0xD8, 0x14,
+    0xD5, 0x68, 0xD3, 0xBC, 0xD1, 0x10, 0xCF, 0x64, 0xCC, 0xB8, 0xCA, 0x0C, 0xC8, 0x60, 0xC6, 0xB4,
+    0xC4, 0x08, 0xC1, 0x5C, 0xBF, 0xB0, 0xBD, 0x04, 0xBB, 0x58, 0xB8, 0xAC, 0xB6, 0x00, 0xB4, 0x54,
+    0xB2, 0xA8, 0xAF, 0xFC,
+};
+
+// 600x4 rgb565, 1756 bytes
+const uint8_t asset_wide[] PROGMEM = {
+    0x47, 0x41, 0x01, 0x00, 0x58, 0x02, 0x04, 0x00, 0x66, 0x8E, 0xFF, 0x04, 0x40, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x10,
+    0x00, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x3B, 0x8E, 0xD1, 0x04, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B,
+    0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B,
+    0x80, 0x7A, 0x80, 0x3B, 0x8E, 0x28, 0x80, 0x2B, 0x80, 0x35, 0x80, 0x38, 0x80, 0x02, 0x80, 0x05,
+    0x80, 0x7B, 0x80, 0x12, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A,
+    0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0x24, 0x80, 0x7A, 0x80, 0x31, 0x80, 0x34, 0x80, 0x3E,
+    0x80, 0x01, 0x80, 0x0B, 0x80, 0x0E, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B,
+    0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0x00, 0x80, 0x7A, 0x80, 0x0D, 0x80, 0x10,
+    0x80, 0x1A, 0x80, 0x1D, 0x80, 0x7B, 0x80, 0x2A, 0x80, 0x7B, 0x80, 0x37, 0x80, 0x7B, 0x80, 0x04,
+    0x80, 0x7B, 0x80, 0x11, 0x80, 0x7B, 0x80, 0x1E, 0x80, 0x3B, 0x8E, 0x1C, 0x80, 0x1F, 0x80, 0x29,
+    0x80, 0x2C, 0x80, 0x36, 0x80, 0x39, 0x80, 0x7B, 0x80, 0x06, 0x80, 0x30, 0x80, 0x7A, 0x80, 0x3D,
+    0x80, 0x7A, 0x80, 0x0A, 0x80, 0x7A, 0x80, 0x17, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0x18, 0x80, 0x7A,
+    0x80, 0x25, 0x80, 0x28, 0x80, 0x32, 0x80, 0x35, 0x80, 0x3F, 0x80, 0x02, 0x80, 0x0C, 0x80, 0x7A,
+    0x80, 0x19, 0x80, 0x7A, 0x80, 0x26, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x3B, 0x8E, 0x34,
+    0x80, 0x37, 0x80, 0x01, 0x80, 0x04, 0x80, 0x0E, 0x80, 0x11, 0x80, 0x7B, 0x80, 0x1E, 0x80, 0x7B,
+    0x80, 0x2B, 0x80, 0x7B, 0x80, 0x38, 0x80, 0x7B, 0x80, 0x05, 0x80, 0x7B, 0x80, 0x12, 0x80, 0x3B,
+    0x8E, 0x30, 0x80, 0x7A, 0x80, 0x3D, 0x80, 0x00, 0x80, 0x0A, 0x80, 0x0D, 0x80, 0x17, 0x80, 0x1A,
+    0x80, 0x24, 0x80, 0x7A, 0x80, 0x31, 0x80, 0x7A, 0x80, 0x3E, 0x80, 0x7A, 0x80, 0x0B, 0x80, 0x7A,
+    0x80, 0x3B, 0x8E, 0x0C, 0x80, 0x7A, 0x80, 0x19, 0x80, 0x1C, 0x80, 0x26, 0x80, 0x29, 0x80, 0x7B,
+    0x80, 0x36, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x10, 0x80, 0x7B, 0x80, 0x1D, 0x80, 0x7B,
+    0x80, 0x2A, 0x80, 0x3B, 0x8E, 0x28, 0x80, 0x2B, 0x80, 0x35, 0x80, 0x38, 0x80, 0x02, 0x80, 0x05,
+    0x80, 0x7B, 0x80, 0x12, 0x80, 0x7B, 0x80, 0x1F, 0x80, 0x7B, 0x80, 0x2C, 0x80, 0x7B, 0x80, 0x39,
+    0x80, 0x7B, 0x80, 0x06, 0x80, 0x3B, 0x8E, 0x24, 0x80, 0x7A, 0x80, 0x31, 0x80, 0x34, 0x80, 0x3B,
+    0x8E, 0xD2, 0xFB, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x3B, 0x8E, 0xFF, 0x30, 0x00, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x3B, 0x8E, 0xFF, 0x3C, 0xC0, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0xCE, 0x25, 0x8E, 0x2D, 0x80, 0x30,
+    0x37, 0x3A, 0x80, 0x3D, 0x04, 0x07, 0x80, 0x0A, 0x6B, 0x7A, 0x80, 0x17, 0x6B, 0x7A, 0x80, 0x7A,
+    0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0xFF, 0xE0, 0x07,
+    0x8E, 0xFF, 0x34, 0x40, 0x80, 0x7A, 0x33, 0x7A, 0x80, 0x39, 0x00, 0x03, 0x80, 0x06, 0x0D, 0x10,
+    0x80, 0x13, 0x1A, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A,
+    0x80, 0x7A, 0x6B, 0x3B, 0x8E, 0xD2, 0x77, 0x80, 0x7A, 0x0F, 0x7A, 0x80, 0x15, 0x1C, 0x1F, 0x80,
+    0x22, 0x6B, 0x7A, 0x80, 0x2F, 0x6B, 0x7A, 0x80, 0x3C, 0x6B, 0x7A, 0x80, 0x09, 0x6B, 0x7A, 0x80,
+    0x16, 0x6B, 0x7A, 0x80, 0x23, 0x6B, 0x3B, 0x8E, 0x21, 0x80, 0x24, 0x2B, 0x2E, 0x80, 0x31, 0x38,
+    0x7A, 0x80, 0x3E, 0x6B, 0x7A, 0x80, 0x0B, 0x6B, 0x7A, 0x80, 0x7A, 0x3F, 0x02, 0x80, 0x7A, 0x0C,
+    0x7A, 0x80, 0x7A, 0x19, 0x7A, 0x80, 0x7A, 0x26, 0xFF, 0xE0, 0x07, 0x8E, 0xFF, 0x38, 0x80, 0x80,
+    0x7A, 0x27, 0x7A, 0x80, 0x2D, 0x34, 0x37, 0x80, 0x3A, 0x01, 0x04, 0x80, 0x07, 0x0E, 0x7A, 0x80,
+    0x7A, 0x1B, 0x7A, 0x80, 0x7A, 0x28, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x72, 0x8E,
+    0x39, 0x80, 0x3C, 0x03, 0x06, 0x80, 0x09, 0x10, 0x13, 0x80, 0x16, 0x6B, 0x7A, 0x80, 0x23, 0x6B,
+    0x7A, 0x80, 0x30, 0x6B, 0x7A, 0x80, 0x3D, 0x6B, 0x7A, 0x80, 0x0A, 0x6B, 0x7A, 0x80, 0x17, 0x6B,
+    0x3B, 0x8E, 0xFF, 0x30, 0x00, 0x80, 0x7A, 0x3F, 0x02, 0x80, 0x05, 0x0C, 0x0F, 0x80, 0x12, 0x19,
+    0x1C, 0x80, 0x1F, 0x26, 0x7A, 0x80, 0x7A, 0x33, 0x7A, 0x80, 0x7A, 0x00, 0x7A, 0x80, 0x7A, 0x0D,
+    0x7A, 0x80, 0x7A, 0x1A, 0x3B, 0x8E, 0xFF, 0x3C, 0xC0, 0x80, 0x7A, 0x1B, 0x7A, 0x80, 0x21, 0x28,
+    0x2B, 0x80, 0x2E, 0x6B, 0x7A, 0x80, 0x7A, 0x22, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x15, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x2F, 0x6B, 0xCE, 0x25, 0x8E, 0x2D, 0x80, 0x30, 0x37, 0x3A,
+    0x80, 0x3D, 0x04, 0x07, 0x80, 0x0A, 0x6B, 0x7A, 0x80, 0x17, 0x6B, 0x7A, 0x80, 0x24, 0x6B, 0x7A,
+    0x80, 0x31, 0x6B, 0x7A, 0x80, 0x3E, 0x6B, 0x7A, 0x80, 0x0B, 0x6B, 0xFF, 0xE0, 0x07, 0x8E, 0xFF,
+    0x34, 0x40, 0x80, 0x7A, 0x33, 0x7A, 0x80, 0x39, 0x00, 0x3B, 0x8E, 0xD3, 0xFB, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x3B, 0x8E, 0xFF, 0x50,
+    0x00, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80,
+    0xFF, 0xE0, 0x07, 0x8E, 0xFF, 0x5C, 0xC0, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80,
+    0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0xCD, 0x36, 0x8E, 0x32, 0x80, 0x3C, 0x80, 0x3F, 0x80, 0x09,
+    0x80, 0x0C, 0x80, 0x7B, 0x80, 0x19, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B,
+    0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x3B, 0x8E, 0xFF, 0x54, 0x40, 0x80, 0x38,
+    0x80, 0x7A, 0x80, 0x05, 0x80, 0x08, 0x80, 0x12, 0x80, 0x15, 0x80, 0x1F, 0x80, 0x7A, 0x80, 0x7B,
+    0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0xFF, 0xE0, 0x07,
+    0x8E, 0xD3, 0x77, 0x80, 0x14, 0x80, 0x7A, 0x80, 0x21, 0x80, 0x24, 0x80, 0x7B, 0x80, 0x31, 0x80,
+    0x7B, 0x80, 0x3E, 0x80, 0x7B, 0x80, 0x0B, 0x80, 0x7B, 0x80, 0x18, 0x80, 0x7B, 0x80, 0x25, 0x80,
+    0x7B, 0x80, 0xFF, 0xE0, 0x07, 0x8E, 0x26, 0x80, 0x30, 0x80, 0x33, 0x80, 0x3D, 0x80, 0x00, 0x80,
+    0x7B, 0x80, 0x0D, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x04, 0x80, 0x07, 0x80, 0x11, 0x80, 0x7A, 0x80,
+    0x1E, 0x80, 0x7A, 0x80, 0x2B, 0x80, 0x3B, 0x8E, 0xFF, 0x58, 0x80, 0x80, 0x2C, 0x80, 0x7A, 0x80,
+    0x39, 0x80, 0x3C, 0x80, 0x06, 0x80, 0x09, 0x80, 0x13, 0x80, 0x7A, 0x80, 0x20, 0x80, 0x7A, 0x80,
+    0x2D, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x27, 0x80, 0x3B, 0x8E, 0x3E, 0x80, 0x08, 0x80,
+    0x0B, 0x80, 0x15, 0x80, 0x18, 0x80, 0x7B, 0x80, 0x25, 0x80, 0x7B, 0x80, 0x32, 0x80, 0x7B, 0x80,
+    0x3F, 0x80, 0x7B, 0x80, 0x0C, 0x80, 0x7B, 0x80, 0x19, 0x80, 0x7B, 0x80, 0x3B, 0x8E, 0xFF, 0x50,
+    0x00, 0x80, 0x04, 0x80, 0x07, 0x80, 0x11, 0x80, 0x14, 0x80, 0x1E, 0x80, 0x21, 0x80, 0x2B, 0x80,
+    0x7A, 0x80, 0x38, 0x80, 0x7A, 0x80, 0x05, 0x80, 0x7A, 0x80, 0x12, 0x80, 0x7A, 0x80, 0x1F, 0x80,
+    0xFF, 0xE0, 0x07, 0x8E, 0xFF, 0x5C, 0xC0, 0x80, 0x20, 0x80, 0x7A, 0x80, 0x2D, 0x80, 0x30, 0x80,
+    0x7B, 0x80, 0x3D, 0x80, 0x27, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x7A, 0x80, 0x7B, 0x80, 0x24, 0x80,
+    0x7B, 0x80, 0x31, 0x80, 0x7B, 0x80, 0xCD, 0x36, 0x8E, 0x32, 0x80, 0x3C, 0x80, 0x3F, 0x80, 0x09,
+    0x80, 0x0C, 0x80, 0x7B, 0x80, 0x19, 0x80, 0x7B, 0x80, 0x26, 0x80, 0x7B, 0x80, 0x33, 0x80, 0x7B,
+    0x80, 0x00, 0x80, 0x7B, 0x80, 0x0D, 0x80, 0x7B, 0x80, 0x3B, 0x8E, 0xFF, 0x54, 0x40, 0x80, 0x38,
+    0x80, 0x7A, 0x80, 0x05, 0x80, 0xFF, 0xE0, 0x07, 0x8E, 0xD4, 0xEA, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x70, 0x00, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x3B, 0x8E,
+    0xFF, 0x7C, 0xC0, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x3B, 0x8E, 0x37, 0x3E, 0x01, 0x80, 0x04, 0x0B, 0x0E, 0x80, 0x11, 0x18, 0x7A, 0x80,
+    0x1E, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x74, 0x40, 0x3A, 0x7A, 0x80, 0x7A, 0x07, 0x0A, 0x80,
+    0x0D, 0x14, 0x17, 0x80, 0x1A, 0x21, 0x24, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80,
+    0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0xFF, 0xE0, 0x07, 0x8E, 0xD4, 0x66, 0x16, 0x7A,
+    0x80, 0x7A, 0x23, 0x26, 0x80, 0x29, 0x30, 0x7A, 0x80, 0x36, 0x6B, 0x7A, 0x80, 0x03, 0x6B, 0x7A,
+    0x80, 0x10, 0x6B, 0x7A, 0x80, 0x1D, 0x6B, 0x7A, 0x80, 0x2A, 0x6B, 0x7A, 0x80, 0x3B, 0x8E, 0x2B,
+    0x32, 0x35, 0x80, 0x38, 0x3F, 0x02, 0x80, 0x05, 0x0C, 0x7A, 0x80, 0x12, 0x6B, 0x7A, 0x80, 0x7A,
+    0x06, 0x09, 0x80, 0x7A, 0x13, 0x7A, 0x80, 0x7A, 0x20, 0x7A, 0x80, 0x7A, 0x2D, 0x7A, 0x80, 0x3B,
+    0x8E, 0xFF, 0x78, 0x80, 0x2E, 0x7A, 0x80, 0x7A, 0x6B, 0x3E, 0x80, 0x01, 0x08, 0x0B, 0x80, 0x0E,
+    0x15, 0x18, 0x80, 0x7A, 0x22, 0x7A, 0x80, 0x7A, 0x2F, 0x7A, 0x80, 0x7A, 0x3C, 0x7A, 0x80, 0x7A,
+    0x6B, 0x2C, 0x80, 0xCC, 0xBA, 0x8E, 0x03, 0x0A, 0x0D, 0x80, 0x10, 0x17, 0x1A, 0x80, 0x1D, 0x24,
+    0x7A, 0x80, 0x2A, 0x6B, 0x7A, 0x80, 0x37, 0x6B, 0x7A, 0x80, 0x04, 0x6B, 0x7A, 0x80, 0x11, 0x6B,
+    0x7A, 0x80, 0x1E, 0x6B, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x70, 0x00, 0x06, 0x09, 0x80, 0x0C, 0x13,
+    0x16, 0x80, 0x19, 0x20, 0x23, 0x80, 0x26, 0x2D, 0x30, 0x80, 0x7A, 0x3A, 0x7A, 0x80, 0x7A, 0x07,
+    0x7A, 0x80, 0x7A, 0x14, 0x7A, 0x80, 0x7A, 0x21, 0x7A, 0x80, 0x3B, 0x8E, 0xFF, 0x7C, 0xC0, 0x22,
+    0x7A, 0x80, 0x7A, 0x2F, 0x32, 0x80, 0x35, 0x3C, 0x7A, 0x80, 0x02, 0x29, 0x2C, 0x80, 0x7A, 0x6B,
+    0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x7A, 0x6B, 0x7A, 0x80, 0x36, 0x6B, 0x7A, 0x80, 0x3B, 0x8E,
+    0x37, 0x3E, 0x01, 0x80, 0x04, 0x0B, 0x0E, 0x80, 0x11, 0x18, 0x7A, 0x80, 0x1E, 0x6B, 0x7A, 0x80,
+    0x2B, 0x6B, 0x7A, 0x80, 0x38, 0x6B, 0x7A, 0x80, 0x05, 0x6B, 0x7A, 0x80, 0x12, 0x6B, 0x7A, 0x80,
+    0x3B, 0x8E, 0xFF, 0x74, 0x40, 0x3A, 0x7A, 0x80, 0x7A, 0x07, 0x0A, 0x80,
+};
@@ -0,0 +1,323 @@
+/*
+ * GFXAsset decoder and drawAsset() tests against the fixture made by
+ * make_asset_fixture.py. The formulas below repeat the ones in that script.
+ */
+#include <chrono>
+#include <vector>
+
+#include "Arduino_GFX.h"
+#include "Arduino_RecordingBus.h"
+#include "GFXAsset.h"
+#include "canvas/Arduino_Canvas.h"
+#include "display/Arduino_ST7789.h"
+
+#include "asset_fixture.h"
+#include "host_test.h"
+
+static const uint16_t fixture_palette[] = {0x0000, 0xFFFF, 0xF800, 0x07E0, 0x001F};
+
+static uint16_t smooth(int x, int y)
+{
+  if ((((x >> 4) + (y >> 4)) % 3) == 0)
+  {
+    return 0x07E0;
+  }
+  return RGB565((x * 4) & 0xFF, (y * 4) & 0xFF, ((x + y) * 2) & 0xFF);
+}
+
+static uint16_t indexed(int x, int y)
+{
+  if (((x * y) % 7) == 3)
+  {
+    return fixture_palette[4];
+  }
+  return fixture_palette[((x >> 3) ^ (y / 5)) % 5];
+}
+
+static uint16_t noise(int x, int y)
+{
+  uint32_t v = (uint32_t)x * 7919 + (uint32_t)y * 104729 + 12345;
+  v = v * 1103515245 + 12345;
+  return (uint16_t)(v >> 8);
+}
+
+typedef struct
+{
+  const char *name;
+  const uint8_t *data;
+  uint32_t len;
+  uint16_t (*pixel)(int x, int y);
+  uint16_t w, h;
+  uint8_t format;
+} fixture_t;
+
+static const fixture_t fixtures[] = {
+    {"smooth", asset_smooth, sizeof(asset_smooth), smooth, 67, 45, GFX_ASSET_RGB565},
+    {"indexed", asset_indexed, sizeof(asset_indexed), indexed, 90, 20, GFX_ASSET_PALETTE},
+    {"noise", asset_noise, sizeof(asset_noise), noise, 30, 17, GFX_ASSET_RAW},
+    {"wide", asset_wide, sizeof(asset_wide), smooth, 600, 4, GFX_ASSET_RGB565},
+};
+
+static std::vector<uint16_t> expected(const fixture_t &f)
+{
+  std::vector<uint16_t> px((size_t)f.w * f.h);
+  for (int y = 0; y < f.h; ++y)
+  {
+    for (int x = 0; x < f.w; ++x)
+    {
+      px[(size_t)y * f.w + x] = f.pixel(x, y);
+    }
+  }
+  return px;
+}
+
+// decode the whole asset chunk pixels at a time
+static std::vector<uint16_t> decode(const uint8_t *data, uint32_t len, uint32_t chunk)
+{
+  std::vector<uint16_t> out;
+  gfx_asset_decoder_t d;
+  if (!gfx_asset_open(&d, data, len))
+  {
+    return out;
+  }
+  std::vector<uint16_t> buf(chunk);
+  uint32_t total = (uint32_t)d.width * d.height;
+  while (out.size() < total)
+  {
+    uint32_t n = gfx_asset_decode(&d, buf.data(), min(chunk, total - (uint32_t)out.size()));
+    if (!n)
+    {
+      break;
+    }
+    out.insert(out.end(), buf.begin(), buf.begin() + n);
+  }
+  return out;
+}
+
+static void test_header()
+{
+  for (const fixture_t &f : fixtures)
+  {
+    gfx_asset_decoder_t d;
+    CHECK(gfx_asset_open(&d, f.data, f.len));
+    CHECK_EQ(d.width, f.w);
+    CHECK_EQ(d.height, f.h);
+    CHECK_EQ(d.format, f.format);
+  }
+
+  uint8_t bad[16];
+  memcpy(bad, asset_smooth, sizeof(bad));
+  gfx_asset_decoder_t d;
+  CHECK(!gfx_asset_open(&d, bad, 7));
+  bad[0] = 'X';
+  CHECK(!gfx_asset_open(&d, bad, sizeof(bad)));
+  bad[0] = 'G';
+  bad[2] = 2; // version
+  CHECK(!gfx_asset_open(&d, bad, sizeof(bad)));
+  bad[2] = 1;
+  bad[3] = 3; // format
+  CHECK(!gfx_asset_open(&d, bad, sizeof(bad)));
+  // palette larger than the data
+  CHECK(!gfx_asset_open(&d, asset_indexed, 12));
+  // no pixels, or too big for int16_t coordinates
+  memcpy(bad, asset_smooth, sizeof(bad));
+  bad[4] = bad[5] = 0; // width
+  CHECK(!gfx_asset_open(&d, bad, sizeof(bad)));
+  memcpy(bad, asset_smooth, sizeof(bad));
+  bad[6] = bad[7] = 0; // height
+  CHECK(!gfx_asset_open(&d, bad, sizeof(bad)));
+  memcpy(bad, asset_smooth, sizeof(bad));
+  bad[5] = 0x80; // width 32768 + 67
+  CHECK(!gfx_asset_open(&d, bad, sizeof(bad)));
+}
+
+static void test_empty_draw()
+{
+  // a 0 x 1 and a 1 x 0 asset draw nothing and don't divide by the width
+  const uint8_t no_width[] = {'G', 'A', 1, GFX_ASSET_RAW, 0, 0, 1, 0};
+  const uint8_t no_height[] = {'G', 'A', 1, GFX_ASSET_RAW, 1, 0, 0, 0, 0x34, 0x12};
+  Arduino_RecordingBus bus;
+  Arduino_ST7789 tft(&bus, GFX_NOT_DEFINED, 0, true);
+  tft.begin();
+  bus.resetStats();
+  tft.drawAsset(10, 20, no_width, sizeof(no_width));
+  tft.drawAsset(10, 20, no_height, sizeof(no_height));
+  tft.drawAsset(-5, -5, no_width, sizeof(no_width));
+  CHECK_EQ(bus.stats().pixels, 0);
+
+  Arduino_Canvas canvas(240, 320, &tft);
+  canvas.begin(GFX_SKIP_OUTPUT_BEGIN);
+  canvas.drawAsset(10, 20, no_width, sizeof(no_width));
+  canvas.drawAsset(10, 20, no_height, sizeof(no_height));
+}
+
+static void test_corrupt_palette()
+{
+  // 1 color palette; the 3rd literal and the run after it index past it
+  const uint8_t asset[] = {
+      'G', 'A', 1, GFX_ASSET_PALETTE, 8, 0, 1, 0, // 8 x 1
+      0, 0x34, 0x12,                            // 1 color
+      0x83, 0, 0, 200, 0,                       // 4 literals
+      0x03,                                     // run of 4
+  };
+  gfx_asset_decoder_t d;
+  CHECK(gfx_asset_open(&d, asset, sizeof(asset)));
+  CHECK_EQ(d.colors, 1);
+  uint16_t buf[8] = {0};
+  CHECK_EQ(gfx_asset_decode(&d, buf, 8), 2);
+  CHECK_EQ(buf[0], 0x1234);
+  CHECK_EQ(buf[1], 0x1234);
+  CHECK_EQ(gfx_asset_decode(&d, buf, 8), 0);
+
+  // every index byte of a 5 color image raised past the palette stops
+  // the decoding, never reads outside it
+  std::vector<uint8_t> bad(asset_indexed, asset_indexed + sizeof(asset_indexed));
+  for (size_t i = 8 + 1 + 5 * 2; i < bad.size(); ++i)
+  {
+    std::vector<uint8_t> copy = bad;
+    copy[i] |= 0x7F;
+    std::vector<uint16_t> px = decode(copy.data(), copy.size(), 37);
+    CHECK(px.size() <= (size_t)90 * 20);
+  }
+
+  Arduino_RecordingBus bus;
+  Arduino_ST7789 tft(&bus, GFX_NOT_DEFINED, 0, true);
+  tft.begin();
+  tft.drawAsset(10, 20, asset, sizeof(asset));
+}
+
+static void test_decode()
+{
+  const uint32_t chunks[] = {1, 7, 64, GFX_ASSET_BUF_PIXELS, 100000};
+  for (const fixture_t &f : fixtures)
+  {
+    std::vector<uint16_t> ref = expected(f);
+    for (uint32_t chunk : chunks)
+    {
+      std::vector<uint16_t> px = decode(f.data, f.len, chunk);
+      if (px != ref)
+      {
+        printf("  %s: chunk %u decodes %zu pixels, differs from the source\n", f.name, chunk, px.size());
+        ++host_test_failures;
+      }
+    }
+
+    // nothing past the last pixel
+    gfx_asset_decoder_t d;
+    std::vector<uint16_t> buf((size_t)f.w * f.h + 16);
+    CHECK(gfx_asset_open(&d, f.data, f.len));
+    CHECK_EQ(gfx_asset_decode(&d, buf.data(), buf.size()), (uint32_t)f.w * f.h);
+    CHECK_EQ(gfx_asset_decode(&d, buf.data(), buf.size()), 0);
+  }
+}
+
+static void test_truncated()
+{
+  // data cut anywhere decodes a correct prefix and stops, never reads past len
+  for (const fixture_t &f : fixtures)
+  {
+    std::vector<uint16_t> ref = expected(f);
+    for (uint32_t len = 8; len < f.len; len += 13)
+    {
+      std::vector<uint8_t> cut(f.data, f.data + len);
+      std::vector<uint16_t> px = decode(cut.data(), len, 37);
+      CHECK(px.size() <= ref.size());
+      if (!std::equal(px.begin(), px.end(), ref.begin()))
+      {
+        printf("  %s: cut at %u decodes a wrong prefix\n", f.name, len);
+        ++host_test_failures;
+        break;
+      }
+    }
+  }
+}
+
+static void check_draw(Arduino_GFX *g, Arduino_RecordingBus &bus, const fixture_t &f, int16_t x, int16_t y)
+{
+  Arduino_RecordingBus refBus;
+  Arduino_ST7789 ref(&refBus, GFX_NOT_DEFINED, g->getRotation(), true);
+  ref.begin();
+  std::vector<uint16_t> px = expected(f);
+  ref.fillScreen(RGB565_DARKGREY);
+  ref.draw16bitRGBBitmap(x, y, px.data(), f.w, f.h);
+
+  g->fillScreen(RGB565_DARKGREY);
+  g->drawAsset(x, y, f.data, f.len);
+  g->flush();
+
+  bool same = true;
+  for (int16_t j = 0; j < bus.gramHeight(); ++j)
+  {
+    for (int16_t i = 0; i < bus.gramWidth(); ++i)
+    {
+      same &= bus.pixel(i, j) == refBus.pixel(i, j);
+    }
+  }
+  if (!same)
+  {
+    printf("  %s at %d,%d differs from draw16bitRGBBitmap()\n", f.name, x, y);
+    ++host_test_failures;
+  }
+}
+
+static void test_draw_asset()
+{
+  for (const fixture_t &f : fixtures)
+  {
+    Arduino_RecordingBus bus;
+    Arduino_ST7789 tft(&bus, GFX_NOT_DEFINED, 0, true);
+    tft.begin();
+    check_draw(&tft, bus, f, 10, 20);
+    check_draw(&tft, bus, f, -7, -5);
+    check_draw(&tft, bus, f, 200, 300);
+
+    Arduino_Canvas canvas(240, 320, &tft);
+    canvas.begin(GFX_SKIP_OUTPUT_BEGIN);
+    check_draw(&canvas, bus, f, 10, 20);
+    check_draw(&canvas, bus, f, -7, -5);
+  }
+
+  // unclipped, Arduino_TFT streams the image through a single window
+  Arduino_RecordingBus bus;
+  Arduino_ST7789 tft(&bus, GFX_NOT_DEFINED, 0, true);
+  tft.begin();
+  bus.resetStats();
+  tft.drawAsset(10, 20, asset_smooth, sizeof(asset_smooth));
+  CHECK_EQ(bus.stats().ramwr, 1);
+  CHECK_EQ(bus.stats().pixels, 67 * 45);
+}
+
+static void test_decode_speed()
+{
+  // informational, printed for comparison between builds
+  std::vector<uint16_t> buf(GFX_ASSET_BUF_PIXELS);
+  for (const fixture_t &f : fixtures)
+  {
+    uint32_t pixels = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 200; ++i)
+    {
+      gfx_asset_decoder_t d;
+      gfx_asset_open(&d, f.data, f.len);
+      uint32_t n;
+      while ((n = gfx_asset_decode(&d, buf.data(), buf.size())))
+      {
+        pixels += n;
+      }
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf("  %-8s %5u bytes, %6.2f ns/pixel\n", f.name, f.len, ns / pixels);
+  }
+}
+
+int main()
+{
+  RUN_TEST(test_header);
+  RUN_TEST(test_decode);
+  RUN_TEST(test_truncated);
+  RUN_TEST(test_draw_asset);
+  RUN_TEST(test_empty_draw);
+  RUN_TEST(test_corrupt_palette);
+  RUN_TEST(test_decode_speed);
+  return host_test_result();
+}
@@ -0,0 +1,223 @@
+/*
+ * Arduino_ST7789::addDirtyRect() / flushDirtyRects(): which rectangles share
+ * an address window, that every dirty pixel reaches the frame memory with
+ * nothing but framebuffer pixels around it, and that the windows go out in
+ * the order the panel scans its rows in every rotation.
+ */
+#include <vector>
+
+#include "Arduino_GFX.h"
+#include "Arduino_RecordingBus.h"
+#include "display/Arduino_ST7789.h"
+
+#include "host_test.h"
+
+// records the first panel row of every window a RAMWR opens, in the model's
+// mapping: MV puts the window's columns on the panel rows, MY reverses them
+class ScanBus : public Arduino_RecordingBus
+{
+public:
+  std::vector<int32_t> firstRows;
+
+  void writeCommand(uint8_t c) override
+  {
+    Arduino_RecordingBus::writeCommand(c);
+    if (c == RECORDING_BUS_RAMWR)
+    {
+      bool mv = _madctl & RECORDING_BUS_MADCTL_MV;
+      int32_t first = mv ? _xs : _ys;
+      int32_t last = mv ? _xe : _ye;
+      firstRows.push_back((_madctl & RECORDING_BUS_MADCTL_MY) ? (_gramH - 1 - last) : first);
+    }
+  }
+};
+
+struct Rect
+{
+  int16_t x, y, w, h;
+};
+
+struct Panel
+{
+  ScanBus bus;
+  Arduino_ST7789 tft;
+  std::vector<uint16_t> fb;
+
+  Panel(uint8_t rotation) : tft(&bus, GFX_NOT_DEFINED, rotation, true)
+  {
+    tft.begin();
+    fb.resize((size_t)tft.width() * tft.height());
+    for (int16_t y = 0; y < tft.height(); ++y)
+    {
+      for (int16_t x = 0; x < tft.width(); ++x)
+      {
+        fb[(size_t)y * tft.width() + x] = (uint16_t)((x * 7 + y * 13) | 1); // never 0
+      }
+    }
+    bus.clearGram(0);
+    bus.resetStats();
+    bus.firstRows.clear();
+  }
+
+  void flush(const Rect *rects, size_t count)
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      tft.addDirtyRect(rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+    }
+    tft.flushDirtyRects(fb.data(), tft.width());
+  }
+};
+
+// every dirty pixel holds its framebuffer value, anything else sent along with
+// a merged window is a framebuffer pixel too, the rest is untouched
+static void check_frame(Panel &p, const Rect *rects, size_t count)
+{
+  Panel dirty(p.tft.getRotation());
+  Panel full(p.tft.getRotation());
+  for (size_t i = 0; i < count; ++i)
+  {
+    const Rect &r = rects[i];
+    for (int16_t y = max(r.y, (int16_t)0); (y < r.y + r.h) && (y < p.tft.height()); ++y)
+    {
+      for (int16_t x = max(r.x, (int16_t)0); (x < r.x + r.w) && (x < p.tft.width()); ++x)
+      {
+        dirty.tft.drawPixel(x, y, p.fb[(size_t)y * p.tft.width() + x]);
+      }
+    }
+  }
+  full.tft.draw16bitRGBBitmap(0, 0, full.fb.data(), full.tft.width(), full.tft.height());
+
+  int32_t n = (int32_t)p.bus.gramWidth() * p.bus.gramHeight();
+  int32_t wrong = 0;
+  for (int32_t i = 0; i < n; ++i)
+  {
+    uint16_t got = p.bus.gram()[i];
+    uint16_t want = dirty.bus.gram()[i];
+    if (want ? (got != want) : (got && (got != full.bus.gram()[i])))
+    {
+      ++wrong;
+    }
+  }
+  CHECK_EQ(wrong, 0);
+  CHECK_EQ(p.bus.stats().clipped, 0);
+}
+
+static void test_overlapping()
+{
+  Panel p(0);
+  const Rect rects[] = {
+      {10, 10, 40, 40},
+      {20, 20, 40, 40},  // overlaps the first, the union is smaller than both apart
+      {25, 25, 5, 5},    // inside
+      {-20, 15, 35, 30}, // clipped to the left edge, overlaps the union
+      {100, 100, 0, 10}, // empty
+  };
+  p.flush(rects, sizeof(rects) / sizeof(rects[0]));
+  CHECK_EQ(p.bus.commandCount(RECORDING_BUS_RAMWR), 1);
+  check_frame(p, rects, sizeof(rects) / sizeof(rects[0]));
+
+  // two rectangles too far apart to merge until a third bridges them
+  Panel q(0);
+  const Rect bridged[] = {
+      {0, 100, 60, 20},
+      {100, 100, 60, 20},
+      {50, 100, 60, 20},
+  };
+  q.flush(bridged, 2);
+  CHECK_EQ(q.bus.commandCount(RECORDING_BUS_RAMWR), 2);
+  q.bus.clearGram(0);
+  q.bus.resetStats();
+  q.flush(bridged, 3);
+  CHECK_EQ(q.bus.commandCount(RECORDING_BUS_RAMWR), 1);
+  CHECK_EQ(q.bus.stats().pixels, 160 * 20);
+  check_frame(q, bridged, 3);
+}
+
+static void test_adjacent()
+{
+  // sharing an edge: the union is exactly both, one window
+  Panel p(0);
+  const Rect stacked[] = {{0, 0, 100, 10}, {0, 10, 100, 10}};
+  p.flush(stacked, 2);
+  CHECK_EQ(p.bus.commandCount(RECORDING_BUS_RAMWR), 1);
+  CHECK_EQ(p.bus.stats().pixels, 2000);
+  check_frame(p, stacked, 2);
+
+  // side by side with a small gap in the union, within ST7789_RECT_MERGE_SLACK
+  Panel q(0);
+  const Rect side[] = {{0, 0, 10, 10}, {10, 0, 10, 20}};
+  q.flush(side, 2);
+  CHECK_EQ(q.bus.commandCount(RECORDING_BUS_RAMWR), 1);
+  CHECK_EQ(q.bus.stats().pixels, 400);
+  check_frame(q, side, 2);
+
+  // touching corners of large rectangles, the union would cost more than a window
+  Panel r(0);
+  const Rect corner[] = {{0, 0, 50, 50}, {50, 50, 50, 50}};
+  r.flush(corner, 2);
+  CHECK_EQ(r.bus.commandCount(RECORDING_BUS_RAMWR), 2);
+  CHECK_EQ(r.bus.stats().pixels, 5000);
+  check_frame(r, corner, 2);
+}
+
+static void test_overflow()
+{
+  // more disjoint rectangles than the queue holds
+  Panel p(0);
+  Rect rects[3 * 5];
+  size_t count = 0;
+  for (int16_t row = 0; row < 5; ++row)
+  {
+    for (int16_t col = 0; col < 3; ++col)
+    {
+      rects[count++] = {(int16_t)(col * 80 + 5), (int16_t)(row * 60 + 5), 6, 6};
+    }
+  }
+  p.flush(rects, count);
+  CHECK(p.bus.commandCount(RECORDING_BUS_RAMWR) <= ST7789_DIRTY_RECTS);
+  CHECK(p.bus.commandCount(RECORDING_BUS_RAMWR) > 1);
+  check_frame(p, rects, count);
+
+  // the queue is empty after a flush
+  p.bus.resetStats();
+  p.tft.flushDirtyRects(p.fb.data(), p.tft.width());
+  CHECK_EQ(p.bus.stats().pixels, 0);
+}
+
+static void test_scan_order()
+{
+  // far apart in both axes, given in no particular order
+  const Rect rects[] = {
+      {150, 20, 10, 10},
+      {10, 200, 10, 10},
+      {200, 120, 10, 10},
+      {90, 70, 10, 10},
+      {40, 10, 10, 10},
+  };
+  for (uint8_t rotation = 0; rotation < 4; ++rotation)
+  {
+    Panel p(rotation);
+    p.flush(rects, sizeof(rects) / sizeof(rects[0]));
+    CHECK_EQ(p.bus.firstRows.size(), sizeof(rects) / sizeof(rects[0]));
+    for (size_t i = 1; i < p.bus.firstRows.size(); ++i)
+    {
+      if (p.bus.firstRows[i - 1] > p.bus.firstRows[i])
+      {
+        printf("  rotation %u: window %u starts on panel row %d, before window %u on %d\n", rotation,
+               (unsigned)i, p.bus.firstRows[i], (unsigned)(i - 1), p.bus.firstRows[i - 1]);
+        ++host_test_failures;
+      }
+    }
+    check_frame(p, rects, sizeof(rects) / sizeof(rects[0]));
+  }
+}
+
+int main()
+{
+  RUN_TEST(test_overlapping);
+  RUN_TEST(test_adjacent);
+  RUN_TEST(test_overflow);
+  RUN_TEST(test_scan_order);
+  return host_test_result();
+}
@@ -0,0 +1,1084 @@
+/*
+ * Golden image tests: scenes are drawn on an Arduino_ST7789 over
+ * Arduino_RecordingBus and the panel frame memory is compared against a
+ * known hash. Canvases are checked against direct drawing, and the bus
+ * counters pin down what the driver sends for the simple cases.
+ *
+ * GFX_GOLDEN_UPDATE=1  print the current hashes as table entries instead of
+ *                      failing, paste them over golden[] after checking the
+ *                      images
+ * GFX_GOLDEN_DUMP=dir  write every golden scene to dir/<scene>_r<rotation>.ppm
+ */
+#include <stdlib.h>
+#include <utility>
+
+#include "Arduino_GFX.h"
+#include "Arduino_RecordingBus.h"
+#include "Arduino_TextLayout.h"
+#include "PixelConvert.h"
+#include "canvas/Arduino_Canvas.h"
+#include "canvas/Arduino_Canvas_DisplayList.h"
+#include "canvas/Arduino_Canvas_Indexed.h"
+#include "canvas/Arduino_Canvas_Tiled.h"
+#include "canvas/Arduino_Compositor.h"
+#include "canvas/Arduino_Sprite.h"
+#include "display/Arduino_ST7789.h"
+
+#include "FreeSansBold10pt7b.h"
+
+#include "host_test.h"
+
+struct Panel
+{
+  Arduino_RecordingBus bus;
+  Arduino_ST7789 tft;
+
+  Panel(uint8_t r = 0) : tft(&bus, GFX_NOT_DEFINED, r, true)
+  {
+    tft.begin();
+    bus.resetStats();
+  }
+};
+
+// number of differing frame memory pixels, the first one is printed
+static uint32_t gram_diff(Arduino_RecordingBus &a, Arduino_RecordingBus &b)
+{
+  uint32_t count = 0;
+  for (int16_t y = 0; y < a.gramHeight(); ++y)
+  {
+    for (int16_t x = 0; x < a.gramWidth(); ++x)
+    {
+      if (a.pixel(x, y) != b.pixel(x, y))
+      {
+        if (!count)
+        {
+          printf("  first difference at %d,%d: 0x%04x != 0x%04x\n", x, y, a.pixel(x, y), b.pixel(x, y));
+        }
+        ++count;
+      }
+    }
+  }
+  return count;
+}
+
+static uint8_t mono_bitmap[(48 / 8) * 24];
+static uint8_t gray_bitmap[40 * 30];
+static uint8_t mask_bitmap[(40 / 8) * 30];
+static uint8_t indexed_bitmap[32 * 20];
+static uint16_t palette[16];
+static uint16_t rgb_bitmap[50 * 36];
+static uint16_t be_bitmap[50 * 36];
+static uint8_t rgb24_bitmap[30 * 20 * 3];
+
+static void make_bitmaps()
+{
+  for (int i = 0; i < (int)sizeof(mono_bitmap); ++i)
+  {
+    mono_bitmap[i] = (uint8_t)(0xA5 ^ (i * 37));
+  }
+  for (int y = 0; y < 30; ++y)
+  {
+    for (int x = 0; x < 40; ++x)
+    {
+      gray_bitmap[y * 40 + x] = (uint8_t)(x * 6 + y * 2);
+    }
+  }
+  for (int i = 0; i < (int)sizeof(mask_bitmap); ++i)
+  {
+    mask_bitmap[i] = (i & 1) ? 0xF0 : 0x3C;
+  }
+  for (int i = 0; i < 16; ++i)
+  {
+    palette[i] = RGB565(i * 16, 255 - i * 16, (i * 64) & 0xFF);
+  }
+  for (int i = 0; i < (int)sizeof(indexed_bitmap); ++i)
+  {
+    indexed_bitmap[i] = (uint8_t)((i / 3) & 15);
+  }
+  for (int y = 0; y < 36; ++y)
+  {
+    for (int x = 0; x < 50; ++x)
+    {
+      uint16_t c = RGB565(x * 5, y * 7, (x ^ y) * 8);
+      rgb_bitmap[y * 50 + x] = c;
+      be_bitmap[y * 50 + x] = (uint16_t)((c >> 8) | (c << 8));
+    }
+  }
+  for (int i = 0; i < 30 * 20; ++i)
+  {
+    rgb24_bitmap[i * 3] = (uint8_t)(i * 3);
+    rgb24_bitmap[i * 3 + 1] = (uint8_t)(255 - i);
+    rgb24_bitmap[i * 3 + 2] = (uint8_t)(i * 7);
+  }
+}
+
+static void scene_primitives(Arduino_GFX *g)
+{
+  int16_t w = g->width();
+  int16_t h = g->height();
+  g->fillScreen(RGB565_BLACK);
+  for (int16_t i = 0; i < 20; ++i)
+  {
+    g->drawPixel(2 + i * 3, 2 + (i * 7) % 11, RGB565_WHITE);
+  }
+  for (int16_t x = 0; x < w; x += 24)
+  {
+    g->drawLine(0, h - 1, x, 16, RGB565_BLUE);
+  }
+  g->drawLine(w - 1, 0, 0, h / 3, RGB565_YELLOW);
+  g->drawFastHLine(-5, 20, w / 2, RGB565_RED);
+  g->drawFastVLine(w - 3, -4, h / 2, RGB565_GREEN);
+  g->drawRect(10, 30, 60, 40, RGB565_CYAN);
+  g->fillRect(14, 34, 52, 32, RGB565_NAVY);
+  g->fillRect(w - 20, h - 20, 40, 40, RGB565_ORANGE);
+  g->drawRoundRect(80, 30, 70, 44, 9, RGB565_MAGENTA);
+  g->fillRoundRect(84, 34, 62, 36, 6, RGB565_DARKGREEN);
+  g->drawCircle(40, 110, 28, RGB565_WHITE);
+  g->fillCircle(40, 110, 20, RGB565_MAROON);
+  g->fillCircle(-6, 160, 14, RGB565_MAGENTA);
+  g->drawTriangle(90, 90, 150, 140, 70, 150, RGB565_GREENYELLOW);
+  g->fillTriangle(160, 90, 200, 100, 170, 150, RGB565_PURPLE);
+  g->drawEllipse(60, 190, 50, 20, RGB565_LIGHTGREY);
+  g->fillEllipse(60, 190, 30, 12, RGB565_OLIVE);
+  g->drawArc(160, 200, 40, 30, 20.0, 250.0, RGB565_RED);
+  g->fillArc(160, 200, 26, 10, 300.0, 45.0, RGB565_DARKCYAN);
+  g->fillArc(w - 10, 60, 30, 18, 200.0, 120.0, RGB565_ORANGE, RGB565_BLACK);
+}
+
+static void scene_text(Arduino_GFX *g)
+{
+  g->fillScreen(RGB565_BLACK);
+  g->setFont();
+  g->setTextWrap(true);
+  g->setCursor(0, 0);
+  g->setTextSize(1);
+  g->setTextColor(RGB565_WHITE, RGB565_BLACK);
+  g->println("Hello World! 0123456789");
+  g->setTextSize(2);
+  g->setTextColor(RGB565_RED);
+  g->print("RED ");
+  g->setTextColor(RGB565_GREEN);
+  g->print("GREEN ");
+  g->setTextColor(RGB565_BLUE);
+  g->println("BLUE");
+  g->setTextSize(3, 2);
+  g->setTextColor(RGB565_YELLOW, RGB565_NAVY);
+  g->println("Wide");
+  g->setTextSize(1);
+  g->setTextColor(RGB565_CYAN);
+  g->println("a line long enough to wrap around the right edge of the panel");
+  g->setFont(&FreeSansBold10pt7b);
+  g->setTextColor(RGB565_ORANGE);
+  g->setCursor(4, 150);
+  g->println("GFXfont gjpqy");
+  g->setTextSize(2);
+  g->setTextColor(RGB565_WHITE);
+  g->print("Big");
+  g->setFont();
+  g->setTextSize(1);
+}
+
+static void scene_bitmaps(Arduino_GFX *g)
+{
+  g->fillScreen(RGB565_DARKGREY);
+  g->drawBitmap(4, 4, mono_bitmap, 48, 24, RGB565_YELLOW);
+  g->drawBitmap(60, 4, mono_bitmap, 48, 24, RGB565_BLACK, RGB565_WHITE);
+  g->drawXBitmap(116, 4, mono_bitmap, 48, 24, RGB565_CYAN);
+  g->drawGrayscaleBitmap(4, 34, gray_bitmap, 40, 30);
+  g->drawGrayscaleBitmap(50, 34, gray_bitmap, mask_bitmap, 40, 30);
+  g->drawIndexedBitmap(96, 34, indexed_bitmap, palette, 32, 20);
+  g->draw16bitRGBBitmap(4, 70, rgb_bitmap, 50, 36);
+  g->draw16bitBeRGBBitmap(60, 70, be_bitmap, 50, 36);
+  g->draw16bitRGBBitmapWithMask(116, 70, rgb_bitmap, mask_bitmap, 40, 30);
+  g->draw16bitRGBBitmapWithTranColor(160, 70, rgb_bitmap, rgb_bitmap[0], 50, 36);
+  g->draw24bitRGBBitmap(4, 112, rgb24_bitmap, 30, 20);
+  // partly off every edge
+  g->draw16bitRGBBitmap(-20, 140, rgb_bitmap, 50, 36);
+  g->draw16bitRGBBitmap(g->width() - 30, 150, rgb_bitmap, 50, 36);
+  g->draw16bitRGBBitmap(100, -18, rgb_bitmap, 50, 36);
+  g->draw16bitRGBBitmap(100, g->height() - 16, rgb_bitmap, 50, 36);
+  g->drawGrayscaleBitmap(g->width() - 16, 200, gray_bitmap, 40, 30);
+}
+
+// asymmetric so a wrong rotation cannot look right
+static void scene_orientation(Arduino_GFX *g)
+{
+  g->fillScreen(RGB565_BLACK);
+  g->fillRect(0, 0, 30, 10, RGB565_RED);
+  g->fillRect(0, 0, 10, 50, RGB565_GREEN);
+  g->drawLine(0, 0, g->width() - 1, g->height() - 1, RGB565_WHITE);
+  g->setCursor(20, 20);
+  g->setTextSize(2);
+  g->setTextColor(RGB565_YELLOW);
+  g->print("Up");
+  g->setTextSize(1);
+}
+
+typedef void (*scene_fn)(Arduino_GFX *g);
+
+typedef struct
+{
+  const char *name;
+  scene_fn scene;
+  uint8_t rotation;
+  uint64_t hash;
+} golden_t;
+
+#define GOLDEN(scene, rotation, hash) {#scene, scene, rotation, hash}
+
+// regenerate with GFX_GOLDEN_UPDATE=1 after an intended rendering change
+static const golden_t golden[] = {
+    GOLDEN(scene_primitives, 0, 0x980c6cba36c9ae00ULL),
+    GOLDEN(scene_primitives, 1, 0x6e0148c294c2b80eULL),
+    GOLDEN(scene_text, 0, 0xcbe99b8daf4d586fULL),
+    GOLDEN(scene_text, 3, 0x5ff3fff49f18190fULL),
+    GOLDEN(scene_bitmaps, 0, 0x8ddafd4eef492b2fULL),
+    GOLDEN(scene_bitmaps, 2, 0x7fb86e452f3fb5afULL),
+    GOLDEN(scene_orientation, 0, 0xb49bf9117f690920ULL),
+    GOLDEN(scene_orientation, 1, 0x22101bd402a84cefULL),
+    GOLDEN(scene_orientation, 2, 0x9efd1bb140c96308ULL),
+    GOLDEN(scene_orientation, 3, 0xc39ea8f45a47565fULL),
+};
+
+static void test_golden_images()
+{
+  bool update = getenv("GFX_GOLDEN_UPDATE") != nullptr;
+  const char *dump = getenv("GFX_GOLDEN_DUMP");
+  for (const golden_t &gi : golden)
+  {
+    Panel p(gi.rotation);
+    gi.scene(&p.tft);
+    uint64_t h = p.bus.hash();
+    if (dump)
+    {
+      char path[512];
+      snprintf(path, sizeof(path), "%s/%s_r%d.ppm", dump, gi.name, gi.rotation);
+      CHECK(p.bus.savePPM(path));
+    }
+    if (update)
+    {
+      printf("    GOLDEN(%s, %d, 0x%016llxULL),\n", gi.name, gi.rotation, (unsigned long long)h);
+    }
+    else if (h != gi.hash)
+    {
+      printf("  %s rotation %d: hash 0x%016llx, expected 0x%016llx\n", gi.name, gi.rotation,
+             (unsigned long long)h, (unsigned long long)gi.hash);
+      ++host_test_failures;
+    }
+  }
+}
+
+// the same scene drawn directly and through a canvas must give the same panel
+static void check_canvas_matches(scene_fn scene, uint8_t rotation)
+{
+  Panel direct(rotation);
+  scene(&direct.tft);
+
+  Panel p(rotation);
+  Arduino_Canvas canvas(p.tft.width(), p.tft.height(), &p.tft);
+  CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+  scene(&canvas);
+  canvas.flush();
+  CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+}
+
+static void test_canvas_matches_direct()
+{
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    check_canvas_matches(scene_primitives, r);
+    check_canvas_matches(scene_orientation, r);
+  }
+  check_canvas_matches(scene_text, 0);
+  check_canvas_matches(scene_bitmaps, 0);
+}
+
+static void test_canvas_rotation()
+{
+  // a rotated canvas on an unrotated panel lands where a rotated panel draws
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    Panel direct(r);
+    scene_orientation(&direct.tft);
+
+    Panel p(0);
+    Arduino_Canvas canvas(p.tft.width(), p.tft.height(), &p.tft, 0, 0, r);
+    CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+    scene_orientation(&canvas);
+    canvas.flush();
+    CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+  }
+}
+
+// the scaled and rotated framebuffer pixel that flushTransformed() puts at x, y
+static uint16_t transformed_pixel(const uint16_t *fb, int16_t w, int16_t h, uint8_t scale, uint8_t rotation, int16_t x, int16_t y)
+{
+  int16_t n = (scale == GFX_SCALE_QUARTER) ? 4 : (scale == GFX_SCALE_HALF) ? 2 : 1;
+  int16_t sw = (scale == GFX_SCALE_2X) ? (w * 2) : (w / n);
+  int16_t sh = (scale == GFX_SCALE_2X) ? (h * 2) : (h / n);
+  int16_t sx = x, sy = y;
+  switch (rotation)
+  {
+  case 1:
+    sx = y;
+    sy = sh - 1 - x;
+    break;
+  case 2:
+    sx = sw - 1 - x;
+    sy = sh - 1 - y;
+    break;
+  case 3:
+    sx = sw - 1 - y;
+    sy = x;
+    break;
+  }
+  if (scale == GFX_SCALE_2X)
+  {
+    return fb[(sy >> 1) * w + (sx >> 1)];
+  }
+  uint32_t r = 0, g = 0, b = 0;
+  for (int16_t j = 0; j < n; ++j)
+  {
+    for (int16_t i = 0; i < n; ++i)
+    {
+      uint16_t c = fb[(sy * n + j) * w + sx * n + i];
+      r += c >> 11;
+      g += (c >> 5) & 0x3F;
+      b += c & 0x1F;
+    }
+  }
+  uint32_t d = n * n;
+  return (uint16_t)((((r + d / 2) / d) << 11) | (((g + d / 2) / d) << 5) | ((b + d / 2) / d));
+}
+
+static void test_canvas_transform()
+{
+  // drawn in the rotated panel's orientation and turned at flush, the panel
+  // gets what the rotated panel draws, in few address windows
+  for (uint8_t r = 1; r < 4; ++r)
+  {
+    Panel direct(r);
+    scene_primitives(&direct.tft);
+
+    Panel p(0);
+    Arduino_Canvas canvas(direct.tft.width(), direct.tft.height(), &p.tft);
+    CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+    scene_primitives(&canvas);
+    canvas.flushTransformed(GFX_SCALE_1, r);
+    CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+    int16_t rows = (GFX_CANVAS_TRANSFER_PIXELS / p.tft.width()) & ~1;
+    CHECK_EQ(p.bus.stats().ramwr, (p.tft.height() + rows - 1) / rows);
+  }
+
+  // every scale and rotation against the per pixel formula, odd sizes take
+  // the unaligned paths
+  const int16_t sizes[][2] = {{64, 48}, {37, 23}, {6, 5}};
+  const uint8_t scales[] = {GFX_SCALE_QUARTER, GFX_SCALE_HALF, GFX_SCALE_1, GFX_SCALE_2X};
+  for (const int16_t *size : sizes)
+  {
+    for (uint8_t scale : scales)
+    {
+      for (uint8_t r = 0; r < 4; ++r)
+      {
+        Panel p;
+        p.tft.fillScreen(RGB565_NAVY);
+        Arduino_Canvas canvas(size[0], size[1], &p.tft, 11, 7);
+        CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+        uint16_t *fb = canvas.getFramebuffer();
+        for (int32_t i = 0; i < size[0] * size[1]; ++i)
+        {
+          fb[i] = (uint16_t)(i * 2654435761u >> 13);
+        }
+        canvas.flushTransformed(scale, r);
+
+        int16_t n = (scale == GFX_SCALE_QUARTER) ? 4 : (scale == GFX_SCALE_HALF) ? 2 : 1;
+        int16_t dw = (scale == GFX_SCALE_2X) ? (size[0] * 2) : (size[0] / n);
+        int16_t dh = (scale == GFX_SCALE_2X) ? (size[1] * 2) : (size[1] / n);
+        if (r & 1)
+        {
+          std::swap(dw, dh);
+        }
+        uint32_t wrong = 0;
+        for (int16_t y = 0; y < dh; ++y)
+        {
+          for (int16_t x = 0; x < dw; ++x)
+          {
+            wrong += p.bus.pixel(11 + x, 7 + y) != transformed_pixel(fb, size[0], size[1], scale, r, x, y);
+          }
+        }
+        CHECK_EQ(p.bus.pixel(11 + dw, 7), RGB565_NAVY);
+        CHECK_EQ(p.bus.pixel(11, 7 + dh), RGB565_NAVY);
+        if (wrong)
+        {
+          printf("  %dx%d scale %d rotation %d: %u wrong pixels\n", size[0], size[1], scale, r, wrong);
+          ++host_test_failures;
+        }
+      }
+    }
+  }
+
+  // flushQuad() sends bands, not one window per row
+  Panel p;
+  Arduino_Canvas canvas(240, 320, &p.tft);
+  CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+  canvas.fillScreen(RGB565_WHITE);
+  p.bus.resetStats();
+  canvas.flushQuad();
+  CHECK_EQ(p.bus.stats().pixels, 120 * 160);
+  int16_t rows = (GFX_CANVAS_TRANSFER_PIXELS / 120) & ~1;
+  CHECK_EQ(p.bus.stats().ramwr, (160 + rows - 1) / rows);
+  CHECK_EQ(p.bus.pixel(119, 159), RGB565_WHITE);
+  CHECK_EQ(p.bus.pixel(120, 159), 0);
+  CHECK_EQ(p.bus.pixel(119, 160), 0);
+}
+
+static void test_tiled_canvas()
+{
+  Panel direct;
+  scene_primitives(&direct.tft);
+  direct.tft.fillRect(100, 100, 10, 10, RGB565_WHITE);
+
+  Panel p;
+  Arduino_Canvas_Tiled canvas(p.tft.width(), p.tft.height(), &p.tft);
+  CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+  scene_primitives(&canvas);
+  canvas.flush();
+  CHECK_EQ(canvas.lastFlushPixels(), (uint32_t)p.tft.width() * p.tft.height());
+
+  p.bus.resetStats();
+  canvas.fillRect(100, 100, 10, 10, RGB565_WHITE);
+  canvas.flush();
+  CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+  // one 16x16 tile, as the rectangle sits inside it
+  CHECK_EQ(canvas.lastFlushPixels(), CANVAS_TILE_SIZE * CANVAS_TILE_SIZE);
+  CHECK_EQ(p.bus.stats().pixels, CANVAS_TILE_SIZE * CANVAS_TILE_SIZE);
+
+  p.bus.resetStats();
+  canvas.flush();
+  CHECK_EQ(p.bus.stats().pixels, 0);
+}
+
+static void test_display_list()
+{
+  Panel direct;
+  scene_primitives(&direct.tft);
+  scene_orientation(&direct.tft);
+
+  Panel p;
+  Arduino_Canvas_DisplayList dl(p.tft.width(), p.tft.height(), &p.tft);
+  CHECK(dl.begin(GFX_SKIP_OUTPUT_BEGIN));
+  scene_primitives(&dl);
+  scene_orientation(&dl);
+  dl.flush();
+  CHECK(!dl.overflowed());
+  CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+
+  // nothing changed, no band is sent again
+  p.bus.resetStats();
+  dl.flush();
+  CHECK_EQ(p.bus.stats().pixels, 0);
+}
+
+static void test_compositor()
+{
+  Panel direct;
+  direct.tft.fillScreen(RGB565_NAVY);
+  direct.tft.fillRect(50, 60, 40, 30, RGB565_RED);
+  direct.tft.drawRect(50, 60, 40, 30, RGB565_WHITE);
+  direct.tft.setCursor(54, 64);
+  direct.tft.setTextColor(RGB565_YELLOW);
+  direct.tft.print("Hi");
+
+  Panel p;
+  Arduino_Sprite sprite(40, 30);
+  CHECK(sprite.begin());
+  sprite.fillRect(0, 0, 40, 30, RGB565_RED);
+  sprite.drawRect(0, 0, 40, 30, RGB565_WHITE);
+  sprite.setCursor(4, 4);
+  sprite.setTextColor(RGB565_YELLOW);
+  sprite.print("Hi");
+  sprite.moveTo(50, 60);
+
+  Arduino_Compositor comp(&p.tft, p.tft.width(), p.tft.height());
+  CHECK(comp.begin(GFX_SKIP_OUTPUT_BEGIN));
+  comp.setBackgroundColor(RGB565_NAVY);
+  CHECK(comp.addSprite(&sprite));
+  comp.invalidateAll();
+  comp.update();
+  CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+
+  // moving the sprite sends only the area it left and entered
+  direct.tft.fillRect(50, 60, 40, 30, RGB565_NAVY);
+  direct.tft.fillRect(54, 60, 40, 30, RGB565_RED);
+  direct.tft.drawRect(54, 60, 40, 30, RGB565_WHITE);
+  direct.tft.setCursor(58, 64);
+  direct.tft.print("Hi");
+  p.bus.resetStats();
+  sprite.moveTo(54, 60);
+  uint32_t sent = comp.update();
+  CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+  CHECK_EQ(p.bus.stats().pixels, sent);
+  CHECK_EQ(sent, 44 * 30);
+}
+
+// the window rules of the QSPI AMOLED controllers on a recording panel
+class EvenST7789 : public Arduino_ST7789
+{
+public:
+  EvenST7789(Arduino_DataBus *bus) : Arduino_ST7789(bus, GFX_NOT_DEFINED, 0, true) {}
+  uint8_t getWindowAlignment() override { return 2; }
+};
+
+static void test_compositor_alignment()
+{
+  Arduino_RecordingBus bus;
+  EvenST7789 tft(&bus);
+  tft.begin();
+  Arduino_Sprite sprite(21, 11);
+  CHECK(sprite.begin());
+  sprite.fillRect(0, 0, 21, 11, RGB565_RED);
+  sprite.moveTo(31, 41);
+
+  // at 1,1 on the panel, the odd compositor origin flips the rounding
+  Arduino_Compositor comp(&tft, 200, 200, 1, 1);
+  CHECK(comp.begin(GFX_SKIP_OUTPUT_BEGIN));
+  comp.setBackgroundColor(RGB565_NAVY);
+  CHECK(comp.addSprite(&sprite));
+  comp.update();
+  CHECK_EQ(bus.pixel(32, 42), RGB565_RED);
+  CHECK_EQ(bus.pixel(52, 52), RGB565_RED);
+  CHECK_EQ(bus.pixel(53, 53), RGB565_NAVY);
+
+  // left panel 32..52 x 42..52, entered 34..54: the window is 32..55 x 42..53
+  bus.resetStats();
+  sprite.moveTo(33, 41);
+  comp.update();
+  CHECK_EQ(bus.stats().pixels, 24 * 12);
+  CHECK_EQ(bus.pixel(33, 42), RGB565_NAVY);
+  CHECK_EQ(bus.pixel(54, 52), RGB565_RED);
+  CHECK_EQ(bus.pixel(55, 52), RGB565_NAVY);
+}
+
+static void test_text_layout()
+{
+  // a right aligned clock in the built-in font, every step matched by
+  // erasing and printing on a second panel
+  Panel direct, p;
+  direct.tft.setTextSize(2);
+  direct.tft.setTextColor(RGB565_WHITE);
+  p.tft.setTextSize(2);
+  Arduino_TextLayout clock(&p.tft, 200, 50, TEXT_ALIGN_RIGHT);
+  clock.setColor(RGB565_WHITE, RGB565_BLACK);
+  CHECK_EQ(clock.update("12:05"), 5);
+  CHECK_EQ(clock.getAdvance(), 5 * 12);
+  direct.tft.setCursor(140, 50);
+  direct.tft.print("12:05");
+  CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+
+  int16_t x1, y1;
+  uint16_t w, h;
+  clock.getTextBounds(&x1, &y1, &w, &h);
+  CHECK_EQ(x1, 140);
+  CHECK_EQ(y1, 50);
+  CHECK_EQ(w, 60);
+  CHECK_EQ(h, 16);
+
+  // one digit changes, one cell is sent
+  CHECK(!clock.setText("12:05"));
+  CHECK_EQ(clock.update(), 0);
+  p.bus.resetStats();
+  CHECK_EQ(clock.update("12:06"), 1);
+  CHECK(p.bus.stats().pixels >= 12 * 16);
+  CHECK(p.bus.stats().pixels < 2 * 12 * 16);
+  direct.tft.fillRect(188, 50, 12, 16, RGB565_BLACK);
+  direct.tft.setCursor(188, 50);
+  direct.tft.print("6");
+  CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+
+  // shorter text moves every glyph, the old ones are erased
+  CHECK_EQ(clock.update("9:59"), 4);
+  direct.tft.fillRect(140, 50, 60, 16, RGB565_BLACK);
+  direct.tft.setCursor(152, 50);
+  direct.tft.print("9:59");
+  CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+  CHECK_EQ(p.tft.getCursorX(), 0); // print() state is left alone
+
+  // a proportional font, centered: bounds match getTextBounds()
+  p.tft.setFont(&FreeSansBold10pt7b);
+  p.tft.setTextSize(1);
+  Arduino_TextLayout label(&p.tft, 120, 200, TEXT_ALIGN_CENTER);
+  label.setColor(RGB565_YELLOW, RGB565_BLACK);
+  CHECK(label.setText("Level 42"));
+  label.getTextBounds(&x1, &y1, &w, &h);
+  int16_t gx1, gy1;
+  uint16_t gw, gh;
+  p.tft.getTextBounds("Level 42", 120 - label.getAdvance() / 2, 200, &gx1, &gy1, &gw, &gh);
+  CHECK_EQ(x1, gx1);
+  CHECK_EQ(y1, gy1);
+  CHECK_EQ(w, gw);
+  CHECK_EQ(h, gh);
+  label.draw();
+  CHECK_EQ(label.update("Level 43"), 1);
+  // the font change of the clock's display is picked up with a full redraw
+  CHECK_EQ(clock.update(), 4);
+}
+
+static void test_wire_fill_rect()
+{
+  Panel p;
+  p.tft.fillRect(10, 20, 50, 40, RGB565_RED);
+  const recording_bus_stats_t &s = p.bus.stats();
+  CHECK_EQ(s.caset, 1);
+  CHECK_EQ(s.raset, 1);
+  CHECK_EQ(s.ramwr, 1);
+  CHECK_EQ(s.commands, 3);
+  CHECK_EQ(s.pixels, 50 * 40);
+  CHECK_EQ(s.dataBytes, 4 + 4 + 50 * 40 * 2);
+  CHECK_EQ(s.clipped, 0);
+  CHECK_EQ(p.bus.pixel(10, 20), RGB565_RED);
+  CHECK_EQ(p.bus.pixel(59, 59), RGB565_RED);
+  CHECK_EQ(p.bus.pixel(60, 59), RGB565_BLACK);
+  CHECK_EQ(p.bus.pixel(9, 20), RGB565_BLACK);
+
+  // same columns, the driver skips CASET
+  p.bus.resetStats();
+  p.tft.fillRect(10, 100, 50, 10, RGB565_GREEN);
+  CHECK_EQ(p.bus.stats().caset, 0);
+  CHECK_EQ(p.bus.stats().raset, 1);
+
+  // clipped to the panel before anything is sent
+  p.bus.resetStats();
+  p.tft.fillRect(-10, -10, 20, 20, RGB565_BLUE);
+  CHECK_EQ(p.bus.stats().pixels, 10 * 10);
+  CHECK_EQ(p.bus.stats().clipped, 0);
+
+  p.bus.resetStats();
+  p.tft.fillScreen(RGB565_WHITE);
+  CHECK_EQ(p.bus.stats().ramwr, 1);
+  CHECK_EQ(p.bus.stats().pixels, 240 * 320);
+}
+
+static void test_wire_bitmap()
+{
+  Panel p;
+  p.tft.draw16bitRGBBitmap(30, 40, rgb_bitmap, 50, 36);
+  CHECK_EQ(p.bus.stats().ramwr, 1);
+  CHECK_EQ(p.bus.stats().pixels, 50 * 36);
+  bool same = true;
+  for (int16_t y = 0; y < 36; ++y)
+  {
+    for (int16_t x = 0; x < 50; ++x)
+    {
+      same &= p.bus.pixel(30 + x, 40 + y) == rgb_bitmap[y * 50 + x];
+    }
+  }
+  CHECK(same);
+}
+
+static void test_arc()
+{
+  // the sine table is within one of sin()
+  int32_t worst = 0;
+  for (int32_t a = -360 * GFX_ANGLE_SCALE; a <= 720 * GFX_ANGLE_SCALE; a += 7)
+  {
+    int32_t ref = (int32_t)lround(16384.0 * sin(a * M_PI / (180.0 * GFX_ANGLE_SCALE)));
+    worst = max(worst, abs(gfx_sin_q14(a) - ref));
+  }
+  CHECK(worst <= 1);
+
+  // a ring keeps the pixels with (r2 - 1)^2 + r2 - 1 <= d^2 < r1^2 + r1, one span per row and side
+  Panel p;
+  p.tft.fillArc(120, 160, 50, 40, 0.0, 360.0, RGB565_WHITE);
+  uint32_t lit = 0;
+  bool same = true;
+  for (int32_t y = -52; y <= 52; ++y)
+  {
+    for (int32_t x = -52; x <= 52; ++x)
+    {
+      int32_t d2 = x * x + y * y;
+      bool in = (d2 >= 39 * 39 + 39) && (d2 < 50 * 50 + 50);
+      same &= (p.bus.pixel(120 + x, 160 + y) == RGB565_WHITE) == in;
+      lit += in;
+    }
+  }
+  CHECK(same);
+  CHECK_EQ(p.bus.stats().pixels, lit);
+  CHECK(p.bus.stats().ramwr <= 2 * 101);
+
+  // anti-aliased: only pixels of the aliased arc are fully covered, the edges are blended
+  Panel aliased;
+  Panel aa;
+  aliased.tft.fillScreen(RGB565_NAVY);
+  aliased.tft.fillArc(120, 160, 50, 30, 30.0, 300.0, RGB565_ORANGE);
+  aa.tft.fillScreen(RGB565_NAVY);
+  aa.tft.fillArc(120, 160, 50, 30, 30.0, 300.0, RGB565_ORANGE, RGB565_NAVY);
+  uint32_t blended = 0;
+  same = true;
+  for (int16_t y = 100; y < 220; ++y)
+  {
+    for (int16_t x = 60; x < 180; ++x)
+    {
+      uint16_t c = aa.bus.pixel(x, y);
+      if (c == RGB565_ORANGE)
+      {
+        same &= aliased.bus.pixel(x, y) == RGB565_ORANGE;
+      }
+      else if (c != RGB565_NAVY)
+      {
+        ++blended;
+      }
+    }
+  }
+  CHECK(same);
+  CHECK(blended > 100);
+  CHECK_EQ(aa.bus.pixel(80, 160), RGB565_ORANGE);
+  CHECK_EQ(aa.bus.pixel(120, 160), RGB565_NAVY);
+}
+
+// one 4x4 glyph 'A' of 4 bit coverage, rows 0 5 10 15 / 15 15 15 15 / 8 0 0 8 / 0 0 0 0
+static uint8_t aa_font_bitmap[] = {0x05, 0xAF, 0xFF, 0xFF, 0x80, 0x08, 0x00, 0x00};
+static GFXglyph aa_font_glyph[] = {{0, 4, 4, 5, 0, -4}};
+static const GFXfont aa_font = {aa_font_bitmap, aa_font_glyph, 'A', 'A', 6};
+
+static uint16_t blended(uint16_t bg, uint16_t color, uint8_t cov)
+{
+  gfx_blend_rgb565_color(&bg, color, cov, 1);
+  return bg;
+}
+
+static void test_anti_alias()
+{
+  // a shallow line: every column has one or two lit pixels, the ends are solid
+  Panel p;
+  p.tft.fillScreen(RGB565_NAVY);
+  p.tft.drawLine(10, 20, 200, 90, RGB565_WHITE, RGB565_NAVY);
+  bool columns = true;
+  uint32_t partial = 0;
+  for (int16_t x = 10; x <= 200; ++x)
+  {
+    uint8_t lit = 0;
+    for (int16_t y = 15; y <= 95; ++y)
+    {
+      uint16_t c = p.bus.pixel(x, y);
+      lit += (c != RGB565_NAVY);
+      partial += (c != RGB565_NAVY) && (c != RGB565_WHITE);
+    }
+    columns &= (lit >= 1) && (lit <= 2);
+  }
+  CHECK(columns);
+  CHECK(partial > 100);
+  CHECK_EQ(p.bus.pixel(10, 20), RGB565_WHITE);
+  CHECK_EQ(p.bus.pixel(200, 90), RGB565_WHITE);
+
+  // a steep one on a canvas, blended with the framebuffer, matches the display
+  Panel direct;
+  Arduino_Canvas canvas(240, 320, &p.tft);
+  CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+  direct.tft.fillScreen(RGB565_NAVY);
+  direct.tft.drawLine(30, 300, 70, 10, RGB565_YELLOW, RGB565_NAVY);
+  direct.tft.fillCircle(160, 160, 40, RGB565_RED, RGB565_NAVY);
+  direct.tft.fillRoundRect(20, 200, 120, 60, 14, RGB565_GREEN, RGB565_NAVY);
+  canvas.fillScreen(RGB565_NAVY);
+  canvas.drawLine(30, 300, 70, 10, RGB565_YELLOW, RGB565_YELLOW);
+  canvas.fillCircle(160, 160, 40, RGB565_RED, RGB565_RED);
+  canvas.fillRoundRect(20, 200, 120, 60, 14, RGB565_GREEN, RGB565_GREEN);
+  canvas.flush();
+  CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+
+  // a filled circle is solid within r - 1 and blended only around r, the
+  // edges of each row go out as short windows next to one fill
+  Panel c;
+  c.tft.fillScreen(RGB565_BLACK);
+  c.bus.resetStats();
+  c.tft.fillCircle(120, 160, 40, RGB565_WHITE, RGB565_BLACK);
+  bool ring = true;
+  partial = 0;
+  for (int32_t y = -42; y <= 42; ++y)
+  {
+    for (int32_t x = -42; x <= 42; ++x)
+    {
+      int32_t d2 = x * x + y * y;
+      uint16_t px = c.bus.pixel(120 + x, 160 + y);
+      if (d2 <= 39 * 39)
+      {
+        ring &= px == RGB565_WHITE;
+      }
+      else if (d2 >= 41 * 41)
+      {
+        ring &= px == RGB565_BLACK;
+      }
+      else
+      {
+        partial += (px != RGB565_WHITE) && (px != RGB565_BLACK);
+      }
+    }
+  }
+  CHECK(ring);
+  CHECK(partial > 100);
+  CHECK(c.bus.stats().ramwr <= 5 * 83);
+
+  // round rect outline: straight edges solid, corners blended, inside untouched
+  Panel r;
+  r.tft.fillScreen(RGB565_BLACK);
+  r.tft.drawRoundRect(40, 40, 100, 60, 12, RGB565_WHITE, RGB565_BLACK);
+  CHECK_EQ(r.bus.pixel(90, 40), RGB565_WHITE);
+  CHECK_EQ(r.bus.pixel(40, 70), RGB565_WHITE);
+  CHECK_EQ(r.bus.pixel(139, 70), RGB565_WHITE);
+  CHECK_EQ(r.bus.pixel(90, 99), RGB565_WHITE);
+  CHECK_EQ(r.bus.pixel(90, 70), RGB565_BLACK);
+  CHECK_EQ(r.bus.pixel(40, 40), RGB565_BLACK);
+  uint16_t corner = r.bus.pixel(40 + 12 - 9, 40 + 12 - 9); // 45 degrees, d = 12.7
+  CHECK((corner != RGB565_WHITE) && (corner != RGB565_BLACK));
+
+  // 4 bpp font: each nibble is the coverage of its pixel
+  Panel t;
+  t.tft.fillScreen(RGB565_BLACK);
+  t.tft.setFont(&aa_font, 4);
+  t.tft.setTextColor(RGB565_WHITE, RGB565_BLACK);
+  t.tft.setCursor(20, 40);
+  t.tft.print("A");
+  CHECK_EQ(t.bus.pixel(20, 36), RGB565_BLACK);
+  CHECK_EQ(t.bus.pixel(21, 36), blended(RGB565_BLACK, RGB565_WHITE, 5 * 17));
+  CHECK_EQ(t.bus.pixel(22, 36), blended(RGB565_BLACK, RGB565_WHITE, 10 * 17));
+  CHECK_EQ(t.bus.pixel(23, 36), RGB565_WHITE);
+  CHECK_EQ(t.bus.pixel(21, 37), RGB565_WHITE);
+  CHECK_EQ(t.bus.pixel(20, 38), blended(RGB565_BLACK, RGB565_WHITE, 8 * 17));
+  CHECK_EQ(t.bus.pixel(21, 38), RGB565_BLACK);
+  CHECK_EQ(t.tft.getCursorX(), 25);
+
+  // on a canvas without a text background it blends with what is there
+  canvas.fillScreen(RGB565_NAVY);
+  canvas.setFont(&aa_font, 4);
+  canvas.setTextColor(RGB565_WHITE);
+  canvas.setCursor(20, 40);
+  canvas.print("A");
+  canvas.flush();
+  CHECK_EQ(p.bus.pixel(20, 36), RGB565_NAVY);
+  CHECK_EQ(p.bus.pixel(20, 38), blended(RGB565_NAVY, RGB565_WHITE, 8 * 17));
+  CHECK_EQ(p.bus.pixel(23, 36), RGB565_WHITE);
+
+  // smooth scaled text: solid where every sample is set, so inside the
+  // blocks of the aliased glyph, with blended edges
+  Panel blocks, smooth;
+  blocks.tft.setTextSize(3);
+  blocks.tft.setTextColor(RGB565_WHITE, RGB565_BLACK);
+  blocks.tft.setCursor(30, 30);
+  blocks.tft.print("Og");
+  smooth.tft.setTextSize(3);
+  smooth.tft.setTextAntiAlias(true);
+  smooth.tft.setTextColor(RGB565_WHITE, RGB565_BLACK);
+  smooth.tft.setCursor(30, 30);
+  smooth.tft.print("Og");
+  CHECK_EQ(smooth.tft.getCursorX(), blocks.tft.getCursorX());
+  bool inside = true;
+  uint32_t white = 0;
+  partial = 0;
+  for (int16_t y = 30; y < 30 + 24; ++y)
+  {
+    for (int16_t x = 30; x < 30 + 36; ++x)
+    {
+      uint16_t px = smooth.bus.pixel(x, y);
+      if (px == RGB565_WHITE)
+      {
+        inside &= blocks.bus.pixel(x, y) == RGB565_WHITE;
+        ++white;
+      }
+      else if (px != RGB565_BLACK)
+      {
+        ++partial;
+      }
+    }
+  }
+  CHECK(inside);
+  CHECK(white > 50);
+  CHECK(partial > 50);
+}
+
+// AA drawing blends through writeCoverageSpanPreclipped(), the tiles it
+// touches must reach the panel like those of any other primitive
+static void test_tiled_anti_alias()
+{
+  for (uint8_t rotation = 0; rotation < 2; ++rotation)
+  {
+    Panel direct(rotation);
+    Arduino_Canvas plain(240, 320, &direct.tft);
+    CHECK(plain.begin(GFX_SKIP_OUTPUT_BEGIN));
+    Panel p(rotation);
+    Arduino_Canvas_Tiled canvas(240, 320, &p.tft);
+    CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+    Arduino_Canvas *canvases[] = {&plain, &canvas};
+    for (Arduino_Canvas *g : canvases)
+    {
+      g->setRotation(rotation);
+      g->fillScreen(RGB565_NAVY);
+      g->flush();
+    }
+    CHECK_EQ(canvas.dirtyTileCount(), 0);
+
+    for (Arduino_Canvas *g : canvases)
+    {
+      g->drawLine(30, 200, 70, 10, RGB565_YELLOW, RGB565_YELLOW);
+      g->fillCircle(160, 160, 30, RGB565_RED, RGB565_RED);
+      g->drawRoundRect(20, 220, 100, 50, 12, RGB565_GREEN, RGB565_GREEN);
+      g->setFont(&aa_font, 4);
+      g->setTextColor(RGB565_WHITE);
+      g->setCursor(20, 40);
+      g->print("A");
+    }
+    CHECK(canvas.dirtyTileCount() > 0);
+    plain.flush();
+    canvas.flush();
+    CHECK(canvas.lastFlushPixels() > 0);
+    CHECK(canvas.lastFlushPixels() < 240 * 320 / 2);
+    CHECK_EQ(gram_diff(p.bus, direct.bus), 0);
+  }
+}
+
+// a miss takes the next free index and every later hit returns it, 200
+// colors in the reverse palette collide so some hits walk a probe chain
+static void test_indexed_color_lookup()
+{
+  Panel p;
+  Arduino_Canvas_Indexed canvas(16, 16, &p.tft);
+  CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+  for (uint16_t i = 0; i < 200; ++i)
+  {
+    CHECK_EQ(canvas.get_color_index(i * 307), i);
+  }
+  for (uint16_t i = 0; i < 200; ++i)
+  {
+    CHECK_EQ(canvas.get_color_index(i * 307), i);
+    CHECK_EQ(canvas.getColorIndex()[i], i * 307);
+  }
+  CHECK_EQ(canvas.get_color_index(RGB565_WHITE), 200);
+
+  for (uint16_t i = 0; i < 256; ++i)
+  {
+    canvas.drawPixel(i % 16, i / 16, (i % 201) * 307);
+  }
+  canvas.flush();
+  for (uint16_t i = 0; i < 256; ++i)
+  {
+    CHECK_EQ(p.bus.pixel(i % 16, i / 16), (i % 201) * 307);
+  }
+}
+
+// the 256th color raises the mask, the framebuffer is remapped in one pass
+// and every pixel keeps its color as reduced by the coarser mask
+static void test_indexed_mask_raise()
+{
+  const uint16_t mask = 0b1111011110011110; // 12-bit mask level
+  Panel p;
+  Arduino_Canvas_Indexed canvas(16, 16, &p.tft);
+  CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+  for (uint16_t i = 0; i < 256; ++i)
+  {
+    canvas.drawPixel(i % 16, i / 16, i);
+  }
+  canvas.flush();
+  for (uint16_t i = 0; i < 256; ++i)
+  {
+    CHECK_EQ(p.bus.pixel(i % 16, i / 16), i & mask);
+  }
+  // colors 0..255 merge into 32 entries, new colors follow them
+  CHECK_EQ(canvas.get_color_index(RGB565_WHITE), 32);
+  CHECK_EQ(canvas.getColorIndex()[32], RGB565_WHITE & mask);
+  CHECK_EQ(canvas.get_color_index(0x00FF), canvas.get_color_index(0x00FE));
+}
+
+// exact palette colors map to their entry, others to the nearest entry,
+// and neither extends the palette or raises the mask
+static void test_indexed_fixed_palette()
+{
+  const uint16_t palette[] = {RGB565_BLACK, RGB565_WHITE, RGB565_RED, RGB565_GREEN, RGB565_BLUE, RGB565_RED};
+  Panel p;
+  Arduino_Canvas_Indexed canvas(16, 16, &p.tft);
+  CHECK(canvas.begin(GFX_SKIP_OUTPUT_BEGIN));
+  CHECK(canvas.setFixedPalette(palette, 6));
+  for (uint8_t i = 0; i < 5; ++i) // the first of duplicated colors wins
+  {
+    CHECK_EQ(canvas.get_color_index(palette[i]), i);
+  }
+  CHECK_EQ(canvas.get_color_index(RGB565(230, 20, 10)), 2);
+  CHECK_EQ(canvas.get_color_index(RGB565(200, 200, 210)), 1);
+  CHECK_EQ(canvas.get_color_index(RGB565(20, 40, 160)), 4);
+  CHECK_EQ(canvas.get_color_index(RGB565(10, 20, 90)), 0);
+
+  for (uint16_t i = 0; i < 256; ++i)
+  {
+    canvas.drawPixel(i % 16, i / 16, i * 257);
+  }
+  canvas.raise_mask_level();
+  canvas.fillRect(0, 0, 4, 4, RGB565(230, 20, 10));
+  canvas.flush();
+  for (uint16_t i = 0; i < 256; ++i)
+  {
+    uint16_t c = p.bus.pixel(i % 16, i / 16);
+    if ((i % 16 < 4) && (i / 16 < 4))
+    {
+      CHECK_EQ(c, RGB565_RED);
+    }
+    else
+    {
+      CHECK(c == RGB565_BLACK || c == RGB565_WHITE || c == RGB565_RED || c == RGB565_GREEN || c == RGB565_BLUE);
+    }
+  }
+
+  // back to the adaptive palette, which starts empty
+  CHECK(canvas.setFixedPalette(NULL, 0));
+  CHECK_EQ(canvas.get_color_index(RGB565(230, 20, 10)), 0);
+  CHECK_EQ(canvas.getColorIndex()[0], RGB565(230, 20, 10));
+}
+
+static void test_rotation_origin()
+{
+  // where logical (0,0) ends up in frame memory for each MADCTL
+  const int16_t expect[4][2] = {{0, 0}, {239, 0}, {239, 319}, {0, 319}};
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    Panel p(r);
+    p.tft.drawPixel(0, 0, RGB565_RED);
+    p.tft.drawPixel(1, 0, RGB565_GREEN);
+    CHECK_EQ(p.bus.pixel(expect[r][0], expect[r][1]), RGB565_RED);
+    CHECK_EQ(p.tft.width(), (r & 1) ? 320 : 240);
+  }
+}
+
+static void test_begin_sequence()
+{
+  Arduino_RecordingBus bus;
+  Arduino_ST7789 tft(&bus, GFX_NOT_DEFINED, 1, true);
+  unsigned long before = host_delay_total();
+  CHECK(tft.begin());
+  CHECK_EQ(bus.commandCount(ST7789_SWRESET), 1);
+  CHECK_EQ(bus.commandCount(ST7789_SLPOUT), 1);
+  CHECK(bus.commandCount(ST7789_DISPON) >= 1);
+  CHECK(bus.inverted()); // IPS panel
+  CHECK_EQ(bus.madctl(), ST7789_MADCTL_MX | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
+  CHECK(host_delay_total() - before >= ST7789_RST_DELAY);
+}
+
+int main()
+{
+  make_bitmaps();
+  RUN_TEST(test_golden_images);
+  RUN_TEST(test_canvas_matches_direct);
+  RUN_TEST(test_canvas_rotation);
+  RUN_TEST(test_canvas_transform);
+  RUN_TEST(test_tiled_canvas);
+  RUN_TEST(test_display_list);
+  RUN_TEST(test_compositor);
+  RUN_TEST(test_compositor_alignment);
+  RUN_TEST(test_text_layout);
+  RUN_TEST(test_wire_fill_rect);
+  RUN_TEST(test_wire_bitmap);
+  RUN_TEST(test_arc);
+  RUN_TEST(test_anti_alias);
+  RUN_TEST(test_tiled_anti_alias);
+  RUN_TEST(test_indexed_color_lookup);
+  RUN_TEST(test_indexed_mask_raise);
+  RUN_TEST(test_indexed_fixed_palette);
+  RUN_TEST(test_rotation_origin);
+  RUN_TEST(test_begin_sequence);
+  return host_test_result();
+}
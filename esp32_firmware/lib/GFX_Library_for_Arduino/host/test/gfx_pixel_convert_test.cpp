@@ -0,0 +1,253 @@
+/*
+ * PixelConvert kernels against plain per pixel loops (color565(), a byte
+ * swap and the YCbCr2RGB.h tables), for every source and destination
+ * alignment and lengths around the word paths, including 0 and 1. Pixels
+ * past len must stay untouched.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "PixelConvert.h"
+#include "YCbCr2RGB.h"
+
+#include "host_test.h"
+
+#define GUARD 0xA5A5
+#define MAX_LEN 300
+
+static const uint32_t lens[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 63, 64, 65, 257};
+
+// word aligned storage, offsets are added in bytes
+static uint32_t src_store[(MAX_LEN * 3 + 16) / 4];
+static uint32_t src2_store[(MAX_LEN * 3 + 16) / 4];
+static uint32_t src3_store[(MAX_LEN * 3 + 16) / 4];
+static uint32_t src4_store[(MAX_LEN * 3 + 16) / 4];
+static uint32_t dst_store[(MAX_LEN * 2 + 16) / 4];
+static uint32_t dst2_store[(MAX_LEN * 2 + 16) / 4];
+static uint16_t ref[MAX_LEN];
+static uint16_t ref2[MAX_LEN];
+
+static uint8_t *at(uint32_t *store, uint32_t offset)
+{
+  return (uint8_t *)store + offset;
+}
+
+static void fill_random(uint32_t *store, size_t words, uint32_t seed)
+{
+  for (size_t i = 0; i < words; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    store[i] = seed ^ (seed >> 13);
+  }
+}
+
+static void fill_guard(uint32_t *store, size_t words)
+{
+  for (size_t i = 0; i < words; ++i)
+  {
+    store[i] = ((uint32_t)GUARD << 16) | GUARD;
+  }
+}
+
+// dst[0, len) matches ref and the pixels just before and after are guards
+static bool same(const char *what, const uint16_t *dst, const uint16_t *expect, uint32_t len, uint32_t src_off, uint32_t dst_off)
+{
+  bool ok = (dst[len] == GUARD) && ((dst_off == 0) || (dst[-1] == GUARD));
+  for (uint32_t i = 0; ok && (i < len); ++i)
+  {
+    ok = dst[i] == expect[i];
+  }
+  if (!ok)
+  {
+    printf("  %s: len %u, src +%u, dst +%u differs from the per pixel loop\n", what, len, src_off, dst_off);
+    ++host_test_failures;
+  }
+  return ok;
+}
+
+static uint16_t color565(uint8_t r, uint8_t g, uint8_t b)
+{
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+static void test_rgb888()
+{
+  fill_random(src_store, sizeof(src_store) / 4, 1);
+  for (uint32_t len : lens)
+  {
+    for (uint32_t src_off = 0; src_off < 4; ++src_off)
+    {
+      const uint8_t *src = at(src_store, src_off);
+      for (uint32_t i = 0; i < len; ++i)
+      {
+        ref[i] = color565(src[i * 3], src[i * 3 + 1], src[i * 3 + 2]);
+      }
+      for (uint32_t dst_off = 0; dst_off < 4; dst_off += 2)
+      {
+        fill_guard(dst_store, sizeof(dst_store) / 4);
+        uint16_t *dst = (uint16_t *)at(dst_store, dst_off);
+        gfx_rgb888_to_rgb565(dst, src, len);
+        if (!same("rgb888", dst, ref, len, src_off, dst_off))
+        {
+          return;
+        }
+      }
+    }
+  }
+}
+
+static void test_gray()
+{
+  fill_random(src_store, sizeof(src_store) / 4, 2);
+  for (uint32_t len : lens)
+  {
+    for (uint32_t src_off = 0; src_off < 4; ++src_off)
+    {
+      const uint8_t *src = at(src_store, src_off);
+      for (uint32_t i = 0; i < len; ++i)
+      {
+        ref[i] = color565(src[i], src[i], src[i]);
+      }
+      for (uint32_t dst_off = 0; dst_off < 4; dst_off += 2)
+      {
+        fill_guard(dst_store, sizeof(dst_store) / 4);
+        uint16_t *dst = (uint16_t *)at(dst_store, dst_off);
+        gfx_gray_to_rgb565(dst, src, len);
+        if (!same("gray", dst, ref, len, src_off, dst_off))
+        {
+          return;
+        }
+      }
+    }
+  }
+}
+
+static void test_swap_bytes()
+{
+  fill_random(src_store, sizeof(src_store) / 4, 3);
+  for (uint32_t len : lens)
+  {
+    for (uint32_t src_off = 0; src_off < 4; src_off += 2)
+    {
+      const uint16_t *src = (const uint16_t *)at(src_store, src_off);
+      for (uint32_t i = 0; i < len; ++i)
+      {
+        ref[i] = (uint16_t)((src[i] >> 8) | (src[i] << 8));
+      }
+      for (uint32_t dst_off = 0; dst_off < 4; dst_off += 2)
+      {
+        fill_guard(dst_store, sizeof(dst_store) / 4);
+        uint16_t *dst = (uint16_t *)at(dst_store, dst_off);
+        gfx_rgb565_swap_bytes(dst, src, len);
+        if (!same("swap", dst, ref, len, src_off, dst_off))
+        {
+          return;
+        }
+      }
+
+      // in place
+      fill_guard(dst_store, sizeof(dst_store) / 4);
+      uint16_t *buf = (uint16_t *)at(dst_store, src_off);
+      memcpy(buf, src, len * 2);
+      gfx_rgb565_swap_bytes(buf, buf, len);
+      if (!same("swap in place", buf, ref, len, src_off, src_off))
+      {
+        return;
+      }
+    }
+  }
+}
+
+static void ycbcr_ref(uint16_t *out, const uint8_t *y, const uint8_t *cb, const uint8_t *cr, uint32_t w, bool be)
+{
+  for (uint32_t i = 0; i < w; ++i)
+  {
+    uint8_t u = cb[i >> 1];
+    uint8_t v = cr[i >> 1];
+    int16_t r = CR2R16[v];
+    int16_t g = -CB2G16[u] - CR2G16[v];
+    int16_t b = CB2B16[u];
+    int16_t l = Y2I16[y[i]];
+    out[i] = be ? (CLIPRBE[l + r] | CLIPGBE[l + g] | CLIPBBE[l + b]) : (CLIPR[l + r] | CLIPG[l + g] | CLIPB[l + b]);
+  }
+}
+
+static void test_ycbcr(bool be)
+{
+  const char *name = be ? "ycbcr420 be" : "ycbcr420";
+  fill_random(src_store, sizeof(src_store) / 4, 4);
+  fill_random(src2_store, sizeof(src2_store) / 4, 5);
+  fill_random(src3_store, sizeof(src3_store) / 4, 6);
+  fill_random(src4_store, sizeof(src4_store) / 4, 7);
+  for (uint32_t len : lens)
+  {
+    uint16_t w = (uint16_t)(len & ~1u); // even widths only
+    for (uint32_t src_off = 0; src_off < 4; ++src_off)
+    {
+      const uint8_t *y = at(src_store, src_off);
+      const uint8_t *y2 = at(src2_store, (src_off + 1) & 3);
+      const uint8_t *cb = at(src3_store, (src_off + 2) & 3);
+      const uint8_t *cr = at(src4_store, (src_off + 3) & 3);
+      ycbcr_ref(ref, y, cb, cr, w, be);
+      ycbcr_ref(ref2, y2, cb, cr, w, be);
+      for (uint32_t dst_off = 0; dst_off < 4; dst_off += 2)
+      {
+        for (uint32_t dst2_off = 0; dst2_off < 4; dst2_off += 2)
+        {
+          fill_guard(dst_store, sizeof(dst_store) / 4);
+          fill_guard(dst2_store, sizeof(dst2_store) / 4);
+          uint16_t *dst = (uint16_t *)at(dst_store, dst_off);
+          uint16_t *dst2 = (uint16_t *)at(dst2_store, dst2_off);
+          if (be)
+          {
+            gfx_ycbcr420_to_rgb565be(dst, dst2, y, y2, cb, cr, w);
+          }
+          else
+          {
+            gfx_ycbcr420_to_rgb565(dst, dst2, y, y2, cb, cr, w);
+          }
+          if (!same(name, dst, ref, w, src_off, dst_off) || !same(name, dst2, ref2, w, src_off, dst2_off))
+          {
+            return;
+          }
+        }
+
+        // single trailing row
+        fill_guard(dst_store, sizeof(dst_store) / 4);
+        uint16_t *dst = (uint16_t *)at(dst_store, dst_off);
+        if (be)
+        {
+          gfx_ycbcr420_to_rgb565be(dst, nullptr, y, nullptr, cb, cr, w);
+        }
+        else
+        {
+          gfx_ycbcr420_to_rgb565(dst, nullptr, y, nullptr, cb, cr, w);
+        }
+        if (!same(name, dst, ref, w, src_off, dst_off))
+        {
+          return;
+        }
+      }
+    }
+  }
+}
+
+static void test_ycbcr_native()
+{
+  test_ycbcr(false);
+}
+
+static void test_ycbcr_be()
+{
+  test_ycbcr(true);
+}
+
+int main()
+{
+  RUN_TEST(test_rgb888);
+  RUN_TEST(test_gray);
+  RUN_TEST(test_swap_bytes);
+  RUN_TEST(test_ycbcr_native);
+  RUN_TEST(test_ycbcr_be);
+  return host_test_result();
+}
@@ -0,0 +1,271 @@
+/*
+ * Arduino_DisplayScheduler tests on a simulated clock: the buses take time
+ * per pixel like a DMA transfer, render callbacks take the time they are
+ * given, and run() is polled the way a sketch's loop() would.
+ */
+#include <vector>
+
+#include "Arduino_GFX.h"
+#include "Arduino_RecordingBus.h"
+#include "canvas/Arduino_Canvas.h"
+#include "canvas/Arduino_DisplayScheduler.h"
+#include "display/Arduino_ST7789.h"
+
+#include "host_test.h"
+
+static uint32_t clock_us = 0;
+
+// every look at the clock costs a little, so polling loops make progress
+class TestScheduler : public Arduino_DisplayScheduler
+{
+public:
+  uint32_t now() override
+  {
+    clock_us += 5;
+    return clock_us;
+  }
+
+  uint8_t sendingCount()
+  {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < _count; ++i)
+    {
+      n += _displays[i].sending;
+    }
+    return n;
+  }
+};
+
+// a bus whose last transfer stays on the wire for pixels / pixelsPerUs
+class SlowBus : public Arduino_RecordingBus
+{
+public:
+  uint32_t pixelsPerUs = 20;
+  uint32_t busyUntil = 0;
+  SlowBus *other = nullptr;
+  uint32_t overlaps = 0; // submits while the other bus was busy
+
+  bool busy()
+  {
+    return (int32_t)(busyUntil - clock_us) > 0;
+  }
+
+  uint32_t submitPixels(uint16_t *data, uint32_t len) override
+  {
+    if (other && other->busy())
+    {
+      ++overlaps;
+    }
+    uint32_t start = busy() ? busyUntil : clock_us;
+    busyUntil = start + len / pixelsPerUs;
+    return Arduino_RecordingBus::submitPixels(data, len);
+  }
+
+  bool fenceReached(uint32_t fence) override
+  {
+    return ((int32_t)(_fence - fence) > 0) || !busy();
+  }
+};
+
+struct Panel
+{
+  SlowBus bus;
+  Arduino_ST7789 tft;
+
+  Panel() : tft(&bus, GFX_NOT_DEFINED, 0, true)
+  {
+    tft.begin();
+    bus.resetStats();
+  }
+};
+
+typedef struct
+{
+  uint32_t costUs;
+  uint32_t frames;
+  uint16_t color;
+  std::vector<uint32_t> starts;
+} render_t;
+
+static void render(Arduino_GFX *gfx, void *arg)
+{
+  render_t *r = (render_t *)arg;
+  r->starts.push_back(clock_us);
+  r->color = (uint16_t)(0x1234 + r->frames * 0x0841);
+  gfx->fillScreen(r->color);
+  ++r->frames;
+  clock_us += r->costUs;
+}
+
+static void run_for(TestScheduler &s, uint32_t us)
+{
+  uint32_t end = clock_us + us;
+  while ((int32_t)(end - clock_us) > 0)
+  {
+    if (!s.run())
+    {
+      clock_us += 50;
+    }
+  }
+  s.finish();
+}
+
+// largest distance of a frame start from its slot on the period grid
+static uint32_t jitter(const render_t &r, uint32_t period)
+{
+  uint32_t worst = 0;
+  for (size_t i = 1; i < r.starts.size(); ++i)
+  {
+    uint32_t late = (r.starts[i] - r.starts[0]) % period;
+    worst = max(worst, min(late, period - late));
+  }
+  return worst;
+}
+
+static void test_two_buses()
+{
+  // a full screen primary and a companion panel on a slow bus: both keep
+  // their frame rates and the primary goes on while the companion sends
+  clock_us = 1000;
+  Panel a, b;
+  a.bus.other = &b.bus;
+  b.bus.other = &a.bus;
+  b.bus.pixelsPerUs = 2;
+  Arduino_Canvas primary(240, 320, &a.tft);
+  Arduino_Canvas status(240, 300, &b.tft, 0, 20);
+  CHECK(primary.begin(GFX_SKIP_OUTPUT_BEGIN));
+  CHECK(status.begin(GFX_SKIP_OUTPUT_BEGIN));
+
+  render_t rp = {2000, 0, 0, {}};
+  render_t rs = {1000, 0, 0, {}};
+  TestScheduler s;
+  int8_t ip = s.add(&primary, &a.tft, &a.bus, render, &rp, 30, 1);
+  int8_t is = s.add(&status, &b.tft, &b.bus, render, &rs, 10);
+  CHECK_EQ(ip, 0);
+  CHECK_EQ(is, 1);
+  run_for(s, 1000000);
+
+  CHECK(abs((int)rp.frames - 30) <= 1);
+  CHECK(abs((int)rs.frames - 10) <= 1);
+  CHECK_EQ(s.stats(ip)->dropped, 0);
+  CHECK_EQ(s.stats(ip)->frames, rp.frames);
+  CHECK(abs((int)s.stats(ip)->intervalUs - 33333) <= 200);
+  // render plus 76800 pixels at 20 per us
+  CHECK(s.stats(ip)->frameUs >= 2000 + 3840);
+  CHECK(s.stats(ip)->maxFrameUs >= s.stats(ip)->avgFrameUs);
+  CHECK(a.bus.overlaps + b.bus.overlaps > 0);
+
+  // one window per frame, the last frame is on the panels
+  CHECK_EQ(a.bus.stats().ramwr, rp.frames);
+  CHECK_EQ(a.bus.stats().pixels, rp.frames * 240 * 320);
+  CHECK_EQ(a.bus.pixel(239, 319), rp.color);
+  CHECK_EQ(b.bus.pixel(0, 20), rs.color);
+  CHECK_EQ(b.bus.pixel(239, 319), rs.color);
+  CHECK_EQ(b.bus.pixel(0, 19), 0);
+
+  CHECK(s.stats(5) == nullptr);
+  s.resetStats(ip);
+  CHECK_EQ(s.stats(ip)->frames, 0);
+}
+
+static uint32_t primary_jitter(uint8_t statusPriority)
+{
+  clock_us = 1000;
+  Panel a, b;
+  Arduino_Canvas primary(240, 320, &a.tft);
+  Arduino_Canvas status(120, 120, &b.tft);
+  primary.begin(GFX_SKIP_OUTPUT_BEGIN);
+  status.begin(GFX_SKIP_OUTPUT_BEGIN);
+
+  // 60 fps primary busy for 5 ms + 3.84 ms of every 16.7 ms, a 6 ms status render
+  render_t rp = {5000, 0, 0, {}};
+  render_t rs = {6000, 0, 0, {}};
+  TestScheduler s;
+  s.add(&status, &b.tft, &b.bus, render, &rs, 20, statusPriority);
+  int8_t ip = s.add(&primary, &a.tft, &a.bus, render, &rp, 60, 1);
+  run_for(s, 500000);
+
+  CHECK(rs.frames >= 5);
+  CHECK(abs((int)rp.frames - 30) <= 1);
+  if (statusPriority < 1)
+  {
+    CHECK_EQ(s.stats(ip)->dropped, 0);
+  }
+  return jitter(rp, 1000000 / 60);
+}
+
+static void test_priority()
+{
+  // the status panel only renders where it cannot push the primary's frames
+  CHECK(primary_jitter(0) <= 200);
+  // at the same priority it does, by up to one status render
+  CHECK(primary_jitter(1) > 1000);
+}
+
+static void test_bus_group()
+{
+  // two canvases on one bus take turns
+  clock_us = 1000;
+  Panel a;
+  Arduino_Canvas top(240, 160, &a.tft);
+  Arduino_Canvas bottom(240, 160, &a.tft, 0, 160);
+  top.begin(GFX_SKIP_OUTPUT_BEGIN);
+  bottom.begin(GFX_SKIP_OUTPUT_BEGIN);
+  render_t rt = {500, 0, 0, {}};
+  render_t rb = {500, 0, 0, {}};
+  TestScheduler s;
+  s.add(&top, &a.tft, &a.bus, render, &rt, 50);
+  s.add(&bottom, &a.tft, &a.bus, render, &rb, 50);
+  uint8_t most = 0;
+  uint32_t end = clock_us + 200000;
+  while ((int32_t)(end - clock_us) > 0)
+  {
+    if (!s.run())
+    {
+      clock_us += 50;
+    }
+    most = max(most, s.sendingCount());
+  }
+  s.finish();
+  CHECK_EQ(most, 1);
+  CHECK(rt.frames >= 9);
+  CHECK(rb.frames >= 9);
+  CHECK_EQ(a.bus.pixel(0, 0), rt.color);
+  CHECK_EQ(a.bus.pixel(239, 319), rb.color);
+}
+
+static void test_direct_and_requested()
+{
+  clock_us = 1000;
+  Panel a, b;
+  render_t rd = {300, 0, 0, {}};
+  render_t rq = {300, 0, 0, {}};
+  Arduino_Canvas clipped(100, 100, &b.tft, -20, 300);
+  clipped.begin(GFX_SKIP_OUTPUT_BEGIN);
+  TestScheduler s;
+  // drawn straight to the panel, done when render() returns
+  int8_t id = s.add(&a.tft, &a.bus, render, &rd, 25);
+  // on demand only, and a canvas that needs clipping goes through flush()
+  int8_t iq = s.add(&clipped, &b.tft, &b.bus, render, &rq, 0);
+  run_for(s, 200000);
+  CHECK(abs((int)rd.frames - 5) <= 1);
+  CHECK(s.stats(id)->frameUs >= 300);
+  CHECK(s.stats(id)->frameUs < 400);
+  CHECK_EQ(rq.frames, 0);
+
+  s.requestFrame(iq);
+  run_for(s, 1000);
+  CHECK_EQ(rq.frames, 1);
+  CHECK_EQ(b.bus.pixel(0, 300), rq.color);
+  CHECK_EQ(b.bus.pixel(79, 319), rq.color);
+  CHECK_EQ(a.bus.pixel(0, 0), rd.color);
+}
+
+int main()
+{
+  RUN_TEST(test_two_buses);
+  RUN_TEST(test_priority);
+  RUN_TEST(test_bus_group);
+  RUN_TEST(test_direct_and_requested);
+  return host_test_result();
+}
@@ -0,0 +1,51 @@
+/*
+ * Tiny check helpers shared by the host tests, no framework needed.
+ */
+#ifndef _HOST_TEST_H_
+#define _HOST_TEST_H_
+
+#include <stdio.h>
+
+static int host_test_failures = 0;
+
+#define CHECK(cond)                                                    \
+  do                                                                   \
+  {                                                                    \
+    if (!(cond))                                                       \
+    {                                                                  \
+      printf("  %s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+      ++host_test_failures;                                            \
+    }                                                                  \
+  } while (0)
+
+#define CHECK_EQ(a, b)                                                          \
+  do                                                                            \
+  {                                                                             \
+    long long _a = (long long)(a), _b = (long long)(b);                         \
+    if (_a != _b)                                                               \
+    {                                                                           \
+      printf("  %s:%d: %s == %s failed, %lld != %lld\n", __FILE__, __LINE__, #a, \
+             #b, _a, _b);                                                       \
+      ++host_test_failures;                                                     \
+    }                                                                           \
+  } while (0)
+
+#define RUN_TEST(fn)                                \
+  do                                                \
+  {                                                 \
+    int _before = host_test_failures;               \
+    fn();                                           \
+    printf("%s %s\n", (host_test_failures == _before) ? "ok  " : "FAIL", #fn); \
+  } while (0)
+
+static int host_test_result()
+{
+  if (host_test_failures)
+  {
+    printf("%d check(s) failed\n", host_test_failures);
+    return 1;
+  }
+  return 0;
+}
+
+#endif // _HOST_TEST_H_
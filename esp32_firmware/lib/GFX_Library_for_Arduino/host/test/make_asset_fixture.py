@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""Regenerate asset_fixture.h for gfx_asset_test.cpp.
+
+The images come from formulas that gfx_asset_test.cpp repeats in C, so the
+test can check every decoded pixel without storing the source images.
+"""
+
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, "..", "..", "tools"))
+sys.dont_write_bytecode = True
+
+import gfx_asset  # noqa: E402
+
+PALETTE = [0x0000, 0xFFFF, 0xF800, 0x07E0, 0x001F]
+
+
+def smooth(x, y):
+    if ((x >> 4) + (y >> 4)) % 3 == 0:
+        return 0x07E0
+    return gfx_asset.rgb565((x * 4) & 0xFF, (y * 4) & 0xFF, ((x + y) * 2) & 0xFF)
+
+
+def indexed(x, y):
+    if (x * y) % 7 == 3:
+        return PALETTE[4]
+    return PALETTE[((x >> 3) ^ (y // 5)) % 5]
+
+
+def noise(x, y):
+    v = (x * 7919 + y * 104729 + 12345) & 0xFFFFFFFF
+    v = (v * 1103515245 + 12345) & 0xFFFFFFFF
+    return (v >> 8) & 0xFFFF
+
+
+IMAGES = [
+    # name, formula, width, height, format
+    ("asset_smooth", smooth, 67, 45, "rgb565"),
+    ("asset_indexed", indexed, 90, 20, "palette"),
+    ("asset_noise", noise, 30, 17, "raw"),
+    ("asset_wide", smooth, 600, 4, "rgb565"),
+]
+
+
+def main():
+    path = os.path.join(HERE, "asset_fixture.h")
+    with open(path, "w") as f:
+        f.write("// made by make_asset_fixture.py, do not edit\n")
+        f.write("#pragma once\n")
+        for name, formula, w, h, fmt in IMAGES:
+            pixels = [formula(x, y) for y in range(h) for x in range(w)]
+            data = gfx_asset.encode(pixels, w, h, fmt)
+            if gfx_asset.decode(data) != (w, h, pixels):
+                sys.exit("%s: round trip mismatch" % name)
+            f.write("\n// %dx%d %s, %d bytes\n" % (w, h, fmt, len(data)))
+            f.write("const uint8_t %s[] PROGMEM = {\n" % name)
+            for i in range(0, len(data), 16):
+                f.write("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",\n")
+            f.write("};\n")
+    print("wrote %s" % path)
+
+
+if __name__ == "__main__":
+    main()
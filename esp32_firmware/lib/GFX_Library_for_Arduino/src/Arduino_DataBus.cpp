@@ -179,35 +179,49 @@ void Arduino_DataBus::writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uin
   }
 }
 
+#define YCBCR_CHUNK_PIXELS 64 // must be even, chroma is shared by pixel pairs
+
 void Arduino_DataBus::writeYCbCrPixels(uint8_t *yData, uint8_t *cbData, uint8_t *crData, uint16_t w, uint16_t h)
 {
-  w >>= 1;
-  for (int i = 0; i < h;)
+  // convert a slice of a row at a time and send it as big endian bytes
+  uint16_t buf[YCBCR_CHUNK_PIXELS];
+  uint16_t cols = w >> 1;
+  for (int i = 0; i < h; ++i)
   {
-    for (int j = 0; j < w; ++j)
+    uint16_t done = 0;
+    while (done < w)
     {
-      uint8_t cb = *cbData++;
-      uint8_t cr = *crData++;
-      int16_t r = CR2R16[cr];
-      int16_t g = -CB2G16[cb] - CR2G16[cr];
-      int16_t b = CB2B16[cb];
-      int16_t y = Y2I16[*yData++];
-      _data16.value = CLIPRBE[y + r] | CLIPGBE[y + g] | CLIPBBE[y + b];
-      write(_data16.lsb);
-      write(_data16.msb);
-      y = Y2I16[*yData++];
-      _data16.value = CLIPRBE[y + r] | CLIPGBE[y + g] | CLIPBBE[y + b];
-      write(_data16.lsb);
-      write(_data16.msb);
+      uint16_t len = min((uint16_t)(w - done), (uint16_t)YCBCR_CHUNK_PIXELS);
+      gfx_ycbcr420_to_rgb565be(buf, nullptr, yData + done, nullptr, cbData + (done >> 1), crData + (done >> 1), len);
+      writeBytes((uint8_t *)buf, len << 1);
+      done += len;
     }
-
-    if (++i & 1)
+    yData += w;
+    if (i & 1)
     {
-      // rollback CbCr data
-      cbData -= w;
-      crData -= w;
+      // both rows of the pair are sent, next CbCr row
+      cbData += cols;
+      crData += cols;
     }
   }
 }
 
+uint32_t Arduino_DataBus::submitPixels(uint16_t *data, uint32_t len)
+{
+  writePixels(data, len);
+  return ++_fence;
+}
+
+bool Arduino_DataBus::fenceReached(uint32_t fence)
+{
+  UNUSED(fence);
+  return true;
+}
+
+void Arduino_DataBus::waitFence(uint32_t fence)
+{
+  while (!fenceReached(fence))
+    ;
+}
+
 #endif // !defined(LITTLE_FOOT_PRINT)
@@ -8,6 +8,7 @@
 #include <Arduino.h>
 
 #include "YCbCr2RGB.h"
+#include "PixelConvert.h"
 
 #define GFX_SKIP_OUTPUT_BEGIN -2
 #define GFX_NOT_DEFINED -1
@@ -295,6 +296,15 @@ public:
   virtual void writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t len);
   virtual void writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uint32_t len);
   virtual void writeYCbCrPixels(uint8_t *yData, uint8_t *cbData, uint8_t *crData, uint16_t w, uint16_t h);
+
+  // Asynchronous pixel transfer: submitPixels() queues len pixels and returns a
+  // fence for them, data can be reused as soon as it returns. Buses without a
+  // DMA pipeline fall back to a blocking writePixels(), their fences are
+  // always reached.
+  virtual uint32_t submitPixels(uint16_t *data, uint32_t len);
+  virtual bool fenceReached(uint32_t fence);
+  virtual void waitFence(uint32_t fence);
+  uint32_t fence() { return _fence; }
 #else
   void batchOperation(const uint8_t *operations, size_t len);
 #endif // !defined(LITTLE_FOOT_PRINT)
@@ -302,6 +312,9 @@ public:
 protected:
   int32_t _speed;
   int8_t _dataMode;
+#if !defined(LITTLE_FOOT_PRINT)
+  uint32_t _fence = 0; // fence of the last submitted transfer
+#endif // !defined(LITTLE_FOOT_PRINT)
 };
 
 #endif // _ARDUINO_DATABUS_H_
@@ -18,6 +18,10 @@ public:
   virtual void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) = 0;
   virtual void draw24bitRGBBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h) = 0;
 
+  // address windows must start and end on multiples of this many pixels,
+  // senders of partial updates round their areas out to it
+  virtual uint8_t getWindowAlignment() { return 1; }
+
 protected:
   int16_t
       WIDTH,  ///< This is the 'raw' display width - never changes
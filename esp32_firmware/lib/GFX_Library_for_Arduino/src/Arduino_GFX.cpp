@@ -7,6 +7,7 @@
  */
 #include "Arduino_DataBus.h"
 #include "Arduino_GFX.h"
+#include "PixelConvert.h"
 #include "font/glcdfont.h"
 #include "float.h"
 #ifdef __AVR__
@@ -59,20 +60,43 @@ Arduino_GFX::Arduino_GFX(int16_t w, int16_t h) : Arduino_G(w, h)
   _height = HEIGHT;
   _max_x = _width - 1;  ///< x zero base bound
   _max_y = _height - 1; ///< y zero base bound
+  // subclasses that never call setRotation() still need a text bound
+  setTextBound(0, 0, _width, _height);
   _rotation = 0;
   cursor_y = cursor_x = 0;
   textsize_x = textsize_y = 1;
   text_pixel_margin = 0;
   textcolor = textbgcolor = 0xFFFF;
   wrap = true;
+  textAntiAlias = false;
 #if !defined(ATTINY_CORE)
   gfxFont = NULL;
+  gfxFontBpp = 1;
 #if defined(U8G2_FONT_SUPPORT)
   u8g2Font = NULL;
 #endif // defined(U8G2_FONT_SUPPORT)
 #endif // !defined(ATTINY_CORE)
 }
 
+/**************************************************************************/
+/*!
+  @brief  Release the u8g2 glyph cache and font indexes built by setFont()
+*/
+/**************************************************************************/
+Arduino_GFX::~Arduino_GFX()
+{
+#if defined(U8G2_FONT_SUPPORT)
+  free(_u8g2_cache);
+#if (U8G2_GLYPH_INDEX_FONTS > 0)
+  for (uint8_t i = 0; i < U8G2_GLYPH_INDEX_FONTS; ++i)
+  {
+    free(_u8g2_index[i].encodings);
+    free(_u8g2_index[i].offsets);
+  }
+#endif // (U8G2_GLYPH_INDEX_FONTS > 0)
+#endif // defined(U8G2_FONT_SUPPORT)
+}
+
 /**************************************************************************/
 /*!
   @brief  Write a line. Check straight or slash line and call corresponding function
@@ -419,6 +443,32 @@ void Arduino_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   endWrite();
 }
 
+/**************************************************************************/
+/*!
+  @brief  Draw an anti-aliased line
+  @param  x0      Start point x coordinate
+  @param  y0      Start point y coordinate
+  @param  x1      End point x coordinate
+  @param  y1      End point y coordinate
+  @param  color   16-bit 5-6-5 Color to draw with
+  @param  bg      16-bit 5-6-5 Color the edges are blended with
+*/
+/**************************************************************************/
+void Arduino_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                           uint16_t color, uint16_t bg)
+{
+  startWrite();
+  if ((x0 == x1) || (y0 == y1))
+  {
+    writeLine(x0, y0, x1, y1, color); // nothing to smooth
+  }
+  else
+  {
+    writeLineAAHelper(x0, y0, x1, y1, color, bg);
+  }
+  endWrite();
+}
+
 /**************************************************************************/
 /*!
   @brief  Draw a circle outline
@@ -436,6 +486,28 @@ void Arduino_GFX::drawCircle(int16_t x, int16_t y,
   endWrite();
 }
 
+/**************************************************************************/
+/*!
+  @brief  Draw an anti-aliased circle outline, one pixel wide
+  @param  x       Center-point x coordinate
+  @param  y       Center-point y coordinate
+  @param  r       Radius of circle
+  @param  color   16-bit 5-6-5 Color to draw with
+  @param  bg      16-bit 5-6-5 Color the edges are blended with
+*/
+/**************************************************************************/
+void Arduino_GFX::drawCircle(int16_t x, int16_t y,
+                             int16_t r, uint16_t color, uint16_t bg)
+{
+  if (r < 0)
+  {
+    return;
+  }
+  startWrite();
+  writeFillArcAAHelper(x, y, r, r, 0.0, 360.0, color, bg);
+  endWrite();
+}
+
 /**************************************************************************/
 /*!
   @brief  Quarter-ellipse drawer, used to do circles and roundrects
@@ -544,6 +616,28 @@ void Arduino_GFX::fillCircle(int16_t x, int16_t y,
   endWrite();
 }
 
+/**************************************************************************/
+/*!
+  @brief  Draw a circle with filled color and anti-aliased edges
+  @param  x       Center-point x coordinate
+  @param  y       Center-point y coordinate
+  @param  r       Radius of circle
+  @param  color   16-bit 5-6-5 Color to fill with
+  @param  bg      16-bit 5-6-5 Color the edges are blended with
+*/
+/**************************************************************************/
+void Arduino_GFX::fillCircle(int16_t x, int16_t y,
+                             int16_t r, uint16_t color, uint16_t bg)
+{
+  if (r < 0)
+  {
+    return;
+  }
+  startWrite();
+  writeFillArcAAHelper(x, y, r, 1, 0.0, 360.0, color, bg);
+  endWrite();
+}
+
 /**************************************************************************/
 /*!
   @brief  Quarter-circle drawer with fill, used for circles and roundrects
@@ -662,6 +756,267 @@ void Arduino_GFX::fillEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint
   endWrite();
 }
 
+#define GFX_ARC_ONE 16384 // 1.0 in gfx_sin_q14() units
+#define GFX_ARC_INF 0x7FFFFFF
+
+#define GFX_ARC_FULL 0  // whole ring
+#define GFX_ARC_WEDGE 1 // sweep up to 180 degrees, inside both edges
+#define GFX_ARC_EITHER 2 // sweep over 180 degrees, inside either edge
+
+// sin() for 0 to 90 degrees in 1 degree steps, Q14
+static const uint16_t gfx_sin_q14_table[91] PROGMEM = {
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384};
+
+int16_t gfx_sin_q14(int32_t angle)
+{
+  angle %= 360 * GFX_ANGLE_SCALE;
+  if (angle < 0)
+  {
+    angle += 360 * GFX_ANGLE_SCALE;
+  }
+  uint8_t quadrant = angle / (90 * GFX_ANGLE_SCALE);
+  angle -= quadrant * (90 * GFX_ANGLE_SCALE);
+  if (quadrant & 1)
+  {
+    angle = 90 * GFX_ANGLE_SCALE - angle;
+  }
+  // linear between table entries, off by at most one
+  uint8_t i = angle / GFX_ANGLE_SCALE;
+  int32_t v = pgm_read_word(&gfx_sin_q14_table[i]);
+  if (i < 90)
+  {
+    int32_t next = pgm_read_word(&gfx_sin_q14_table[i + 1]);
+    v += (((next - v) * (angle % GFX_ANGLE_SCALE)) + (GFX_ANGLE_SCALE / 2)) / GFX_ANGLE_SCALE;
+  }
+  return (quadrant & 2) ? -v : v;
+}
+
+/*
+An arc is a ring cut by its start and end edges. Both are half-planes through
+the center: points after the start direction s have s.x * y - s.y * x >= 0,
+points before the end direction e have e.y * x - e.x * y >= 0. A row of the
+ring is one or two x ranges found by stepping the squared radii from the row
+above, a row of each half-plane is one x range found with one division, so
+a row costs a few integer operations however many pixels it has.
+*/
+typedef struct
+{
+  int32_t sc, ss; // start direction, Q14
+  int32_t ec, es; // end direction, Q14
+  int32_t mc, ms; // direction halfway, Q14
+  int32_t margin; // how far pixels outside an edge still count, Q14
+  uint8_t mode;   // GFX_ARC_FULL, GFX_ARC_WEDGE or GFX_ARC_EITHER
+} gfx_arc_t;
+
+// start and end in degrees, 0 to 360
+static void gfx_arc_init(gfx_arc_t *a, float start, float end, int32_t margin)
+{
+  int32_t s = (int32_t)(start * GFX_ANGLE_SCALE + 0.5f);
+  int32_t e = (int32_t)(end * GFX_ANGLE_SCALE + 0.5f);
+  int32_t sweep = e - s;
+  if (sweep < 0)
+  {
+    sweep += 360 * GFX_ANGLE_SCALE;
+  }
+  int32_t m = s + (sweep / 2);
+  a->sc = gfx_sin_q14(s + 90 * GFX_ANGLE_SCALE);
+  a->ss = gfx_sin_q14(s);
+  a->ec = gfx_sin_q14(e + 90 * GFX_ANGLE_SCALE);
+  a->es = gfx_sin_q14(e);
+  a->mc = gfx_sin_q14(m + 90 * GFX_ANGLE_SCALE);
+  a->ms = gfx_sin_q14(m);
+  a->margin = margin;
+  if (sweep >= 360 * GFX_ANGLE_SCALE)
+  {
+    a->mode = GFX_ARC_FULL;
+  }
+  else if (sweep > 180 * GFX_ANGLE_SCALE)
+  {
+    a->mode = GFX_ARC_EITHER;
+  }
+  else
+  {
+    a->mode = GFX_ARC_WEDGE;
+  }
+}
+
+// n / d rounded down, d > 0
+static inline int32_t gfx_arc_floor_div(int32_t n, int32_t d)
+{
+  return (n >= 0) ? (n / d) : -((d - 1 - n) / d);
+}
+
+// x range of a * x <= b
+static void gfx_arc_half(int32_t a, int32_t b, int32_t *lo, int32_t *hi)
+{
+  if (a > 0)
+  {
+    *lo = -GFX_ARC_INF;
+    *hi = gfx_arc_floor_div(b, a);
+  }
+  else if (a < 0)
+  {
+    *lo = -gfx_arc_floor_div(b, -a);
+    *hi = GFX_ARC_INF;
+  }
+  else if (b >= 0)
+  {
+    *lo = -GFX_ARC_INF;
+    *hi = GFX_ARC_INF;
+  }
+  else
+  {
+    *lo = GFX_ARC_INF;
+    *hi = -GFX_ARC_INF;
+  }
+}
+
+// x ranges of row y between the edges, returns how many
+static uint8_t gfx_arc_sector(const gfx_arc_t *a, int32_t y, int32_t *lo, int32_t *hi)
+{
+  if (a->mode == GFX_ARC_FULL)
+  {
+    lo[0] = -GFX_ARC_INF;
+    hi[0] = GFX_ARC_INF;
+    return 1;
+  }
+  int32_t elo, ehi;
+  gfx_arc_half(a->ss, (a->sc * y) + a->margin, &lo[0], &hi[0]);
+  gfx_arc_half(-a->es, a->margin - (a->ec * y), &elo, &ehi);
+  if (a->mode == GFX_ARC_WEDGE)
+  {
+    // both edges meet behind the center too, keep the side of the arc
+    int32_t mlo, mhi;
+    gfx_arc_half(-a->mc, (a->ms * y) + a->margin, &mlo, &mhi);
+    lo[0] = max(lo[0], max(elo, mlo));
+    hi[0] = min(hi[0], min(ehi, mhi));
+    return 1;
+  }
+  // after start, or before end and not after start
+  gfx_arc_half(-a->ss, -((a->sc * y) + a->margin) - 1, &lo[1], &hi[1]);
+  lo[1] = max(lo[1], elo);
+  hi[1] = min(hi[1], ehi);
+  return 2;
+}
+
+// largest x >= 0 with x * x + y2 < r2, -1 if none, stepped from the x of the row above
+static inline int32_t gfx_arc_extent(int32_t x, int32_t y2, int32_t r2)
+{
+  while ((x >= 0) && ((x * x) + y2 >= r2))
+  {
+    --x;
+  }
+  while (((x + 1) * (x + 1)) + y2 < r2)
+  {
+    ++x;
+  }
+  return x;
+}
+
+// spans of row y relative to the center, xo and xi are the outer and inner
+// extents of the row, returns how many
+static uint8_t gfx_arc_row(const gfx_arc_t *a, int32_t y, int32_t xo, int32_t xi, int32_t *x0, int32_t *x1)
+{
+  if (xo < 0)
+  {
+    return 0;
+  }
+  int32_t rlo[2], rhi[2], slo[2], shi[2];
+  uint8_t rn = 1;
+  rlo[0] = -xo;
+  rhi[0] = xo;
+  if (xi >= 0)
+  {
+    rhi[0] = -xi - 1;
+    rlo[1] = xi + 1;
+    rhi[1] = xo;
+    rn = 2;
+  }
+  uint8_t sn = gfx_arc_sector(a, y, slo, shi);
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < rn; ++i)
+  {
+    for (uint8_t j = 0; j < sn; ++j)
+    {
+      int32_t l = max(rlo[i], slo[j]);
+      int32_t r = min(rhi[i], shi[j]);
+      if (l <= r)
+      {
+        x0[n] = l;
+        x1[n] = r;
+        ++n;
+      }
+    }
+  }
+  return n;
+}
+
+// 0 to 255 coverage of pixel x, y relative to the center, from its distance
+// to the nearest edge; edges of the ring are at oradius + 0.5 and
+// iradius - 0.5, with R - d taken as (R * R - d * d) / 2R
+static uint8_t gfx_arc_coverage(const gfx_arc_t *a, int32_t x, int32_t y, int32_t oradius, int32_t iradius)
+{
+  int32_t d2 = (x * x) + (y * y);
+  int32_t c = 256;
+  if (d2 > oradius * oradius)
+  {
+    int32_t od = 2 * oradius + 1;
+    c = 128 + (int32_t)(((int64_t)od * od - 4 * (int64_t)d2) * 64 / od);
+  }
+  if ((iradius > 1) && (d2 < iradius * iradius))
+  {
+    int32_t id = 2 * iradius - 1;
+    c = min(c, 128 + (int32_t)((4 * (int64_t)d2 - (int64_t)id * id) * 64 / id));
+  }
+  if (a->mode != GFX_ARC_FULL)
+  {
+    // distance to an edge in Q14 is 64 times the coverage units
+    int32_t cs = 128 + ((a->sc * y) - (a->ss * x)) / 64;
+    int32_t ce = 128 + ((a->es * x) - (a->ec * y)) / 64;
+    c = min(c, (a->mode == GFX_ARC_WEDGE) ? min(cs, ce) : max(cs, ce));
+  }
+  return (c <= 0) ? 0 : ((c >= 255) ? 255 : c);
+}
+
+// clamp the radii and bring the angles to 0-360, equal angles of a
+// different turn make a full ring
+static void gfx_arc_prepare(int16_t *r1, int16_t *r2, float *start, float *end)
+{
+  if (*r1 < *r2)
+  {
+    _swap_int16_t(*r1, *r2);
+  }
+  if (*r1 < 1)
+  {
+    *r1 = 1;
+  }
+  if (*r2 < 1)
+  {
+    *r2 = 1;
+  }
+  bool equal = fabsf(*start - *end) < FLT_EPSILON;
+  *start = fmodf(*start, 360);
+  *end = fmodf(*end, 360);
+  if (*start < 0)
+    *start += 360.0;
+  if (*end < 0)
+    *end += 360.0;
+  if (!equal && (fabsf(*start - *end) <= 0.0001))
+  {
+    *start = .0;
+    *end = 360.0;
+  }
+}
+
 /**************************************************************************/
 /*!
   @brief  Draw an arc outline
@@ -723,30 +1078,7 @@ void Arduino_GFX::drawArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float st
 /**************************************************************************/
 void Arduino_GFX::fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color)
 {
-  if (r1 < r2)
-  {
-    _swap_int16_t(r1, r2);
-  }
-  if (r1 < 1)
-  {
-    r1 = 1;
-  }
-  if (r2 < 1)
-  {
-    r2 = 1;
-  }
-  bool equal = fabsf(start - end) < FLT_EPSILON;
-  start = fmodf(start, 360);
-  end = fmodf(end, 360);
-  if (start < 0)
-    start += 360.0;
-  if (end < 0)
-    end += 360.0;
-  if (!equal && (fabsf(start - end) <= 0.0001))
-  {
-    start = .0;
-    end = 360.0;
-  }
+  gfx_arc_prepare(&r1, &r2, &start, &end);
 
   startWrite();
   writeFillArcHelper(x, y, r1, r2, start, end, color);
@@ -755,124 +1087,283 @@ void Arduino_GFX::fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float st
 
 /**************************************************************************/
 /*!
-  @brief  Arc drawer with fill
+  @brief  Draw an arc with filled color and anti-aliased edges
+  @param  x       Center-point x coordinate
+  @param  y       Center-point y coordinate
+  @param  r1      Outer radius of arc
+  @param  r2      Inner radius of arc
+  @param  start   degree of arc start
+  @param  end     degree of arc end
+  @param  color   16-bit 5-6-5 Color to fill with
+  @param  bg      16-bit 5-6-5 Color the edges are blended with
+*/
+/**************************************************************************/
+void Arduino_GFX::fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color, uint16_t bg)
+{
+  gfx_arc_prepare(&r1, &r2, &start, &end);
+
+  startWrite();
+  writeFillArcAAHelper(x, y, r1, r2, start, end, color, bg);
+  endWrite();
+}
+
+/**************************************************************************/
+/*!
+  @brief  Arc drawer with fill, emits one span per run of pixels in a row
   @param  cx      Center-point x coordinate
   @param  cy      Center-point y coordinate
   @param  oradius Outer radius of arc
   @param  iradius Inner radius of arc
-  @param  start   degree of arc start
-  @param  end     degree of arc end
+  @param  start   degree of arc start, 0 to 360
+  @param  end     degree of arc end, 0 to 360
   @param  color   16-bit 5-6-5 Color to fill with
 */
 /**************************************************************************/
 void Arduino_GFX::writeFillArcHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t iradius, float start, float end, uint16_t color)
 {
-  if ((start == 90.0) || (start == 180.0) || (start == 270.0) || (start == 360.0))
-  {
-    start -= 0.1;
-  }
-
-  if ((end == 90.0) || (end == 180.0) || (end == 270.0) || (end == 360.0))
-  {
-    end -= 0.1;
-  }
-
-  float s_cos = (cos(start * DEGTORAD));
-  float e_cos = (cos(end * DEGTORAD));
-  float sslope = s_cos / (sin(start * DEGTORAD));
-  float eslope = e_cos / (sin(end * DEGTORAD));
-  float swidth = 0.5 / s_cos;
-  float ewidth = -0.5 / e_cos;
+  gfx_arc_t a;
+  // edges grow by half a pixel, so start == end still draws a line
+  gfx_arc_init(&a, start, end, GFX_ARC_ONE / 2);
   --iradius;
   int32_t ir2 = iradius * iradius + iradius;
   int32_t or2 = oradius * oradius + oradius;
 
-  bool start180 = !(start < 180.0);
-  bool end180 = end < 180.0;
-  bool reversed = start + 180.0 < end || (end < start && start < end + 180.0);
-
-  int32_t xs = -oradius;
-  int32_t y = -oradius;
-  int32_t ye = oradius;
-  int32_t xe = oradius + 1;
-  if (!reversed)
-  {
-    if ((end >= 270 || end < 90) && (start >= 270 || start < 90))
-    {
-      xs = 0;
-    }
-    else if (end < 270 && end >= 90 && start < 270 && start >= 90)
-    {
-      xe = 1;
-    }
-    if (end >= 180 && start >= 180)
-    {
-      ye = 0;
-    }
-    else if (end < 180 && start < 180)
-    {
-      y = 0;
-    }
-  }
-  do
+  int32_t y = max(-(int32_t)oradius, -(int32_t)cy);
+  int32_t ye = min((int32_t)oradius, (int32_t)(_max_y - cy));
+  int32_t xo = -1;
+  int32_t xi = -1;
+  int32_t x0[4], x1[4];
+  for (; y <= ye; ++y)
   {
     int32_t y2 = y * y;
-    int32_t x = xs;
-    if (x < 0)
+    xo = gfx_arc_extent(xo, y2, or2);
+    xi = gfx_arc_extent(xi, y2, ir2);
+    uint8_t n = gfx_arc_row(&a, y, xo, xi, x0, x1);
+    for (uint8_t i = 0; i < n; ++i)
     {
-      while (x * x + y2 >= or2)
-      {
-        ++x;
-      }
-      if (xe != 1)
+      int32_t l = max(cx + x0[i], (int32_t)0);
+      int32_t r = min(cx + x1[i], (int32_t)_max_x);
+      if (l <= r)
       {
-        xe = 1 - x;
+        writeFillRectPreclipped(l, cy + y, r - l + 1, 1, color);
       }
     }
-    float ysslope = (y + swidth) * sslope;
-    float yeslope = (y + ewidth) * eslope;
-    int32_t len = 0;
-    do
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Arc drawer with fill and anti-aliased edges. Coverage of a row is
+    worked out GFX_ARC_AA_CHUNK pixels at a time and sent as coverage spans.
+  @param  cx      Center-point x coordinate
+  @param  cy      Center-point y coordinate
+  @param  oradius Outer radius of arc
+  @param  iradius Inner radius of arc
+  @param  start   degree of arc start, 0 to 360
+  @param  end     degree of arc end, 0 to 360
+  @param  color   16-bit 5-6-5 Color to fill with
+  @param  bg      16-bit 5-6-5 Color the edges are blended with
+*/
+/**************************************************************************/
+void Arduino_GFX::writeFillArcAAHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t iradius, float start, float end, uint16_t color, uint16_t bg)
+{
+  gfx_arc_t a;
+  // pixels within half a pixel outside an edge get some coverage
+  gfx_arc_init(&a, start, end, GFX_ARC_ONE / 2);
+  int32_t ir = iradius - 1;
+  int32_t ir2 = (iradius > 1) ? (ir * ir + 1) : 0;
+  int32_t or2 = (oradius + 1) * (oradius + 1);
+
+  int32_t y = max(-(int32_t)oradius - 1, -(int32_t)cy);
+  int32_t ye = min((int32_t)oradius + 1, (int32_t)(_max_y - cy));
+  int32_t xo = -1;
+  int32_t xi = -1;
+  int32_t x0[4], x1[4];
+  uint8_t cov[GFX_ARC_AA_CHUNK];
+  for (; y <= ye; ++y)
+  {
+    int32_t y2 = y * y;
+    xo = gfx_arc_extent(xo, y2, or2);
+    xi = gfx_arc_extent(xi, y2, ir2);
+    uint8_t n = gfx_arc_row(&a, y, xo, xi, x0, x1);
+    for (uint8_t i = 0; i < n; ++i)
     {
-      bool flg1 = start180 != (x <= ysslope);
-      bool flg2 = end180 != (x <= yeslope);
-      int32_t distance = x * x + y2;
-      if (distance >= ir2 && ((flg1 && flg2) || (reversed && (flg1 || flg2))) && x != xe && distance < or2)
-      {
-        ++len;
-      }
-      else
+      int32_t l = max(cx + x0[i], (int32_t)0);
+      int32_t r = min(cx + x1[i], (int32_t)_max_x);
+      for (int32_t x = l; x <= r; x += GFX_ARC_AA_CHUNK)
       {
-        if (len)
+        int32_t len = min(r - x + 1, (int32_t)GFX_ARC_AA_CHUNK);
+        for (int32_t k = 0; k < len; ++k)
         {
-          writeFastHLine(cx + x - len, cy + y, len, color);
-          len = 0;
-        }
-        if (distance >= or2)
-          break;
-        if (x < 0 && distance < ir2)
-        {
-          x = -x;
+          cov[k] = gfx_arc_coverage(&a, x + k - cx, y, oradius, iradius);
         }
+        writeCoverageSpanPreclipped(x, cy + y, cov, len, color, bg);
       }
-    } while (++x <= xe);
-  } while (++y <= ye);
+    }
+  }
 }
 
 /**************************************************************************/
 /*!
-  @brief  Draw a rectangle with no fill color
-  @param  x       Top left corner x coordinate
-  @param  y       Top left corner y coordinate
-  @param  w       Width in pixels
-  @param  h       Height in pixels
+  @brief  Anti-aliased line drawer, no startWrite()/endWrite(). The line's
+    y at each x (x at each y if steep) is stepped in 16.16 fixed point and
+    split between the two pixels it falls between; pixels of a shallow line
+    sharing a row go out as one coverage span per row.
+  @param  x0      Start point x coordinate
+  @param  y0      Start point y coordinate
+  @param  x1      End point x coordinate
+  @param  y1      End point y coordinate
   @param  color   16-bit 5-6-5 Color to draw with
+  @param  bg      16-bit 5-6-5 Color the edges are blended with
 */
 /**************************************************************************/
-void Arduino_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
-                           uint16_t color)
+void Arduino_GFX::writeLineAAHelper(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, uint16_t bg)
 {
-  startWrite();
+  bool steep = _diff(y1, y0) > _diff(x1, x0);
+  if (steep)
+  {
+    _swap_int16_t(x0, y0);
+    _swap_int16_t(x1, y1);
+  }
+  if (x0 > x1)
+  {
+    _swap_int16_t(x0, x1);
+    _swap_int16_t(y0, y1);
+  }
+  int32_t dx = x1 - x0;
+  int32_t g = dx ? (int32_t)(((int64_t)(y1 - y0) * 65536) / dx) : 0;
+  int32_t fy = (int32_t)y0 * 65536;
+  uint8_t a[GFX_ARC_AA_CHUNK], b[GFX_ARC_AA_CHUNK];
+
+  if (steep)
+  {
+    for (int32_t x = x0; x <= x1; ++x, fy += g)
+    {
+      uint8_t f = (fy >> 8) & 0xFF;
+      a[0] = 255 - f;
+      a[1] = f;
+      writeCoverageSpan(fy >> 16, x, a, 2, color, bg);
+    }
+    return;
+  }
+
+  int32_t start = x0;
+  int32_t row = fy >> 16;
+  int16_t n = 0;
+  for (int32_t x = x0; x <= x1; ++x, fy += g)
+  {
+    if (((fy >> 16) != row) || (n == GFX_ARC_AA_CHUNK))
+    {
+      writeCoverageSpan(start, row, a, n, color, bg);
+      writeCoverageSpan(start, row + 1, b, n, color, bg);
+      start = x;
+      row = fy >> 16;
+      n = 0;
+    }
+    uint8_t f = (fy >> 8) & 0xFF;
+    a[n] = 255 - f;
+    b[n++] = f;
+  }
+  writeCoverageSpan(start, row, a, n, color, bg);
+  writeCoverageSpan(start, row + 1, b, n, color, bg);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Draw a row of pixels by coverage, clipped to the screen, no
+    startWrite()/endWrite()
+  @param  x       Leftmost pixel x coordinate
+  @param  y       Row y coordinate
+  @param  cov     Coverage of each pixel, 0 leaves it, 255 draws color
+  @param  len     Number of pixels
+  @param  color   16-bit 5-6-5 Color to draw with
+  @param  bg      16-bit 5-6-5 Color partly covered pixels are blended with
+*/
+/**************************************************************************/
+void Arduino_GFX::writeCoverageSpan(int16_t x, int16_t y, const uint8_t *cov, int16_t len, uint16_t color, uint16_t bg)
+{
+  if ((y < 0) || (y > _max_y))
+  {
+    return;
+  }
+  if (x < 0)
+  {
+    cov -= x;
+    len += x;
+    x = 0;
+  }
+  if ((x + len - 1) > _max_x)
+  {
+    len = _max_x - x + 1;
+  }
+  if (len > 0)
+  {
+    writeCoverageSpanPreclipped(x, y, cov, len, color, bg);
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Draw a row of pixels by coverage, already clipped. Fully covered
+    runs go out as spans, partly covered pixels are blended with bg. If bg
+    is the same as color the background is unknown, pixels at least half
+    covered are drawn and the rest left; a canvas blends with its
+    framebuffer instead.
+  @param  x       Leftmost pixel x coordinate
+  @param  y       Row y coordinate
+  @param  cov     Coverage of each pixel, 0 leaves it, 255 draws color
+  @param  len     Number of pixels
+  @param  color   16-bit 5-6-5 Color to draw with
+  @param  bg      16-bit 5-6-5 Color partly covered pixels are blended with
+*/
+/**************************************************************************/
+void Arduino_GFX::writeCoverageSpanPreclipped(int16_t x, int16_t y, const uint8_t *cov, int16_t len, uint16_t color, uint16_t bg)
+{
+  bool blend = (bg != color);
+  uint8_t full = blend ? 255 : 128;
+  int16_t run = -1; // start of a drawn run not sent yet
+  for (int16_t k = 0; k < len; ++k)
+  {
+    if (cov[k] >= full)
+    {
+      if (run < 0)
+      {
+        run = k;
+      }
+      continue;
+    }
+    if (run >= 0)
+    {
+      writeFillRectPreclipped(x + run, y, k - run, 1, color);
+      run = -1;
+    }
+    if (blend && cov[k])
+    {
+      uint16_t c = bg;
+      gfx_blend_rgb565_color(&c, color, cov[k], 1);
+      writePixelPreclipped(x + k, y, c);
+    }
+  }
+  if (run >= 0)
+  {
+    writeFillRectPreclipped(x + run, y, len - run, 1, color);
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Draw a rectangle with no fill color
+  @param  x       Top left corner x coordinate
+  @param  y       Top left corner y coordinate
+  @param  w       Width in pixels
+  @param  h       Height in pixels
+  @param  color   16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void Arduino_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                           uint16_t color)
+{
+  startWrite();
   writeFastHLine(x, y, w, color);
   writeFastHLine(x, y + h - 1, w, color);
   writeFastVLine(x, y, h, color);
@@ -937,6 +1428,136 @@ void Arduino_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w,
   endWrite();
 }
 
+/**************************************************************************/
+/*!
+  @brief  Draw a rounded rectangle with anti-aliased corners and no fill color
+  @param  x       Top left corner x coordinate
+  @param  y       Top left corner y coordinate
+  @param  w       Width in pixels
+  @param  h       Height in pixels
+  @param  r       Radius of corner rounding
+  @param  color   16-bit 5-6-5 Color to draw with
+  @param  bg      16-bit 5-6-5 Color the edges are blended with
+*/
+/**************************************************************************/
+void Arduino_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w,
+                                int16_t h, int16_t r, uint16_t color, uint16_t bg)
+{
+  int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
+  if (r > max_radius)
+    r = max_radius;
+  startWrite();
+  writeRoundRectAAHelper(x, y, w, h, r, false, color, bg);
+  endWrite();
+}
+
+/**************************************************************************/
+/*!
+  @brief  Draw a rounded rectangle with fill color and anti-aliased corners
+  @param  x       Top left corner x coordinate
+  @param  y       Top left corner y coordinate
+  @param  w       Width in pixels
+  @param  h       Height in pixels
+  @param  r       Radius of corner rounding
+  @param  color   16-bit 5-6-5 Color to fill with
+  @param  bg      16-bit 5-6-5 Color the edges are blended with
+*/
+/**************************************************************************/
+void Arduino_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w,
+                                int16_t h, int16_t r, uint16_t color, uint16_t bg)
+{
+  int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
+  if (r > max_radius)
+    r = max_radius;
+  startWrite();
+  writeRoundRectAAHelper(x, y, w, h, r, true, color, bg);
+  endWrite();
+}
+
+/**************************************************************************/
+/*!
+  @brief  Rounded rectangle drawer with anti-aliased corners. Rows between
+    the corners are plain spans, corner rows get a coverage span of r
+    pixels on each side with the coverage of a circle of radius r.
+  @param  x       Top left corner x coordinate
+  @param  y       Top left corner y coordinate
+  @param  w       Width in pixels
+  @param  h       Height in pixels
+  @param  r       Radius of corner rounding, at most half of w and h
+  @param  fill    true to fill, false for a one pixel outline
+  @param  color   16-bit 5-6-5 Color to draw with
+  @param  bg      16-bit 5-6-5 Color the edges are blended with
+*/
+/**************************************************************************/
+void Arduino_GFX::writeRoundRectAAHelper(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, bool fill, uint16_t color, uint16_t bg)
+{
+  if ((w <= 0) || (h <= 0))
+  {
+    return;
+  }
+  if (r <= 0)
+  {
+    if (fill)
+    {
+      writeFillRect(x, y, w, h, color);
+    }
+    else
+    {
+      writeFastHLine(x, y, w, color);
+      writeFastHLine(x, y + h - 1, w, color);
+      writeFastVLine(x, y, h, color);
+      writeFastVLine(x + w - 1, y, h, color);
+    }
+    return;
+  }
+
+  gfx_arc_t a;
+  gfx_arc_init(&a, 0.0, 360.0, 0);
+  int16_t ir = fill ? 1 : r; // an outline is a ring one pixel wide
+  uint8_t cov[GFX_ARC_AA_CHUNK];
+  for (int16_t j = 0; j < h; ++j)
+  {
+    int16_t py = y + j;
+    if ((py < 0) || (py > _max_y))
+    {
+      continue;
+    }
+    // row relative to the centers of the corner circles
+    int32_t dy = (j < r) ? (j - r) : ((j >= h - r) ? (j - (h - 1 - r)) : 0);
+    if (dy == 0)
+    {
+      if (fill)
+      {
+        writeFillRect(x, py, w, 1, color);
+      }
+      else
+      {
+        writePixel(x, py, color);
+        writePixel(x + w - 1, py, color);
+      }
+      continue;
+    }
+    for (int16_t i = 0; i < r; i += GFX_ARC_AA_CHUNK)
+    {
+      int16_t n = min((int16_t)(r - i), (int16_t)GFX_ARC_AA_CHUNK);
+      for (int16_t k = 0; k < n; ++k)
+      {
+        cov[k] = gfx_arc_coverage(&a, i + k - r, dy, r, ir);
+      }
+      writeCoverageSpan(x + i, py, cov, n, color, bg);
+      for (int16_t k = 0; k < n; ++k)
+      {
+        cov[k] = gfx_arc_coverage(&a, i + k + 1, dy, r, ir);
+      }
+      writeCoverageSpan(x + w - r + i, py, cov, n, color, bg);
+    }
+    if (fill || (dy == -r) || (dy == r))
+    {
+      writeFillRect(x + r, py, w - 2 * r, 1, color);
+    }
+  }
+}
+
 /**************************************************************************/
 /*!
   @brief  Draw a triangle with no fill color
@@ -1879,6 +2500,61 @@ void Arduino_GFX::draw24bitRGBBitmap(int16_t x, int16_t y,
   endWrite();
 }
 
+#if !defined(LITTLE_FOOT_PRINT)
+/**************************************************************************/
+/*!
+   @brief   Draw a compressed asset made by tools/gfx_asset.py, decoded a
+            band of rows at a time, see GFXAsset.h
+    @param    x       Top left corner x coordinate
+    @param    y       Top left corner y coordinate
+    @param    asset   Asset data, PROGMEM or RAM
+    @param    len     Size of the asset data in bytes
+*/
+/**************************************************************************/
+void Arduino_GFX::drawAsset(int16_t x, int16_t y, const uint8_t *asset, uint32_t len)
+{
+  gfx_asset_decoder_t d;
+  if (!gfx_asset_open(&d, asset, len))
+  {
+    return;
+  }
+  uint32_t buf[GFX_ASSET_BUF_PIXELS / 2]; // word aligned for the bus
+  uint16_t *pixels = (uint16_t *)buf;
+  int16_t w = d.width;
+  int16_t h = d.height;
+
+  if (w <= GFX_ASSET_BUF_PIXELS)
+  {
+    int16_t bandRows = GFX_ASSET_BUF_PIXELS / w;
+    for (int16_t row = 0; (row < h) && ((y + row) < _height); row += bandRows)
+    {
+      int16_t rows = min(bandRows, (int16_t)(h - row));
+      uint32_t n = (uint32_t)w * rows;
+      if (gfx_asset_decode(&d, pixels, n) < n)
+      {
+        return;
+      }
+      draw16bitRGBBitmap(x, y + row, pixels, w, rows);
+    }
+  }
+  else
+  {
+    for (int16_t row = 0; (row < h) && ((y + row) < _height); ++row)
+    {
+      for (int16_t col = 0; col < w; col += GFX_ASSET_BUF_PIXELS)
+      {
+        int16_t n = min((int16_t)GFX_ASSET_BUF_PIXELS, (int16_t)(w - col));
+        if (gfx_asset_decode(&d, pixels, n) < (uint32_t)n)
+        {
+          return;
+        }
+        draw16bitRGBBitmap(x + col, y + row, pixels, n, 1);
+      }
+    }
+  }
+}
+#endif // !defined(LITTLE_FOOT_PRINT)
+
 #if defined(U8G2_FONT_SUPPORT)
 uint16_t Arduino_GFX::u8g2_font_get_word(const uint8_t *font, uint8_t offset)
 {
@@ -1930,127 +2606,556 @@ int8_t Arduino_GFX::u8g2_font_decode_get_signed_bits(uint8_t cnt)
   return v;
 }
 
-void Arduino_GFX::u8g2_font_decode_len(uint8_t len, uint8_t is_foreground, uint16_t color, uint16_t bg)
+/**************************************************************************/
+/*!
+  @brief  Decode the run length encoded glyph at _u8g2_decode_ptr into a 1 bit per pixel bitmap
+  @param  bitmap  Output, rows packed back to back MSB first, at least (_u8g2_char_width * _u8g2_char_height + 7) / 8 bytes
+*/
+/**************************************************************************/
+void Arduino_GFX::u8g2_font_decode_glyph(uint8_t *bitmap)
 {
-  uint8_t cnt;     /* total number of remaining pixels, which have to be drawn */
-  uint8_t rem;     /* remaining pixel to the right edge of the glyph */
-  uint8_t current; /* number of pixels, which need to be drawn for the draw procedure */
-  /* current is either equal to cnt or equal to rem */
-
-  /* target position on the screen */
-  uint16_t x, y;
-
-  cnt = len;
-
-  /* get the local position */
-  uint8_t lx = _u8g2_dx;
-  uint8_t ly = _u8g2_dy;
+  uint16_t total = (uint16_t)_u8g2_char_width * _u8g2_char_height;
+  uint16_t pos = 0;
+  uint8_t a, b;
 
-  int16_t curW;
+  memset(bitmap, 0, (total + 7) >> 3);
   for (;;)
   {
-    /* calculate the number of pixel to the right edge of the glyph */
-    rem = _u8g2_char_width;
-    rem -= lx;
+    a = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_0);
+    b = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_1);
+    do
+    {
+      pos += a;
+      for (uint8_t i = 0; (i < b) && (pos < total); ++i, ++pos)
+      {
+        bitmap[pos >> 3] |= 0x80 >> (pos & 7);
+      }
+    } while (u8g2_font_decode_get_unsigned_bits(1) != 0);
 
-    /* calculate how many pixel to draw. This is either to the right edge */
-    /* or lesser, if not enough pixel are left */
-    current = rem;
-    if (cnt < rem)
-      current = cnt;
+    if (pos >= total)
+      break;
+  }
+}
 
-    /* now draw the line, but apply the rotation around the glyph target position */
-    // u8g2_font_decode_draw_pixel(u8g2, lx,ly,current, is_foreground);
+/**************************************************************************/
+/*!
+  @brief  Index every glyph of the current u8g2 font by encoding so lookups are a binary search instead of a walk
+  @param  index   Index to fill, its previous arrays are released
+*/
+/**************************************************************************/
+void Arduino_GFX::u8g2_font_build_index(u8g2_glyph_index_t *index)
+{
+  free(index->encodings);
+  free(index->offsets);
+  index->font = u8g2Font;
+  index->count = 0;
+  index->encodings = NULL;
+  index->offsets = NULL;
 
-    if (textsize_x == 1 && textsize_y == 1)
-    {
-      /* get target position */
-      x = _u8g2_target_x + lx;
-      y = _u8g2_target_y + ly;
+  const uint8_t *ascii = u8g2Font + 23; // U8G2_FONT_DATA_STRUCT_SIZE
+  const uint8_t *unicode = NULL;
+#ifdef U8G2_WITH_UNICODE
+  if (_u8g2_start_pos_unicode)
+  {
+    unicode = ascii + _u8g2_start_pos_unicode;
+    unicode += u8g2_font_get_word(unicode, 0); // skip the unicode lookup table
+  }
+#endif
 
-      /* draw foreground and background (if required) */
-      if ((x <= _max_text_x) && (y <= _max_text_y))
+  // first pass counts, second pass fills; u8g2 fonts are sorted by encoding
+  uint32_t count = 0;
+  for (uint8_t pass = 0; pass < 2; ++pass)
+  {
+    uint32_t i = 0;
+    const uint8_t *font = ascii;
+    while (pgm_read_byte(font + 1) != 0)
+    {
+      if (pass)
       {
-        curW = current;
-        if ((x + curW - 1) > _max_text_x)
-        {
-          curW = _max_text_x - x + 1;
-        }
-        if (is_foreground)
-        {
-          writeFillRectPreclipped(x, y, curW, 1, color);
-        }
-        else if (bg != color)
-        {
-          writeFillRectPreclipped(x, y, curW, 1, bg);
-        }
+        index->encodings[i] = pgm_read_byte(font);
+        index->offsets[i] = font + 2 - u8g2Font; /* skip encoding and glyph size */
       }
+      ++i;
+      font += pgm_read_byte(font + 1);
     }
-    else
+    if (unicode)
     {
-      /* get target position */
-      x = _u8g2_target_x + (lx * textsize_x);
-      y = _u8g2_target_y + (ly * textsize_y);
-
-      /* draw foreground and background (if required) */
-      if (((x + textsize_x - 1) <= _max_text_x) && ((y + textsize_y - 1) <= _max_text_y))
+      font = unicode;
+      uint16_t e;
+      while ((e = u8g2_font_get_word(font, 0)) != 0)
       {
-        curW = current * textsize_x;
-        while ((x + curW - 1) > _max_text_x)
-        {
-          curW -= textsize_x;
-        }
-        if (is_foreground)
-        {
-          writeFillRectPreclipped(x, y, curW - text_pixel_margin,
-                                  textsize_y - text_pixel_margin, color);
-        }
-        else if (bg != color)
+        if (pass)
         {
-          writeFillRectPreclipped(x, y, curW - text_pixel_margin,
-                                  textsize_y - text_pixel_margin, bg);
+          index->encodings[i] = e;
+          index->offsets[i] = font + 3 - u8g2Font; /* skip encoding and glyph size */
         }
+        ++i;
+        font += pgm_read_byte(font + 2);
       }
     }
 
-    /* check, whether the end of the run length code has been reached */
-    if (cnt < rem)
-      break;
-    cnt -= rem;
-    lx = 0;
-    ly++;
+    if (pass == 0)
+    {
+      count = i;
+      if ((count == 0) || (count > 0xFFFF))
+      {
+        return;
+      }
+#if defined(ESP32)
+      if (psramFound())
+      {
+        index->encodings = (uint16_t *)ps_malloc(count * sizeof(uint16_t));
+        index->offsets = (uint32_t *)ps_malloc(count * sizeof(uint32_t));
+      }
+      else
+      {
+        index->encodings = (uint16_t *)malloc(count * sizeof(uint16_t));
+        index->offsets = (uint32_t *)malloc(count * sizeof(uint32_t));
+      }
+#else
+      index->encodings = (uint16_t *)malloc(count * sizeof(uint16_t));
+      index->offsets = (uint32_t *)malloc(count * sizeof(uint32_t));
+#endif
+      if ((!index->encodings) || (!index->offsets))
+      {
+        free(index->encodings);
+        free(index->offsets);
+        index->encodings = NULL;
+        index->offsets = NULL;
+        return; // fall back to walking the font
+      }
+    }
   }
-  lx += cnt;
-
-  _u8g2_dx = lx;
-  _u8g2_dy = ly;
+  index->count = count;
 }
-#endif // defined(U8G2_FONT_SUPPORT)
-
-// TEXT- AND CHARACTER-HANDLING FUNCTIONS ----------------------------------
 
-// Draw a character
 /**************************************************************************/
 /*!
-  @brief  Draw a single character
-  @param  x       Bottom left corner x coordinate
-  @param  y       Bottom left corner y coordinate
-  @param  c       The 8-bit font-indexed character (likely ascii)
-  @param  color   16-bit 5-6-5 Color to draw chraracter with
-  @param  bg      16-bit 5-6-5 Color to fill background with (if same as color, no background)
+  @brief  Find a glyph in the current u8g2 font
+  @param  encoding  Glyph encoding
+  @return Pointer to the glyph data after its encoding and size, 0 if the font has no such glyph
 */
 /**************************************************************************/
-void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
-                           uint16_t color, uint16_t bg)
+const uint8_t *Arduino_GFX::u8g2_font_get_glyph_data(uint16_t encoding)
 {
-  int16_t block_w, block_h, curX, curY, curW, curH;
-
-#if !defined(ATTINY_CORE)
-  if (gfxFont) // custom font
+#if (U8G2_GLYPH_INDEX_FONTS > 0)
+  if (_u8g2_cur_index && _u8g2_cur_index->count)
   {
-    // Character is assumed previously filtered by write() to eliminate
-    // newlines, returns, non-printable characters, etc.  Calling
-    // drawChar() directly with 'bad' characters of font may cause mayhem!
+    uint16_t lo = 0, hi = _u8g2_cur_index->count;
+    while (lo < hi)
+    {
+      uint16_t mid = (lo + hi) >> 1;
+      if (_u8g2_cur_index->encodings[mid] < encoding)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+    if ((lo < _u8g2_cur_index->count) && (_u8g2_cur_index->encodings[lo] == encoding))
+    {
+      return u8g2Font + _u8g2_cur_index->offsets[lo];
+    }
+    return 0;
+  }
+#endif // (U8G2_GLYPH_INDEX_FONTS > 0)
+
+  uint8_t *font = u8g2Font;
+  const uint8_t *glyph_data = 0;
+
+  // extract from u8g2_font_get_glyph_data()
+  font += 23; // U8G2_FONT_DATA_STRUCT_SIZE
+  if (encoding <= 255)
+  {
+    if (encoding >= 'a')
+    {
+      font += _u8g2_start_pos_lower_a;
+    }
+    else if (encoding >= 'A')
+    {
+      font += _u8g2_start_pos_upper_A;
+    }
+
+    for (;;)
+    {
+      if (pgm_read_byte(font + 1) == 0)
+        break;
+      if (pgm_read_byte(font) == encoding)
+      {
+        glyph_data = font + 2; /* skip encoding and glyph size */
+        break;
+      }
+      font += pgm_read_byte(font + 1);
+    }
+  }
+#ifdef U8G2_WITH_UNICODE
+  else
+  {
+    uint16_t e;
+    font += _u8g2_start_pos_unicode;
+    const uint8_t *unicode_lookup_table = font;
+
+    /* issue 596: search for the glyph start in the unicode lookup table */
+    do
+    {
+      font += u8g2_font_get_word(unicode_lookup_table, 0);
+      e = u8g2_font_get_word(unicode_lookup_table, 2);
+      unicode_lookup_table += 4;
+    } while (e < encoding);
+
+    for (;;)
+    {
+      e = u8g2_font_get_word(font, 0);
+
+      if (e == 0)
+        break;
+
+      if (e == encoding)
+      {
+        glyph_data = font + 3; /* skip encoding and glyph size */
+        break;
+      }
+      font += pgm_read_byte(font + 2);
+    }
+  }
+#endif
+
+  return glyph_data;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Make a glyph of the current u8g2 font the one drawChar() draws.
+          Recently used glyphs come from the glyph cache already decoded; a miss is looked up,
+          its header decoded and, if it fits a cache slot, its bitmap decoded into the least recently used slot.
+  @param  encoding  Glyph encoding
+  @return false if the font has no such glyph
+*/
+/**************************************************************************/
+bool Arduino_GFX::u8g2_font_load_glyph(uint16_t encoding)
+{
+  _u8g2_glyph_bitmap = NULL;
+
+#if (U8G2_GLYPH_CACHE_SIZE > 0)
+  u8g2_cached_glyph_t *slot = NULL;
+  if (_u8g2_cache)
+  {
+    slot = _u8g2_cache;
+    for (uint8_t i = 0; i < U8G2_GLYPH_CACHE_SIZE; ++i)
+    {
+      u8g2_cached_glyph_t *g = &_u8g2_cache[i];
+      if ((g->font == u8g2Font) && (g->encoding == encoding))
+      {
+        g->last_used = ++_u8g2_cache_tick;
+        _u8g2_decode_ptr = g->glyph_data;
+        _u8g2_char_width = g->width;
+        _u8g2_char_height = g->height;
+        _u8g2_char_x = g->x;
+        _u8g2_char_y = g->y;
+        _u8g2_delta_x = g->delta_x;
+        _u8g2_glyph_bitmap = g->bitmap;
+        return true;
+      }
+      if (g->last_used < slot->last_used)
+      {
+        slot = g;
+      }
+    }
+  }
+#endif // (U8G2_GLYPH_CACHE_SIZE > 0)
+
+  const uint8_t *glyph_data = u8g2_font_get_glyph_data(encoding);
+  if (!glyph_data)
+  {
+    return false;
+  }
+
+  // u8g2_font_decode_glyph
+  _u8g2_decode_ptr = glyph_data;
+  _u8g2_decode_bit_pos = 0;
+
+  _u8g2_char_width = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_char_width);
+  _u8g2_char_height = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_char_height);
+  _u8g2_char_x = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_char_x);
+  _u8g2_char_y = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_char_y);
+  _u8g2_delta_x = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_delta_x);
+  // log_d("_encoding: %d, _u8g2_char_width: %d, _u8g2_char_height: %d, _u8g2_char_x: %d, _u8g2_char_y: %d, _u8g2_delta_x: %d",
+  //       encoding, _u8g2_char_width, _u8g2_char_height, _u8g2_char_x, _u8g2_char_y, _u8g2_delta_x);
+
+#if (U8G2_GLYPH_CACHE_SIZE > 0)
+  // bitmaps are kept unscaled, writeGlyph() applies the text size
+  if (slot && ((((uint16_t)_u8g2_char_width * _u8g2_char_height + 7) >> 3) <= U8G2_GLYPH_CACHE_BYTES))
+  {
+    slot->font = u8g2Font;
+    slot->glyph_data = glyph_data;
+    slot->encoding = encoding;
+    slot->last_used = ++_u8g2_cache_tick;
+    slot->width = _u8g2_char_width;
+    slot->height = _u8g2_char_height;
+    slot->x = _u8g2_char_x;
+    slot->y = _u8g2_char_y;
+    slot->delta_x = _u8g2_delta_x;
+    if (_u8g2_char_width > 0)
+    {
+      u8g2_font_decode_glyph(slot->bitmap);
+    }
+    _u8g2_glyph_bitmap = slot->bitmap;
+  }
+#endif // (U8G2_GLYPH_CACHE_SIZE > 0)
+
+  return true;
+}
+
+#endif // defined(U8G2_FONT_SUPPORT)
+
+/**************************************************************************/
+/*!
+  @brief  Clip a rectangle to the text bound
+  @param  x   Top left corner x coordinate, updated
+  @param  y   Top left corner y coordinate, updated
+  @param  w   Width in pixels, updated
+  @param  h   Height in pixels, updated
+  @return true if anything is left to draw
+*/
+/**************************************************************************/
+bool Arduino_GFX::clipToTextBound(int16_t *x, int16_t *y, int16_t *w, int16_t *h)
+{
+  int16_t x2 = *x + *w - 1, y2 = *y + *h - 1;
+  if (*x < _min_text_x)
+  {
+    *x = _min_text_x;
+  }
+  if (*y < _min_text_y)
+  {
+    *y = _min_text_y;
+  }
+  if (x2 > _max_text_x)
+  {
+    x2 = _max_text_x;
+  }
+  if (y2 > _max_text_y)
+  {
+    y2 = _max_text_y;
+  }
+  *w = x2 - *x + 1;
+  *h = y2 - *y + 1;
+  return (*w > 0) && (*h > 0);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Fill a rectangle clipped to the text bound, no startWrite()/endWrite()
+  @param  x       Top left corner x coordinate
+  @param  y       Top left corner y coordinate
+  @param  w       Width in pixels
+  @param  h       Height in pixels
+  @param  color   16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void Arduino_GFX::writeFillRectTextBound(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if (clipToTextBound(&x, &y, &w, &h))
+  {
+    writeFillRectPreclipped(x, y, w, h, color);
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Draw a 1 bit glyph bitmap scaled by the text size, no startWrite()/endWrite().
+          Foreground is drawn as horizontal runs of set bits instead of one rectangle per font pixel.
+  @param  x       Top left corner x coordinate of the character box
+  @param  y       Top left corner y coordinate of the character box
+  @param  bw      Width of the character box in font pixels
+  @param  bh      Height of the character box in font pixels
+  @param  gx      X offset of the glyph bitmap inside the box in font pixels
+  @param  gy      Y offset of the glyph bitmap inside the box in font pixels
+  @param  bitmap  Glyph bitmap in RAM, rows packed back to back MSB first
+  @param  gw      Width of the glyph bitmap
+  @param  gh      Height of the glyph bitmap
+  @param  color   16-bit 5-6-5 Color to draw the glyph with
+  @param  bg      16-bit 5-6-5 Color to fill the box with (if same as color, no background)
+*/
+/**************************************************************************/
+void Arduino_GFX::writeGlyph(int16_t x, int16_t y, uint8_t bw, uint8_t bh, int8_t gx, int8_t gy,
+                             const uint8_t *bitmap, uint8_t gw, uint8_t gh, uint16_t color, uint16_t bg)
+{
+  // NOTE: Different from Adafruit_GFX design, Arduino_GFX also cater background.
+  // Since it may introduce many ugly output, it should limited using on mono font only.
+  if (bg != color) // have background color
+  {
+    writeFillRectTextBound(x, y, bw * textsize_x, bh * textsize_y, bg);
+  }
+
+  uint8_t pw = textsize_x - text_pixel_margin;
+  uint8_t ph = textsize_y - text_pixel_margin;
+  uint16_t bit = 0;
+  int16_t curY = y + (gy * textsize_y);
+  for (uint8_t yy = 0; yy < gh; ++yy, curY += textsize_y)
+  {
+    if ((curY > _max_text_y) || ((curY + ph - 1) < _min_text_y))
+    {
+      bit += gw;
+      continue;
+    }
+    uint8_t xx = 0;
+    while (xx < gw)
+    {
+      if (!(bitmap[bit >> 3] & (0x80 >> (bit & 7))))
+      {
+        ++xx;
+        ++bit;
+        continue;
+      }
+      uint8_t start = xx;
+      do
+      {
+        ++xx;
+        ++bit;
+      } while ((xx < gw) && (bitmap[bit >> 3] & (0x80 >> (bit & 7))));
+
+      int16_t curX = x + ((gx + start) * textsize_x);
+      if (text_pixel_margin > 0) // keep the gap between font pixels
+      {
+        for (; start < xx; ++start, curX += textsize_x)
+        {
+          writeFillRectTextBound(curX, curY, pw, ph, color);
+        }
+      }
+      else // one rectangle for the whole run
+      {
+        writeFillRectTextBound(curX, curY, (xx - start) * textsize_x, textsize_y, color);
+      }
+    }
+  }
+}
+
+// coverage 0 to 255 of pixel i of a glyph bitmap, rows packed back to back
+static inline uint8_t gfx_glyph_coverage(const uint8_t *bitmap, uint16_t i, uint8_t bpp)
+{
+  if (bpp == 4)
+  {
+    uint8_t b = bitmap[i >> 1];
+    return ((i & 1) ? (b & 0x0F) : (b >> 4)) * 17;
+  }
+  return (bitmap[i >> 3] & (0x80 >> (i & 7))) ? 255 : 0;
+}
+
+// source position of output pixel i of a glyph scaled by s, in 1/256 pixel
+// from the center of the first source pixel, so it is sampled between the
+// two source pixels it falls between
+static inline int32_t gfx_glyph_sample(int32_t i, uint8_t s)
+{
+  return ((((2 * i) + 1) * 128) / s) - 128;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Draw a 1 or 4 bit glyph bitmap with anti-aliased edges, no
+          startWrite()/endWrite(). The glyph is scaled by the text size with
+          bilinear filtering and each row sent as coverage spans, see
+          writeCoverageSpanPreclipped() for how they are blended.
+  @param  x       Top left corner x coordinate of the character box
+  @param  y       Top left corner y coordinate of the character box
+  @param  bw      Width of the character box in font pixels
+  @param  bh      Height of the character box in font pixels
+  @param  gx      X offset of the glyph bitmap inside the box in font pixels
+  @param  gy      Y offset of the glyph bitmap inside the box in font pixels
+  @param  bitmap  Glyph bitmap in RAM, rows packed back to back, MSB first
+  @param  gw      Width of the glyph bitmap
+  @param  gh      Height of the glyph bitmap
+  @param  bpp     Bits per bitmap pixel, 1 or 4 (coverage 0 to 15)
+  @param  color   16-bit 5-6-5 Color to draw the glyph with
+  @param  bg      16-bit 5-6-5 Color to fill the box with (if same as color, no background)
+*/
+/**************************************************************************/
+void Arduino_GFX::writeGlyphAA(int16_t x, int16_t y, uint8_t bw, uint8_t bh, int8_t gx, int8_t gy,
+                               const uint8_t *bitmap, uint8_t gw, uint8_t gh, uint8_t bpp, uint16_t color, uint16_t bg)
+{
+  uint8_t sx = textsize_x, sy = textsize_y;
+  if ((bpp == 1) && (((sx == 1) && (sy == 1)) || (text_pixel_margin > 0)))
+  {
+    // nothing to smooth
+    writeGlyph(x, y, bw, bh, gx, gy, bitmap, gw, gh, color, bg);
+    return;
+  }
+  if (bg != color) // have background color
+  {
+    writeFillRectTextBound(x, y, bw * sx, bh * sy, bg);
+  }
+
+  int16_t ox = x + (gx * sx), oy = y + (gy * sy);
+  int16_t cx = ox, cy = oy, cw = gw * sx, ch = gh * sy;
+  if (!clipToTextBound(&cx, &cy, &cw, &ch))
+  {
+    return;
+  }
+  // the text bound may reach off screen
+  int16_t cx2 = min((int16_t)(cx + cw - 1), _max_x);
+  int16_t cy2 = min((int16_t)(cy + ch - 1), _max_y);
+  cx = max(cx, (int16_t)0);
+  cy = max(cy, (int16_t)0);
+  cw = cx2 - cx + 1;
+  ch = cy2 - cy + 1;
+  if ((cw <= 0) || (ch <= 0))
+  {
+    return;
+  }
+
+  // one source row blended for the output row, with a 0 column on each side
+  uint8_t mix[gw + 2];
+  mix[0] = mix[gw + 1] = 0;
+  uint8_t cov[GFX_ARC_AA_CHUNK];
+  for (int16_t j = cy - oy; j < cy - oy + ch; ++j)
+  {
+    int32_t t = gfx_glyph_sample(j, sy);
+    int32_t r0 = t >> 8;
+    uint8_t fy = t & 0xFF;
+    for (uint8_t i = 0; i < gw; ++i)
+    {
+      int32_t a = (r0 >= 0) ? gfx_glyph_coverage(bitmap, (r0 * gw) + i, bpp) : 0;
+      int32_t b = (fy && (r0 + 1 < gh)) ? gfx_glyph_coverage(bitmap, ((r0 + 1) * gw) + i, bpp) : 0;
+      mix[i + 1] = a + (((b - a) * fy) >> 8);
+    }
+    for (int16_t i = cx - ox; i < cx - ox + cw; i += GFX_ARC_AA_CHUNK)
+    {
+      int16_t n = min((int16_t)(cx - ox + cw - i), (int16_t)GFX_ARC_AA_CHUNK);
+      for (int16_t k = 0; k < n; ++k)
+      {
+        int32_t u = gfx_glyph_sample(i + k, sx);
+        int32_t c0 = (u >> 8) + 1;
+        int32_t a = mix[c0];
+        cov[k] = a + (((mix[c0 + 1] - a) * (u & 0xFF)) >> 8);
+      }
+      writeCoverageSpanPreclipped(ox + i, oy + j, cov, n, color, bg);
+    }
+  }
+}
+
+// TEXT- AND CHARACTER-HANDLING FUNCTIONS ----------------------------------
+
+// Draw a character
+/**************************************************************************/
+/*!
+  @brief  Draw a single character
+  @param  x       Bottom left corner x coordinate
+  @param  y       Bottom left corner y coordinate
+  @param  c       The 8-bit font-indexed character (likely ascii)
+  @param  color   16-bit 5-6-5 Color to draw chraracter with
+  @param  bg      16-bit 5-6-5 Color to fill background with (if same as color, no background)
+*/
+/**************************************************************************/
+void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+                           uint16_t color, uint16_t bg)
+{
+#if !defined(ATTINY_CORE)
+  if (gfxFont) // custom font
+  {
+    // Character is assumed previously filtered by write() to eliminate
+    // newlines, returns, non-printable characters, etc.  Calling
+    // drawChar() directly with 'bad' characters of font may cause mayhem!
 
     c -= pgm_read_byte(&gfxFont->first);
     GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c);
@@ -2069,93 +3174,44 @@ void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     int8_t xo = pgm_read_sbyte(&glyph->xOffset),
            yo = pgm_read_sbyte(&glyph->yOffset);
 #endif
-    uint8_t xx, yy, bits = 0, bit = 0;
-    int16_t xo16 = xo, yo16 = yo;
 
     if (xAdvance < w)
     {
       xAdvance = w; // Don't know why it exists
     }
-
-    block_w = xAdvance * textsize_x;
-    block_h = yAdvance * textsize_y;
-    curY = y - (baseline * textsize_y);
-    if (
-        (x > _max_text_x) ||                 // Clip right
-        (curY > _max_text_y) ||              // Clip bottom
-        ((x + block_w - 1) < _min_text_x) || // Clip left
-        ((y + block_h - 1) < _min_text_y)    // Clip top
-    )
-    {
-      return;
-    }
-
-    // NOTE: Different from Adafruit_GFX design, Arduino_GFX also cater background.
-    // Since it may introduce many ugly output, it should limited using on mono font only.
-    startWrite();
+    // urgly workaround for the character not fit in the box
     if (bg != color) // have background color
     {
-      curW = block_w;
-      while ((x + curW - 1) > _max_text_x)
+      if ((xo + w) > xAdvance) // if character draw outside the box
       {
-        curW -= textsize_x;
+        xo = xAdvance - w; // pad inside the box
       }
-      curH = block_h;
-      while ((curY + curH - 1) > _max_text_y)
+      if (xo < 0) // padding X offset to >= 0
       {
-        curH -= textsize_y;
+        x += xo * textsize_x;
+        xo = 0;
       }
-      writeFillRectPreclipped(x, curY, curW, curH, bg);
     }
-    if (textsize_x == 1 && textsize_y == 1)
+
+#ifdef __AVR__
+    // writeGlyph() reads RAM, copy the glyph out of PROGMEM
+    uint8_t bits[((uint16_t)w * h * gfxFontBpp + 7) >> 3];
+    for (uint16_t i = 0; i < sizeof(bits); ++i)
     {
-      curY = y + yo;
-      for (yy = 0; yy < h; ++yy, ++curY)
-      {
-        if (curY <= _max_text_y)
-        {
-          curX = x + xo;
-          for (xx = 0; xx < w; ++xx, ++curX, bits <<= 1)
-          {
-            if (!(bit++ & 7))
-            {
-              bits = pgm_read_byte(&bitmap[bo++]);
-            }
-            if (curX <= _max_text_x)
-            {
-              if (bits & 0x80)
-              {
-                writePixelPreclipped(curX, curY, color);
-              }
-            }
-          }
-        }
-      }
+      bits[i] = pgm_read_byte(&bitmap[bo + i]);
     }
-    else // (textsize_x > 1 || textsize_y > 1)
+#else
+    const uint8_t *bits = &bitmap[bo];
+#endif
+
+    startWrite();
+    if ((gfxFontBpp > 1) || textAntiAlias)
     {
-      curY = y + (yo16 * textsize_y);
-      for (yy = 0; yy < h; ++yy, curY += textsize_y)
-      {
-        if ((curY + textsize_y - 1) <= _max_text_y)
-        {
-          curX = x + (xo16 * textsize_x);
-          for (xx = 0; xx < w; ++xx, curX += textsize_x, bits <<= 1)
-          {
-            if (!(bit++ & 7))
-            {
-              bits = pgm_read_byte(&bitmap[bo++]);
-            }
-            if ((curX + textsize_x - 1) <= _max_text_x)
-            {
-              if (bits & 0x80)
-              {
-                writeFillRectPreclipped(curX, curY, textsize_x - text_pixel_margin, textsize_y - text_pixel_margin, color);
-              }
-            }
-          }
-        }
-      }
+      writeGlyphAA(x, y - (baseline * textsize_y), xAdvance, yAdvance, xo, baseline + yo, bits, w, h, gfxFontBpp, color, bg);
+    }
+    else
+    {
+      writeGlyph(x, y - (baseline * textsize_y), xAdvance, yAdvance, xo, baseline + yo, bits, w, h, color, bg);
     }
     endWrite();
   }
@@ -2170,31 +3226,29 @@ void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
       return;
     }
 
-    if ((_u8g2_decode_ptr) && (_u8g2_char_width > 0))
+    if ((_u8g2_decode_ptr) && (_u8g2_char_width > 0) && (_u8g2_char_height > 0))
     {
-      uint8_t a, b;
-
       _u8g2_target_x = x + (_u8g2_char_x * textsize_x);
       // log_d("_u8g2_target_x: %d, _u8g2_target_y: %d", _u8g2_target_x, _u8g2_target_y);
 
-      /* reset local x/y position */
-      _u8g2_dx = 0;
-      _u8g2_dy = 0;
-      /* decode glyph */
-      startWrite();
-      for (;;)
+      const uint8_t *bits = _u8g2_glyph_bitmap;
+      uint8_t buf[bits ? 1 : (((uint16_t)_u8g2_char_width * _u8g2_char_height + 7) >> 3)];
+      if (!bits) // not in the glyph cache
       {
-        a = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_0);
-        b = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_1);
-        // log_d("a: %d, b: %d", a, b);
-        do
-        {
-          u8g2_font_decode_len(a, 0, color, bg);
-          u8g2_font_decode_len(b, 1, color, bg);
-        } while (u8g2_font_decode_get_unsigned_bits(1) != 0);
+        u8g2_font_decode_glyph(buf);
+        bits = buf;
+      }
 
-        if (_u8g2_dy >= _u8g2_char_height)
-          break;
+      startWrite();
+      if (textAntiAlias)
+      {
+        writeGlyphAA(_u8g2_target_x, _u8g2_target_y, _u8g2_char_width, _u8g2_char_height, 0, 0,
+                     bits, _u8g2_char_width, _u8g2_char_height, 1, color, bg);
+      }
+      else
+      {
+        writeGlyph(_u8g2_target_x, _u8g2_target_y, _u8g2_char_width, _u8g2_char_height, 0, 0,
+                   bits, _u8g2_char_width, _u8g2_char_height, color, bg);
       }
       endWrite();
     }
@@ -2202,101 +3256,28 @@ void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
   else // glcdfont
 #endif // defined(U8G2_FONT_SUPPORT)
   {
-    block_w = 6 * textsize_x;
-    block_h = 8 * textsize_y;
-    if (
-        (x > _max_text_x) ||                 // Clip right
-        (y > _max_text_y) ||                 // Clip bottom
-        ((x + block_w - 1) < _min_text_x) || // Clip left
-        ((y + block_h - 1) < _min_text_y)    // Clip top
-    )
+    // transpose the 5 columns into 8 rows of 5 bits, the 6th column is spacing
+    uint8_t bits[5] = {0};
+    for (uint8_t i = 0; i < 5; ++i)
     {
-      return;
-    }
-
-    startWrite();
-    if (textsize_x == 1 && textsize_y == 1)
-    {
-      curX = x;
-      for (int8_t i = 0; i < 5; ++i, ++curX) // Char bitmap = 5 columns
-      {
-        uint8_t line = pgm_read_byte(&font[c * 5 + i]);
-        if (curX <= _max_text_x)
-        {
-          curY = y;
-          for (int8_t j = 0; j < 8; ++j, ++curY, line >>= 1)
-          {
-            if (curY <= _max_text_y)
-            {
-              if (line & 1)
-              {
-                writePixelPreclipped(curX, curY, color);
-              }
-              else if (bg != color)
-              {
-                writePixelPreclipped(curX, curY, bg);
-              }
-            }
-          }
-        }
-      }
-      if (bg != color) // If opaque, draw vertical line for last column
+      uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+      for (uint8_t j = 0, idx = i; j < 8; ++j, idx += 5, line >>= 1)
       {
-        curX = x + 5;
-        if (curX <= _max_text_x)
+        if (line & 1)
         {
-          curH = ((y + 8 - 1) <= _max_text_y) ? 8 : (_max_text_y - y + 1);
-          writeFastVLine(curX, y, curH, bg);
+          bits[idx >> 3] |= 0x80 >> (idx & 7);
         }
       }
     }
-    else // (textsize_x > 1 || textsize_y > 1)
+
+    startWrite();
+    if (textAntiAlias)
     {
-      curX = x;
-      for (int8_t i = 0; i < 5; ++i, curX += textsize_x) // Char bitmap = 5 columns
-      {
-        if ((curX + textsize_x - 1) <= _max_text_x)
-        {
-          uint8_t line = pgm_read_byte(&font[c * 5 + i]);
-          curY = y;
-          for (int8_t j = 0; j < 8; j++, line >>= 1, curY += textsize_y)
-          {
-            if ((curY + textsize_y - 1) <= _max_text_y)
-            {
-              if (line & 1)
-              {
-                if (text_pixel_margin > 0)
-                {
-                  writeFillRectPreclipped(curX, y + j * textsize_y, textsize_x - text_pixel_margin, textsize_y - text_pixel_margin, color);
-                  writeFillRectPreclipped(curX + textsize_x - text_pixel_margin, y + j * textsize_y, text_pixel_margin, textsize_y, bg);
-                  writeFillRectPreclipped(curX, y + ((j + 1) * textsize_y) - text_pixel_margin, textsize_x - text_pixel_margin, text_pixel_margin, bg);
-                }
-                else
-                {
-                  writeFillRectPreclipped(curX, curY, textsize_x, textsize_y, color);
-                }
-              }
-              else if (bg != color)
-              {
-                writeFillRectPreclipped(curX, curY, textsize_x, textsize_y, bg);
-              }
-            }
-          }
-        }
-      }
-      if (bg != color) // If opaque, draw vertical line for last column
-      {
-        curX = x + 5 * textsize_x;
-        if ((curX + textsize_x - 1) <= _max_text_x)
-        {
-          curH = 8 * textsize_y;
-          while ((y + curH - 1) > _max_text_y)
-          {
-            curH -= textsize_y;
-          }
-          writeFillRectPreclipped(curX, y, textsize_x, curH, bg);
-        }
-      }
+      writeGlyphAA(x, y, 6, 8, 0, 0, bits, 5, 8, 1, color, bg);
+    }
+    else
+    {
+      writeGlyph(x, y, 6, 8, 0, 0, bits, 5, 8, color, bg);
     }
     endWrite();
   }
@@ -2399,79 +3380,8 @@ size_t Arduino_GFX::write(uint8_t c)
       }
       else if (_encoding != '\r')
       { // Ignore carriage returns
-        uint8_t *font = u8g2Font;
-        const uint8_t *glyph_data = 0;
-
-        // extract from u8g2_font_get_glyph_data()
-        font += 23; // U8G2_FONT_DATA_STRUCT_SIZE
-        if (_encoding <= 255)
+        if (u8g2_font_load_glyph(_encoding))
         {
-          if (_encoding >= 'a')
-          {
-            font += _u8g2_start_pos_lower_a;
-          }
-          else if (_encoding >= 'A')
-          {
-            font += _u8g2_start_pos_upper_A;
-          }
-
-          for (;;)
-          {
-            if (pgm_read_byte(font + 1) == 0)
-              break;
-            if (pgm_read_byte(font) == _encoding)
-            {
-              glyph_data = font + 2; /* skip encoding and glyph size */
-            }
-            font += pgm_read_byte(font + 1);
-          }
-        }
-#ifdef U8G2_WITH_UNICODE
-        else
-        {
-          uint16_t e;
-          font += _u8g2_start_pos_unicode;
-          const uint8_t *unicode_lookup_table = font;
-
-          /* issue 596: search for the glyph start in the unicode lookup table */
-          do
-          {
-            font += u8g2_font_get_word(unicode_lookup_table, 0);
-            e = u8g2_font_get_word(unicode_lookup_table, 2);
-            unicode_lookup_table += 4;
-          } while (e < _encoding);
-
-          for (;;)
-          {
-            e = u8g2_font_get_word(font, 0);
-
-            if (e == 0)
-              break;
-
-            if (e == _encoding)
-            {
-              glyph_data = font + 3; /* skip encoding and glyph size */
-              break;
-            }
-            font += pgm_read_byte(font + 2);
-          }
-        }
-#endif
-
-        if (glyph_data)
-        {
-          // u8g2_font_decode_glyph
-          _u8g2_decode_ptr = glyph_data;
-          _u8g2_decode_bit_pos = 0;
-
-          _u8g2_char_width = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_char_width);
-          _u8g2_char_height = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_char_height);
-          _u8g2_char_x = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_char_x);
-          _u8g2_char_y = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_char_y);
-          _u8g2_delta_x = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_delta_x);
-          // log_d("c: %c, _encoding: %d, _u8g2_char_width: %d, _u8g2_char_height: %d, _u8g2_char_x: %d, _u8g2_char_y: %d, _u8g2_delta_x: %d",
-          //       c, _encoding, _u8g2_char_width, _u8g2_char_height, _u8g2_char_x, _u8g2_char_y, _u8g2_delta_x);
-
           if (_u8g2_char_width > 0)
           {
             if (wrap && ((cursor_x + (textsize_x * _u8g2_char_width) - 1) > _max_text_x))
@@ -2589,8 +3499,25 @@ void Arduino_GFX::setRotation(uint8_t r)
 */
 /**************************************************************************/
 void Arduino_GFX::setFont(const GFXfont *f)
+{
+  setFont(f, 1);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Set a custom font whose bitmaps may hold coverage instead of bits
+  @param  f     The GFXfont object, if NULL use built in 6x8 font
+  @param  bpp   1 for an ordinary GFXfont, 4 for an anti-aliased one: every
+                pixel is a 0 to 15 coverage nibble, high nibble first, rows
+                packed back to back like the bits of a 1 bpp glyph. Glyphs
+                are blended with the text background color, or on a canvas
+                without one with what is under the text.
+*/
+/**************************************************************************/
+void Arduino_GFX::setFont(const GFXfont *f, uint8_t bpp)
 {
   gfxFont = (GFXfont *)f;
+  gfxFontBpp = (bpp == 4) ? 4 : 1;
 #if defined(U8G2_FONT_SUPPORT)
   u8g2Font = NULL;
 #endif // defined(U8G2_FONT_SUPPORT)
@@ -2655,6 +3582,30 @@ void Arduino_GFX::setFont(const uint8_t *font)
   _u8g2_first_char = pgm_read_byte(font + 23);
   // log_d("_u8g2_start_pos_upper_A: %d, _u8g2_start_pos_lower_a: %d, _u8g2_start_pos_unicode: %d, _u8g2_first_char: %d",
   //       _u8g2_start_pos_upper_A, _u8g2_start_pos_lower_a, _u8g2_start_pos_unicode, _u8g2_first_char);
+
+#if (U8G2_GLYPH_CACHE_SIZE > 0)
+  if (!_u8g2_cache)
+  {
+    _u8g2_cache = (u8g2_cached_glyph_t *)calloc(U8G2_GLYPH_CACHE_SIZE, sizeof(u8g2_cached_glyph_t));
+  }
+#endif // (U8G2_GLYPH_CACHE_SIZE > 0)
+
+#if (U8G2_GLYPH_INDEX_FONTS > 0)
+  _u8g2_cur_index = NULL;
+  for (uint8_t i = 0; i < U8G2_GLYPH_INDEX_FONTS; ++i)
+  {
+    if (_u8g2_index[i].font == u8g2Font)
+    {
+      _u8g2_cur_index = &_u8g2_index[i];
+    }
+  }
+  if (!_u8g2_cur_index) // index a new font, replacing the oldest one
+  {
+    _u8g2_cur_index = &_u8g2_index[_u8g2_index_next];
+    _u8g2_index_next = (_u8g2_index_next + 1) % U8G2_GLYPH_INDEX_FONTS;
+    u8g2_font_build_index(_u8g2_cur_index);
+  }
+#endif // (U8G2_GLYPH_INDEX_FONTS > 0)
 }
 
 void Arduino_GFX::setUTF8Print(bool isEnable)
@@ -2789,79 +3740,8 @@ void Arduino_GFX::charBounds(char c, int16_t *x, int16_t *y,
       }
       else if (_encoding != '\r')
       { // Ignore carriage returns
-        uint8_t *font = u8g2Font;
-        const uint8_t *glyph_data = 0;
-
-        // extract from u8g2_font_get_glyph_data()
-        font += 23; // U8G2_FONT_DATA_STRUCT_SIZE
-        if (_encoding <= 255)
+        if (u8g2_font_load_glyph(_encoding))
         {
-          if (_encoding >= 'a')
-          {
-            font += _u8g2_start_pos_lower_a;
-          }
-          else if (_encoding >= 'A')
-          {
-            font += _u8g2_start_pos_upper_A;
-          }
-
-          for (;;)
-          {
-            if (pgm_read_byte(font + 1) == 0)
-              break;
-            if (pgm_read_byte(font) == _encoding)
-            {
-              glyph_data = font + 2; /* skip encoding and glyph size */
-            }
-            font += pgm_read_byte(font + 1);
-          }
-        }
-#ifdef U8G2_WITH_UNICODE
-        else
-        {
-          uint16_t e;
-          font += _u8g2_start_pos_unicode;
-          const uint8_t *unicode_lookup_table = font;
-
-          /* issue 596: search for the glyph start in the unicode lookup table */
-          do
-          {
-            font += u8g2_font_get_word(unicode_lookup_table, 0);
-            e = u8g2_font_get_word(unicode_lookup_table, 2);
-            unicode_lookup_table += 4;
-          } while (e < _encoding);
-
-          for (;;)
-          {
-            e = u8g2_font_get_word(font, 0);
-
-            if (e == 0)
-              break;
-
-            if (e == _encoding)
-            {
-              glyph_data = font + 3; /* skip encoding and glyph size */
-              break;
-            }
-            font += pgm_read_byte(font + 2);
-          }
-        }
-#endif
-
-        if (glyph_data)
-        {
-          // u8g2_font_decode_glyph
-          _u8g2_decode_ptr = glyph_data;
-          _u8g2_decode_bit_pos = 0;
-
-          _u8g2_char_width = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_char_width);
-          _u8g2_char_height = u8g2_font_decode_get_unsigned_bits(_u8g2_bits_per_char_height);
-          _u8g2_char_x = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_char_x);
-          _u8g2_char_y = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_char_y);
-          _u8g2_delta_x = u8g2_font_decode_get_signed_bits(_u8g2_bits_per_delta_x);
-          // log_d("c: %c, _encoding: %d, _u8g2_char_width: %d, _u8g2_char_height: %d, _u8g2_char_x: %d, _u8g2_char_y: %d, _u8g2_delta_x: %d",
-          //       c, _encoding, _u8g2_char_width, _u8g2_char_height, _u8g2_char_x, _u8g2_char_y, _u8g2_delta_x);
-
           if (_u8g2_char_width > 0)
           {
             if (wrap && ((*x + (textsize_x * _u8g2_char_width) - 1) > _max_text_x))
@@ -7,6 +7,7 @@
 
 #include "Arduino_G.h"
 #include "Arduino_DataBus.h"
+#include "GFXAsset.h"
 #include <Print.h>
 
 #if !defined(ATTINY_CORE)
@@ -17,6 +18,14 @@
 #define DEGTORAD 0.017453292519943295769236907684886F
 #endif
 
+#define GFX_ANGLE_SCALE 64 // gfx_sin_q14() angle units per degree
+#ifndef GFX_ARC_AA_CHUNK
+#define GFX_ARC_AA_CHUNK 64 // pixels of coverage buffer for anti-aliased drawing
+#endif
+
+// sin() of an angle in 1/GFX_ANGLE_SCALE degree, Q14 (16384 is 1.0)
+int16_t gfx_sin_q14(int32_t angle);
+
 #if __has_include(<U8g2lib.h>)
 #include <U8g2lib.h>
 #define U8G2_FONT_SUPPORT
@@ -27,6 +36,38 @@
 #include "font/u8g2_font_unifont_t_chinese.h"
 #include "font/u8g2_font_unifont_t_chinese4.h"
 #include "font/u8g2_font_unifont_t_cjk.h"
+
+#ifndef U8G2_GLYPH_CACHE_SIZE
+#define U8G2_GLYPH_CACHE_SIZE 32 // decoded glyphs kept for reuse, 0 to disable
+#endif
+#ifndef U8G2_GLYPH_CACHE_BYTES
+#define U8G2_GLYPH_CACHE_BYTES 72 // 1 bit bitmap bytes per cache slot, fits 24x24 glyphs
+#endif
+#ifndef U8G2_GLYPH_INDEX_FONTS
+#define U8G2_GLYPH_INDEX_FONTS 4 // fonts with an encoding to glyph index, 0 to disable
+#endif
+
+typedef struct
+{
+  const uint8_t *font;                    ///< Font the glyph belongs to
+  const uint8_t *glyph_data;              ///< Glyph data in the font
+  uint32_t last_used;                     ///< Cache tick of the last use
+  uint16_t encoding;                      ///< Glyph encoding
+  uint8_t width;                          ///< Bitmap dimensions in pixels
+  uint8_t height;                         ///< Bitmap dimensions in pixels
+  int8_t x;                               ///< X offset from cursor
+  int8_t y;                               ///< Y offset from baseline to glyph bottom
+  int8_t delta_x;                         ///< Distance to advance cursor
+  uint8_t bitmap[U8G2_GLYPH_CACHE_BYTES]; ///< Unscaled 1 bit bitmap, rows packed MSB first
+} u8g2_cached_glyph_t;
+
+typedef struct
+{
+  const uint8_t *font; ///< Indexed font
+  uint16_t count;      ///< Number of glyphs, 0 when the index could not be built
+  uint16_t *encodings; ///< Glyph encodings, ascending
+  uint32_t *offsets;   ///< Glyph data offsets from the font start
+} u8g2_glyph_index_t;
 #endif
 
 #define RGB565(r, g, b) ((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | ((b) >> 3))
@@ -169,8 +210,11 @@ class Arduino_GFX : public Print
 class Arduino_GFX : public Print, public Arduino_G
 #endif // !defined(LITTLE_FOOT_PRINT)
 {
+  friend class Arduino_TextLayout;
+
 public:
   Arduino_GFX(int16_t w, int16_t h); // Constructor
+  virtual ~Arduino_GFX();
 
   // This MUST be defined by the subclass:
   virtual bool begin(int32_t speed = GFX_NOT_DEFINED) = 0;
@@ -233,13 +277,17 @@ public:
 
 #if !defined(ATTINY_CORE)
   void setFont(const GFXfont *f = NULL);
+  void setFont(const GFXfont *f, uint8_t bpp);
 #if defined(U8G2_FONT_SUPPORT)
   void setFont(const uint8_t *font);
   void setUTF8Print(bool isEnable);
   uint16_t u8g2_font_get_word(const uint8_t *font, uint8_t offset);
   uint8_t u8g2_font_decode_get_unsigned_bits(uint8_t cnt);
   int8_t u8g2_font_decode_get_signed_bits(uint8_t cnt);
-  void u8g2_font_decode_len(uint8_t len, uint8_t is_foreground, uint16_t color, uint16_t bg);
+  void u8g2_font_decode_glyph(uint8_t *bitmap);
+  void u8g2_font_build_index(u8g2_glyph_index_t *index);
+  const uint8_t *u8g2_font_get_glyph_data(uint16_t encoding);
+  bool u8g2_font_load_glyph(uint16_t encoding);
 #endif // defined(U8G2_FONT_SUPPORT)
   virtual void flush(void);
 #endif // !defined(ATTINY_CORE)
@@ -251,7 +299,21 @@ public:
   void writeFillEllipseHelper(int32_t x, int32_t y, int32_t rx, int32_t ry, uint8_t cornername, int16_t delta, uint16_t color);
   void drawArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color);
   void fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color);
+  void fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color, uint16_t bg);
   void writeFillArcHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t iradius, float start, float end, uint16_t color);
+  void writeFillArcAAHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t iradius, float start, float end, uint16_t color, uint16_t bg);
+
+  // anti-aliased, edges are blended with bg; with bg the same as color, on a
+  // canvas with what is under them, on a display half covered pixels are drawn
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, uint16_t bg);
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint16_t bg);
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint16_t bg);
+  void drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t radius, uint16_t color, uint16_t bg);
+  void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t radius, uint16_t color, uint16_t bg);
+  void writeLineAAHelper(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, uint16_t bg);
+  void writeRoundRectAAHelper(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, bool fill, uint16_t color, uint16_t bg);
+  void writeCoverageSpan(int16_t x, int16_t y, const uint8_t *cov, int16_t len, uint16_t color, uint16_t bg);
+  void writeGlyphAA(int16_t x, int16_t y, uint8_t bw, uint8_t bh, int8_t gx, int8_t gy, const uint8_t *bitmap, uint8_t gw, uint8_t gh, uint8_t bpp, uint16_t color, uint16_t bg);
 
 // TFT optimization code, too big for ATMEL family
 #if defined(LITTLE_FOOT_PRINT)
@@ -271,6 +333,8 @@ public:
   void draw24bitRGBBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h);
   void draw24bitRGBBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h);
   void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg);
+  void writeGlyph(int16_t x, int16_t y, uint8_t bw, uint8_t bh, int8_t gx, int8_t gy, const uint8_t *bitmap, uint8_t gw, uint8_t gh, uint16_t color, uint16_t bg);
+  void writeCoverageSpanPreclipped(int16_t x, int16_t y, const uint8_t *cov, int16_t len, uint16_t color, uint16_t bg);
 #else  // !defined(LITTLE_FOOT_PRINT)
   virtual void writeSlashLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
   virtual void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg);
@@ -287,7 +351,10 @@ public:
   virtual void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h);
   virtual void draw24bitRGBBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h);
   virtual void draw24bitRGBBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h);
+  virtual void drawAsset(int16_t x, int16_t y, const uint8_t *asset, uint32_t len);
   virtual void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg);
+  virtual void writeGlyph(int16_t x, int16_t y, uint8_t bw, uint8_t bh, int8_t gx, int8_t gy, const uint8_t *bitmap, uint8_t gw, uint8_t gh, uint16_t color, uint16_t bg);
+  virtual void writeCoverageSpanPreclipped(int16_t x, int16_t y, const uint8_t *cov, int16_t len, uint16_t color, uint16_t bg);
 
   virtual void draw16bitBeRGBBitmapR1(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h);
 #endif // !defined(LITTLE_FOOT_PRINT)
@@ -351,6 +418,16 @@ public:
   /**********************************************************************/
   void setTextWrap(bool w) { wrap = w; }
 
+  /**********************************************************************/
+  /*!
+  @brief  Set whether text enlarged by setTextSize() is drawn with smooth
+          edges instead of blocks, blended with the text background color,
+          or on a canvas without one with what is under the text
+  @param  aa  true for smooth edges
+  */
+  /**********************************************************************/
+  void setTextAntiAlias(bool aa) { textAntiAlias = aa; }
+
   virtual size_t write(uint8_t);
 
   /************************************************************************/
@@ -412,6 +489,8 @@ public:
 
 protected:
   void charBounds(char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy);
+  bool clipToTextBound(int16_t *x, int16_t *y, int16_t *w, int16_t *h);
+  void writeFillRectTextBound(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
   int16_t
       _width,  ///< Display width as modified by current rotation
       _height, ///< Display height as modified by current rotation
@@ -432,10 +511,12 @@ protected:
       text_pixel_margin, ///< Margin for each text pixel
       _rotation;         ///< Display rotation (0 thru 3)
   bool
-      wrap; ///< If set, 'wrap' text at right edge of display
+      wrap,          ///< If set, 'wrap' text at right edge of display
+      textAntiAlias; ///< If set, scaled text gets smooth edges
 #if !defined(ATTINY_CORE)
-  GFXfont *gfxFont; ///< Pointer to special font
-#endif              // !defined(ATTINY_CORE)
+  GFXfont *gfxFont;   ///< Pointer to special font
+  uint8_t gfxFontBpp; ///< Bits per pixel of gfxFont bitmaps, 1 or 4
+#endif                // !defined(ATTINY_CORE)
 
 #if defined(U8G2_FONT_SUPPORT)
   uint8_t *u8g2Font;
@@ -464,13 +545,20 @@ protected:
   int8_t _u8g2_char_y;
   int8_t _u8g2_delta_x;
 
-  int8_t _u8g2_dx;
-  int8_t _u8g2_dy;
   int16_t _u8g2_target_x;
   int16_t _u8g2_target_y;
 
   const uint8_t *_u8g2_decode_ptr;
   uint8_t _u8g2_decode_bit_pos;
+
+  u8g2_cached_glyph_t *_u8g2_cache = NULL;
+  uint32_t _u8g2_cache_tick = 0;
+  const uint8_t *_u8g2_glyph_bitmap = NULL;
+#if (U8G2_GLYPH_INDEX_FONTS > 0)
+  u8g2_glyph_index_t _u8g2_index[U8G2_GLYPH_INDEX_FONTS] = {};
+  u8g2_glyph_index_t *_u8g2_cur_index = NULL;
+  uint8_t _u8g2_index_next = 0;
+#endif // (U8G2_GLYPH_INDEX_FONTS > 0)
 #endif // defined(U8G2_FONT_SUPPORT)
 
 #if defined(LITTLE_FOOT_PRINT)
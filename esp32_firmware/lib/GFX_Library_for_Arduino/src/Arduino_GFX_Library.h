@@ -45,6 +45,12 @@
 #include "canvas/Arduino_Canvas_Indexed.h"
 #include "canvas/Arduino_Canvas_3bit.h"
 #include "canvas/Arduino_Canvas_Mono.h"
+#include "canvas/Arduino_Canvas_Tiled.h"
+#include "canvas/Arduino_Canvas_DisplayList.h"
+#include "canvas/Arduino_Sprite.h"
+#include "canvas/Arduino_Compositor.h"
+#include "canvas/Arduino_DisplayScheduler.h"
+#include "Arduino_TextLayout.h"
 #include "display/Arduino_ILI9488_3bit.h"
 #endif // !defined(LITTLE_FOOT_PRINT)
 
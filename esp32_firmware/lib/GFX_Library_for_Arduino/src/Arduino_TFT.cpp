@@ -5,9 +5,13 @@
 #include "Arduino_DataBus.h"
 #include "Arduino_GFX.h"
 #include "Arduino_TFT.h"
+#include "PixelConvert.h"
 #include "font/glcdfont.h"
 #include "pin_config.h"
 
+#define TFT_CONVERT_PIXELS 256 // stack buffer for 8 and 24-bit bitmap conversion
+#define TFT_COVERAGE_RUN 8     // fully covered pixels sent as a fill instead of in the blended window
+
 Arduino_TFT::Arduino_TFT(
     Arduino_DataBus *bus, int8_t rst, uint8_t r,
     bool ips, int16_t w, int16_t h,
@@ -433,13 +437,16 @@ void Arduino_TFT::drawGrayscaleBitmap(
   else
   {
     uint32_t len = (uint32_t)w * h;
-    uint8_t v;
+    uint32_t buf[TFT_CONVERT_PIXELS / 2]; // word aligned for the conversion kernel
     startWrite();
     writeAddrWindow(x, y, w, h);
-    while (len--)
+    while (len)
     {
-      v = *(bitmap++);
-      _bus->write16(color565(v, v, v));
+      uint32_t n = min(len, (uint32_t)TFT_CONVERT_PIXELS);
+      gfx_gray_to_rgb565((uint16_t *)buf, bitmap, n);
+      _bus->writePixels((uint16_t *)buf, n);
+      bitmap += n;
+      len -= n;
     }
     endWrite();
   }
@@ -796,305 +803,187 @@ void Arduino_TFT::draw24bitRGBBitmap(
   else
   {
     uint32_t len = (uint32_t)w * h;
-    uint32_t offset = 0;
+    uint32_t buf[TFT_CONVERT_PIXELS / 2]; // word aligned for the conversion kernel
     startWrite();
     writeAddrWindow(x, y, w, h);
-    while (len--)
+    while (len)
     {
-      _bus->write16(color565(bitmap[offset], bitmap[offset + 1], bitmap[offset + 2]));
-      offset += 3;
+      uint32_t n = min(len, (uint32_t)TFT_CONVERT_PIXELS);
+      gfx_rgb888_to_rgb565((uint16_t *)buf, bitmap, n);
+      _bus->writePixels((uint16_t *)buf, n);
+      bitmap += n * 3;
+      len -= n;
     }
     endWrite();
   }
 }
 
-void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg)
+void Arduino_TFT::drawAsset(int16_t x, int16_t y, const uint8_t *asset, uint32_t len)
 {
-  uint16_t block_w;
-  uint16_t block_h;
-
-#if !defined(ATTINY_CORE)
-  if (gfxFont) // custom font
+  gfx_asset_decoder_t d;
+  if (!gfx_asset_open(&d, asset, len))
   {
-    // Character is assumed previously filtered by write() to eliminate
-    // newlines, returns, non-printable characters, etc.  Calling
-    // drawChar() directly with 'bad' characters of font may cause mayhem!
-    uint8_t first = pgm_read_byte(&gfxFont->first);
-    GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
-    uint8_t *bitmap = pgm_read_bitmap_ptr(gfxFont);
-
-    uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
-    uint8_t w = pgm_read_byte(&glyph->width),
-            h = pgm_read_byte(&glyph->height),
-            xAdvance = pgm_read_byte(&glyph->xAdvance),
-            yAdvance = pgm_read_byte(&gfxFont->yAdvance),
-            baseline = yAdvance * 2 / 3; // TODO: baseline is an arbitrary currently, may be define in font file
-    int8_t xo = pgm_read_sbyte(&glyph->xOffset),
-           yo = pgm_read_sbyte(&glyph->yOffset);
-    // urgly workaround for the character not fit in the box
-    if ((bg != color)             // have background color
-        && ((xo + w) > xAdvance)) // if character draw outside the box
+    return;
+  }
+  if (
+      (x < 0) ||                      // Clip left
+      (y < 0) ||                      // Clip top
+      ((x + d.width - 1) > _max_x) || // Clip right
+      ((y + d.height - 1) > _max_y))  // Clip bottom
+  {
+    Arduino_GFX::drawAsset(x, y, asset, len);
+  }
+  else
+  {
+    // one window for the whole image, decoded chunks go straight to the bus
+    uint32_t left = (uint32_t)d.width * d.height;
+    uint32_t buf[GFX_ASSET_BUF_PIXELS / 2];
+    startWrite();
+    writeAddrWindow(x, y, d.width, d.height);
+    while (left)
     {
-      xo = xAdvance - w; // pad inside the box
+      uint32_t n = gfx_asset_decode(&d, (uint16_t *)buf, min(left, (uint32_t)GFX_ASSET_BUF_PIXELS));
+      if (n == 0)
+      {
+        break;
+      }
+      _bus->writePixels((uint16_t *)buf, n);
+      left -= n;
     }
+    endWrite();
+  }
+}
 
-    uint8_t xx, yy, bits = 0, bit = 0;
-    int16_t xo16 = xo, yo16 = yo;
+void Arduino_TFT::writeGlyph(int16_t x, int16_t y, uint8_t bw, uint8_t bh, int8_t gx, int8_t gy,
+                             const uint8_t *bitmap, uint8_t gw, uint8_t gh, uint16_t color, uint16_t bg)
+{
+  if (bg == color) // no background color, draw the glyph runs only
+  {
+    Arduino_GFX::writeGlyph(x, y, bw, bh, gx, gy, bitmap, gw, gh, color, bg);
+    return;
+  }
 
-    if (xAdvance < w)
-    {
-      xAdvance = w; // Don't know why it exists
-    }
+  // opaque: send the whole (clipped) box as one window, one line buffer per font row
+  int16_t block_w = bw * textsize_x;
+  int16_t cx = x, cy = y, cw = block_w, ch = bh * textsize_y;
+  if (!clipToTextBound(&cx, &cy, &cw, &ch))
+  {
+    return;
+  }
+  writeAddrWindow(cx, cy, cw, ch);
 
-    block_w = xAdvance * textsize_x;
-    block_h = yAdvance * textsize_y;
-    int16_t x1 = (xo < 0) ? (x + xo) : x;
-    if (
-        (x1 < _min_text_x) ||                        // Clip left
-        ((y - baseline) < _min_text_y) ||            // Clip top
-        ((x1 + block_w - 1) > _max_text_x) ||        // Clip right
-        ((y - baseline + block_h - 1) > _max_text_y) // Clip bottom
-    )
-    {
-      // partial draw char by parent class
-      Arduino_GFX::drawChar(x, y, c, color, bg);
-    }
-    else
+  uint16_t line_buf[block_w];
+  uint16_t *line = line_buf + (cx - x);
+  uint8_t pw = textsize_x - text_pixel_margin;
+  uint8_t ph = textsize_y - text_pixel_margin;
+  int16_t curY = y;
+  for (int16_t yy = 0; yy < bh; ++yy)
+  {
+    int16_t row = yy - gy;
+    bool has_dot = false;
+    if ((row >= 0) && (row < gh) && ((curY + textsize_y) > cy))
     {
-      // NOTE: Different from Adafruit_GFX design, Adruino_GFX also cater background.
-      // Since it may introduce many ugly output, it should limited using on mono font only.
-      if (xo < 0) // padding X offset to >= 0
-      {
-        x += xo;
-        xo = 0;
-      }
-
-      startWrite();
-      if (bg != color) // have background color
+      uint16_t bit = row * gw;
+      int16_t i = gx * textsize_x;
+      for (uint8_t xx = 0; xx < gw; ++xx, ++bit, i += textsize_x)
       {
-        writeAddrWindow(x, y - (baseline * textsize_y), block_w, block_h);
-
-        uint16_t line_buf[block_w];
-        int8_t i;
-        bool draw_dot;
-        for (yy = 0; yy < yAdvance; yy++)
+        bool draw_dot = bitmap[bit >> 3] & (0x80 >> (bit & 7));
+        if (!draw_dot && !has_dot)
+        {
+          continue;
+        }
+        if (!has_dot) // first dot of the row, clear the line
         {
-          if ((yy < (baseline + yo)) || (yy > (baseline + yo + h - 1)))
+          for (int16_t k = 0; k < block_w; ++k)
           {
-            writeRepeat(bg, block_w * textsize_y);
-          }
-          else
-          {
-            i = 0;
-            for (xx = 0; xx < xAdvance; xx++)
-            {
-              if ((xx < xo) || (xx > (xo + w - 1)))
-              {
-                draw_dot = false;
-              }
-              else
-              {
-                if (!(bit++ & 7))
-                {
-                  bits = pgm_read_byte(&bitmap[bo++]);
-                }
-                draw_dot = bits & 0x80;
-                bits <<= 1;
-              }
-
-              if (textsize_x == 1)
-              {
-                line_buf[i++] = draw_dot ? color : bg;
-              }
-              else
-              {
-                if (draw_dot)
-                {
-                  for (int8_t k = 0; k < textsize_x; k++)
-                  {
-                    line_buf[i++] = (k < (textsize_x - text_pixel_margin)) ? color : bg;
-                  }
-                }
-                else
-                {
-                  for (int8_t k = 0; k < textsize_x; k++)
-                  {
-                    line_buf[i++] = bg;
-                  }
-                }
-              }
-            }
-            if (textsize_y == 1)
-            {
-              writePixels(line_buf, block_w);
-            }
-            else
-            {
-              for (int8_t l = 0; l < textsize_y; l++)
-              {
-                if (l < (textsize_y - text_pixel_margin))
-                {
-                  writePixels(line_buf, block_w);
-                }
-                else
-                {
-                  writeRepeat(bg, block_w);
-                }
-              }
-            }
+            line_buf[k] = bg;
           }
+          has_dot = true;
         }
-      }
-      else // (bg == color), no background color
-      {
-        for (yy = 0; yy < h; yy++)
+        if (draw_dot && (i >= 0) && (i < block_w))
         {
-          for (xx = 0; xx < w; xx++)
+          for (uint8_t k = 0; k < pw; ++k)
           {
-            if (!(bit++ & 7))
-            {
-              bits = pgm_read_byte(&bitmap[bo++]);
-            }
-            if (bits & 0x80)
-            {
-              if (textsize_x == 1 && textsize_y == 1)
-              {
-                writePixelPreclipped(x + xo + xx, y + yo + yy, color);
-              }
-              else
-              {
-                writeFillRectPreclipped(x + (xo16 + xx) * textsize_x, y + (yo16 + yy) * textsize_y,
-                                        textsize_x - text_pixel_margin, textsize_y - text_pixel_margin, color);
-              }
-            }
-            bits <<= 1;
+            line_buf[i + k] = color;
           }
         }
       }
-      endWrite();
+    }
+    for (uint8_t l = 0; l < textsize_y; ++l, ++curY)
+    {
+      if ((curY < cy) || (curY >= (cy + ch)))
+      {
+        continue;
+      }
+      if (has_dot && (l < ph))
+      {
+        writePixels(line, cw);
+      }
+      else
+      {
+        writeRepeat(bg, cw);
+      }
     }
   }
-  else // not gfxFont
-#endif // !defined(ATTINY_CORE)
-#if defined(U8G2_FONT_SUPPORT)
-      if (u8g2Font)
+}
+
+// blended pixels between the gaps and long fully covered runs go out as one
+// window each, instead of one window per edge pixel
+void Arduino_TFT::writeCoverageSpanPreclipped(int16_t x, int16_t y, const uint8_t *cov, int16_t len, uint16_t color, uint16_t bg)
+{
+  if (bg == color) // no background color, nothing to blend with
   {
-    Arduino_GFX::drawChar(x, y, c, color, bg);
+    Arduino_GFX::writeCoverageSpanPreclipped(x, y, cov, len, color, bg);
+    return;
   }
-  else // not u8g2Font
-#endif // defined(U8G2_FONT_SUPPORT)
+
+  uint16_t buf[GFX_ARC_AA_CHUNK];
+  int16_t i = 0;
+  while (i < len)
   {
-    block_w = 6 * textsize_x;
-    block_h = 8 * textsize_y;
-    if (
-        (x < _min_text_x) ||                 // Clip left
-        (y < _min_text_y) ||                 // Clip top
-        ((x + block_w - 1) > _max_text_x) || // Clip right
-        ((y + block_h - 1) > _max_text_y)    // Clip bottom
-    )
+    if (!cov[i])
     {
-      // partial draw char by parent class
-      Arduino_GFX::drawChar(x, y, c, color, bg);
+      ++i;
+      continue;
     }
-    else
+    int16_t run = 0;
+    while (((i + run) < len) && (cov[i + run] == 255))
     {
-      uint8_t col[5];
-      for (int8_t i = 0; i < 5; i++)
-      {
-        col[i] = pgm_read_byte(&font[c * 5 + i]);
-      }
-
-      startWrite();
-      if (bg != color) // have background color
+      ++run;
+    }
+    if (run >= TFT_COVERAGE_RUN)
+    {
+      writeFillRectPreclipped(x + i, y, run, 1, color);
+      i += run;
+      continue;
+    }
+    int16_t start = i;
+    uint8_t n = 0;
+    while ((i < len) && cov[i] && (n < GFX_ARC_AA_CHUNK))
+    {
+      if (cov[i] == 255)
       {
-        writeAddrWindow(x, y, block_w, block_h);
-
-        uint16_t line_buf[block_w];
-        if (textsize_x == 1)
+        run = 0;
+        while (((i + run) < len) && (cov[i + run] == 255) && (run < TFT_COVERAGE_RUN))
         {
-          line_buf[5] = bg; // last column always bg
-        }
-        else
-        {
-          for (int8_t k = 0; k < textsize_x; k++)
-          {
-            line_buf[5 * textsize_x + k] = bg;
-          }
+          ++run;
         }
-        uint8_t bit = 1;
-        bool draw_dot;
-
-        while (bit)
+        if (run >= TFT_COVERAGE_RUN)
         {
-          for (int8_t i = 0; i < 5; i++)
-          {
-            draw_dot = col[i] & bit;
-            if (textsize_x == 1)
-            {
-              line_buf[i] = (draw_dot) ? color : bg;
-            }
-            else
-            {
-              if (draw_dot)
-              {
-                for (int8_t k = 0; k < textsize_x; k++)
-                {
-                  line_buf[i * textsize_x + k] = (k < (textsize_x - text_pixel_margin)) ? color : bg;
-                }
-              }
-              else
-              {
-                for (int8_t k = 0; k < textsize_x; k++)
-                {
-                  line_buf[i * textsize_x + k] = bg;
-                }
-              }
-            }
-          }
-          if (textsize_y == 1)
-          {
-            writePixels(line_buf, block_w);
-          }
-          else
-          {
-            for (int8_t l = 0; l < textsize_y; l++)
-            {
-              if (l < (textsize_y - text_pixel_margin))
-              {
-                writePixels(line_buf, block_w);
-              }
-              else
-              {
-                writeRepeat(bg, block_w);
-              }
-            }
-          }
-          bit <<= 1;
+          break;
         }
+        buf[n] = color;
       }
-      else // (bg == color), no background color
+      else
       {
-        for (int8_t i = 0; i < 5; i++)
-        { // Char bitmap = 5 columns
-          uint8_t line = col[i];
-          for (int8_t j = 0; j < 8; j++, line >>= 1)
-          {
-            if (line & 1)
-            {
-              if (textsize_x == 1 && textsize_y == 1)
-              {
-                writePixelPreclipped(x + i, y + j, color);
-              }
-              else
-              {
-                writeFillRectPreclipped(x + i * textsize_x, y + j * textsize_y, textsize_x - text_pixel_margin, textsize_y - text_pixel_margin, color);
-              }
-            }
-          }
-        }
+        buf[n] = bg;
+        gfx_blend_rgb565_color(&buf[n], color, cov[i], 1);
       }
-      endWrite();
+      ++n;
+      ++i;
     }
+    writeAddrWindow(x + start, y, n, 1);
+    _bus->writePixels(buf, n);
   }
 }
 
@@ -57,7 +57,9 @@ public:
   void draw16bitBeRGBBitmapR1(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
   void draw24bitRGBBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h) override;
   void draw24bitRGBBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h) override;
-  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg) override;
+  void drawAsset(int16_t x, int16_t y, const uint8_t *asset, uint32_t len) override;
+  void writeGlyph(int16_t x, int16_t y, uint8_t bw, uint8_t bh, int8_t gx, int8_t gy, const uint8_t *bitmap, uint8_t gw, uint8_t gh, uint16_t color, uint16_t bg) override;
+  void writeCoverageSpanPreclipped(int16_t x, int16_t y, const uint8_t *cov, int16_t len, uint16_t color, uint16_t bg) override;
 #endif // !defined(LITTLE_FOOT_PRINT)
 
 protected:
@@ -0,0 +1,375 @@
+#include "Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "Arduino_TextLayout.h"
+
+// screen x of the left edge of a text anchored at x
+static int16_t text_layout_left(int16_t x, uint8_t align, int16_t advance)
+{
+  if (align == TEXT_ALIGN_CENTER)
+  {
+    return x - (advance / 2);
+  }
+  if (align == TEXT_ALIGN_RIGHT)
+  {
+    return x - advance;
+  }
+  return x;
+}
+
+/**************************************************************************/
+/*!
+   @brief   A line of text on gfx, measured with the font and text size gfx
+            has when setText() or update() is called
+    @param    gfx     Display or canvas to draw on
+    @param    x       Left edge, center or right edge by align
+    @param    y       Cursor y, as for setCursor()
+    @param    align   TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTER or TEXT_ALIGN_RIGHT
+*/
+/**************************************************************************/
+Arduino_TextLayout::Arduino_TextLayout(Arduino_GFX *gfx, int16_t x, int16_t y, uint8_t align)
+    : _gfx(gfx), _x(x), _y(y), _align(align)
+{
+  memset(&_cur, 0, sizeof(_cur));
+  memset(&_drawn, 0, sizeof(_drawn));
+}
+
+void Arduino_TextLayout::setPosition(int16_t x, int16_t y, uint8_t align)
+{
+  _x = x;
+  _y = y;
+  _align = align;
+  _redrawAll = true;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Text and background color, the same color for both draws
+            without erasing
+    @param    color   16-bit 5-6-5 Color of the text
+    @param    bg      16-bit 5-6-5 Color changed glyph cells are filled with
+*/
+/**************************************************************************/
+void Arduino_TextLayout::setColor(uint16_t color, uint16_t bg)
+{
+  if ((color != _color) || (bg != _bg))
+  {
+    _color = color;
+    _bg = bg;
+    _redrawAll = true;
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Set the text, measured only if it or the font changed
+    @param    text   One line, '\n' and '\r' are skipped
+    @return   true if the layout was measured again
+*/
+/**************************************************************************/
+bool Arduino_TextLayout::setText(const char *text)
+{
+  if (!text)
+  {
+    text = "";
+  }
+  if (_measured && (!fontChanged()) && (strncmp(_cur.text, text, TEXTLAYOUT_MAX_BYTES) == 0))
+  {
+    return false;
+  }
+  strncpy(_cur.text, text, TEXTLAYOUT_MAX_BYTES);
+  _cur.text[TEXTLAYOUT_MAX_BYTES] = 0;
+  measure();
+  return true;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Draw the whole text, erasing what was drawn before
+    @return   number of glyphs drawn
+*/
+/**************************************************************************/
+uint16_t Arduino_TextLayout::draw()
+{
+  if ((!_measured) || fontChanged())
+  {
+    measure();
+  }
+  return redraw(true);
+}
+
+/**************************************************************************/
+/*!
+   @brief   Bring the screen up to date with the text, drawing only the
+            glyphs that changed or moved since the last draw
+    @return   number of glyphs drawn
+*/
+/**************************************************************************/
+uint16_t Arduino_TextLayout::update()
+{
+  if ((!_measured) || fontChanged())
+  {
+    measure();
+  }
+  return redraw((!_shown) || _redrawAll);
+}
+
+uint16_t Arduino_TextLayout::update(const char *text)
+{
+  setText(text);
+  return update();
+}
+
+// measure again on the next update() or draw(), e.g. after the text bound changed
+void Arduino_TextLayout::invalidate()
+{
+  _measured = false;
+  _redrawAll = true;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Pixels the current text covers at the current position, as
+            Arduino_GFX::getTextBounds()
+    @param    x1   Left column, set by function
+    @param    y1   Top row, set by function
+    @param    w    Width, 0 for no pixels, set by function
+    @param    h    Height, 0 for no pixels, set by function
+*/
+/**************************************************************************/
+void Arduino_TextLayout::getTextBounds(int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+{
+  if ((!_measured) || fontChanged())
+  {
+    measure();
+  }
+  int16_t left = text_layout_left(_x, _align, _cur.advance);
+  *x1 = left;
+  *y1 = _y;
+  *w = *h = 0;
+  if (_cur.x2 >= _cur.x1)
+  {
+    *x1 = left + _cur.x1;
+    *y1 = _y + _cur.y1;
+    *w = _cur.x2 - _cur.x1 + 1;
+    *h = _cur.y2 - _cur.y1 + 1;
+  }
+}
+
+bool Arduino_TextLayout::fontChanged()
+{
+  const void *font = _gfx->gfxFont;
+#if defined(U8G2_FONT_SUPPORT)
+  if (_gfx->u8g2Font)
+  {
+    font = _gfx->u8g2Font;
+  }
+#endif // defined(U8G2_FONT_SUPPORT)
+  return (font != _font) || (_gfx->textsize_x != _sizeX) || (_gfx->textsize_y != _sizeY);
+}
+
+// walk the text once with charBounds(), no wrapping, relative to a pen at 0,0
+void Arduino_TextLayout::measure()
+{
+  if (fontChanged())
+  {
+    _redrawAll = true;
+    _font = _gfx->gfxFont;
+#if defined(U8G2_FONT_SUPPORT)
+    if (_gfx->u8g2Font)
+    {
+      _font = _gfx->u8g2Font;
+    }
+#endif // defined(U8G2_FONT_SUPPORT)
+    _sizeX = _gfx->textsize_x;
+    _sizeY = _gfx->textsize_y;
+  }
+
+  bool wrap = _gfx->wrap;
+  _gfx->wrap = false;
+  text_layout_state_t *s = &_cur;
+  s->count = 0;
+  s->x1 = s->y1 = INT16_MAX;
+  s->x2 = s->y2 = INT16_MIN;
+  int16_t pen = 0, y = 0;
+  uint8_t start = 0;
+  for (uint8_t i = 0; s->text[i]; ++i)
+  {
+    char c = s->text[i];
+    if ((c == '\n') || (c == '\r'))
+    {
+      start = i + 1;
+      continue;
+    }
+    int16_t x = pen;
+    int16_t minx = INT16_MAX, miny = INT16_MAX, maxx = INT16_MIN, maxy = INT16_MIN;
+    _gfx->charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+    if ((x == pen) && (maxx < minx))
+    {
+      continue; // UTF-8 lead byte or not in the font, goes with the next glyph
+    }
+    text_glyph_t *g = &s->glyphs[s->count++];
+    g->x = pen;
+    g->x1 = pen;
+    g->x2 = x - 1;
+    g->start = start;
+    g->len = i - start + 1;
+    if (maxx >= minx)
+    {
+      g->x1 = min(g->x1, minx);
+      g->x2 = max(g->x2, maxx);
+      s->x1 = min(s->x1, minx);
+      s->x2 = max(s->x2, maxx);
+      s->y1 = min(s->y1, miny);
+      s->y2 = max(s->y2, maxy);
+    }
+    pen = x;
+    start = i + 1;
+  }
+  s->advance = pen;
+  _gfx->wrap = wrap;
+#if defined(U8G2_FONT_SUPPORT)
+  _gfx->_utf8_state = 0; // text cut inside a sequence
+#endif // defined(U8G2_FONT_SUPPORT)
+  _measured = true;
+}
+
+// clear the cells of glyphs that changed, then draw them and any glyph
+// reaching into a cleared cell
+uint16_t Arduino_TextLayout::redraw(bool all)
+{
+  text_layout_state_t *s = &_cur;
+  const text_layout_state_t *d = _shown ? &_drawn : nullptr;
+  s->left = text_layout_left(_x, _align, s->advance);
+  s->y = _y;
+  bool opaque = (_bg != _color);
+
+  bool keep[TEXTLAYOUT_MAX_BYTES];
+  for (uint8_t i = 0; i < s->count; ++i)
+  {
+    keep[i] = false;
+    if ((!all) && d && (i < d->count))
+    {
+      const text_glyph_t *o = &d->glyphs[i];
+      const text_glyph_t *n = &s->glyphs[i];
+      keep[i] = ((d->left + o->x) == (s->left + n->x)) && (o->len == n->len) &&
+                (memcmp(d->text + o->start, s->text + n->start, n->len) == 0);
+    }
+  }
+
+  // cells to clear in screen x, sorted and merged
+  int16_t spans[2 * TEXTLAYOUT_MAX_BYTES][2];
+  uint8_t n = 0;
+  int16_t y1 = s->y1, y2 = s->y2;
+  if (opaque)
+  {
+    if (d && all)
+    {
+      // the old text may sit on other rows, clear it on its own
+      for (uint8_t i = 0; (i < d->count) && (d->y2 >= d->y1); ++i)
+      {
+        const text_glyph_t *o = &d->glyphs[i];
+        _gfx->fillRect(d->left + o->x1, d->y + d->y1, o->x2 - o->x1 + 1, d->y2 - d->y1 + 1, _bg);
+      }
+    }
+    else if (d)
+    {
+      for (uint8_t i = 0; i < d->count; ++i)
+      {
+        if ((i >= s->count) || (!keep[i]))
+        {
+          spans[n][0] = d->left + d->glyphs[i].x1;
+          spans[n++][1] = d->left + d->glyphs[i].x2;
+        }
+      }
+      y1 = min(y1, d->y1);
+      y2 = max(y2, d->y2);
+    }
+    for (uint8_t i = 0; i < s->count; ++i)
+    {
+      if (!keep[i])
+      {
+        spans[n][0] = s->left + s->glyphs[i].x1;
+        spans[n++][1] = s->left + s->glyphs[i].x2;
+      }
+    }
+    for (uint8_t i = 1; i < n; ++i)
+    {
+      int16_t a = spans[i][0], b = spans[i][1];
+      int8_t j = i - 1;
+      while ((j >= 0) && (spans[j][0] > a))
+      {
+        spans[j + 1][0] = spans[j][0];
+        spans[j + 1][1] = spans[j][1];
+        --j;
+      }
+      spans[j + 1][0] = a;
+      spans[j + 1][1] = b;
+    }
+    uint8_t m = 0;
+    for (uint8_t i = 0; i < n; ++i)
+    {
+      if (m && (spans[i][0] <= spans[m - 1][1] + 1))
+      {
+        spans[m - 1][1] = max(spans[m - 1][1], spans[i][1]);
+      }
+      else
+      {
+        spans[m][0] = spans[i][0];
+        spans[m++][1] = spans[i][1];
+      }
+    }
+    n = m;
+    if (y2 >= y1)
+    {
+      for (uint8_t i = 0; i < n; ++i)
+      {
+        _gfx->fillRect(spans[i][0], _y + y1, spans[i][1] - spans[i][0] + 1, y2 - y1 + 1, _bg);
+      }
+    }
+  }
+
+  int16_t cursor_x = _gfx->cursor_x, cursor_y = _gfx->cursor_y;
+  uint16_t textcolor = _gfx->textcolor, textbgcolor = _gfx->textbgcolor;
+  bool wrap = _gfx->wrap;
+  _gfx->textcolor = _gfx->textbgcolor = _color;
+  _gfx->wrap = false;
+
+  uint16_t drawn = 0;
+  for (uint8_t i = 0; i < s->count; ++i)
+  {
+    bool redo = !keep[i];
+    for (uint8_t j = 0; (!redo) && (j < n); ++j)
+    {
+      redo = (s->left + s->glyphs[i].x1 <= spans[j][1]) && (spans[j][0] <= s->left + s->glyphs[i].x2);
+    }
+    if (redo)
+    {
+      drawGlyph(s, i);
+      ++drawn;
+    }
+  }
+
+  _gfx->cursor_x = cursor_x;
+  _gfx->cursor_y = cursor_y;
+  _gfx->textcolor = textcolor;
+  _gfx->textbgcolor = textbgcolor;
+  _gfx->wrap = wrap;
+
+  memcpy(&_drawn, s, sizeof(text_layout_state_t));
+  _shown = true;
+  _redrawAll = false;
+  return drawn;
+}
+
+void Arduino_TextLayout::drawGlyph(const text_layout_state_t *s, uint8_t i)
+{
+  const text_glyph_t *g = &s->glyphs[i];
+  _gfx->setCursor(s->left + g->x, s->y);
+  for (uint8_t b = 0; b < g->len; ++b)
+  {
+    _gfx->write((uint8_t)s->text[g->start + b]);
+  }
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -0,0 +1,97 @@
+#include "Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_TEXTLAYOUT_H_
+#define _ARDUINO_TEXTLAYOUT_H_
+
+#include "Arduino_GFX.h"
+
+#ifndef TEXTLAYOUT_MAX_BYTES
+#define TEXTLAYOUT_MAX_BYTES 32 // longer text is cut, UTF-8 counts every byte
+#endif
+
+#define TEXT_ALIGN_LEFT 0
+#define TEXT_ALIGN_CENTER 1
+#define TEXT_ALIGN_RIGHT 2
+
+typedef struct
+{
+  int16_t x;      // pen position from the layout's left edge
+  int16_t x1, x2; // cell, pen to next pen grown by the glyph's pixels, inclusive
+  uint8_t start;  // bytes of the glyph in the text
+  uint8_t len;
+} text_glyph_t;
+
+typedef struct
+{
+  char text[TEXTLAYOUT_MAX_BYTES + 1];
+  text_glyph_t glyphs[TEXTLAYOUT_MAX_BYTES];
+  uint8_t count;
+  int16_t advance; // pen travel over the whole text, what alignment uses
+  int16_t x1, x2;  // pixel columns from the left edge, inclusive, x2 < x1 when empty
+  int16_t y1, y2;  // pixel rows from the cursor y
+  int16_t left, y; // screen x of the left edge and cursor y it was drawn at
+} text_layout_state_t;
+
+/*!
+  One line of text measured once and kept on screen. setText() walks the
+  string with the display's font and text size only when the text differs
+  from the last one, and stores every glyph's pen position and cell.
+  update() then redraws only the glyphs that changed or moved since the last
+  draw: their old and new cells are filled with the background color and
+  the glyphs over them drawn again, so a numeric readout changing one digit
+  sends one digit. A new font or text size on the display is picked up by
+  the next update() with a full redraw.
+
+  The anchor is the print() cursor: x is the left edge, center or right
+  edge of the text by alignment, y is the cursor y of the font. Without a
+  background color (setColor() with one color) nothing is erased, update()
+  only draws the changed glyphs.
+*/
+class Arduino_TextLayout
+{
+public:
+  Arduino_TextLayout(Arduino_GFX *gfx, int16_t x, int16_t y, uint8_t align = TEXT_ALIGN_LEFT);
+
+  void setPosition(int16_t x, int16_t y, uint8_t align = TEXT_ALIGN_LEFT);
+  void setColor(uint16_t color) { setColor(color, color); }
+  void setColor(uint16_t color, uint16_t bg);
+  bool setText(const char *text);
+  const char *getText() { return _cur.text; }
+
+  uint16_t draw();
+  uint16_t update();
+  uint16_t update(const char *text);
+  void invalidate();
+
+  void getTextBounds(int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+  int16_t getAdvance() { return _cur.advance; }
+  uint8_t glyphCount() { return _cur.count; }
+
+protected:
+  bool fontChanged();
+  void measure();
+  uint16_t redraw(bool all);
+  void drawGlyph(const text_layout_state_t *s, uint8_t i);
+
+  Arduino_GFX *_gfx;
+  int16_t _x, _y;
+  uint8_t _align;
+  uint16_t _color = RGB565_WHITE, _bg = RGB565_WHITE;
+
+  // font and size the current layout was measured with
+  const void *_font = nullptr;
+  uint8_t _sizeX = 0, _sizeY = 0;
+  bool _measured = false;
+  bool _shown = false;     // _drawn is on the screen, what update() diffs against
+  bool _redrawAll = false; // position, colors or cells changed since the last draw
+
+  text_layout_state_t _cur;
+  text_layout_state_t _drawn;
+
+private:
+};
+
+#endif // _ARDUINO_TEXTLAYOUT_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
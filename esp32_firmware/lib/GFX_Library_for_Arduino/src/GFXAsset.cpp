@@ -0,0 +1,233 @@
+#include "Arduino_GFX.h"
+#include "GFXAsset.h"
+
+#define ASSET_HEADER_SIZE 8
+#define ASSET_HASH(c) (((((c) >> 11) * 3) + ((((c) >> 5) & 0x3F) * 5) + (((c) & 0x1F) * 7)) & 63)
+
+bool gfx_asset_open(gfx_asset_decoder_t *d, const uint8_t *asset, uint32_t len)
+{
+  if ((len < ASSET_HEADER_SIZE) || (pgm_read_byte(asset) != 'G') || (pgm_read_byte(asset + 1) != 'A') || (pgm_read_byte(asset + 2) != 1))
+  {
+    return false;
+  }
+  d->format = pgm_read_byte(asset + 3);
+  d->width = pgm_read_byte(asset + 4) | (pgm_read_byte(asset + 5) << 8);
+  d->height = pgm_read_byte(asset + 6) | (pgm_read_byte(asset + 7) << 8);
+  // drawAsset() works in int16_t coordinates
+  if ((d->width == 0) || (d->height == 0) || (d->width > 0x7FFF) || (d->height > 0x7FFF))
+  {
+    return false;
+  }
+  d->data = asset + ASSET_HEADER_SIZE;
+  d->end = asset + len;
+  d->palette = nullptr;
+  d->colors = 0;
+  d->index = 0;
+  d->px = 0;
+  d->run = 0;
+  d->literals = 0;
+
+  if (d->format == GFX_ASSET_PALETTE)
+  {
+    if (len < ASSET_HEADER_SIZE + 1)
+    {
+      return false;
+    }
+    d->colors = pgm_read_byte(d->data) + 1;
+    d->palette = d->data + 1;
+    d->data = d->palette + (d->colors * 2);
+    if (d->data > d->end)
+    {
+      return false;
+    }
+  }
+  else if (d->format == GFX_ASSET_RGB565)
+  {
+    memset(d->cache, 0, sizeof(d->cache));
+  }
+  else if (d->format != GFX_ASSET_RAW)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+static uint32_t decode_palette(gfx_asset_decoder_t *d, uint16_t *dst, uint32_t len)
+{
+  const uint8_t *p = d->data;
+  const uint8_t *pal = d->palette;
+  uint32_t done = 0;
+  while (done < len)
+  {
+    if (d->run)
+    {
+      uint32_t n = min((uint32_t)d->run, len - done);
+      uint16_t c = pgm_read_byte(pal + (d->index << 1)) | (pgm_read_byte(pal + (d->index << 1) + 1) << 8);
+      d->run -= n;
+      done += n;
+      while (n--)
+      {
+        *dst++ = c;
+      }
+    }
+    else if (d->literals)
+    {
+      if (p >= d->end)
+      {
+        break;
+      }
+      uint8_t index = pgm_read_byte(p++);
+      if (index >= d->colors)
+      {
+        // corrupt, never read past the palette
+        p = d->end;
+        d->literals = 0;
+        break;
+      }
+      d->index = index;
+      *dst++ = pgm_read_byte(pal + (d->index << 1)) | (pgm_read_byte(pal + (d->index << 1) + 1) << 8);
+      --d->literals;
+      ++done;
+    }
+    else
+    {
+      if (p >= d->end)
+      {
+        break;
+      }
+      uint8_t op = pgm_read_byte(p++);
+      if (op & 0x80)
+      {
+        d->literals = (op & 0x7F) + 1;
+      }
+      else
+      {
+        d->run = op + 1;
+      }
+    }
+  }
+  d->data = p;
+  return done;
+}
+
+static uint32_t decode_rgb565(gfx_asset_decoder_t *d, uint16_t *dst, uint32_t len)
+{
+  const uint8_t *p = d->data;
+  uint16_t px = d->px;
+  uint32_t done = 0;
+  while (done < len)
+  {
+    if (d->run)
+    {
+      uint32_t n = min((uint32_t)d->run, len - done);
+      d->run -= n;
+      done += n;
+      while (n--)
+      {
+        *dst++ = px;
+      }
+      continue;
+    }
+    if (p >= d->end)
+    {
+      break;
+    }
+
+    uint8_t op = pgm_read_byte(p++);
+    switch (op >> 6)
+    {
+    case 0: // index
+      px = d->cache[op];
+      break;
+    case 1: // small diff
+    {
+      uint16_t r = ((px >> 11) + ((op >> 4) & 3) - 2) & 0x1F;
+      uint16_t g = (((px >> 5) & 0x3F) + ((op >> 2) & 3) - 2) & 0x3F;
+      uint16_t b = ((px & 0x1F) + (op & 3) - 2) & 0x1F;
+      px = (r << 11) | (g << 5) | b;
+      break;
+    }
+    case 2: // run
+      d->run = (op & 0x3F) + 1;
+      continue;
+    default:
+      if ((op & 0xE0) == 0xC0) // luma
+      {
+        if (p >= d->end)
+        {
+          d->data = d->end;
+          d->px = px;
+          return done;
+        }
+        uint8_t op2 = pgm_read_byte(p++);
+        int16_t dg = (int16_t)(op & 0x1F) - 16;
+        int16_t dg2 = dg >> 1;
+        uint16_t r = ((px >> 11) + (op2 >> 4) - 8 + dg2) & 0x1F;
+        uint16_t g = (((px >> 5) & 0x3F) + dg) & 0x3F;
+        uint16_t b = ((px & 0x1F) + (op2 & 0x0F) - 8 + dg2) & 0x1F;
+        px = (r << 11) | (g << 5) | b;
+      }
+      else if ((op & 0xF0) == 0xE0) // long run
+      {
+        if (p >= d->end)
+        {
+          d->data = d->end;
+          d->px = px;
+          return done;
+        }
+        d->run = (((op & 0x0F) << 8) | pgm_read_byte(p++)) + 65;
+        continue;
+      }
+      else if (op == 0xFF) // literal
+      {
+        if (p + 1 >= d->end)
+        {
+          d->data = d->end;
+          d->px = px;
+          return done;
+        }
+        px = pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+        p += 2;
+      }
+      else // reserved, treat as the end of the data
+      {
+        d->data = d->end;
+        d->px = px;
+        return done;
+      }
+    }
+    d->cache[ASSET_HASH(px)] = px;
+    *dst++ = px;
+    ++done;
+  }
+  d->data = p;
+  d->px = px;
+  return done;
+}
+
+static uint32_t decode_raw(gfx_asset_decoder_t *d, uint16_t *dst, uint32_t len)
+{
+  const uint8_t *p = d->data;
+  len = min(len, (uint32_t)(d->end - p) >> 1);
+  for (uint32_t i = 0; i < len; ++i)
+  {
+    *dst++ = pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+    p += 2;
+  }
+  d->data = p;
+  return len;
+}
+
+uint32_t gfx_asset_decode(gfx_asset_decoder_t *d, uint16_t *dst, uint32_t len)
+{
+  switch (d->format)
+  {
+  case GFX_ASSET_PALETTE:
+    return decode_palette(d, dst, len);
+  case GFX_ASSET_RAW:
+    return decode_raw(d, dst, len);
+  default:
+    return decode_rgb565(d, dst, len);
+  }
+}
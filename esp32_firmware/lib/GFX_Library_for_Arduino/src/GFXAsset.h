@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+Compressed image asset, made by tools/gfx_asset.py and drawn with
+Arduino_GFX::drawAsset(). Rows are stored top to bottom in one stream, the
+decoder only keeps a few bytes of state so an image is decoded a chunk at a
+time straight to the output without a full image buffer.
+
+Header, little endian:
+  0  'G', 'A'
+  2  version, 1
+  3  format, GFX_ASSET_RGB565, GFX_ASSET_PALETTE or GFX_ASSET_RAW
+  4  width (uint16_t)
+  6  height (uint16_t)
+  8  GFX_ASSET_PALETTE only: color count - 1 (uint8_t), then the RGB565
+     colors (uint16_t each)
+
+GFX_ASSET_RGB565 ops, similar to QOI. px starts at 0, index[] at all 0,
+every decoded color except runs is stored at index[(r * 3 + g * 5 + b * 7) & 63]
+with r, g, b the RGB565 fields:
+  00iiiiii            px = index[i]
+  01rrggbb            r += rr - 2, g += gg - 2, b += bb - 2
+  110ggggg rrrrbbbb   dg = ggggg - 16, g += dg,
+                      r += rrrr - 8 + (dg >> 1), b += bbbb - 8 + (dg >> 1)
+  10nnnnnn            repeat px n + 1 times
+  1110nnnn nnnnnnnn   repeat px n + 65 times
+  11111111 lo hi      px = hi << 8 | lo
+Fields wrap around, the other 1111xxxx codes are reserved.
+
+GFX_ASSET_PALETTE ops, index starts at 0, an index past the color count
+stops the decoding:
+  0nnnnnnn            repeat the palette color of index n + 1 times
+  1nnnnnnn            n + 1 index bytes follow
+
+GFX_ASSET_RAW is plain RGB565 (uint16_t each), for images the ops above
+would make bigger.
+*/
+
+#define GFX_ASSET_RGB565 0
+#define GFX_ASSET_PALETTE 1
+#define GFX_ASSET_RAW 2
+#define GFX_ASSET_BUF_PIXELS 512 // pixels decoded per chunk, on the stack
+
+typedef struct
+{
+  const uint8_t *data; // next op
+  const uint8_t *end;
+  const uint8_t *palette;
+  uint16_t colors;    // GFX_ASSET_PALETTE color count
+  uint16_t width;
+  uint16_t height;
+  uint8_t format;
+  uint8_t index;      // last palette index
+  uint16_t px;        // last RGB565 color
+  uint16_t run;       // repeats left of px / index
+  uint8_t literals;   // palette index bytes left
+  uint16_t cache[64]; // GFX_ASSET_RGB565 color index
+} gfx_asset_decoder_t;
+
+// Check the header and prepare d, false if asset is not a valid asset, has
+// no pixels or is over 32767 pixels wide or high
+bool gfx_asset_open(gfx_asset_decoder_t *d, const uint8_t *asset, uint32_t len);
+
+// Decode up to len pixels to dst in row order, returns the number decoded;
+// less than len only at the end of the asset or when the data is cut short
+// or corrupt, after which it decodes nothing more
+uint32_t gfx_asset_decode(gfx_asset_decoder_t *d, uint16_t *dst, uint32_t len);
@@ -0,0 +1,402 @@
+#include <string.h>
+
+#include "PixelConvert.h"
+#include "YCbCr2RGB.h"
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define PIXELCONVERT_WORDS
+#endif
+
+#define RGB888_TO_565(r, g, b) ((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | ((b) >> 3))
+#define WORD_ALIGNED(p) ((((uintptr_t)(p)) & 3) == 0)
+
+void gfx_rgb888_to_rgb565(uint16_t *dst, const uint8_t *src, uint32_t len)
+{
+#ifdef PIXELCONVERT_WORDS
+  if (WORD_ALIGNED(src) && WORD_ALIGNED(dst))
+  {
+    const uint32_t *s = (const uint32_t *)src;
+    uint32_t *d = (uint32_t *)dst;
+    while (len >= 4)
+    {
+      // w0 = r0 g0 b0 r1, w1 = g1 b1 r2 g2, w2 = b2 r3 g3 b3 (lowest byte first)
+      uint32_t w0 = *s++;
+      uint32_t w1 = *s++;
+      uint32_t w2 = *s++;
+      uint32_t p0 = RGB888_TO_565(w0 & 0xFF, (w0 >> 8) & 0xFF, (w0 >> 16) & 0xFF);
+      uint32_t p1 = RGB888_TO_565(w0 >> 24, w1 & 0xFF, (w1 >> 8) & 0xFF);
+      uint32_t p2 = RGB888_TO_565((w1 >> 16) & 0xFF, w1 >> 24, w2 & 0xFF);
+      uint32_t p3 = RGB888_TO_565((w2 >> 8) & 0xFF, (w2 >> 16) & 0xFF, w2 >> 24);
+      *d++ = p0 | (p1 << 16);
+      *d++ = p2 | (p3 << 16);
+      len -= 4;
+    }
+    src = (const uint8_t *)s;
+    dst = (uint16_t *)d;
+  }
+#endif
+  while (len--)
+  {
+    *dst++ = RGB888_TO_565(src[0], src[1], src[2]);
+    src += 3;
+  }
+}
+
+void gfx_rgb565_swap_bytes(uint16_t *dst, const uint16_t *src, uint32_t len)
+{
+#ifdef PIXELCONVERT_WORDS
+  if (len && (!WORD_ALIGNED(src)) && (!WORD_ALIGNED(dst)))
+  {
+    // both off by one pixel, one scalar step aligns them
+    *dst++ = (*src >> 8) | (*src << 8);
+    ++src;
+    --len;
+  }
+  if (WORD_ALIGNED(src) && WORD_ALIGNED(dst))
+  {
+    const uint32_t *s = (const uint32_t *)src;
+    uint32_t *d = (uint32_t *)dst;
+    while (len >= 2)
+    {
+      uint32_t v = *s++;
+      *d++ = ((v & 0x00FF00FF) << 8) | ((v >> 8) & 0x00FF00FF);
+      len -= 2;
+    }
+    src = (const uint16_t *)s;
+    dst = (uint16_t *)d;
+  }
+#endif
+  while (len--)
+  {
+    uint16_t v = *src++;
+    *dst++ = (v >> 8) | (v << 8);
+  }
+}
+
+void gfx_gray_to_rgb565(uint16_t *dst, const uint8_t *src, uint32_t len)
+{
+#ifdef PIXELCONVERT_WORDS
+  if (WORD_ALIGNED(src) && WORD_ALIGNED(dst))
+  {
+    const uint32_t *s = (const uint32_t *)src;
+    uint32_t *d = (uint32_t *)dst;
+    while (len >= 4)
+    {
+      uint32_t v = *s++;
+      uint32_t g0 = v & 0xFF;
+      uint32_t g1 = (v >> 8) & 0xFF;
+      uint32_t g2 = (v >> 16) & 0xFF;
+      uint32_t g3 = v >> 24;
+      *d++ = RGB888_TO_565(g0, g0, g0) | (RGB888_TO_565(g1, g1, g1) << 16);
+      *d++ = RGB888_TO_565(g2, g2, g2) | (RGB888_TO_565(g3, g3, g3) << 16);
+      len -= 4;
+    }
+    src = (const uint8_t *)s;
+    dst = (uint16_t *)d;
+  }
+#endif
+  while (len--)
+  {
+    uint8_t v = *src++;
+    *dst++ = RGB888_TO_565(v, v, v);
+  }
+}
+
+// BE selects the CLIP*BE tables, the two rows share every chroma sample
+template <bool BE>
+static inline void ycbcr420_rows(uint16_t *dst, uint16_t *dst2, const uint8_t *y, const uint8_t *y2, const uint8_t *cb, const uint8_t *cr, uint16_t w)
+{
+  const uint16_t *clipR = BE ? CLIPRBE : CLIPR;
+  const uint16_t *clipG = BE ? CLIPGBE : CLIPG;
+  const uint16_t *clipB = BE ? CLIPBBE : CLIPB;
+  uint16_t cols = w >> 1;
+  bool words = false;
+#ifdef PIXELCONVERT_WORDS
+  words = WORD_ALIGNED(dst) && ((!dst2) || WORD_ALIGNED(dst2));
+#endif
+  for (uint16_t col = 0; col < cols; ++col)
+  {
+    uint8_t u = *cb++;
+    uint8_t v = *cr++;
+    int16_t r = CR2R16[v];
+    int16_t g = -CB2G16[u] - CR2G16[v];
+    int16_t b = CB2B16[u];
+    int16_t l0 = Y2I16[*y++];
+    int16_t l1 = Y2I16[*y++];
+    uint16_t p0 = clipR[l0 + r] | clipG[l0 + g] | clipB[l0 + b];
+    uint16_t p1 = clipR[l1 + r] | clipG[l1 + g] | clipB[l1 + b];
+    if (words)
+    {
+      *(uint32_t *)dst = p0 | ((uint32_t)p1 << 16);
+      dst += 2;
+    }
+    else
+    {
+      *dst++ = p0;
+      *dst++ = p1;
+    }
+    if (dst2)
+    {
+      l0 = Y2I16[*y2++];
+      l1 = Y2I16[*y2++];
+      p0 = clipR[l0 + r] | clipG[l0 + g] | clipB[l0 + b];
+      p1 = clipR[l1 + r] | clipG[l1 + g] | clipB[l1 + b];
+      if (words)
+      {
+        *(uint32_t *)dst2 = p0 | ((uint32_t)p1 << 16);
+        dst2 += 2;
+      }
+      else
+      {
+        *dst2++ = p0;
+        *dst2++ = p1;
+      }
+    }
+  }
+}
+
+void gfx_ycbcr420_to_rgb565(uint16_t *dst, uint16_t *dst2, const uint8_t *y, const uint8_t *y2, const uint8_t *cb, const uint8_t *cr, uint16_t w)
+{
+  ycbcr420_rows<false>(dst, dst2, y, y2, cb, cr, w);
+}
+
+void gfx_ycbcr420_to_rgb565be(uint16_t *dst, uint16_t *dst2, const uint8_t *y, const uint8_t *y2, const uint8_t *cb, const uint8_t *cr, uint16_t w)
+{
+  ycbcr420_rows<true>(dst, dst2, y, y2, cb, cr, w);
+}
+
+// spread RGB565 as 00000gggggg00000rrrrr000000bbbbb so one multiply scales all
+// three fields, a is 0..32
+#define RGB565_SPREAD(c) ((((uint32_t)(c)) | (((uint32_t)(c)) << 16)) & 0x07E0F81F)
+#define RGB565_FOLD(v) ((uint16_t)(((v) & 0x07E0F81F) | (((v) & 0x07E0F81F) >> 16)))
+
+static inline uint16_t blend565(uint16_t fg, uint16_t bg, uint32_t a)
+{
+  uint32_t v = ((RGB565_SPREAD(fg) * a) + (RGB565_SPREAD(bg) * (32 - a))) >> 5;
+  return RGB565_FOLD(v);
+}
+
+void gfx_blend_rgb565_a8(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint32_t len)
+{
+  while (len--)
+  {
+    uint8_t a = *alpha++;
+    if (a == 0xFF)
+    {
+      *dst = *src;
+    }
+    else if (a)
+    {
+      *dst = blend565(*src, *dst, (a + 4) >> 3);
+    }
+    ++dst;
+    ++src;
+  }
+}
+
+void gfx_blend_rgb565_color(uint16_t *dst, uint16_t color, uint8_t alpha, uint32_t len)
+{
+  if (alpha == 0)
+  {
+    return;
+  }
+  uint32_t a = (alpha + 4) >> 3;
+  uint32_t fg = RGB565_SPREAD(color) * a;
+  uint32_t ia = 32 - a;
+  while (len--)
+  {
+    uint32_t v = (fg + (RGB565_SPREAD(*dst) * ia)) >> 5;
+    *dst++ = RGB565_FOLD(v);
+  }
+}
+
+void gfx_blend_rgb565_color_a8(uint16_t *dst, uint16_t color, const uint8_t *alpha, uint32_t len)
+{
+  while (len--)
+  {
+    uint8_t a = *alpha++;
+    if (a == 0xFF)
+    {
+      *dst = color;
+    }
+    else if (a)
+    {
+      *dst = blend565(color, *dst, (a + 4) >> 3);
+    }
+    ++dst;
+  }
+}
+
+// RGB565_SPREAD() of both pixels of a word, summed; the two fields of each
+// color sit in different halves, so swapping the halves spreads the other one
+#define RGB565_PAIR_SPREAD(w) (((w) & 0x07E0F81F) + ((((w) >> 16) | ((w) << 16)) & 0x07E0F81F))
+
+void gfx_downscale_rgb565(uint16_t *dst, const uint16_t *src, uint32_t stride, uint32_t len, uint8_t shift)
+{
+  uint32_t n = 1 << shift;
+  // half of the divisor in every field, so the average rounds to nearest
+  uint32_t round = (0x00200801 << (2 * shift)) >> 1;
+#ifdef PIXELCONVERT_WORDS
+  if (WORD_ALIGNED(src) && !(stride & 1))
+  {
+    uint32_t wstride = stride >> 1;
+    uint32_t wn = n >> 1;
+    if (shift == 1)
+    {
+      const uint32_t *s0 = (const uint32_t *)src;
+      const uint32_t *s1 = s0 + wstride;
+      while (len--)
+      {
+        uint32_t sum = round + RGB565_PAIR_SPREAD(*s0) + RGB565_PAIR_SPREAD(*s1);
+        *dst++ = RGB565_FOLD(sum >> 2);
+        ++s0;
+        ++s1;
+      }
+      return;
+    }
+    while (len--)
+    {
+      const uint32_t *s = (const uint32_t *)src;
+      uint32_t sum = round;
+      for (uint32_t j = 0; j < n; ++j)
+      {
+        for (uint32_t i = 0; i < wn; ++i)
+        {
+          sum += RGB565_PAIR_SPREAD(s[i]);
+        }
+        s += wstride;
+      }
+      *dst++ = RGB565_FOLD(sum >> (2 * shift));
+      src += n;
+    }
+    return;
+  }
+#endif
+  while (len--)
+  {
+    const uint16_t *s = src;
+    uint32_t sum = round;
+    for (uint32_t j = 0; j < n; ++j)
+    {
+      for (uint32_t i = 0; i < n; ++i)
+      {
+        sum += RGB565_SPREAD(s[i]);
+      }
+      s += stride;
+    }
+    *dst++ = RGB565_FOLD(sum >> (2 * shift));
+    src += n;
+  }
+}
+
+void gfx_upscale2_rgb565(uint16_t *dst, const uint16_t *src, uint32_t len)
+{
+#ifdef PIXELCONVERT_WORDS
+  if (WORD_ALIGNED(dst))
+  {
+    uint32_t *d = (uint32_t *)dst;
+    while (len--)
+    {
+      uint32_t p = *src++;
+      *d++ = p | (p << 16);
+    }
+    return;
+  }
+#endif
+  while (len--)
+  {
+    *dst++ = *src;
+    *dst++ = *src++;
+  }
+}
+
+// edge of the square tiles gfx_rotate_rgb565() walks the block in, 16 rows
+// of 16 pixels of src and of dst stay in a 1 KB working set
+#define ROTATE_TILE 16
+
+static inline void rotate_pixel(uint16_t *dst, const uint16_t *src, uint32_t src_stride, uint16_t w, uint16_t h, uint8_t rotation, uint16_t x, uint16_t y)
+{
+  uint16_t p = src[(uint32_t)y * src_stride + x];
+  switch (rotation)
+  {
+  case 1:
+    dst[(uint32_t)x * h + (h - 1 - y)] = p;
+    break;
+  case 2:
+    dst[(uint32_t)(h - 1 - y) * w + (w - 1 - x)] = p;
+    break;
+  default: // case 3:
+    dst[(uint32_t)(w - 1 - x) * h + y] = p;
+  }
+}
+
+void gfx_rotate_rgb565(uint16_t *dst, const uint16_t *src, uint32_t src_stride, uint16_t w, uint16_t h, uint8_t rotation)
+{
+  rotation &= 3;
+  if (rotation == 0)
+  {
+    for (uint16_t y = 0; y < h; ++y)
+    {
+      memcpy(dst, src, w * 2);
+      dst += w;
+      src += src_stride;
+    }
+    return;
+  }
+#ifdef PIXELCONVERT_WORDS
+  if (WORD_ALIGNED(src) && WORD_ALIGNED(dst) && !(src_stride & 1) && !(w & 1) && !(h & 1))
+  {
+    // 2x2 pixel blocks: a = row y (cols x, x + 1), b = row y + 1, each block
+    // gives two dst words
+    uint32_t *d = (uint32_t *)dst;
+    for (uint16_t ty = 0; ty < h; ty += ROTATE_TILE)
+    {
+      uint16_t ey = ((h - ty) > ROTATE_TILE) ? (ty + ROTATE_TILE) : h;
+      for (uint16_t tx = 0; tx < w; tx += ROTATE_TILE)
+      {
+        uint16_t ex = ((w - tx) > ROTATE_TILE) ? (tx + ROTATE_TILE) : w;
+        for (uint16_t y = ty; y < ey; y += 2)
+        {
+          const uint32_t *sa = (const uint32_t *)(src + (uint32_t)y * src_stride);
+          const uint32_t *sb = (const uint32_t *)(src + (uint32_t)(y + 1) * src_stride);
+          for (uint16_t x = tx; x < ex; x += 2)
+          {
+            uint32_t a = sa[x >> 1];
+            uint32_t b = sb[x >> 1];
+            switch (rotation)
+            {
+            case 1:
+              d[((uint32_t)x * h + (h - 2 - y)) >> 1] = (b & 0xFFFF) | (a << 16);
+              d[((uint32_t)(x + 1) * h + (h - 2 - y)) >> 1] = (b >> 16) | (a & 0xFFFF0000);
+              break;
+            case 2:
+              d[((uint32_t)(h - 1 - y) * w + (w - 2 - x)) >> 1] = (a >> 16) | (a << 16);
+              d[((uint32_t)(h - 2 - y) * w + (w - 2 - x)) >> 1] = (b >> 16) | (b << 16);
+              break;
+            default: // case 3:
+              d[((uint32_t)(w - 1 - x) * h + y) >> 1] = (a & 0xFFFF) | (b << 16);
+              d[((uint32_t)(w - 2 - x) * h + y) >> 1] = (a >> 16) | (b & 0xFFFF0000);
+            }
+          }
+        }
+      }
+    }
+    return;
+  }
+#endif
+  for (uint16_t ty = 0; ty < h; ty += ROTATE_TILE)
+  {
+    uint16_t ey = ((h - ty) > ROTATE_TILE) ? (ty + ROTATE_TILE) : h;
+    for (uint16_t tx = 0; tx < w; tx += ROTATE_TILE)
+    {
+      uint16_t ex = ((w - tx) > ROTATE_TILE) ? (tx + ROTATE_TILE) : w;
+      for (uint16_t y = ty; y < ey; ++y)
+      {
+        for (uint16_t x = tx; x < ex; ++x)
+        {
+          rotate_pixel(dst, src, src_stride, w, h, rotation, x, y);
+        }
+      }
+    }
+  }
+}
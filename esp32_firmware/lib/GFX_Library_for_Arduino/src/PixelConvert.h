@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+Bulk pixel format conversion, dst and src may not overlap except for
+gfx_rgb565_swap_bytes(), which also works in place.
+
+The kernels move 32-bit words whenever the buffers are word aligned, e.g.
+4 RGB888 pixels are read as 3 words and written as 2, which is where most
+of the time goes on targets with slow byte loads. Results are bit exact
+with the per pixel code (color565(), MSB_16_SET() and the YCbCr2RGB.h
+tables).
+*/
+
+// RGB888 (r, g, b byte order) to RGB565
+void gfx_rgb888_to_rgb565(uint16_t *dst, const uint8_t *src, uint32_t len);
+
+// RGB565 big endian <-> little endian
+void gfx_rgb565_swap_bytes(uint16_t *dst, const uint16_t *src, uint32_t len);
+
+// 8-bit grayscale to RGB565
+void gfx_gray_to_rgb565(uint16_t *dst, const uint8_t *src, uint32_t len);
+
+// Two rows of YCbCr 4:2:0 sharing one chroma row to RGB565, native or big
+// endian (as sent by writeYCbCrPixels()). w must be even, y2/dst2 may be NULL
+// for a trailing odd row.
+void gfx_ycbcr420_to_rgb565(uint16_t *dst, uint16_t *dst2, const uint8_t *y, const uint8_t *y2, const uint8_t *cb, const uint8_t *cr, uint16_t w);
+void gfx_ycbcr420_to_rgb565be(uint16_t *dst, uint16_t *dst2, const uint8_t *y, const uint8_t *y2, const uint8_t *cb, const uint8_t *cr, uint16_t w);
+
+// Blend RGB565 src over dst with an 8-bit alpha per pixel (0 keeps dst, 255
+// copies src), alpha is quantized to 32 levels
+void gfx_blend_rgb565_a8(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint32_t len);
+
+// Blend one RGB565 color over len dst pixels with a constant alpha
+void gfx_blend_rgb565_color(uint16_t *dst, uint16_t color, uint8_t alpha, uint32_t len);
+
+// Blend one RGB565 color over dst with an 8-bit alpha per pixel, the
+// coverage of an anti-aliased span
+void gfx_blend_rgb565_color_a8(uint16_t *dst, uint16_t color, const uint8_t *alpha, uint32_t len);
+
+// Average blocks of 2x2 (shift 1) or 4x4 (shift 2) src pixels, rounded, into
+// len dst pixels; src rows are stride pixels apart
+void gfx_downscale_rgb565(uint16_t *dst, const uint16_t *src, uint32_t stride, uint32_t len, uint8_t shift);
+
+// Repeat each of len src pixels twice, dst takes 2 * len pixels
+void gfx_upscale2_rgb565(uint16_t *dst, const uint16_t *src, uint32_t len);
+
+// Copy a w x h block of src (rows src_stride pixels apart) to dst turned
+// clockwise by rotation * 90 degrees, the same mapping as a canvas drawn with
+// setRotation(rotation). dst is packed, h x w for rotation 1 and 3. Walks
+// the block in 16x16 tiles and moves 2x2 pixels per step when aligned.
+void gfx_rotate_rgb565(uint16_t *dst, const uint16_t *src, uint32_t src_stride, uint16_t w, uint16_t h, uint8_t rotation);
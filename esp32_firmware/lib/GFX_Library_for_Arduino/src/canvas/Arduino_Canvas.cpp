@@ -2,6 +2,7 @@
 #if !defined(LITTLE_FOOT_PRINT)
 
 #include "../Arduino_GFX.h"
+#include "../PixelConvert.h"
 #include "Arduino_Canvas.h"
 
 Arduino_Canvas::Arduino_Canvas(
@@ -19,6 +20,10 @@ Arduino_Canvas::~Arduino_Canvas()
   {
     free(_framebuffer);
   }
+  if (_transferBuf)
+  {
+    free(_transferBuf);
+  }
 }
 
 bool Arduino_Canvas::begin(int32_t speed)
@@ -234,6 +239,48 @@ void Arduino_Canvas::writeFillRectPreclipped(int16_t x, int16_t y,
   }
 }
 
+// with bg the same as color, blended with what is in the framebuffer
+void Arduino_Canvas::writeCoverageSpanPreclipped(int16_t x, int16_t y, const uint8_t *cov, int16_t len, uint16_t color, uint16_t bg)
+{
+  uint16_t *fb = _framebuffer;
+  int32_t step;
+  switch (_rotation)
+  {
+  case 1:
+    fb += (int32_t)x * WIDTH + (_max_y - y);
+    step = WIDTH;
+    break;
+  case 2:
+    fb += (int32_t)(_max_y - y) * WIDTH + (_max_x - x);
+    step = -1;
+    break;
+  case 3:
+    fb += (int32_t)(_max_x - x) * WIDTH + y;
+    step = -WIDTH;
+    break;
+  default: // case 0:
+    fb += (int32_t)y * WIDTH + x;
+    step = 1;
+  }
+  if ((bg == color) && (step == 1))
+  {
+    gfx_blend_rgb565_color_a8(fb, color, cov, len);
+    return;
+  }
+  for (int16_t i = 0; i < len; ++i, fb += step)
+  {
+    if (bg == color)
+    {
+      gfx_blend_rgb565_color_a8(fb, color, cov + i, 1);
+    }
+    else if (cov[i])
+    {
+      *fb = bg;
+      gfx_blend_rgb565_color(fb, color, cov[i], 1);
+    }
+  }
+}
+
 void Arduino_Canvas::drawIndexedBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h, int16_t x_skip)
@@ -559,15 +606,10 @@ void Arduino_Canvas::draw16bitBeRGBBitmap(int16_t x, int16_t y,
       uint16_t *row = _framebuffer;
       row += y * _width;
       row += x;
-      uint16_t color;
       for (int j = 0; j < h; j++)
       {
-        for (int i = 0; i < w; i++)
-        {
-          color = *bitmap++;
-          MSB_16_SET(row[i], color);
-        }
-        bitmap += x_skip;
+        gfx_rgb565_swap_bytes(row, bitmap, w);
+        bitmap += w + x_skip;
         row += _width;
       }
     }
@@ -584,32 +626,148 @@ void Arduino_Canvas::flush()
 
 void Arduino_Canvas::flushQuad(void)
 {
-  int16_t y = _output_y;
-  uint16_t *row1 = _framebuffer;
-  uint16_t *row2 = _framebuffer + WIDTH;
-  if (_output)
+  flushTransformed(GFX_SCALE_HALF);
+}
+
+// pixels [x, x + w) of row y of the framebuffer scaled by scale
+static void gfx_canvas_scaled_row(uint16_t *dst, const uint16_t *fb, int16_t stride, int16_t x, int16_t y, int16_t w, uint8_t scale)
+{
+  switch (scale)
   {
-    int16_t hQuad = HEIGHT / 2;
-    int16_t wQuad = WIDTH / 2;
-    if (!_rowBuf)
+  case GFX_SCALE_QUARTER:
+    gfx_downscale_rgb565(dst, fb + ((int32_t)y * 4 * stride) + (x * 4), stride, w, 2);
+    break;
+  case GFX_SCALE_HALF:
+    gfx_downscale_rgb565(dst, fb + ((int32_t)y * 2 * stride) + (x * 2), stride, w, 1);
+    break;
+  case GFX_SCALE_2X:
+  {
+    const uint16_t *row = fb + ((int32_t)(y >> 1) * stride);
+    if (x & 1)
     {
-      _rowBuf = (uint16_t *)malloc(wQuad * 2);
+      *dst++ = row[x >> 1];
+      ++x;
+      --w;
     }
-    uint16_t p;
-    while (hQuad--)
+    gfx_upscale2_rgb565(dst, row + (x >> 1), w >> 1);
+    if (w & 1)
     {
-      for (int16_t i = 0; i < wQuad; ++i)
+      dst[w - 1] = row[(x + w - 1) >> 1];
+    }
+    break;
+  }
+  default: // GFX_SCALE_1
+    memcpy(dst, fb + ((int32_t)y * stride) + x, w * 2);
+  }
+}
+
+void Arduino_Canvas::flushTransformed(uint8_t scale, uint8_t rotation)
+{
+  if ((!_output) || (!_framebuffer))
+  {
+    return;
+  }
+  rotation &= 3;
+  if ((scale == GFX_SCALE_1) && (rotation == 0))
+  {
+    flush();
+    return;
+  }
+
+  int16_t sw, sh; // the scaled framebuffer
+  switch (scale)
+  {
+  case GFX_SCALE_QUARTER:
+    sw = WIDTH / 4;
+    sh = HEIGHT / 4;
+    break;
+  case GFX_SCALE_HALF:
+    sw = WIDTH / 2;
+    sh = HEIGHT / 2;
+    break;
+  case GFX_SCALE_2X:
+    sw = WIDTH * 2;
+    sh = HEIGHT * 2;
+    break;
+  default:
+    scale = GFX_SCALE_1;
+    sw = WIDTH;
+    sh = HEIGHT;
+  }
+  if ((sw <= 0) || (sh <= 0))
+  {
+    return;
+  }
+
+  if (!_transferBuf)
+  {
+    // a band and a scratch block of the same size, both at least one row of
+    // the widest output (2x scale)
+    _transferPixels = max((int32_t)GFX_CANVAS_TRANSFER_PIXELS, (int32_t)max(WIDTH, HEIGHT) * 2);
+    _transferBuf = (uint16_t *)malloc(_transferPixels * 2 * 2);
+    if (!_transferBuf)
+    {
+      return;
+    }
+  }
+
+  int16_t dw = (rotation & 1) ? sh : sw;
+  int16_t dh = (rotation & 1) ? sw : sh;
+  int16_t rows = min((int32_t)dh, (int32_t)(_transferPixels / dw));
+  if (rows > 1)
+  {
+    // even band starts keep the scaled blocks word aligned for the kernels
+    rows &= ~1;
+  }
+  uint16_t *band = _transferBuf;
+  uint16_t *block = _transferBuf + _transferPixels;
+
+  for (int16_t y = 0; y < dh; y += rows)
+  {
+    int16_t n = min(rows, (int16_t)(dh - y));
+    // the block of the scaled framebuffer that lands on output rows y..y+n-1
+    int16_t bx = 0, by = 0, bw = n, bh = sh;
+    switch (rotation)
+    {
+    case 1:
+      bx = y;
+      break;
+    case 2:
+      by = sh - y - n;
+      bw = sw;
+      bh = n;
+      break;
+    case 3:
+      bx = sw - y - n;
+      break;
+    default: // case 0:
+      by = y;
+      bw = sw;
+      bh = n;
+    }
+
+    const uint16_t *src;
+    int16_t stride;
+    if (scale == GFX_SCALE_1)
+    {
+      src = _framebuffer + ((int32_t)by * WIDTH) + bx;
+      stride = WIDTH;
+    }
+    else
+    {
+      uint16_t *dst = rotation ? block : band;
+      for (int16_t j = 0; j < bh; ++j)
       {
-        p = (*row1++ & 0b1110011110011100) >> 2;
-        p += (*row1++ & 0b1110011110011100) >> 2;
-        p += (*row2++ & 0b1110011110011100) >> 2;
-        p += (*row2++ & 0b1110011110011100) >> 2;
-        _rowBuf[i] = p;
+        gfx_canvas_scaled_row(dst + ((int32_t)j * bw), _framebuffer, WIDTH, bx, by + j, bw, scale);
       }
-      _output->draw16bitRGBBitmap(_output_x, _output_y + y++, _rowBuf, wQuad, 1);
-      row1 += WIDTH;
-      row2 += WIDTH;
+      src = dst;
+      stride = bw;
+    }
+    if (rotation)
+    {
+      gfx_rotate_rgb565(band, src, stride, bw, bh, rotation);
     }
+    _output->draw16bitRGBBitmap(_output_x, _output_y + y, band, dw, n);
   }
 }
 
@@ -6,8 +6,22 @@
 
 #include "../Arduino_GFX.h"
 
+// scale factors for flushTransformed()
+#define GFX_SCALE_QUARTER 0 // 1/4, each output pixel averages 4x4 pixels
+#define GFX_SCALE_HALF 1    // 1/2, each output pixel averages 2x2 pixels
+#define GFX_SCALE_1 2
+#define GFX_SCALE_2X 3 // 2x, each pixel repeated 2x2 (nearest)
+
+// pixels per output band of flushTransformed(), each band is one address
+// window; the canvas allocates two buffers of this size on the first call
+#ifndef GFX_CANVAS_TRANSFER_PIXELS
+#define GFX_CANVAS_TRANSFER_PIXELS 4096
+#endif
+
 class Arduino_Canvas : public Arduino_GFX
 {
+  friend class Arduino_DisplayScheduler;
+
 public:
   Arduino_Canvas(int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0, uint8_t rotation = 0);
   ~Arduino_Canvas();
@@ -19,6 +33,7 @@ public:
   void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
   void writeFastHLineCore(int16_t x, int16_t y, int16_t w, uint16_t color);
   void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void writeCoverageSpanPreclipped(int16_t x, int16_t y, const uint8_t *cov, int16_t len, uint16_t color, uint16_t bg) override;
   void drawIndexedBitmap(int16_t x, int16_t y, uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h, int16_t x_skip = 0) override;
   void drawIndexedBitmap(int16_t x, int16_t y, uint8_t *bitmap, uint16_t *color_index, uint8_t chroma_key, int16_t w, int16_t h, int16_t x_skip = 0) override;
   void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
@@ -26,6 +41,7 @@ public:
   void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
   void flush(void) override;
   void flushQuad(void);
+  void flushTransformed(uint8_t scale, uint8_t rotation = 0);
 
   uint16_t *getFramebuffer();
 
@@ -35,8 +51,9 @@ protected:
   int16_t _output_x, _output_y;
   int16_t MAX_X, MAX_Y;
 
-  // for flushQuad() only
-  uint16_t *_rowBuf = nullptr;
+  // for flushTransformed() only
+  uint16_t *_transferBuf = nullptr;
+  int32_t _transferPixels = 0;
 
 private:
 };
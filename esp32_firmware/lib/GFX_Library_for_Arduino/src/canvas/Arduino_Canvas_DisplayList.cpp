@@ -0,0 +1,478 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "../Arduino_GFX.h"
+#include "Arduino_Canvas_DisplayList.h"
+
+Arduino_Canvas_DisplayList::Arduino_Canvas_DisplayList(
+    int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y, uint16_t capacity)
+    : Arduino_GFX(w, h), _output(output), _output_x(output_x), _output_y(output_y), _capacity(capacity)
+{
+  _bands = (h + DISPLAYLIST_BAND_LINES - 1) >> DISPLAYLIST_BAND_SHIFT;
+}
+
+Arduino_Canvas_DisplayList::~Arduino_Canvas_DisplayList()
+{
+  if (_cmds)
+  {
+    free(_cmds);
+  }
+  if (_order)
+  {
+    free(_order);
+  }
+  if (_bandStart)
+  {
+    free(_bandStart);
+  }
+  if (_bandHash)
+  {
+    free(_bandHash);
+  }
+  if (_bandBuf)
+  {
+    free(_bandBuf);
+  }
+}
+
+bool Arduino_Canvas_DisplayList::begin(int32_t speed)
+{
+  if (
+      (speed != GFX_SKIP_OUTPUT_BEGIN) && (_output))
+  {
+    if (!_output->begin(speed))
+    {
+      return false;
+    }
+  }
+
+  if (!_cmds)
+  {
+    size_t s = (size_t)_capacity * sizeof(displaylist_cmd_t);
+#if defined(ESP32)
+    if (psramFound())
+    {
+      _cmds = (displaylist_cmd_t *)ps_malloc(s);
+    }
+    else
+    {
+      _cmds = (displaylist_cmd_t *)malloc(s);
+    }
+#else
+    _cmds = (displaylist_cmd_t *)malloc(s);
+#endif
+    _order = (uint16_t *)malloc((size_t)_capacity * 3 * sizeof(uint16_t));
+    _bandStart = (uint16_t *)malloc((_bands + 1) * sizeof(uint16_t));
+    _bandHash = (uint32_t *)calloc(_bands, sizeof(uint32_t));
+    // the band buffer feeds the bus, keep it in internal RAM
+    _bandBuf = (uint16_t *)malloc((size_t)WIDTH * DISPLAYLIST_BAND_LINES * 2);
+    if ((!_cmds) || (!_order) || (!_bandStart) || (!_bandHash) || (!_bandBuf))
+    {
+      return false;
+    }
+    _active = _order + _capacity;
+    _merge = _active + _capacity;
+  }
+
+  return true;
+}
+
+void Arduino_Canvas_DisplayList::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
+{
+  // text and lines come in pixel by pixel, extend the last span when possible
+  if (_count)
+  {
+    displaylist_cmd_t *last = _cmds + _count - 1;
+    if ((last->type == DISPLAYLIST_FILL) && (last->h == 1) && (last->y == y) && (last->color == color) && ((last->x + last->w) == x))
+    {
+      ++last->w;
+      return;
+    }
+  }
+  addFill(x, y, 1, 1, color);
+}
+
+void Arduino_Canvas_DisplayList::writeFastVLine(int16_t x, int16_t y,
+                                                int16_t h, uint16_t color)
+{
+  writeFillRect(x, y, 1, h, color);
+}
+
+void Arduino_Canvas_DisplayList::writeFastHLine(int16_t x, int16_t y,
+                                                int16_t w, uint16_t color)
+{
+  writeFillRect(x, y, w, 1, color);
+}
+
+void Arduino_Canvas_DisplayList::writeFillRectPreclipped(int16_t x, int16_t y,
+                                                         int16_t w, int16_t h, uint16_t color)
+{
+  addFill(x, y, w, h, color);
+}
+
+void Arduino_Canvas_DisplayList::draw16bitRGBBitmap(int16_t x, int16_t y,
+                                                    const uint16_t bitmap[], int16_t w, int16_t h)
+{
+  addBitmap(DISPLAYLIST_BITMAP, x, y, bitmap, w, h, 0);
+}
+
+void Arduino_Canvas_DisplayList::draw16bitRGBBitmap(int16_t x, int16_t y,
+                                                    uint16_t *bitmap, int16_t w, int16_t h)
+{
+  addBitmap(DISPLAYLIST_BITMAP, x, y, bitmap, w, h, 0);
+}
+
+void Arduino_Canvas_DisplayList::draw16bitRGBBitmapWithTranColor(
+    int16_t x, int16_t y,
+    uint16_t *bitmap, uint16_t transparent_color, int16_t w, int16_t h)
+{
+  addBitmap(DISPLAYLIST_BITMAP_TRAN, x, y, bitmap, w, h, transparent_color);
+}
+
+void Arduino_Canvas_DisplayList::draw16bitBeRGBBitmap(int16_t x, int16_t y,
+                                                      uint16_t *bitmap, int16_t w, int16_t h)
+{
+  addBitmap(DISPLAYLIST_BITMAP_BE, x, y, bitmap, w, h, 0);
+}
+
+/**************************************************************************/
+/*!
+   @brief   Rasterize the command list band by band and send the bands that
+            changed since the last flush(). The list is kept.
+*/
+/**************************************************************************/
+void Arduino_Canvas_DisplayList::flush()
+{
+  if ((!_output) || (!_bandBuf))
+  {
+    return;
+  }
+  compact();
+
+  // counting sort by first band, stable so recording order holds in a bucket;
+  // afterwards bucket b is _order[_bandStart[b - 1] .. _bandStart[b] - 1]
+  memset(_bandStart, 0, (_bands + 1) * sizeof(uint16_t));
+  for (uint16_t i = 0; i < _count; ++i)
+  {
+    ++_bandStart[(_cmds[i].y >> DISPLAYLIST_BAND_SHIFT) + 1];
+  }
+  for (int16_t b = 1; b <= _bands; ++b)
+  {
+    _bandStart[b] += _bandStart[b - 1];
+  }
+  for (uint16_t i = 0; i < _count; ++i)
+  {
+    _order[_bandStart[_cmds[i].y >> DISPLAYLIST_BAND_SHIFT]++] = i;
+  }
+
+  uint16_t activeCount = 0;
+  uint16_t bucket = 0;
+  for (int16_t b = 0; b < _bands; ++b)
+  {
+    int16_t y0 = b << DISPLAYLIST_BAND_SHIFT;
+    int16_t lines = min((int16_t)DISPLAYLIST_BAND_LINES, (int16_t)(HEIGHT - y0));
+    int16_t y1 = y0 + lines;
+
+    // drop commands that ended above this band, merge in the ones starting here
+    uint16_t bucketEnd = _bandStart[b];
+    uint16_t n = 0;
+    uint16_t i = 0;
+    while ((i < activeCount) || (bucket < bucketEnd))
+    {
+      uint16_t idx;
+      if ((bucket >= bucketEnd) || ((i < activeCount) && (_active[i] < _order[bucket])))
+      {
+        idx = _active[i++];
+        if ((_cmds[idx].y + _cmds[idx].h) <= y0)
+        {
+          continue;
+        }
+      }
+      else
+      {
+        idx = _order[bucket++];
+      }
+      _merge[n++] = idx;
+    }
+    uint16_t *t = _active;
+    _active = _merge;
+    _merge = t;
+    activeCount = n;
+
+    // everything under the last fill covering the whole band is overdrawn
+    uint16_t first = 0;
+    bool covered = false;
+    for (uint16_t k = activeCount; k > 0; --k)
+    {
+      const displaylist_cmd_t *c = _cmds + _active[k - 1];
+      if ((c->type == DISPLAYLIST_FILL) && (c->x == 0) && (c->w == WIDTH) && (c->y <= y0) && ((c->y + c->h) >= y1))
+      {
+        first = k - 1;
+        covered = true;
+        break;
+      }
+    }
+
+    // FNV-1a over what would be drawn; bitmaps may have changed behind the
+    // pointer, so bands holding one are always sent
+    uint32_t hash = 2166136261UL;
+    bool force = false;
+    for (uint16_t k = first; k < activeCount; ++k)
+    {
+      const displaylist_cmd_t *c = _cmds + _active[k];
+      uint32_t v[3] = {
+          ((uint32_t)c->type << 16) | c->color,
+          ((uint32_t)(uint16_t)c->x << 16) | (uint16_t)c->y,
+          ((uint32_t)(uint16_t)c->w << 16) | (uint16_t)c->h};
+      for (uint8_t j = 0; j < 3; ++j)
+      {
+        hash = (hash ^ v[j]) * 16777619UL;
+      }
+      if (c->type != DISPLAYLIST_FILL)
+      {
+        force = true;
+      }
+    }
+    if (hash == 0)
+    {
+      hash = 1;
+    }
+    if ((!force) && (hash == _bandHash[b]))
+    {
+      continue;
+    }
+    _bandHash[b] = hash;
+
+    if (!covered)
+    {
+      memset(_bandBuf, 0, (size_t)WIDTH * lines * 2);
+    }
+    for (uint16_t k = first; k < activeCount; ++k)
+    {
+      rasterize(_cmds + _active[k], y0, lines);
+    }
+    _output->draw16bitRGBBitmap(_output_x, _output_y + y0, _bandBuf, WIDTH, lines);
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Drop all commands, the next flush() sends a black screen
+*/
+/**************************************************************************/
+void Arduino_Canvas_DisplayList::clear()
+{
+  _count = 0;
+  _dead = 0;
+  _overflow = false;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Forget what was sent, the next flush() sends every band
+*/
+/**************************************************************************/
+void Arduino_Canvas_DisplayList::invalidate()
+{
+  if (_bandHash)
+  {
+    memset(_bandHash, 0, _bands * sizeof(uint32_t));
+  }
+}
+
+uint16_t Arduino_Canvas_DisplayList::commandCount()
+{
+  return _count - _dead;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Whether commands were dropped because the list could not grow
+*/
+/**************************************************************************/
+bool Arduino_Canvas_DisplayList::overflowed()
+{
+  return _overflow;
+}
+
+void Arduino_Canvas_DisplayList::addFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if ((int32_t)w * h >= DISPLAYLIST_CULL_AREA)
+  {
+    int16_t x2 = x + w;
+    int16_t y2 = y + h;
+    for (uint16_t i = 0; i < _count; ++i)
+    {
+      displaylist_cmd_t *c = _cmds + i;
+      if ((c->type != DISPLAYLIST_NONE) && (c->x >= x) && (c->y >= y) && ((c->x + c->w) <= x2) && ((c->y + c->h) <= y2))
+      {
+        c->type = DISPLAYLIST_NONE;
+        ++_dead;
+      }
+    }
+  }
+
+  displaylist_cmd_t *c = newCommand();
+  if (c)
+  {
+    c->type = DISPLAYLIST_FILL;
+    c->color = color;
+    c->x = x;
+    c->y = y;
+    c->w = w;
+    c->h = h;
+    c->stride = 0;
+    c->bitmap = nullptr;
+  }
+}
+
+void Arduino_Canvas_DisplayList::addBitmap(uint8_t type, int16_t x, int16_t y, const uint16_t *bitmap, int16_t w, int16_t h, uint16_t color)
+{
+  int16_t stride = w;
+  if (x < 0)
+  {
+    bitmap -= x;
+    w += x;
+    x = 0;
+  }
+  if (y < 0)
+  {
+    bitmap -= (int32_t)y * stride;
+    h += y;
+    y = 0;
+  }
+  if ((x + w - 1) > _max_x)
+  {
+    w = _max_x - x + 1;
+  }
+  if ((y + h - 1) > _max_y)
+  {
+    h = _max_y - y + 1;
+  }
+  if ((w <= 0) || (h <= 0))
+  {
+    return;
+  }
+
+  displaylist_cmd_t *c = newCommand();
+  if (c)
+  {
+    c->type = type;
+    c->color = color;
+    c->x = x;
+    c->y = y;
+    c->w = w;
+    c->h = h;
+    c->stride = stride;
+    c->bitmap = bitmap;
+  }
+}
+
+displaylist_cmd_t *Arduino_Canvas_DisplayList::newCommand()
+{
+  if (!_cmds)
+  {
+    return nullptr;
+  }
+  if (_count == _capacity)
+  {
+    compact();
+    if ((_count == _capacity) && (!grow()))
+    {
+      _overflow = true;
+      return nullptr;
+    }
+  }
+  return _cmds + _count++;
+}
+
+bool Arduino_Canvas_DisplayList::grow()
+{
+  if (_capacity > (UINT16_MAX / 2))
+  {
+    return false;
+  }
+  uint16_t capacity = _capacity * 2;
+  size_t s = (size_t)capacity * sizeof(displaylist_cmd_t);
+#if defined(ESP32)
+  displaylist_cmd_t *cmds = psramFound() ? (displaylist_cmd_t *)ps_realloc(_cmds, s) : (displaylist_cmd_t *)realloc(_cmds, s);
+#else
+  displaylist_cmd_t *cmds = (displaylist_cmd_t *)realloc(_cmds, s);
+#endif
+  if (!cmds)
+  {
+    return false;
+  }
+  _cmds = cmds;
+
+  uint16_t *order = (uint16_t *)realloc(_order, (size_t)capacity * 3 * sizeof(uint16_t));
+  if (!order)
+  {
+    return false; // the commands fit, the index arrays keep their old size
+  }
+  _order = order;
+  _active = _order + capacity;
+  _merge = _active + capacity;
+  _capacity = capacity;
+  return true;
+}
+
+void Arduino_Canvas_DisplayList::compact()
+{
+  if (_dead)
+  {
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < _count; ++i)
+    {
+      if (_cmds[i].type != DISPLAYLIST_NONE)
+      {
+        _cmds[n++] = _cmds[i];
+      }
+    }
+    _count = n;
+    _dead = 0;
+  }
+}
+
+void Arduino_Canvas_DisplayList::rasterize(const displaylist_cmd_t *c, int16_t y0, int16_t lines)
+{
+  int16_t ys = max(c->y, y0);
+  int16_t ye = min((int16_t)(c->y + c->h), (int16_t)(y0 + lines));
+  uint16_t *row = _bandBuf + (int32_t)(ys - y0) * WIDTH + c->x;
+  const uint16_t *src = c->bitmap + (int32_t)(ys - c->y) * c->stride;
+  for (int16_t y = ys; y < ye; ++y)
+  {
+    int16_t i;
+    switch (c->type)
+    {
+    case DISPLAYLIST_FILL:
+      for (i = 0; i < c->w; ++i)
+      {
+        row[i] = c->color;
+      }
+      break;
+    case DISPLAYLIST_BITMAP:
+      memcpy(row, src, c->w * 2);
+      break;
+    case DISPLAYLIST_BITMAP_BE:
+      for (i = 0; i < c->w; ++i)
+      {
+        row[i] = (src[i] >> 8) | (src[i] << 8);
+      }
+      break;
+    case DISPLAYLIST_BITMAP_TRAN:
+      for (i = 0; i < c->w; ++i)
+      {
+        if (src[i] != c->color)
+        {
+          row[i] = src[i];
+        }
+      }
+      break;
+    }
+    row += WIDTH;
+    src += c->stride;
+  }
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -0,0 +1,96 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_CANVAS_DISPLAYLIST_H_
+#define _ARDUINO_CANVAS_DISPLAYLIST_H_
+
+#include "../Arduino_GFX.h"
+
+#ifndef DISPLAYLIST_BAND_SHIFT
+#define DISPLAYLIST_BAND_SHIFT 4 // 16 lines per band
+#endif
+#define DISPLAYLIST_BAND_LINES (1 << DISPLAYLIST_BAND_SHIFT)
+#define DISPLAYLIST_DEFAULT_CAPACITY 512
+#define DISPLAYLIST_CULL_AREA 256 // fills at least this big remove the commands they cover
+
+typedef enum
+{
+  DISPLAYLIST_NONE = 0, // culled
+  DISPLAYLIST_FILL,
+  DISPLAYLIST_BITMAP,
+  DISPLAYLIST_BITMAP_BE,
+  DISPLAYLIST_BITMAP_TRAN,
+} displaylist_cmd_type_t;
+
+typedef struct
+{
+  uint8_t type;
+  uint16_t color;         // fill color, or transparent color of DISPLAYLIST_BITMAP_TRAN
+  int16_t x, y, w, h;     // clipped to the canvas
+  int16_t stride;         // bitmap row length in pixels
+  const uint16_t *bitmap; // first visible pixel, must stay valid until flush()
+} displaylist_cmd_t;
+
+/*!
+  Canvas without a framebuffer: primitives are recorded into a command list
+  and flush() rasterizes the list a band of DISPLAYLIST_BAND_LINES rows at a
+  time into a line buffer, sending each band as one draw16bitRGBBitmap().
+  Bands whose commands did not change since the last flush() are skipped, so
+  the list is retained until clear() or a fill that covers earlier commands.
+  Pixels no command covers are black. Set the rotation on the output.
+*/
+class Arduino_Canvas_DisplayList : public Arduino_GFX
+{
+public:
+  Arduino_Canvas_DisplayList(int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0, uint16_t capacity = DISPLAYLIST_DEFAULT_CAPACITY);
+  ~Arduino_Canvas_DisplayList();
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void draw16bitRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) override;
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
+  void draw16bitRGBBitmapWithTranColor(int16_t x, int16_t y, uint16_t *bitmap, uint16_t transparent_color, int16_t w, int16_t h) override;
+  void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
+  void flush(void) override;
+
+  void clear();
+  void invalidate();
+  uint16_t commandCount();
+  bool overflowed();
+
+protected:
+  void addFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void addBitmap(uint8_t type, int16_t x, int16_t y, const uint16_t *bitmap, int16_t w, int16_t h, uint16_t color);
+  displaylist_cmd_t *newCommand();
+  bool grow();
+  void compact();
+  void rasterize(const displaylist_cmd_t *c, int16_t y0, int16_t lines);
+
+  Arduino_G *_output = nullptr;
+  int16_t _output_x, _output_y;
+
+  displaylist_cmd_t *_cmds = nullptr;
+  uint16_t _capacity;
+  uint16_t _count = 0;
+  uint16_t _dead = 0;
+  bool _overflow = false;
+
+  // flush() working set: commands bucketed by first band, and the commands
+  // touching the current band, both in recording order
+  uint16_t *_order = nullptr;
+  uint16_t *_active = nullptr;
+  uint16_t *_merge = nullptr;
+  uint16_t *_bandStart = nullptr;
+  uint32_t *_bandHash = nullptr; // 0 means unknown, the band is sent
+  uint16_t *_bandBuf = nullptr;
+  int16_t _bands;
+
+private:
+};
+
+#endif // _ARDUINO_CANVAS_DISPLAYLIST_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
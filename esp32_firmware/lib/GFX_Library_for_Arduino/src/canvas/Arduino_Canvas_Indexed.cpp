@@ -25,6 +25,10 @@ Arduino_Canvas_Indexed::~Arduino_Canvas_Indexed()
   {
     free(_framebuffer);
   }
+  if (_nearest_index)
+  {
+    free(_nearest_index);
+  }
 }
 
 bool Arduino_Canvas_Indexed::begin(int32_t speed)
@@ -504,21 +508,113 @@ void Arduino_Canvas_Indexed::setDirectUseColorIndex(bool isEnable)
   _isDirectUseColorIndex = isEnable;
 }
 
+/**************************************************************************/
+/*!
+   @brief   Switch to a fixed palette. Colors are no longer added or masked,
+            each color maps to its palette entry or, failing that, to the
+            palette entry nearest to it, looked up from a map precomputed
+            here at RGB444 resolution. Framebuffer content is not remapped.
+    @param    palette   Up to COLOR_IDX_SIZE RGB565 colors, NULL returns to the
+                        adaptive palette
+    @param    size      Number of colors in palette
+    @return   false if the nearest-color map could not be allocated
+*/
+/**************************************************************************/
+bool Arduino_Canvas_Indexed::setFixedPalette(const uint16_t *palette, uint16_t size)
+{
+  clear_color_hash();
+  _indexed_size = 0;
+  if ((!palette) || (size == 0))
+  {
+    if (_nearest_index)
+    {
+      free(_nearest_index);
+      _nearest_index = nullptr;
+    }
+    return true;
+  }
+
+  if (!_nearest_index)
+  {
+    _nearest_index = (uint8_t *)malloc(COLOR_IDX_NEAREST_SIZE);
+    if (!_nearest_index)
+    {
+      return false;
+    }
+  }
+
+  if (size > COLOR_IDX_SIZE)
+  {
+    size = COLOR_IDX_SIZE;
+  }
+  for (uint16_t i = 0; i < size; i++)
+  {
+    _color_index[i] = palette[i];
+    int16_t slot = find_color_slot(palette[i]);
+    if (!_color_hash[slot]) // first of duplicated colors wins
+    {
+      _color_hash[slot] = i + 1;
+    }
+  }
+
+  // compare in 6 bits per channel at the center of each RGB444 cell,
+  // weighted roughly by how sensitive the eye is to each channel
+  for (uint16_t key = 0; key < COLOR_IDX_NEAREST_SIZE; key++)
+  {
+    int16_t r = ((key >> 8) << 2) | 2;
+    int16_t g = (((key >> 4) & 0xF) << 2) | 2;
+    int16_t b = ((key & 0xF) << 2) | 2;
+    uint32_t best_dist = UINT32_MAX;
+    uint8_t best = 0;
+    for (uint16_t i = 0; i < size; i++)
+    {
+      uint16_t c = _color_index[i];
+      int16_t dr = r - ((c >> 10) & 0x3E);
+      int16_t dg = g - ((c >> 5) & 0x3F);
+      int16_t db = b - ((c << 1) & 0x3E);
+      uint32_t dist = (3 * dr * dr) + (4 * dg * dg) + (2 * db * db);
+      if (dist < best_dist)
+      {
+        best_dist = dist;
+        best = i;
+      }
+    }
+    _nearest_index[key] = best;
+  }
+
+  return true;
+}
+
 uint8_t Arduino_Canvas_Indexed::get_color_index(uint16_t color)
 {
-  color &= _color_mask;
-  for (uint8_t i = 0; i < _indexed_size; i++)
+  if (_nearest_index) // fixed palette
   {
-    if (_color_index[i] == color)
+    int16_t slot = find_color_slot(color);
+    if (_color_hash[slot])
     {
-      return i;
+      return _color_hash[slot] - 1;
     }
+    return _nearest_index[((color >> 4) & 0xF00) | ((color >> 3) & 0xF0) | ((color >> 1) & 0xF)];
+  }
+
+  color &= _color_mask;
+  int16_t slot = find_color_slot(color);
+  if (_color_hash[slot])
+  {
+    return _color_hash[slot] - 1;
   }
   if (_indexed_size == (COLOR_IDX_SIZE - 1)) // overflowed
   {
+    uint8_t mask_level = _current_mask_level;
     raise_mask_level();
+    if (_current_mask_level != mask_level)
+    {
+      // the coarser mask may merge color into an existing entry
+      return get_color_index(color);
+    }
   }
   _color_index[_indexed_size] = color;
+  _color_hash[slot] = _indexed_size + 1;
   // print("color_index[");
   // print(_indexed_size);
   // print("] = ");
@@ -533,29 +629,49 @@ GFX_INLINE uint16_t Arduino_Canvas_Indexed::get_index_color(uint8_t idx)
 
 void Arduino_Canvas_Indexed::raise_mask_level()
 {
-  if ((_current_mask_level + 1) < MAXMASKLEVEL)
+  if ((!_nearest_index) && ((_current_mask_level + 1) < MAXMASKLEVEL))
   {
     int32_t buffer_size = _width * _height;
     uint8_t old_indexed_size = _indexed_size;
-    uint8_t new_color;
+    uint8_t remap[COLOR_IDX_SIZE];
     _indexed_size = 0;
     _color_mask = mask_level_list[++_current_mask_level];
+    clear_color_hash();
     // print("Raised mask level: ");
     // println(_current_mask_level);
 
-    // update _framebuffer color index, it is a time consuming job
-    for (uint8_t old_color = 0; old_color < old_indexed_size; old_color++)
+    // new indexes never pass the old ones, so the palette is rebuilt in place
+    for (int16_t old_color = 0; old_color < COLOR_IDX_SIZE; old_color++)
+    {
+      remap[old_color] = (old_color < old_indexed_size) ? get_color_index(_color_index[old_color]) : old_color;
+    }
+
+    // update _framebuffer color index in a single pass
+    if (_framebuffer)
     {
-      new_color = get_color_index(_color_index[old_color]);
       for (int32_t i = 0; i < buffer_size; i++)
       {
-        if (_framebuffer[i] == old_color)
-        {
-          _framebuffer[i] = new_color;
-        }
+        _framebuffer[i] = remap[_framebuffer[i]];
       }
     }
   }
 }
 
+// slot holding color, or the empty slot it goes into
+int16_t Arduino_Canvas_Indexed::find_color_slot(uint16_t color)
+{
+  int16_t slot = (uint32_t)(color * 2654435761UL) >> (32 - COLOR_IDX_HASH_BITS);
+  uint16_t idx;
+  while ((idx = _color_hash[slot]) && (_color_index[idx - 1] != color))
+  {
+    slot = (slot + 1) & (COLOR_IDX_HASH_SIZE - 1);
+  }
+  return slot;
+}
+
+void Arduino_Canvas_Indexed::clear_color_hash()
+{
+  memset(_color_hash, 0, sizeof(_color_hash));
+}
+
 #endif // !defined(LITTLE_FOOT_PRINT)
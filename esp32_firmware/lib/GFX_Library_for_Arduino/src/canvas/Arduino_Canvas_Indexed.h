@@ -7,6 +7,9 @@
 #include "../Arduino_GFX.h"
 
 #define COLOR_IDX_SIZE 256
+#define COLOR_IDX_HASH_BITS 9 // reverse palette slots, 2x COLOR_IDX_SIZE keeps probes short
+#define COLOR_IDX_HASH_SIZE (1 << COLOR_IDX_HASH_BITS)
+#define COLOR_IDX_NEAREST_SIZE 4096 // fixed palette nearest-color map, indexed by RGB444
 
 class Arduino_Canvas_Indexed : public Arduino_GFX
 {
@@ -28,12 +31,15 @@ public:
   uint8_t *getFramebuffer();
   uint16_t *getColorIndex();
   void setDirectUseColorIndex(bool isEnable);
+  bool setFixedPalette(const uint16_t *palette, uint16_t size);
 
   uint8_t get_color_index(uint16_t color);
   uint16_t get_index_color(uint8_t idx);
   void raise_mask_level();
 
 protected:
+  int16_t find_color_slot(uint16_t color);
+  void clear_color_hash();
   uint8_t *_framebuffer = nullptr;
   Arduino_G *_output = nullptr;
   int16_t _output_x, _output_y;
@@ -43,6 +49,10 @@ protected:
   uint8_t _indexed_size = 0;
   bool _isDirectUseColorIndex = false;
 
+  // open addressing reverse palette, slot holds index + 1, 0 is empty
+  uint16_t _color_hash[COLOR_IDX_HASH_SIZE] = {0};
+  uint8_t *_nearest_index = nullptr; // set in fixed palette mode only
+
   uint8_t _current_mask_level;
   uint16_t _color_mask;
 #define MAXMASKLEVEL 3
@@ -0,0 +1,361 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "../Arduino_GFX.h"
+#include "Arduino_Canvas_Tiled.h"
+
+Arduino_Canvas_Tiled::Arduino_Canvas_Tiled(
+    int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y, uint8_t r)
+    : Arduino_Canvas(w, h, output, output_x, output_y, r)
+{
+  _tilesX = (WIDTH + CANVAS_TILE_SIZE - 1) >> CANVAS_TILE_SHIFT;
+  _tilesY = (HEIGHT + CANVAS_TILE_SIZE - 1) >> CANVAS_TILE_SHIFT;
+  _tileWords = (_tilesX + 31) >> 5;
+}
+
+Arduino_Canvas_Tiled::~Arduino_Canvas_Tiled()
+{
+  if (_dirty)
+  {
+    free(_dirty);
+  }
+  if (_flushBuf)
+  {
+    free(_flushBuf);
+  }
+}
+
+bool Arduino_Canvas_Tiled::begin(int32_t speed)
+{
+  if (!Arduino_Canvas::begin(speed))
+  {
+    return false;
+  }
+
+  if (!_dirty)
+  {
+    _dirty = (uint32_t *)calloc((size_t)_tileWords * _tilesY, sizeof(uint32_t));
+    if (!_dirty)
+    {
+      return false;
+    }
+  }
+  if (!_flushBuf)
+  {
+    _flushBuf = (uint16_t *)malloc(((size_t)WIDTH << CANVAS_TILE_SHIFT) * 2);
+    if (!_flushBuf)
+    {
+      return false;
+    }
+  }
+
+  // the panel content is unknown, the first flush() sends everything
+  markAllDirty();
+
+  return true;
+}
+
+void Arduino_Canvas_Tiled::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
+{
+  Arduino_Canvas::writePixelPreclipped(x, y, color);
+  markDirty(x, y, 1, 1);
+}
+
+void Arduino_Canvas_Tiled::writeFastVLine(int16_t x, int16_t y,
+                                          int16_t h, uint16_t color)
+{
+  Arduino_Canvas::writeFastVLine(x, y, h, color);
+  markDirty(x, y, 1, h);
+}
+
+void Arduino_Canvas_Tiled::writeFastHLine(int16_t x, int16_t y,
+                                          int16_t w, uint16_t color)
+{
+  Arduino_Canvas::writeFastHLine(x, y, w, color);
+  markDirty(x, y, w, 1);
+}
+
+void Arduino_Canvas_Tiled::writeFillRectPreclipped(int16_t x, int16_t y,
+                                                   int16_t w, int16_t h, uint16_t color)
+{
+  Arduino_Canvas::writeFillRectPreclipped(x, y, w, h, color);
+  markDirty(x, y, w, h);
+}
+
+void Arduino_Canvas_Tiled::writeCoverageSpanPreclipped(int16_t x, int16_t y, const uint8_t *cov, int16_t len, uint16_t color, uint16_t bg)
+{
+  Arduino_Canvas::writeCoverageSpanPreclipped(x, y, cov, len, color, bg);
+  markDirty(x, y, len, 1);
+}
+
+void Arduino_Canvas_Tiled::drawIndexedBitmap(
+    int16_t x, int16_t y,
+    uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h, int16_t x_skip)
+{
+  Arduino_Canvas::drawIndexedBitmap(x, y, bitmap, color_index, w, h, x_skip);
+  markDirty(x, y, w, h);
+}
+
+void Arduino_Canvas_Tiled::drawIndexedBitmap(
+    int16_t x, int16_t y,
+    uint8_t *bitmap, uint16_t *color_index, uint8_t chroma_key, int16_t w, int16_t h, int16_t x_skip)
+{
+  Arduino_Canvas::drawIndexedBitmap(x, y, bitmap, color_index, chroma_key, w, h, x_skip);
+  markDirty(x, y, w, h);
+}
+
+void Arduino_Canvas_Tiled::draw16bitRGBBitmap(
+    int16_t x, int16_t y,
+    uint16_t *bitmap, int16_t w, int16_t h)
+{
+  Arduino_Canvas::draw16bitRGBBitmap(x, y, bitmap, w, h);
+  markDirty(x, y, w, h);
+}
+
+void Arduino_Canvas_Tiled::draw16bitRGBBitmapWithTranColor(
+    int16_t x, int16_t y,
+    uint16_t *bitmap, uint16_t transparent_color, int16_t w, int16_t h)
+{
+  Arduino_Canvas::draw16bitRGBBitmapWithTranColor(x, y, bitmap, transparent_color, w, h);
+  markDirty(x, y, w, h);
+}
+
+void Arduino_Canvas_Tiled::draw16bitBeRGBBitmap(
+    int16_t x, int16_t y,
+    uint16_t *bitmap, int16_t w, int16_t h)
+{
+  Arduino_Canvas::draw16bitBeRGBBitmap(x, y, bitmap, w, h);
+  markDirty(x, y, w, h);
+}
+
+/**************************************************************************/
+/*!
+   @brief   Mark a rectangle dirty, for code that writes to getFramebuffer()
+            directly. Coordinates are in the current rotation and may lie
+            partly off the canvas.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    w   Width in pixels, may be negative
+    @param    h   Height in pixels, may be negative
+*/
+/**************************************************************************/
+void Arduino_Canvas_Tiled::markDirty(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if (w < 0)
+  {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0)
+  {
+    y += h + 1;
+    h = -h;
+  }
+  if ((w == 0) || (h == 0))
+  {
+    return;
+  }
+
+  // same mapping as Arduino_Canvas::writeFillRectPreclipped()
+  if (_rotation > 0)
+  {
+    int16_t t = x;
+    switch (_rotation)
+    {
+    case 1:
+      x = WIDTH - y - h;
+      y = t;
+      t = w;
+      w = h;
+      h = t;
+      break;
+    case 2:
+      x = WIDTH - x - w;
+      y = HEIGHT - y - h;
+      break;
+    case 3:
+      x = y;
+      y = HEIGHT - t - w;
+      t = w;
+      w = h;
+      h = t;
+      break;
+    }
+  }
+
+  int16_t x2 = x + w - 1;
+  int16_t y2 = y + h - 1;
+  if ((x2 < 0) || (y2 < 0) || (x > MAX_X) || (y > MAX_Y))
+  {
+    return;
+  }
+  markDirtyTiles(max(x, (int16_t)0), max(y, (int16_t)0), min(x2, MAX_X), min(y2, MAX_Y));
+}
+
+void Arduino_Canvas_Tiled::markAllDirty()
+{
+  markDirtyTiles(0, 0, MAX_X, MAX_Y);
+}
+
+void Arduino_Canvas_Tiled::clearDirty()
+{
+  if (_dirty)
+  {
+    memset(_dirty, 0, (size_t)_tileWords * _tilesY * sizeof(uint32_t));
+  }
+}
+
+uint32_t Arduino_Canvas_Tiled::dirtyTileCount()
+{
+  uint32_t count = 0;
+  if (_dirty)
+  {
+    for (int32_t i = 0; i < (int32_t)_tileWords * _tilesY; ++i)
+    {
+      count += __builtin_popcount(_dirty[i]);
+    }
+  }
+  return count;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Number of pixels the last flush() sent to the output
+*/
+/**************************************************************************/
+uint32_t Arduino_Canvas_Tiled::lastFlushPixels()
+{
+  return _lastFlushPixels;
+}
+
+// x1..y2 are framebuffer pixels, inclusive and already clipped
+void Arduino_Canvas_Tiled::markDirtyTiles(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+  if (!_dirty)
+  {
+    return;
+  }
+  int16_t tx1 = x1 >> CANVAS_TILE_SHIFT;
+  int16_t tx2 = x2 >> CANVAS_TILE_SHIFT;
+  int16_t ty2 = y2 >> CANVAS_TILE_SHIFT;
+  for (int16_t ty = y1 >> CANVAS_TILE_SHIFT; ty <= ty2; ++ty)
+  {
+    uint32_t *row = _dirty + (int32_t)ty * _tileWords;
+    for (int16_t tx = tx1; tx <= tx2; ++tx)
+    {
+      row[tx >> 5] |= 1UL << (tx & 31);
+    }
+  }
+}
+
+bool Arduino_Canvas_Tiled::isTileDirty(int16_t tx, int16_t ty)
+{
+  return _dirty[(int32_t)ty * _tileWords + (tx >> 5)] & (1UL << (tx & 31));
+}
+
+void Arduino_Canvas_Tiled::clearTiles(int16_t tx1, int16_t tx2, int16_t ty)
+{
+  uint32_t *row = _dirty + (int32_t)ty * _tileWords;
+  for (int16_t tx = tx1; tx <= tx2; ++tx)
+  {
+    row[tx >> 5] &= ~(1UL << (tx & 31));
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Send the dirty tiles to the output and clear them. Each run of
+            dirty tiles in a tile row is grown downwards for as long as the
+            rows below are dirty over the whole run, and the resulting
+            rectangle goes out as one draw16bitRGBBitmap() call per band.
+*/
+/**************************************************************************/
+void Arduino_Canvas_Tiled::flush()
+{
+  _lastFlushPixels = 0;
+  if ((!_output) || (!_dirty))
+  {
+    return;
+  }
+
+  for (int16_t ty = 0; ty < _tilesY; ++ty)
+  {
+    int16_t tx = 0;
+    while (tx < _tilesX)
+    {
+      if (!isTileDirty(tx, ty))
+      {
+        ++tx;
+        continue;
+      }
+
+      int16_t tx2 = tx;
+      while ((tx2 + 1 < _tilesX) && isTileDirty(tx2 + 1, ty))
+      {
+        ++tx2;
+      }
+
+      int16_t ty2 = ty;
+      bool grow = true;
+      while (grow && (ty2 + 1 < _tilesY))
+      {
+        for (int16_t i = tx; i <= tx2; ++i)
+        {
+          if (!isTileDirty(i, ty2 + 1))
+          {
+            grow = false;
+            break;
+          }
+        }
+        if (grow)
+        {
+          ++ty2;
+        }
+      }
+
+      for (int16_t i = ty; i <= ty2; ++i)
+      {
+        clearTiles(tx, tx2, i);
+      }
+
+      int16_t x = tx << CANVAS_TILE_SHIFT;
+      int16_t y = ty << CANVAS_TILE_SHIFT;
+      int16_t w = min((int16_t)((tx2 + 1) << CANVAS_TILE_SHIFT), WIDTH) - x;
+      int16_t h = min((int16_t)((ty2 + 1) << CANVAS_TILE_SHIFT), HEIGHT) - y;
+      flushRect(x, y, w, h);
+
+      tx = tx2 + 1;
+    }
+  }
+}
+
+void Arduino_Canvas_Tiled::flushRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  _lastFlushPixels += (uint32_t)w * h;
+
+  if (w == WIDTH)
+  {
+    // full framebuffer rows are already contiguous
+    _output->draw16bitRGBBitmap(_output_x, _output_y + y, _framebuffer + (int32_t)y * WIDTH, w, h);
+    return;
+  }
+
+  int16_t bandRows = ((int32_t)WIDTH << CANVAS_TILE_SHIFT) / w;
+  uint16_t *src = _framebuffer + (int32_t)y * WIDTH + x;
+  while (h > 0)
+  {
+    int16_t rows = min(h, bandRows);
+    uint16_t *dst = _flushBuf;
+    for (int16_t j = 0; j < rows; ++j)
+    {
+      memcpy(dst, src, w * 2);
+      dst += w;
+      src += WIDTH;
+    }
+    _output->draw16bitRGBBitmap(_output_x + x, _output_y + y, _flushBuf, w, rows);
+    y += rows;
+    h -= rows;
+  }
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -0,0 +1,62 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_CANVAS_TILED_H_
+#define _ARDUINO_CANVAS_TILED_H_
+
+#include "../Arduino_GFX.h"
+#include "Arduino_Canvas.h"
+
+#ifndef CANVAS_TILE_SHIFT
+#define CANVAS_TILE_SHIFT 4 // 16x16 pixel tiles
+#endif
+#define CANVAS_TILE_SIZE (1 << CANVAS_TILE_SHIFT)
+
+/*!
+  Arduino_Canvas that remembers which CANVAS_TILE_SIZE square tiles of the
+  framebuffer were written since the last flush(). flush() coalesces the dirty
+  tiles into rectangles and sends only those to the output, each through its
+  own address window. Tiles are kept in framebuffer (unrotated) coordinates.
+*/
+class Arduino_Canvas_Tiled : public Arduino_Canvas
+{
+public:
+  Arduino_Canvas_Tiled(int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0, uint8_t rotation = 0);
+  ~Arduino_Canvas_Tiled();
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void writeCoverageSpanPreclipped(int16_t x, int16_t y, const uint8_t *cov, int16_t len, uint16_t color, uint16_t bg) override;
+  void drawIndexedBitmap(int16_t x, int16_t y, uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h, int16_t x_skip = 0) override;
+  void drawIndexedBitmap(int16_t x, int16_t y, uint8_t *bitmap, uint16_t *color_index, uint8_t chroma_key, int16_t w, int16_t h, int16_t x_skip = 0) override;
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
+  void draw16bitRGBBitmapWithTranColor(int16_t x, int16_t y, uint16_t *bitmap, uint16_t transparent_color, int16_t w, int16_t h) override;
+  void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
+  void flush(void) override;
+
+  void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+  void markAllDirty();
+  void clearDirty();
+  uint32_t dirtyTileCount();
+  uint32_t lastFlushPixels();
+
+protected:
+  void markDirtyTiles(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+  bool isTileDirty(int16_t tx, int16_t ty);
+  void clearTiles(int16_t tx1, int16_t tx2, int16_t ty);
+  void flushRect(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  uint32_t *_dirty = nullptr;   // one bit per tile, _tileWords words per tile row
+  uint16_t *_flushBuf = nullptr; // gathers partial-width rects into contiguous rows
+  int16_t _tilesX, _tilesY, _tileWords;
+  uint32_t _lastFlushPixels = 0;
+
+private:
+};
+
+#endif // _ARDUINO_CANVAS_TILED_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
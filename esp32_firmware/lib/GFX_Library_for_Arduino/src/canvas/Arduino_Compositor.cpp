@@ -0,0 +1,290 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "Arduino_Compositor.h"
+
+Arduino_Compositor::Arduino_Compositor(
+    Arduino_G *output, int16_t w, int16_t h, int16_t output_x, int16_t output_y)
+    : _output(output), _width(w), _height(h), _output_x(output_x), _output_y(output_y)
+{
+}
+
+Arduino_Compositor::~Arduino_Compositor()
+{
+  if (_lineBuf)
+  {
+    free(_lineBuf);
+  }
+}
+
+bool Arduino_Compositor::begin(int32_t speed)
+{
+  if (
+      (speed != GFX_SKIP_OUTPUT_BEGIN) && (_output))
+  {
+    if (!_output->begin(speed))
+    {
+      return false;
+    }
+  }
+
+  if (!_lineBuf)
+  {
+    // feeds the bus, keep it in internal RAM
+    _lineBuf = (uint16_t *)malloc((size_t)_width * COMPOSITOR_BUF_LINES * 2);
+    if (!_lineBuf)
+    {
+      return false;
+    }
+  }
+  invalidateAll();
+
+  return true;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Compose over a framebuffer, it is read on every update()
+    @param    framebuffer   Row major RGB565 pixels of the compositor size,
+                            NULL to use the background color
+*/
+/**************************************************************************/
+void Arduino_Compositor::setBackground(const uint16_t *framebuffer)
+{
+  _background = framebuffer;
+  invalidateAll();
+}
+
+void Arduino_Compositor::setBackgroundColor(uint16_t color)
+{
+  _backgroundColor = color;
+  if (!_background)
+  {
+    invalidateAll();
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Put a sprite on top of the stack, it shows on the next update()
+    @param    sprite   Sprite, begin() already called
+    @return   false if the stack is full or the sprite has no buffers
+*/
+/**************************************************************************/
+bool Arduino_Compositor::addSprite(Arduino_Sprite *sprite)
+{
+  if ((_layerCount >= COMPOSITOR_MAX_SPRITES) || (!sprite->getFramebuffer()))
+  {
+    return false;
+  }
+  compositor_layer_t *l = &_layers[_layerCount++];
+  l->sprite = sprite;
+  l->x = sprite->getX();
+  l->y = sprite->getY();
+  l->shown = false;
+  return true;
+}
+
+void Arduino_Compositor::removeSprite(Arduino_Sprite *sprite)
+{
+  for (uint8_t i = 0; i < _layerCount; ++i)
+  {
+    compositor_layer_t *l = &_layers[i];
+    if (l->sprite == sprite)
+    {
+      if (l->shown)
+      {
+        addDirty(l->x, l->y, sprite->width(), sprite->height());
+      }
+      memmove(l, l + 1, (_layerCount - i - 1) * sizeof(compositor_layer_t));
+      --_layerCount;
+      return;
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Recompose an area on the next update(), e.g. after drawing to
+            the background framebuffer
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    w   Width in pixels
+    @param    h   Height in pixels
+*/
+/**************************************************************************/
+void Arduino_Compositor::invalidate(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  addDirty(x, y, w, h);
+}
+
+void Arduino_Compositor::invalidateAll()
+{
+  _rectCount = 0;
+  addDirty(0, 0, _width, _height);
+}
+
+/**************************************************************************/
+/*!
+   @brief   Send the areas that changed since the last update()
+    @return   Number of pixels sent
+*/
+/**************************************************************************/
+uint32_t Arduino_Compositor::update()
+{
+  for (uint8_t i = 0; i < _layerCount; ++i)
+  {
+    compositor_layer_t *l = &_layers[i];
+    Arduino_Sprite *s = l->sprite;
+    bool show = s->isVisible();
+    bool touched = s->_changed || (s->getX() != l->x) || (s->getY() != l->y);
+    if (l->shown && ((!show) || touched))
+    {
+      // restore what the sprite covered
+      addDirty(l->x, l->y, s->width(), s->height());
+    }
+    if (show && ((!l->shown) || touched))
+    {
+      addDirty(s->getX(), s->getY(), s->width(), s->height());
+    }
+    l->x = s->getX();
+    l->y = s->getY();
+    l->shown = show;
+    s->_changed = false;
+  }
+
+  uint32_t pixels = 0;
+  if (_output && _lineBuf)
+  {
+    for (uint8_t i = 0; i < _rectCount; ++i)
+    {
+      pixels += composeRect(&_rects[i]);
+    }
+    _rectCount = 0;
+  }
+  return pixels;
+}
+
+// clip and align, then merge with every rect it overlaps or touches; a full
+// list takes the merge that grows a rect the least
+void Arduino_Compositor::addDirty(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if ((w <= 0) || (h <= 0))
+  {
+    return;
+  }
+  compositor_rect_t r;
+  r.x1 = max(x, (int16_t)0);
+  r.y1 = max(y, (int16_t)0);
+  r.x2 = min((int16_t)(x + w - 1), (int16_t)(_width - 1));
+  r.y2 = min((int16_t)(y + h - 1), (int16_t)(_height - 1));
+  if ((r.x1 > r.x2) || (r.y1 > r.y2))
+  {
+    return;
+  }
+  int16_t m = (_output ? _output->getWindowAlignment() : 1) - 1;
+  if (m > 0)
+  {
+    // round out on the output's grid, in panel coordinates
+    r.x1 = max((int16_t)(r.x1 - ((r.x1 + _output_x) & m)), (int16_t)0);
+    r.y1 = max((int16_t)(r.y1 - ((r.y1 + _output_y) & m)), (int16_t)0);
+    r.x2 = min((int16_t)(r.x2 + m - ((r.x2 + _output_x) & m)), (int16_t)(_width - 1));
+    r.y2 = min((int16_t)(r.y2 + m - ((r.y2 + _output_y) & m)), (int16_t)(_height - 1));
+  }
+
+  int8_t hit;
+  do
+  {
+    hit = -1;
+    for (uint8_t i = 0; i < _rectCount; ++i)
+    {
+      const compositor_rect_t *o = &_rects[i];
+      if ((r.x1 <= o->x2 + 1) && (o->x1 <= r.x2 + 1) && (r.y1 <= o->y2 + 1) && (o->y1 <= r.y2 + 1))
+      {
+        hit = i;
+        break;
+      }
+    }
+    if ((hit < 0) && (_rectCount == COMPOSITOR_MAX_RECTS))
+    {
+      int32_t best = INT32_MAX;
+      for (uint8_t i = 0; i < _rectCount; ++i)
+      {
+        const compositor_rect_t *o = &_rects[i];
+        int32_t grow = (int32_t)(max(r.x2, o->x2) - min(r.x1, o->x1) + 1) * (max(r.y2, o->y2) - min(r.y1, o->y1) + 1) - (int32_t)(o->x2 - o->x1 + 1) * (o->y2 - o->y1 + 1);
+        if (grow < best)
+        {
+          best = grow;
+          hit = i;
+        }
+      }
+    }
+    if (hit >= 0)
+    {
+      const compositor_rect_t *o = &_rects[hit];
+      r.x1 = min(r.x1, o->x1);
+      r.y1 = min(r.y1, o->y1);
+      r.x2 = max(r.x2, o->x2);
+      r.y2 = max(r.y2, o->y2);
+      _rects[hit] = _rects[--_rectCount];
+    }
+  } while (hit >= 0);
+
+  _rects[_rectCount++] = r;
+}
+
+uint32_t Arduino_Compositor::composeRect(const compositor_rect_t *r)
+{
+  int16_t w = r->x2 - r->x1 + 1;
+  int16_t bandRows = ((int32_t)_width * COMPOSITOR_BUF_LINES) / w;
+  int16_t y = r->y1;
+  while (y <= r->y2)
+  {
+    int16_t rows = min(bandRows, (int16_t)(r->y2 - y + 1));
+    uint16_t *dst = _lineBuf;
+    for (int16_t j = 0; j < rows; ++j)
+    {
+      int16_t yy = y + j;
+      if (_background)
+      {
+        memcpy(dst, _background + (int32_t)yy * _width + r->x1, w * 2);
+      }
+      else
+      {
+        for (int16_t i = 0; i < w; ++i)
+        {
+          dst[i] = _backgroundColor;
+        }
+      }
+
+      for (uint8_t i = 0; i < _layerCount; ++i)
+      {
+        const compositor_layer_t *l = &_layers[i];
+        if (!l->shown)
+        {
+          continue;
+        }
+        Arduino_Sprite *s = l->sprite;
+        int16_t sy = yy - l->y;
+        if ((sy < 0) || (sy >= s->height()))
+        {
+          continue;
+        }
+        int16_t x1 = max(r->x1, l->x);
+        int16_t x2 = min(r->x2, (int16_t)(l->x + s->width() - 1));
+        if (x1 > x2)
+        {
+          continue;
+        }
+        int32_t offset = (int32_t)sy * s->width() + (x1 - l->x);
+        gfx_blend_rgb565_a8(dst + (x1 - r->x1), s->getFramebuffer() + offset, s->getAlphaBuffer() + offset, x2 - x1 + 1);
+      }
+      dst += w;
+    }
+    _output->draw16bitRGBBitmap(_output_x + r->x1, _output_y + y, _lineBuf, w, rows);
+    y += rows;
+  }
+  return (uint32_t)w * (r->y2 - r->y1 + 1);
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
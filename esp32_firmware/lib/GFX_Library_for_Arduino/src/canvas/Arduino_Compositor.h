@@ -0,0 +1,72 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_COMPOSITOR_H_
+#define _ARDUINO_COMPOSITOR_H_
+
+#include "../Arduino_G.h"
+#include "Arduino_Sprite.h"
+
+#ifndef COMPOSITOR_MAX_SPRITES
+#define COMPOSITOR_MAX_SPRITES 8
+#endif
+#define COMPOSITOR_MAX_RECTS 16
+#define COMPOSITOR_BUF_LINES 16 // line buffer holds this many full width rows
+
+typedef struct
+{
+  int16_t x1, y1, x2, y2; // inclusive
+} compositor_rect_t;
+
+typedef struct
+{
+  Arduino_Sprite *sprite;
+  int16_t x, y; // where the sprite was last drawn
+  bool shown;
+} compositor_layer_t;
+
+/*!
+  Stacks Arduino_Sprite layers over a background and keeps the output up to
+  date. update() collects the areas sprites left, entered or changed in, and
+  recomposes only those: background, then every sprite in the order they were
+  added, alpha blended, sent a few rows at a time. The background is a
+  framebuffer of the compositor size, e.g. Arduino_Canvas::getFramebuffer(),
+  or a solid color. Call invalidate() after changing the background.
+*/
+class Arduino_Compositor
+{
+public:
+  Arduino_Compositor(Arduino_G *output, int16_t w, int16_t h, int16_t output_x = 0, int16_t output_y = 0);
+  ~Arduino_Compositor();
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED);
+  void setBackground(const uint16_t *framebuffer);
+  void setBackgroundColor(uint16_t color);
+  bool addSprite(Arduino_Sprite *sprite);
+  void removeSprite(Arduino_Sprite *sprite);
+  void invalidate(int16_t x, int16_t y, int16_t w, int16_t h);
+  void invalidateAll();
+  uint32_t update();
+
+protected:
+  void addDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+  uint32_t composeRect(const compositor_rect_t *r);
+
+  Arduino_G *_output;
+  int16_t _width, _height;
+  int16_t _output_x, _output_y;
+  const uint16_t *_background = nullptr;
+  uint16_t _backgroundColor = 0;
+  uint16_t *_lineBuf = nullptr;
+
+  compositor_layer_t _layers[COMPOSITOR_MAX_SPRITES];
+  uint8_t _layerCount = 0;
+  compositor_rect_t _rects[COMPOSITOR_MAX_RECTS];
+  uint8_t _rectCount = 0;
+
+private:
+};
+
+#endif // _ARDUINO_COMPOSITOR_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
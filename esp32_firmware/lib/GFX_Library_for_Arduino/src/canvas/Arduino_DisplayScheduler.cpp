@@ -0,0 +1,354 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "Arduino_DisplayScheduler.h"
+
+Arduino_DisplayScheduler::Arduino_DisplayScheduler()
+{
+}
+
+/**************************************************************************/
+/*!
+   @brief   Refresh a canvas on its display, the scheduler sends the
+            framebuffer after every render()
+    @param    canvas     Canvas render() draws on, begin() already called
+    @param    output     The canvas output
+    @param    bus        The output's bus
+    @param    render     Draws the next frame
+    @param    arg        Passed to render()
+    @param    fps        Frame rate target, 0 for frames on requestFrame() only
+    @param    priority   Higher goes first
+    @return   id of the display, -1 if the scheduler is full
+*/
+/**************************************************************************/
+int8_t Arduino_DisplayScheduler::add(Arduino_Canvas *canvas, Arduino_TFT *output, Arduino_DataBus *bus, scheduler_render_cb render, void *arg, uint16_t fps, uint8_t priority)
+{
+  int8_t id = add(static_cast<Arduino_GFX *>(canvas), bus, render, arg, fps, priority);
+  if (id >= 0)
+  {
+    _displays[id].canvas = canvas;
+    _displays[id].output = output;
+  }
+  return id;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Refresh a display render() draws on directly, the frame is done
+            when render() returns
+    @param    gfx        Display or a canvas render() flushes itself
+    @param    bus        Bus render() writes to
+    @param    render     Draws the next frame
+    @param    arg        Passed to render()
+    @param    fps        Frame rate target, 0 for frames on requestFrame() only
+    @param    priority   Higher goes first
+    @return   id of the display, -1 if the scheduler is full
+*/
+/**************************************************************************/
+int8_t Arduino_DisplayScheduler::add(Arduino_GFX *gfx, Arduino_DataBus *bus, scheduler_render_cb render, void *arg, uint16_t fps, uint8_t priority)
+{
+  if ((_count >= SCHEDULER_MAX_DISPLAYS) || (!gfx) || (!bus) || (!render))
+  {
+    return -1;
+  }
+
+  int8_t id = _count;
+  scheduler_display_t *d = &_displays[id];
+  memset(d, 0, sizeof(scheduler_display_t));
+  d->gfx = gfx;
+  d->bus = bus;
+  d->render = render;
+  d->arg = arg;
+  d->priority = priority;
+  d->group = id;
+  for (uint8_t i = 0; i < _count; ++i)
+  {
+    if (_displays[i].bus == bus)
+    {
+      d->group = _displays[i].group;
+      break;
+    }
+  }
+  ++_count;
+  setFrameRate(id, fps);
+  sortByPriority();
+  return id;
+}
+
+void Arduino_DisplayScheduler::setFrameRate(int8_t id, uint16_t fps)
+{
+  if ((id < 0) || (id >= _count))
+  {
+    return;
+  }
+  _displays[id].periodUs = fps ? (1000000UL / fps) : 0;
+  _displays[id].due = now();
+}
+
+void Arduino_DisplayScheduler::setPriority(int8_t id, uint8_t priority)
+{
+  if ((id < 0) || (id >= _count))
+  {
+    return;
+  }
+  _displays[id].priority = priority;
+  sortByPriority();
+}
+
+/**************************************************************************/
+/*!
+   @brief   Put displays that cannot send at the same time, e.g. on one SPI
+            host with separate CS pins, in the same group
+    @param    id      Display
+    @param    group   Any number, displays added with the same bus start in
+                      the same group
+*/
+/**************************************************************************/
+void Arduino_DisplayScheduler::setBusGroup(int8_t id, uint8_t group)
+{
+  if ((id < 0) || (id >= _count))
+  {
+    return;
+  }
+  _displays[id].group = group;
+}
+
+void Arduino_DisplayScheduler::requestFrame(int8_t id)
+{
+  if ((id < 0) || (id >= _count))
+  {
+    return;
+  }
+  _displays[id].requested = true;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Feed the buses and render at most one frame, call as often as
+            possible
+    @return   true if anything was done, false if every display is idle or
+              waiting for its bus
+*/
+/**************************************************************************/
+bool Arduino_DisplayScheduler::run()
+{
+  bool worked = false;
+  uint32_t t = now();
+
+  for (uint8_t i = 0; i < _count; ++i)
+  {
+    scheduler_display_t *d = &_displays[_order[i]];
+    if (d->sending)
+    {
+      worked |= sendBand(d, t);
+    }
+  }
+
+  for (uint8_t i = 0; i < _count; ++i)
+  {
+    scheduler_display_t *d = &_displays[_order[i]];
+    if ((!d->sending) && due(d, t) && (!groupSending(d->group)) && (!yieldsTo(i, t)))
+    {
+      startFrame(d, t);
+      return true;
+    }
+  }
+
+  return worked;
+}
+
+// true while any canvas frame is on the wire
+bool Arduino_DisplayScheduler::sending()
+{
+  for (uint8_t i = 0; i < _count; ++i)
+  {
+    if (_displays[i].sending)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// wait for every frame on the wire to finish, no new frame is started
+void Arduino_DisplayScheduler::finish()
+{
+  while (sending())
+  {
+    uint32_t t = now();
+    for (uint8_t i = 0; i < _count; ++i)
+    {
+      if (_displays[i].sending)
+      {
+        sendBand(&_displays[i], t);
+      }
+    }
+  }
+}
+
+const scheduler_stats_t *Arduino_DisplayScheduler::stats(int8_t id)
+{
+  if ((id < 0) || (id >= _count))
+  {
+    return nullptr;
+  }
+  return &_displays[id].stats;
+}
+
+void Arduino_DisplayScheduler::resetStats(int8_t id)
+{
+  if ((id < 0) || (id >= _count))
+  {
+    return;
+  }
+  memset(&_displays[id].stats, 0, sizeof(scheduler_stats_t));
+}
+
+uint32_t Arduino_DisplayScheduler::now()
+{
+  return micros();
+}
+
+void Arduino_DisplayScheduler::sortByPriority()
+{
+  // insertion sort, stable so equal priorities keep the order they were added in
+  for (uint8_t i = 0; i < _count; ++i)
+  {
+    _order[i] = i;
+  }
+  for (uint8_t i = 1; i < _count; ++i)
+  {
+    uint8_t idx = _order[i];
+    int8_t j = i - 1;
+    while ((j >= 0) && (_displays[_order[j]].priority < _displays[idx].priority))
+    {
+      _order[j + 1] = _order[j];
+      --j;
+    }
+    _order[j + 1] = idx;
+  }
+}
+
+bool Arduino_DisplayScheduler::due(const scheduler_display_t *d, uint32_t t)
+{
+  return d->requested || (d->periodUs && ((int32_t)(t - d->due) >= 0));
+}
+
+bool Arduino_DisplayScheduler::groupSending(uint8_t group)
+{
+  for (uint8_t i = 0; i < _count; ++i)
+  {
+    if (_displays[i].sending && (_displays[i].group == group))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// a higher priority display is on the wire or comes due before the render
+// of _order[idx] would be done
+bool Arduino_DisplayScheduler::yieldsTo(uint8_t idx, uint32_t t)
+{
+  const scheduler_display_t *d = &_displays[_order[idx]];
+  for (uint8_t i = 0; i < idx; ++i)
+  {
+    const scheduler_display_t *h = &_displays[_order[i]];
+    if (h->priority <= d->priority)
+    {
+      break;
+    }
+    if (h->sending)
+    {
+      return true;
+    }
+    if (h->periodUs && ((int32_t)(h->due - t) < (int32_t)d->stats.renderUs))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Arduino_DisplayScheduler::startFrame(scheduler_display_t *d, uint32_t t)
+{
+  if (d->periodUs && ((int32_t)(t - d->due) >= 0))
+  {
+    // stay in phase, periods that already passed are dropped
+    uint32_t missed = (t - d->due) / d->periodUs;
+    d->stats.dropped += missed;
+    d->due += d->periodUs * (missed + 1);
+  }
+  d->requested = false;
+  if (d->stats.frames)
+  {
+    d->stats.intervalUs = t - d->frameStart;
+  }
+  d->frameStart = t;
+
+  d->render(d->gfx, d->arg);
+  uint32_t rendered = now();
+  d->stats.renderUs = rendered - t;
+
+  Arduino_Canvas *c = d->canvas;
+  if (!c)
+  {
+    endFrame(d, rendered - t);
+    return;
+  }
+  if (
+      (c->_output_x < 0) || (c->_output_y < 0) ||
+      ((c->_output_x + c->WIDTH) > d->output->width()) ||
+      ((c->_output_y + c->HEIGHT) > d->output->height()))
+  {
+    // needs clipping, leave it to the canvas
+    c->flush();
+    uint32_t flushed = now();
+    endFrame(d, flushed - t);
+    return;
+  }
+
+  d->output->startWrite();
+  d->output->writeAddrWindow(c->_output_x, c->_output_y, c->WIDTH, c->HEIGHT);
+  d->sent = 0;
+  d->sending = true;
+  sendBand(d, rendered);
+}
+
+// next band of a canvas frame once the bus is done with the last one
+bool Arduino_DisplayScheduler::sendBand(scheduler_display_t *d, uint32_t t)
+{
+  if (!d->bus->fenceReached(d->fence))
+  {
+    return false;
+  }
+
+  Arduino_Canvas *c = d->canvas;
+  uint32_t total = (uint32_t)c->WIDTH * c->HEIGHT;
+  if (d->sent < total)
+  {
+    uint32_t len = min((uint32_t)SCHEDULER_BAND_PIXELS, total - d->sent);
+    d->fence = d->bus->submitPixels(c->_framebuffer + d->sent, len);
+    d->sent += len;
+  }
+  else
+  {
+    d->output->endWrite();
+    d->sending = false;
+    endFrame(d, t - d->frameStart);
+  }
+  return true;
+}
+
+void Arduino_DisplayScheduler::endFrame(scheduler_display_t *d, uint32_t frameUs)
+{
+  d->stats.frameUs = frameUs;
+  d->stats.avgFrameUs = d->stats.frames ? (d->stats.avgFrameUs - (d->stats.avgFrameUs >> 3) + (frameUs >> 3)) : frameUs;
+  if (frameUs > d->stats.maxFrameUs)
+  {
+    d->stats.maxFrameUs = frameUs;
+  }
+  ++d->stats.frames;
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
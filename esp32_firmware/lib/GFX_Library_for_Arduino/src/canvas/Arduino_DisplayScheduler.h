@@ -0,0 +1,111 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_DISPLAYSCHEDULER_H_
+#define _ARDUINO_DISPLAYSCHEDULER_H_
+
+#include "../Arduino_TFT.h"
+#include "Arduino_Canvas.h"
+
+#ifndef SCHEDULER_MAX_DISPLAYS
+#define SCHEDULER_MAX_DISPLAYS 4
+#endif
+// pixels handed to a bus per step, one Arduino_ESP32SPI DMA staging buffer
+#ifndef SCHEDULER_BAND_PIXELS
+#define SCHEDULER_BAND_PIXELS 2046
+#endif
+
+// draws the next frame of a display on gfx
+typedef void (*scheduler_render_cb)(Arduino_GFX *gfx, void *arg);
+
+typedef struct
+{
+  uint32_t frames;     // frames completed
+  uint32_t dropped;    // frame periods skipped because a frame started too late
+  uint32_t renderUs;   // render callback of the last frame
+  uint32_t frameUs;    // last frame, render start to the last pixel on the wire
+  uint32_t avgFrameUs; // running average of frameUs
+  uint32_t maxFrameUs;
+  uint32_t intervalUs; // between the last two frame starts, 1000000 / intervalUs is the frame rate
+} scheduler_stats_t;
+
+typedef struct
+{
+  Arduino_GFX *gfx;        // what render() draws on
+  Arduino_Canvas *canvas;  // NULL when render() draws straight to the display
+  Arduino_TFT *output;     // the display of the canvas
+  Arduino_DataBus *bus;
+  scheduler_render_cb render;
+  void *arg;
+  uint32_t periodUs; // 0: only frames asked for by requestFrame()
+  uint32_t due;      // start of the next periodic frame
+  uint32_t frameStart;
+  uint32_t fence; // of the last band submitted
+  uint32_t sent;  // pixels of the current frame submitted
+  uint8_t priority;
+  uint8_t group;
+  bool sending;
+  bool requested;
+  scheduler_stats_t stats;
+} scheduler_display_t;
+
+/*!
+  Refreshes several displays on their own buses from one loop. Each display
+  has a frame rate, a priority and a render callback. run() does a little
+  work and returns:
+    - every canvas frame on the wire gets its next band of
+      SCHEDULER_BAND_PIXELS as soon as its bus reached the fence of the last
+      one, so transfers on different buses overlap each other and rendering
+      (Arduino_DataBus::submitPixels());
+    - then the highest priority display that is due and idle renders its
+      next frame.
+  A display does not start rendering while a display of higher priority is
+  on the wire or comes due within its last render time, so a slow status
+  panel never holds back the primary display.
+
+  A canvas display sends its framebuffer as one address window, the canvas
+  must not be drawn on until the frame is done, render() is only called
+  then. Displays added with the same bus share a bus group and never send
+  at the same time; give displays on one SPI host with separate CS pins the
+  same group with setBusGroup().
+*/
+class Arduino_DisplayScheduler
+{
+public:
+  Arduino_DisplayScheduler();
+  virtual ~Arduino_DisplayScheduler() {}
+
+  int8_t add(Arduino_Canvas *canvas, Arduino_TFT *output, Arduino_DataBus *bus, scheduler_render_cb render, void *arg = nullptr, uint16_t fps = 30, uint8_t priority = 0);
+  int8_t add(Arduino_GFX *gfx, Arduino_DataBus *bus, scheduler_render_cb render, void *arg = nullptr, uint16_t fps = 30, uint8_t priority = 0);
+  void setFrameRate(int8_t id, uint16_t fps);
+  void setPriority(int8_t id, uint8_t priority);
+  void setBusGroup(int8_t id, uint8_t group);
+  void requestFrame(int8_t id);
+
+  bool run();
+  bool sending();
+  void finish();
+
+  const scheduler_stats_t *stats(int8_t id);
+  void resetStats(int8_t id);
+
+protected:
+  virtual uint32_t now();
+  void sortByPriority();
+  bool due(const scheduler_display_t *d, uint32_t t);
+  bool groupSending(uint8_t group);
+  bool yieldsTo(uint8_t idx, uint32_t t);
+  void startFrame(scheduler_display_t *d, uint32_t t);
+  bool sendBand(scheduler_display_t *d, uint32_t t);
+  void endFrame(scheduler_display_t *d, uint32_t frameUs);
+
+  scheduler_display_t _displays[SCHEDULER_MAX_DISPLAYS];
+  uint8_t _order[SCHEDULER_MAX_DISPLAYS]; // indexes into _displays, highest priority first
+  uint8_t _count = 0;
+
+private:
+};
+
+#endif // _ARDUINO_DISPLAYSCHEDULER_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -0,0 +1,182 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "../Arduino_GFX.h"
+#include "Arduino_Sprite.h"
+
+Arduino_Sprite::Arduino_Sprite(int16_t w, int16_t h)
+    : Arduino_GFX(w, h)
+{
+}
+
+Arduino_Sprite::~Arduino_Sprite()
+{
+  if (_framebuffer)
+  {
+    free(_framebuffer);
+  }
+  if (_alpha)
+  {
+    free(_alpha);
+  }
+}
+
+bool Arduino_Sprite::begin(int32_t speed)
+{
+  UNUSED(speed);
+
+  if (!_framebuffer)
+  {
+    size_t s = (size_t)WIDTH * HEIGHT;
+#if defined(ESP32)
+    if (psramFound())
+    {
+      _framebuffer = (uint16_t *)ps_malloc(s * 2);
+      _alpha = (uint8_t *)ps_malloc(s);
+    }
+    else
+    {
+      _framebuffer = (uint16_t *)malloc(s * 2);
+      _alpha = (uint8_t *)malloc(s);
+    }
+#else
+    _framebuffer = (uint16_t *)malloc(s * 2);
+    _alpha = (uint8_t *)malloc(s);
+#endif
+    if ((!_framebuffer) || (!_alpha))
+    {
+      return false;
+    }
+    memset(_framebuffer, 0, s * 2);
+    clear();
+  }
+
+  return true;
+}
+
+void Arduino_Sprite::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
+{
+  int32_t i = (int32_t)y * WIDTH + x;
+  _framebuffer[i] = color;
+  _alpha[i] = _drawAlpha;
+  _changed = true;
+}
+
+void Arduino_Sprite::writeFastVLine(int16_t x, int16_t y,
+                                    int16_t h, uint16_t color)
+{
+  writeFillRect(x, y, 1, h, color);
+}
+
+void Arduino_Sprite::writeFastHLine(int16_t x, int16_t y,
+                                    int16_t w, uint16_t color)
+{
+  writeFillRect(x, y, w, 1, color);
+}
+
+void Arduino_Sprite::writeFillRectPreclipped(int16_t x, int16_t y,
+                                             int16_t w, int16_t h, uint16_t color)
+{
+  uint16_t *row = _framebuffer + (int32_t)y * WIDTH + x;
+  uint8_t *alphaRow = _alpha + (int32_t)y * WIDTH + x;
+  while (h--)
+  {
+    for (int16_t i = 0; i < w; ++i)
+    {
+      row[i] = color;
+    }
+    memset(alphaRow, _drawAlpha, w);
+    row += WIDTH;
+    alphaRow += WIDTH;
+  }
+  _changed = true;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Make every pixel of the sprite transparent
+*/
+/**************************************************************************/
+void Arduino_Sprite::clear()
+{
+  if (_alpha)
+  {
+    memset(_alpha, 0, (size_t)WIDTH * HEIGHT);
+    _changed = true;
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Set the alpha the following primitives write, 0 is transparent
+            and 255 opaque
+    @param    alpha   Alpha of the following primitives
+*/
+/**************************************************************************/
+void Arduino_Sprite::setDrawAlpha(uint8_t alpha)
+{
+  _drawAlpha = alpha;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Place the sprite on the compositor, the area it leaves is
+            restored on the next Arduino_Compositor::update()
+    @param    x   Top left corner x coordinate on the compositor
+    @param    y   Top left corner y coordinate on the compositor
+*/
+/**************************************************************************/
+void Arduino_Sprite::moveTo(int16_t x, int16_t y)
+{
+  _x = x;
+  _y = y;
+}
+
+void Arduino_Sprite::setVisible(bool visible)
+{
+  _visible = visible;
+}
+
+bool Arduino_Sprite::isVisible()
+{
+  return _visible;
+}
+
+int16_t Arduino_Sprite::getX()
+{
+  return _x;
+}
+
+int16_t Arduino_Sprite::getY()
+{
+  return _y;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Have the compositor redraw the sprite on the next update()
+*/
+/**************************************************************************/
+void Arduino_Sprite::markChanged()
+{
+  _changed = true;
+}
+
+uint16_t *Arduino_Sprite::getFramebuffer()
+{
+  return _framebuffer;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Alpha plane, one byte per pixel in the framebuffer layout. Code
+            that writes to it or to getFramebuffer() directly calls
+            markChanged() afterwards.
+*/
+/**************************************************************************/
+uint8_t *Arduino_Sprite::getAlphaBuffer()
+{
+  return _alpha;
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
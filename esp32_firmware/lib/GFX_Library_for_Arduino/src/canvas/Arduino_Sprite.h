@@ -0,0 +1,56 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_SPRITE_H_
+#define _ARDUINO_SPRITE_H_
+
+#include "../Arduino_GFX.h"
+
+class Arduino_Compositor;
+
+/*!
+  Off-screen RGB565 image with an 8-bit alpha plane, drawn into with the usual
+  Arduino_GFX primitives. Every primitive writes the current draw alpha
+  (setDrawAlpha(), opaque by default) next to the color, clear() makes the
+  whole sprite transparent. The sprite is shown by an Arduino_Compositor at
+  the position set by moveTo(). Rotation is not supported.
+*/
+class Arduino_Sprite : public Arduino_GFX
+{
+  friend class Arduino_Compositor;
+
+public:
+  Arduino_Sprite(int16_t w, int16_t h);
+  ~Arduino_Sprite();
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+  void clear();
+  void setDrawAlpha(uint8_t alpha);
+  void moveTo(int16_t x, int16_t y);
+  void setVisible(bool visible);
+  bool isVisible();
+  int16_t getX();
+  int16_t getY();
+  void markChanged();
+  uint16_t *getFramebuffer();
+  uint8_t *getAlphaBuffer();
+
+protected:
+  uint16_t *_framebuffer = nullptr;
+  uint8_t *_alpha = nullptr;
+  uint8_t _drawAlpha = 0xFF;
+  int16_t _x = 0, _y = 0;
+  bool _visible = true;
+  bool _changed = true; // content changed since the compositor last drew it
+
+private:
+};
+
+#endif // _ARDUINO_SPRITE_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -488,26 +488,11 @@ void Arduino_ESP32LCD16::writeYCbCrPixels(uint8_t *yData, uint8_t *cbData, uint8
     bool poll_started = false;
     for (int row = 0; row < rows; ++row)
     {
-      for (int col = 0; col < cols; ++col)
-      {
-        uint8_t cb = *cbData++;
-        uint8_t cr = *crData++;
-        int16_t r = CR2R16[cr];
-        int16_t g = -CB2G16[cb] - CR2G16[cr];
-        int16_t b = CB2B16[cb];
-        int16_t y;
-
-        y = Y2I16[*yData++];
-        *dest++ = CLIPR[y + r] | CLIPG[y + g] | CLIPB[y + b];
-        y = Y2I16[*yData++];
-        *dest++ = CLIPR[y + r] | CLIPG[y + g] | CLIPB[y + b];
-        y = Y2I16[*yData2++];
-        *dest2++ = CLIPR[y + r] | CLIPG[y + g] | CLIPB[y + b];
-        y = Y2I16[*yData2++];
-        *dest2++ = CLIPR[y + r] | CLIPG[y + g] | CLIPB[y + b];
-      }
-      yData += w;
-      yData2 += w;
+      gfx_ycbcr420_to_rgb565(dest, dest2, yData, yData2, cbData, crData, w);
+      yData += w << 1;
+      yData2 += w << 1;
+      cbData += cols;
+      crData += cols;
 
       if (poll_started)
       {
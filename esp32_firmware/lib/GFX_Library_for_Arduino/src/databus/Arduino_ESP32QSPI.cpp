@@ -76,9 +76,9 @@ bool Arduino_ESP32QSPI::begin(int32_t speed, int8_t dataMode)
       .input_delay_ns = 0,
       .spics_io_num = -1, // avoid use system CS control
       .flags = SPI_DEVICE_HALFDUPLEX,
-      .queue_size = 1,
-      .pre_cb = nullptr,
-      .post_cb = nullptr};
+      .queue_size = ESP32QSPI_QUEUE_SIZE,
+      .pre_cb = queuePreCb,
+      .post_cb = queuePostCb};
   ret = spi_bus_add_device(ESP32QSPI_SPI_HOST, &devcfg, &_handle);
   if (ret != ESP_OK)
   {
@@ -93,6 +93,7 @@ bool Arduino_ESP32QSPI::begin(int32_t speed, int8_t dataMode)
 
   memset(&_spi_tran_ext, 0, sizeof(_spi_tran_ext));
   _spi_tran = (spi_transaction_t *)&_spi_tran_ext;
+  memset(_queue, 0, sizeof(_queue));
 
   _buffer = (uint8_t *)heap_caps_aligned_alloc(16, ESP32QSPI_MAX_PIXELS_AT_ONCE * 2, MALLOC_CAP_DMA);
   if (!_buffer)
@@ -126,9 +127,11 @@ void Arduino_ESP32QSPI::beginWrite()
  */
 void Arduino_ESP32QSPI::endWrite()
 {
+  // a dedicated bus leaves the last queued transfer running
   if (_is_shared_interface)
   {
-    spi_device_acquire_bus(_handle, portMAX_DELAY);
+    flushQueue();
+    spi_device_release_bus(_handle);
   }
 }
 
@@ -138,6 +141,24 @@ void Arduino_ESP32QSPI::endWrite()
  * @param c
  */
 void Arduino_ESP32QSPI::writeCommand(uint8_t c)
+{
+  if (c == 0x2C) // RAMWR
+  {
+    // sent with the first pixels as 0x32 0x002C00, saves a transaction; the
+    // queued CASET / RASET stay in flight and chain with the pixel data
+    _ramwrPending = true;
+    return;
+  }
+  flushQueue();
+  sendCommand(c);
+}
+
+/**
+ * @brief sendCommand
+ *
+ * @param c
+ */
+void Arduino_ESP32QSPI::sendCommand(uint8_t c)
 {
   CS_LOW();
   _spi_tran_ext.base.flags = SPI_TRANS_MULTILINE_CMD | SPI_TRANS_MULTILINE_ADDR;
@@ -157,6 +178,7 @@ void Arduino_ESP32QSPI::writeCommand(uint8_t c)
  */
 void Arduino_ESP32QSPI::writeCommand16(uint16_t c)
 {
+  flushQueue();
   CS_LOW();
   _spi_tran_ext.base.flags = SPI_TRANS_MULTILINE_CMD | SPI_TRANS_MULTILINE_ADDR;
   _spi_tran_ext.base.cmd = 0x02;
@@ -170,6 +192,7 @@ void Arduino_ESP32QSPI::writeCommand16(uint16_t c)
 
 void Arduino_ESP32QSPI::writeCommandBytes(uint8_t *data, uint32_t len)
 {
+  flushQueue();
   CS_LOW();
   uint32_t l;
   while (len)
@@ -196,6 +219,7 @@ void Arduino_ESP32QSPI::writeCommandBytes(uint8_t *data, uint32_t len)
  */
 void Arduino_ESP32QSPI::write(uint8_t d)
 {
+  flushQueue();
   CS_LOW();
   _spi_tran_ext.base.flags = SPI_TRANS_USE_TXDATA | SPI_TRANS_MODE_QIO;
   _spi_tran_ext.base.cmd = 0x32;
@@ -214,6 +238,7 @@ void Arduino_ESP32QSPI::write(uint8_t d)
  */
 void Arduino_ESP32QSPI::write16(uint16_t d)
 {
+  flushQueue();
   CS_LOW();
   _spi_tran_ext.base.flags = SPI_TRANS_USE_TXDATA | SPI_TRANS_MODE_QIO;
   _spi_tran_ext.base.cmd = 0x32;
@@ -234,6 +259,7 @@ void Arduino_ESP32QSPI::write16(uint16_t d)
  */
 void Arduino_ESP32QSPI::writeC8D8(uint8_t c, uint8_t d)
 {
+  flushQueue();
   CS_LOW();
   _spi_tran_ext.base.flags = SPI_TRANS_USE_TXDATA | SPI_TRANS_MULTILINE_CMD | SPI_TRANS_MULTILINE_ADDR;
   _spi_tran_ext.base.cmd = 0x02;
@@ -254,6 +280,7 @@ void Arduino_ESP32QSPI::writeC8D8(uint8_t c, uint8_t d)
  */
 void Arduino_ESP32QSPI::writeC8D16(uint8_t c, uint16_t d)
 {
+  flushQueue();
   CS_LOW();
   _spi_tran_ext.base.flags = SPI_TRANS_USE_TXDATA | SPI_TRANS_MULTILINE_CMD | SPI_TRANS_MULTILINE_ADDR;
   _spi_tran_ext.base.cmd = 0x02;
@@ -275,18 +302,21 @@ void Arduino_ESP32QSPI::writeC8D16(uint8_t c, uint16_t d)
  */
 void Arduino_ESP32QSPI::writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2)
 {
-  CS_LOW();
-  _spi_tran_ext.base.flags = SPI_TRANS_USE_TXDATA | SPI_TRANS_MULTILINE_CMD | SPI_TRANS_MULTILINE_ADDR;
-  _spi_tran_ext.base.cmd = 0x02;
-  _spi_tran_ext.base.addr = ((uint32_t)c) << 8;
-  _spi_tran_ext.base.tx_data[0] = d1 >> 8;
-  _spi_tran_ext.base.tx_data[1] = d1;
-  _spi_tran_ext.base.tx_data[2] = d2 >> 8;
-  _spi_tran_ext.base.tx_data[3] = d2;
-  _spi_tran_ext.base.length = 32;
-  POLL_START();
-  POLL_END();
-  CS_HIGH();
+  if (_ramwrPending)
+  {
+    flushQueue();
+  }
+  // CASET / RASET go in the queue ahead of the pixels
+  esp32qspi_trans_t *t = queueSlot(ESP32QSPI_CS_START | ESP32QSPI_CS_END);
+  t->ext.base.flags = SPI_TRANS_USE_TXDATA | SPI_TRANS_MULTILINE_CMD | SPI_TRANS_MULTILINE_ADDR;
+  t->ext.base.cmd = 0x02;
+  t->ext.base.addr = ((uint32_t)c) << 8;
+  t->ext.base.tx_data[0] = d1 >> 8;
+  t->ext.base.tx_data[1] = d1;
+  t->ext.base.tx_data[2] = d2 >> 8;
+  t->ext.base.tx_data[3] = d2;
+  t->ext.base.length = 32;
+  queueTrans(t);
 }
 
 /**
@@ -298,18 +328,21 @@ void Arduino_ESP32QSPI::writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2)
  */
 void Arduino_ESP32QSPI::writeC8D16D16Split(uint8_t c, uint16_t d1, uint16_t d2)
 {
-  CS_LOW();
-  _spi_tran_ext.base.flags = SPI_TRANS_USE_TXDATA | SPI_TRANS_MULTILINE_CMD | SPI_TRANS_MULTILINE_ADDR;
-  _spi_tran_ext.base.cmd = 0x02;
-  _spi_tran_ext.base.addr = ((uint32_t)c) << 8;
-  _spi_tran_ext.base.tx_data[0] = d1 >> 8;
-  _spi_tran_ext.base.tx_data[1] = d1;
-  _spi_tran_ext.base.tx_data[2] = d2 >> 8;
-  _spi_tran_ext.base.tx_data[3] = d2;
-  _spi_tran_ext.base.length = 32;
-  POLL_START();
-  POLL_END();
-  CS_HIGH();
+  if (_ramwrPending)
+  {
+    flushQueue();
+  }
+  // CASET / RASET go in the queue ahead of the pixels
+  esp32qspi_trans_t *t = queueSlot(ESP32QSPI_CS_START | ESP32QSPI_CS_END);
+  t->ext.base.flags = SPI_TRANS_USE_TXDATA | SPI_TRANS_MULTILINE_CMD | SPI_TRANS_MULTILINE_ADDR;
+  t->ext.base.cmd = 0x02;
+  t->ext.base.addr = ((uint32_t)c) << 8;
+  t->ext.base.tx_data[0] = d1 >> 8;
+  t->ext.base.tx_data[1] = d1;
+  t->ext.base.tx_data[2] = d2 >> 8;
+  t->ext.base.tx_data[3] = d2;
+  t->ext.base.length = 32;
+  queueTrans(t);
 }
 
 /**
@@ -321,6 +354,7 @@ void Arduino_ESP32QSPI::writeC8D16D16Split(uint8_t c, uint16_t d1, uint16_t d2)
  */
 void Arduino_ESP32QSPI::writeC8Bytes(uint8_t c, uint8_t *data, uint32_t len)
 {
+  flushQueue();
   CS_LOW();
   _spi_tran_ext.base.flags = SPI_TRANS_MULTILINE_CMD | SPI_TRANS_MULTILINE_ADDR;
   _spi_tran_ext.base.cmd = 0x02;
@@ -340,46 +374,31 @@ void Arduino_ESP32QSPI::writeC8Bytes(uint8_t c, uint8_t *data, uint32_t len)
  */
 void Arduino_ESP32QSPI::writeRepeat(uint16_t p, uint32_t len)
 {
-  bool first_send = true;
-
   uint16_t bufLen = (len >= ESP32QSPI_MAX_PIXELS_AT_ONCE) ? ESP32QSPI_MAX_PIXELS_AT_ONCE : len;
-  int16_t xferLen, l;
+  uint32_t xferLen, l;
   uint32_t c32;
   MSB_32_16_16_SET(c32, p, p);
 
+  uint8_t b = _nextBuffer;
+  _nextBuffer ^= 1;
+  waitBuffer(b);
+  uint32_t *buf32 = b ? _2nd_buffer32 : _buffer32;
   l = (bufLen + 1) / 2;
   for (uint32_t i = 0; i < l; i++)
   {
-    _buffer32[i] = c32;
+    buf32[i] = c32;
   }
 
-  CS_LOW();
   // Issue pixels in blocks from temp buffer
+  bool first_send = true;
   while (len) // While pixels remain
   {
     xferLen = (bufLen <= len) ? bufLen : len; // How many this pass?
-
-    if (first_send)
-    {
-      _spi_tran_ext.base.flags = SPI_TRANS_MODE_QIO;
-      _spi_tran_ext.base.cmd = 0x32;
-      _spi_tran_ext.base.addr = 0x003C00;
-      first_send = false;
-    }
-    else
-    {
-      _spi_tran_ext.base.flags = SPI_TRANS_MODE_QIO | SPI_TRANS_VARIABLE_CMD |
-                                 SPI_TRANS_VARIABLE_ADDR | SPI_TRANS_VARIABLE_DUMMY;
-    }
-    _spi_tran_ext.base.tx_buffer = _buffer16;
-    _spi_tran_ext.base.length = xferLen << 4;
-
-    POLL_START();
-    POLL_END();
-
     len -= xferLen;
+    queuePixelChunk((uint16_t *)buf32, xferLen, first_send, !len);
+    first_send = false;
   }
-  CS_HIGH();
+  _bufferFence[b] = _fence;
 }
 
 /**
@@ -390,8 +409,6 @@ void Arduino_ESP32QSPI::writeRepeat(uint16_t p, uint32_t len)
  */
 void Arduino_ESP32QSPI::writePixels(uint16_t *data, uint32_t len)
 {
-
-  CS_LOW();
   uint32_t l, l2;
   uint16_t p1, p2;
   bool first_send = true;
@@ -399,40 +416,62 @@ void Arduino_ESP32QSPI::writePixels(uint16_t *data, uint32_t len)
   {
     l = (len > ESP32QSPI_MAX_PIXELS_AT_ONCE) ? ESP32QSPI_MAX_PIXELS_AT_ONCE : len;
 
-    if (first_send)
-    {
-      _spi_tran_ext.base.flags = SPI_TRANS_MODE_QIO;
-      _spi_tran_ext.base.cmd = 0x32;
-      _spi_tran_ext.base.addr = 0x003C00;
-      first_send = false;
-    }
-    else
-    {
-      _spi_tran_ext.base.flags = SPI_TRANS_MODE_QIO | SPI_TRANS_VARIABLE_CMD |
-                                 SPI_TRANS_VARIABLE_ADDR | SPI_TRANS_VARIABLE_DUMMY;
-    }
+    // fill one buffer while the other one is on the wire
+    uint8_t b = _nextBuffer;
+    _nextBuffer ^= 1;
+    waitBuffer(b);
+    uint32_t *buf32 = b ? _2nd_buffer32 : _buffer32;
+    uint16_t *buf16 = (uint16_t *)buf32;
+
     l2 = l >> 1;
     for (uint32_t i = 0; i < l2; ++i)
     {
       p1 = *data++;
       p2 = *data++;
-      MSB_32_16_16_SET(_buffer32[i], p1, p2);
+      MSB_32_16_16_SET(buf32[i], p1, p2);
     }
     if (l & 1)
     {
       p1 = *data++;
-      MSB_16_SET(_buffer16[l - 1], p1);
+      MSB_16_SET(buf16[l - 1], p1);
     }
 
-    _spi_tran_ext.base.tx_buffer = _buffer32;
-    _spi_tran_ext.base.length = l << 4;
+    len -= l;
+    queuePixelChunk(buf16, l, first_send, !len);
+    _bufferFence[b] = _fence;
+    first_send = false;
+  }
+}
 
-    POLL_START();
-    POLL_END();
+/**
+ * @brief submitPixels
+ *
+ * Converts into the free DMA buffer and queues it, the last chunk is left on
+ * the wire when this returns.
+ *
+ * @param data
+ * @param len
+ * @return fence of the last queued transaction
+ */
+uint32_t Arduino_ESP32QSPI::submitPixels(uint16_t *data, uint32_t len)
+{
+  writePixels(data, len);
+  return _fence;
+}
 
-    len -= l;
+/**
+ * @brief fenceReached
+ *
+ * @param fence
+ * @return true
+ * @return false
+ */
+bool Arduino_ESP32QSPI::fenceReached(uint32_t fence)
+{
+  while (((int32_t)(_done - fence) < 0) && reapQueue(0))
+  {
   }
-  CS_HIGH();
+  return (int32_t)(_done - fence) >= 0;
 }
 
 void Arduino_ESP32QSPI::batchOperation(const uint8_t *operations, size_t len)
@@ -463,6 +502,7 @@ void Arduino_ESP32QSPI::batchOperation(const uint8_t *operations, size_t len)
       break;
     case WRITE_BYTES:
       l = operations[++i];
+      flushQueue(); // the last queued pixel chunk may still be sending from _buffer
       memcpy(_buffer, operations + i + 1, l);
       i += l;
       writeBytes(_buffer, l);
@@ -481,6 +521,7 @@ void Arduino_ESP32QSPI::batchOperation(const uint8_t *operations, size_t len)
     {
       uint8_t c = operations[++i];
       l = operations[++i];
+      flushQueue(); // the last queued pixel chunk may still be sending from _buffer
       memcpy(_buffer, operations + i + 1, l);
       i += l;
       writeC8Bytes(c, _buffer, l);
@@ -492,6 +533,7 @@ void Arduino_ESP32QSPI::batchOperation(const uint8_t *operations, size_t len)
       endWrite();
       break;
     case DELAY:
+      flushQueue();
       delay(operations[++i]);
       break;
     default:
@@ -509,6 +551,7 @@ void Arduino_ESP32QSPI::batchOperation(const uint8_t *operations, size_t len)
  */
 void Arduino_ESP32QSPI::writeBytes(uint8_t *data, uint32_t len)
 {
+  flushQueue();
   CS_LOW();
   uint32_t l;
   bool first_send = true;
@@ -550,6 +593,7 @@ void Arduino_ESP32QSPI::writeBytes(uint8_t *data, uint32_t len)
  */
 void Arduino_ESP32QSPI::write16bitBeRGBBitmapR1(uint16_t *bitmap, int16_t w, int16_t h)
 {
+  flushQueue();
   CS_LOW();
   uint32_t l = h << 4;
   bool first_send = true;
@@ -595,6 +639,7 @@ void Arduino_ESP32QSPI::write16bitBeRGBBitmapR1(uint16_t *bitmap, int16_t w, int
  */
 void Arduino_ESP32QSPI::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t len)
 {
+  flushQueue();
   CS_LOW();
   uint32_t l, l2;
   uint16_t p1, p2;
@@ -648,6 +693,7 @@ void Arduino_ESP32QSPI::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_
  */
 void Arduino_ESP32QSPI::writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uint32_t len)
 {
+  flushQueue();
   CS_LOW();
   uint32_t l;
   uint16_t p;
@@ -703,29 +749,15 @@ void Arduino_ESP32QSPI::writeYCbCrPixels(uint8_t *yData, uint8_t *cbData, uint8_
 
     uint16_t out_bits = w << 5;
 
+    flushQueue();
     CS_LOW();
     for (int row = 0; row < rows; ++row)
     {
-      for (int col = 0; col < cols; ++col)
-      {
-        uint8_t cb = *cbData++;
-        uint8_t cr = *crData++;
-        int16_t r = CR2R16[cr];
-        int16_t g = -CB2G16[cb] - CR2G16[cr];
-        int16_t b = CB2B16[cb];
-        int16_t y;
-
-        y = Y2I16[*yData++];
-        *dest++ = CLIPRBE[y + r] | CLIPGBE[y + g] | CLIPBBE[y + b];
-        y = Y2I16[*yData++];
-        *dest++ = CLIPRBE[y + r] | CLIPGBE[y + g] | CLIPBBE[y + b];
-        y = Y2I16[*yData2++];
-        *dest2++ = CLIPRBE[y + r] | CLIPGBE[y + g] | CLIPBBE[y + b];
-        y = Y2I16[*yData2++];
-        *dest2++ = CLIPRBE[y + r] | CLIPGBE[y + g] | CLIPBBE[y + b];
-      }
-      yData += w;
-      yData2 += w;
+      gfx_ycbcr420_to_rgb565be(dest, dest2, yData, yData2, cbData, crData, w);
+      yData += w << 1;
+      yData2 += w << 1;
+      cbData += cols;
+      crData += cols;
 
       if (first_send)
       {
@@ -802,4 +834,150 @@ GFX_INLINE void Arduino_ESP32QSPI::POLL_END()
   spi_device_polling_end(_handle, portMAX_DELAY);
 }
 
+/******** transaction queue **********/
+
+/**
+ * @brief queuePreCb
+ *
+ * Runs in the SPI ISR before every transaction. Polling transactions have no
+ * user and drive CS themselves.
+ *
+ * @param t
+ */
+void IRAM_ATTR Arduino_ESP32QSPI::queuePreCb(spi_transaction_t *t)
+{
+  Arduino_ESP32QSPI *bus = (Arduino_ESP32QSPI *)t->user;
+  if (bus && (((esp32qspi_trans_t *)t)->cs & ESP32QSPI_CS_START))
+  {
+    *bus->_csPortClr = bus->_csPinMask;
+  }
+}
+
+/**
+ * @brief queuePostCb
+ *
+ * @param t
+ */
+void IRAM_ATTR Arduino_ESP32QSPI::queuePostCb(spi_transaction_t *t)
+{
+  Arduino_ESP32QSPI *bus = (Arduino_ESP32QSPI *)t->user;
+  if (bus && (((esp32qspi_trans_t *)t)->cs & ESP32QSPI_CS_END))
+  {
+    *bus->_csPortSet = bus->_csPinMask;
+  }
+}
+
+/**
+ * @brief queueSlot
+ *
+ * Next free transaction of the ring, waits for the oldest one when all of
+ * them are in flight.
+ *
+ * @param cs ESP32QSPI_CS_START and / or ESP32QSPI_CS_END
+ * @return esp32qspi_trans_t*
+ */
+esp32qspi_trans_t *Arduino_ESP32QSPI::queueSlot(uint8_t cs)
+{
+  if ((_fence - _done) >= ESP32QSPI_QUEUE_SIZE)
+  {
+    reapQueue(portMAX_DELAY);
+  }
+  esp32qspi_trans_t *t = &_queue[_fence % ESP32QSPI_QUEUE_SIZE];
+  memset(t, 0, sizeof(esp32qspi_trans_t));
+  t->ext.base.user = this;
+  t->cs = cs;
+  return t;
+}
+
+/**
+ * @brief queueTrans
+ *
+ * @param t
+ */
+void Arduino_ESP32QSPI::queueTrans(esp32qspi_trans_t *t)
+{
+  spi_device_queue_trans(_handle, &t->ext.base, portMAX_DELAY);
+  ++_fence;
+}
+
+/**
+ * @brief queuePixelChunk
+ *
+ * The first chunk of a pixel write carries the command, RAMWR if it is still
+ * pending, otherwise RAMWRC. CS stays low until the last one.
+ *
+ * @param buf big endian pixels in a DMA buffer
+ * @param len
+ * @param first
+ * @param last
+ */
+void Arduino_ESP32QSPI::queuePixelChunk(uint16_t *buf, uint32_t len, bool first, bool last)
+{
+  esp32qspi_trans_t *t = queueSlot((first ? ESP32QSPI_CS_START : 0) | (last ? ESP32QSPI_CS_END : 0));
+  if (first)
+  {
+    t->ext.base.flags = SPI_TRANS_MODE_QIO;
+    t->ext.base.cmd = 0x32;
+    t->ext.base.addr = _ramwrPending ? 0x002C00 : 0x003C00;
+    _ramwrPending = false;
+  }
+  else
+  {
+    t->ext.base.flags = SPI_TRANS_MODE_QIO | SPI_TRANS_VARIABLE_CMD |
+                        SPI_TRANS_VARIABLE_ADDR | SPI_TRANS_VARIABLE_DUMMY;
+  }
+  t->ext.base.tx_buffer = buf;
+  t->ext.base.length = len << 4;
+  queueTrans(t);
+}
+
+/**
+ * @brief reapQueue
+ *
+ * @param timeout
+ * @return true if a queued transaction finished
+ */
+bool Arduino_ESP32QSPI::reapQueue(TickType_t timeout)
+{
+  spi_transaction_t *t;
+  if (spi_device_get_trans_result(_handle, &t, timeout) != ESP_OK)
+  {
+    return false;
+  }
+  ++_done;
+  return true;
+}
+
+/**
+ * @brief waitBuffer
+ *
+ * @param idx 0: _buffer, 1: _2nd_buffer
+ */
+void Arduino_ESP32QSPI::waitBuffer(uint8_t idx)
+{
+  while ((int32_t)(_done - _bufferFence[idx]) < 0)
+  {
+    reapQueue(portMAX_DELAY);
+  }
+}
+
+/**
+ * @brief flushQueue
+ *
+ * Finish the queue and a pending RAMWR, polling transactions cannot start
+ * while queued ones are in flight.
+ */
+void Arduino_ESP32QSPI::flushQueue()
+{
+  while (_done != _fence)
+  {
+    reapQueue(portMAX_DELAY);
+  }
+  if (_ramwrPending)
+  {
+    _ramwrPending = false;
+    sendCommand(0x2C);
+  }
+}
+
 #endif // #if defined(ESP32)
@@ -20,6 +20,20 @@
 #ifndef ESP32QSPI_DMA_CHANNEL
 #define ESP32QSPI_DMA_CHANNEL SPI_DMA_CH_AUTO
 #endif
+// transactions in flight: address window commands and pixel chunks are
+// queued to the SPI driver and chained by its ISR
+#ifndef ESP32QSPI_QUEUE_SIZE
+#define ESP32QSPI_QUEUE_SIZE 6
+#endif
+
+#define ESP32QSPI_CS_START 0x01 // CS goes low before the transaction
+#define ESP32QSPI_CS_END 0x02   // CS goes high after it
+
+typedef struct
+{
+  spi_transaction_ext_t ext; // first, the driver hands back &ext.base
+  uint8_t cs;
+} esp32qspi_trans_t;
 
 class Arduino_ESP32QSPI : public Arduino_DataBus
 {
@@ -54,6 +68,9 @@ public:
   void writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uint32_t len) override;
   void writeYCbCrPixels(uint8_t *yData, uint8_t *cbData, uint8_t *crData, uint16_t w, uint16_t h) override;
 
+  uint32_t submitPixels(uint16_t *data, uint32_t len) override;
+  bool fenceReached(uint32_t fence) override;
+
 protected:
 private:
   GFX_INLINE void CS_HIGH(void);
@@ -61,6 +78,16 @@ private:
   GFX_INLINE void POLL_START();
   GFX_INLINE void POLL_END();
 
+  static void queuePreCb(spi_transaction_t *t);
+  static void queuePostCb(spi_transaction_t *t);
+  void sendCommand(uint8_t c);
+  esp32qspi_trans_t *queueSlot(uint8_t cs);
+  void queueTrans(esp32qspi_trans_t *t);
+  void queuePixelChunk(uint16_t *buf, uint32_t len, bool first, bool last);
+  bool reapQueue(TickType_t timeout);
+  void waitBuffer(uint8_t idx);
+  void flushQueue();
+
   int8_t _cs, _sck, _mosi, _miso, _quadwp, _quadhd;
   bool _is_shared_interface;
 
@@ -72,6 +99,12 @@ private:
   spi_transaction_ext_t _spi_tran_ext;
   spi_transaction_t *_spi_tran;
 
+  esp32qspi_trans_t _queue[ESP32QSPI_QUEUE_SIZE];
+  uint32_t _done = 0;            // queued transactions finished, _fence counts the ones queued
+  uint32_t _bufferFence[2] = {}; // last transaction sending from _buffer / _2nd_buffer
+  uint8_t _nextBuffer = 0;
+  bool _ramwrPending = false; // RAMWR not sent yet, the next pixels carry it
+
   union
   {
     uint8_t* _buffer;
@@ -11,7 +11,8 @@ Arduino_ESP32RGBPanel::Arduino_ESP32RGBPanel(
     uint16_t hsync_polarity, uint16_t hsync_front_porch, uint16_t hsync_pulse_width, uint16_t hsync_back_porch,
     uint16_t vsync_polarity, uint16_t vsync_front_porch, uint16_t vsync_pulse_width, uint16_t vsync_back_porch,
     uint16_t pclk_active_neg, int32_t prefer_speed, bool useBigEndian,
-    uint16_t de_idle_high, uint16_t pclk_idle_high)
+    uint16_t de_idle_high, uint16_t pclk_idle_high,
+    uint16_t bounce_buffer_lines, bool double_fb)
     : _de(de), _vsync(vsync), _hsync(hsync), _pclk(pclk),
       _r0(r0), _r1(r1), _r2(r2), _r3(r3), _r4(r4),
       _g0(g0), _g1(g1), _g2(g2), _g3(g3), _g4(g4), _g5(g5),
@@ -19,7 +20,8 @@ Arduino_ESP32RGBPanel::Arduino_ESP32RGBPanel(
       _hsync_polarity(hsync_polarity), _hsync_front_porch(hsync_front_porch), _hsync_pulse_width(hsync_pulse_width), _hsync_back_porch(hsync_back_porch),
       _vsync_polarity(vsync_polarity), _vsync_front_porch(vsync_front_porch), _vsync_pulse_width(vsync_pulse_width), _vsync_back_porch(vsync_back_porch),
       _pclk_active_neg(pclk_active_neg), _prefer_speed(prefer_speed), _useBigEndian(useBigEndian),
-      _de_idle_high(de_idle_high), _pclk_idle_high(pclk_idle_high)
+      _de_idle_high(de_idle_high), _pclk_idle_high(pclk_idle_high),
+      _bounce_buffer_lines(bounce_buffer_lines), _double_fb(double_fb)
 {
 }
 
@@ -111,6 +113,11 @@ uint16_t *Arduino_ESP32RGBPanel::getFrameBuffer(int16_t w, int16_t h)
 
   _panel_config->disp_gpio_num = GPIO_NUM_NC;
 
+  _vsync_sem = xSemaphoreCreateBinary();
+  _swap_sem = xSemaphoreCreateBinary();
+  _panel_config->on_frame_trans_done = onVSync;
+  _panel_config->user_ctx = this;
+
   _panel_config->flags.disp_active_low = 0;
   _panel_config->flags.relax_on_idle = 0;
   _panel_config->flags.fb_in_psram = 1; // allocate frame buffer in PSRAM
@@ -127,7 +134,205 @@ uint16_t *Arduino_ESP32RGBPanel::getFrameBuffer(int16_t w, int16_t h)
   LCD_CAM.lcd_ctrl2.lcd_vsync_idle_pol = _vsync_polarity;
   LCD_CAM.lcd_ctrl2.lcd_hsync_idle_pol = _hsync_polarity;
 
-  return (uint16_t *)_rgb_panel->fb;
+  _fb[0] = (uint16_t *)_rgb_panel->fb;
+  if (_bounce_buffer_lines)
+  {
+    if (!startBounceBuffer(w, h))
+    {
+      log_w("bounce buffer not available, scanning out from PSRAM");
+    }
+  }
+  if (_double_fb && !_bb_chunks)
+  {
+    log_w("double_fb needs the bounce buffer mode");
+  }
+
+  return _fb[1] ? _fb[1] : _fb[0];
+}
+
+/*
+Returns the frame buffer to draw the next frame into. With double_fb, the
+frame buffer drawn so far is shown from the next frame on and the other one
+is returned once the LCD no longer reads it, after copying the shown frame
+into it when copy is set. Without double_fb it returns the only frame
+buffer.
+*/
+uint16_t *Arduino_ESP32RGBPanel::swapFrameBuffer(bool copy)
+{
+  if (!_fb[1])
+  {
+    return _fb[0];
+  }
+
+  uint8_t back = _fb_front ^ 1;
+  xSemaphoreTake(_swap_sem, 0);
+  _fb_pending = back;
+  // taken when the copy of the next frame starts from the new front
+  while (_fb_pending >= 0)
+  {
+    xSemaphoreTake(_swap_sem, pdMS_TO_TICKS(100));
+  }
+  if (copy)
+  {
+    memcpy(_fb[back ^ 1], _fb[back], _rgb_panel->fb_size);
+  }
+  return _fb[back ^ 1];
+}
+
+// Waits for the end of the next vertical sync, false on timeout
+bool Arduino_ESP32RGBPanel::waitVSync(uint32_t timeout_ms)
+{
+  if (!_vsync_sem)
+  {
+    return false;
+  }
+  xSemaphoreTake(_vsync_sem, 0);
+  return xSemaphoreTake(_vsync_sem, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+}
+
+bool Arduino_ESP32RGBPanel::isBounceBuffered()
+{
+  return _bb_chunks > 0;
+}
+
+bool Arduino_ESP32RGBPanel::startBounceBuffer(int16_t w, int16_t h)
+{
+  // the DMA restarts at bounce buffer 0 on a new frame, so each frame must
+  // begin in it: an even number of buffers per frame
+  uint16_t lines = min(_bounce_buffer_lines, (uint16_t)(h / 2));
+  while ((lines > 0) && ((h % lines) || ((h / lines) & 1)))
+  {
+    --lines;
+  }
+  if (!lines)
+  {
+    return false;
+  }
+  uint32_t pixels = (uint32_t)w * lines;
+  uint32_t bytes = pixels * 2;
+  uint32_t nodes = (bytes + RGB_PANEL_DMA_NODE_MAX - 1) / RGB_PANEL_DMA_NODE_MAX;
+  if (nodes * 2 > _rgb_panel->num_dma_nodes)
+  {
+    return false;
+  }
+
+  for (uint8_t b = 0; b < 2; ++b)
+  {
+    _bb[b] = (uint8_t *)heap_caps_aligned_alloc(4, bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+  }
+  if (_double_fb)
+  {
+    _fb[1] = (uint16_t *)heap_caps_aligned_calloc(_rgb_panel->psram_trans_align, 1, _rgb_panel->fb_size, MALLOC_CAP_SPIRAM);
+  }
+  if ((!_bb[0]) || (!_bb[1]) || (_double_fb && !_fb[1]))
+  {
+    heap_caps_free(_bb[0]);
+    heap_caps_free(_bb[1]);
+    heap_caps_free(_fb[1]);
+    _bb[0] = _bb[1] = NULL;
+    _fb[1] = NULL;
+    return false;
+  }
+
+  // fill both bounce buffers while the DMA still reads the frame buffer
+  _bb_pixels = pixels;
+  _bb_chunks = h / lines;
+  _bb_chunk = 0;
+  fillBounceBuffer(0);
+  fillBounceBuffer(1);
+
+  gdma_tx_event_callbacks_t cbs = {.on_trans_eof = onBounceEmpty};
+  gdma_register_tx_event_callbacks(_rgb_panel->dma_chan, &cbs, this);
+
+  // loop the descriptors the driver made for the frame buffer over the
+  // bounce buffers instead, a restart by the driver then still starts at
+  // bounce buffer 0
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+  portENTER_CRITICAL(&lock);
+  lcd_ll_stop(_rgb_panel->hal.dev);
+  gdma_stop(_rgb_panel->dma_chan);
+  dma_descriptor_t *d = _rgb_panel->dma_nodes;
+  for (uint32_t b = 0; b < 2; ++b)
+  {
+    for (uint32_t i = 0; i < nodes; ++i)
+    {
+      uint32_t n = b * nodes + i;
+      uint32_t len = min(bytes - i * RGB_PANEL_DMA_NODE_MAX, (uint32_t)RGB_PANEL_DMA_NODE_MAX);
+      d[n].dw0.size = len;
+      d[n].dw0.length = len;
+      d[n].dw0.suc_eof = (i == nodes - 1);
+      d[n].dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+      d[n].buffer = _bb[b] + i * RGB_PANEL_DMA_NODE_MAX;
+      d[n].next = &d[(n + 1) % (nodes * 2)];
+    }
+    _bb_eof[b] = &d[b * nodes + nodes - 1];
+  }
+  gdma_reset(_rgb_panel->dma_chan);
+  lcd_ll_fifo_reset(_rgb_panel->hal.dev);
+  gdma_start(_rgb_panel->dma_chan, (intptr_t)d);
+  // time for the DMA to pass data to the LCD FIFO
+  esp_rom_delay_us(1);
+  lcd_ll_start(_rgb_panel->hal.dev);
+  portEXIT_CRITICAL(&lock);
+
+  return true;
+}
+
+// Copies the next part of the front frame buffer into bounce buffer buf,
+// returns whether a task waiting for a swap was woken
+IRAM_ATTR bool Arduino_ESP32RGBPanel::fillBounceBuffer(uint8_t buf)
+{
+  BaseType_t woken = pdFALSE;
+  if ((_bb_chunk == 0) && (_fb_pending >= 0))
+  {
+    // the new frame comes from here, the old front is not read any more
+    _fb_front = _fb_pending;
+    _fb_pending = -1;
+    xSemaphoreGiveFromISR(_swap_sem, &woken);
+  }
+  memcpy(_bb[buf], _fb[_fb_front] + (_bb_chunk * _bb_pixels), _bb_pixels * 2);
+  if (++_bb_chunk == _bb_chunks)
+  {
+    _bb_chunk = 0;
+  }
+  return woken == pdTRUE;
+}
+
+// Starts the frame over from bounce buffer 0, from the vertical sync
+IRAM_ATTR void Arduino_ESP32RGBPanel::restartBounceBuffer()
+{
+  _bb_chunk = 0;
+  fillBounceBuffer(0);
+  fillBounceBuffer(1);
+  gdma_reset(_rgb_panel->dma_chan);
+  gdma_start(_rgb_panel->dma_chan, (intptr_t)_rgb_panel->dma_nodes);
+}
+
+IRAM_ATTR bool Arduino_ESP32RGBPanel::onBounceEmpty(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data)
+{
+  Arduino_ESP32RGBPanel *p = (Arduino_ESP32RGBPanel *)user_data;
+  for (uint8_t b = 0; b < 2; ++b)
+  {
+    if (event_data->tx_eof_desc_addr == (intptr_t)p->_bb_eof[b])
+    {
+      return p->fillBounceBuffer(b);
+    }
+  }
+  return false; // not switched to the bounce buffers yet
+}
+
+IRAM_ATTR bool Arduino_ESP32RGBPanel::onVSync(esp_lcd_panel_handle_t panel, esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx)
+{
+  Arduino_ESP32RGBPanel *p = (Arduino_ESP32RGBPanel *)user_ctx;
+  BaseType_t woken = pdFALSE;
+  // between frames, bounce buffers 0 and 1 hold the first two parts of the
+  // next frame; anything else means an end of buffer interrupt was missed
+  if (p->_bb_chunks && (p->_bb_chunk != (2 % p->_bb_chunks)))
+  {
+    p->restartBounceBuffer();
+  }
+  xSemaphoreGiveFromISR(p->_vsync_sem, &woken);
+  return woken == pdTRUE;
 }
 #endif // #if (!defined(ESP_ARDUINO_VERSION_MAJOR)) || (ESP_ARDUINO_VERSION_MAJOR < 3)
 #endif // #if defined(ESP32) && (CONFIG_IDF_TARGET_ESP32S3)
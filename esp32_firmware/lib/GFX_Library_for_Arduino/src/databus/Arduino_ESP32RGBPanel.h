@@ -12,6 +12,9 @@
 #include "esp_lcd_panel_interface.h"
 #include "esp_private/gdma.h"
 #include "esp_pm.h"
+#include "esp_rom_sys.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "hal/dma_types.h"
 
 #include "hal/lcd_hal.h"
@@ -53,6 +56,25 @@ struct esp_rgb_panel_t
   dma_descriptor_t dma_nodes[]; // DMA descriptor pool of size `num_dma_nodes`
 };
 
+#define RGB_PANEL_DMA_NODE_MAX 4092 // bytes per DMA descriptor, word aligned
+
+/*
+With bounce_buffer_lines set, the LCD DMA does not read the frame buffer in
+PSRAM. It loops over two bounce buffers of that many lines in internal SRAM
+instead, and the end of buffer interrupt copies the next lines of the frame
+buffer into the buffer just sent. Scan-out then reads PSRAM once per frame
+through the cache, in large copies, and no longer competes with the CPU
+drawing for every pixel clock. CPU writes reach the copy through the same
+cache, so no cache write back is needed after drawing.
+
+The line count is lowered until it divides the height into an even number
+of buffers. A buffer of 10 to 20 lines is enough for most panels.
+
+double_fb adds a second frame buffer (bounce buffer mode only): draw into
+the one getFrameBuffer() returned, then swapFrameBuffer() shows it from the
+next frame on and returns the other one to draw into.
+*/
+
 class Arduino_ESP32RGBPanel
 {
 public:
@@ -64,14 +86,24 @@ public:
       uint16_t hsync_polarity, uint16_t hsync_front_porch, uint16_t hsync_pulse_width, uint16_t hsync_back_porch,
       uint16_t vsync_polarity, uint16_t vsync_front_porch, uint16_t vsync_pulse_width, uint16_t vsync_back_porch,
       uint16_t pclk_active_neg = 0, int32_t prefer_speed = GFX_NOT_DEFINED, bool useBigEndian = false,
-      uint16_t de_idle_high = 0, uint16_t pclk_idle_high = 0);
+      uint16_t de_idle_high = 0, uint16_t pclk_idle_high = 0,
+      uint16_t bounce_buffer_lines = 0, bool double_fb = false);
 
   bool begin(int32_t speed = GFX_NOT_DEFINED);
 
   uint16_t *getFrameBuffer(int16_t w, int16_t h);
+  uint16_t *swapFrameBuffer(bool copy = false);
+  bool waitVSync(uint32_t timeout_ms = 100);
+  bool isBounceBuffered();
 
 protected:
 private:
+  bool startBounceBuffer(int16_t w, int16_t h);
+  bool fillBounceBuffer(uint8_t buf);
+  void restartBounceBuffer();
+  static bool onBounceEmpty(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data);
+  static bool onVSync(esp_lcd_panel_handle_t panel, esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx);
+
   int32_t _speed;
   int8_t _de, _vsync, _hsync, _pclk;
   int8_t _r0, _r1, _r2, _r3, _r4;
@@ -91,8 +123,22 @@ private:
   uint16_t _de_idle_high;
   uint16_t _pclk_idle_high;
 
+  uint16_t _bounce_buffer_lines;
+  bool _double_fb;
+
   esp_lcd_panel_handle_t _panel_handle = NULL;
   esp_rgb_panel_t *_rgb_panel;
+
+  SemaphoreHandle_t _vsync_sem = NULL;
+  SemaphoreHandle_t _swap_sem = NULL;
+  uint16_t *_fb[2] = {NULL, NULL};             // frame buffers, [1] only with double_fb
+  uint8_t _fb_front = 0;                       // frame buffer being scanned out
+  volatile int8_t _fb_pending = -1;            // frame buffer to scan out from the next frame, -1 for none
+  uint8_t *_bb[2] = {NULL, NULL};              // bounce buffers in internal SRAM
+  dma_descriptor_t *_bb_eof[2] = {NULL, NULL}; // last DMA descriptor of each bounce buffer
+  uint32_t _bb_pixels = 0;                     // pixels per bounce buffer
+  uint16_t _bb_chunks = 0;                     // bounce buffers per frame, 0 when not bounce buffered
+  volatile uint16_t _bb_chunk = 0;             // part of the frame copied next
 };
 
 #endif // #if (!defined(ESP_ARDUINO_VERSION_MAJOR)) || (ESP_ARDUINO_VERSION_MAJOR < 3)
@@ -321,6 +321,42 @@ bool Arduino_ESP32SPI::begin(int32_t speed, int8_t dataMode)
     return false;
   }
 
+#if defined(ESP32SPI_USE_DMA)
+  // optional, without a free GDMA channel everything stays on data_buf
+  if (!_dma_chan)
+  {
+    gdma_channel_alloc_config_t dma_chan_config = {
+        .sibling_chan = NULL,
+        .direction = GDMA_CHANNEL_DIRECTION_TX,
+        .flags = {
+            .reserve_sibling = 0}};
+    if (gdma_new_channel(&dma_chan_config, &_dma_chan) == ESP_OK)
+    {
+      gdma_connect(_dma_chan, GDMA_MAKE_TRIGGER(GDMA_TRIG_PERIPH_SPI, (_spi_num == FSPI) ? 2 : 3));
+      for (uint8_t i = 0; i < 2; ++i)
+      {
+        _dmadesc[i] = (dma_descriptor_t *)heap_caps_malloc(sizeof(dma_descriptor_t), MALLOC_CAP_DMA);
+        _dmabuf[i] = (uint16_t *)heap_caps_aligned_alloc(16, ((ESP32SPI_DMA_PIXELS + 1) & ~1) * 2, MALLOC_CAP_DMA);
+      }
+      if (!_dmadesc[0] || !_dmadesc[1] || !_dmabuf[0] || !_dmabuf[1])
+      {
+        for (uint8_t i = 0; i < 2; ++i)
+        {
+          heap_caps_free(_dmadesc[i]);
+          heap_caps_free(_dmabuf[i]);
+        }
+        gdma_disconnect(_dma_chan);
+        gdma_del_channel(_dma_chan);
+        _dma_chan = nullptr;
+      }
+    }
+    else
+    {
+      _dma_chan = nullptr;
+    }
+  }
+#endif // #if defined(ESP32SPI_USE_DMA)
+
   return true;
 }
 
@@ -351,6 +387,8 @@ void Arduino_ESP32SPI::beginWrite()
  */
 void Arduino_ESP32SPI::endWrite()
 {
+  WAIT_DMA();
+
   if (_data_buf_bit_idx > 0)
   {
     flush_data_buf();
@@ -371,6 +409,8 @@ void Arduino_ESP32SPI::endWrite()
  */
 void Arduino_ESP32SPI::writeCommand(uint8_t c)
 {
+  WAIT_DMA();
+
   if (_dc == GFX_NOT_DEFINED) // 9-bit SPI
   {
     WRITE9BIT(c);
@@ -398,6 +438,8 @@ void Arduino_ESP32SPI::writeCommand(uint8_t c)
  */
 void Arduino_ESP32SPI::writeCommand16(uint16_t c)
 {
+  WAIT_DMA();
+
   if (_dc == GFX_NOT_DEFINED) // 9-bit SPI
   {
     _data16.value = c;
@@ -428,6 +470,8 @@ void Arduino_ESP32SPI::writeCommand16(uint16_t c)
  */
 void Arduino_ESP32SPI::writeCommandBytes(uint8_t *data, uint32_t len)
 {
+  WAIT_DMA();
+
   if (_dc == GFX_NOT_DEFINED) // 9-bit SPI
   {
     while (len--)
@@ -493,6 +537,8 @@ void Arduino_ESP32SPI::write16(uint16_t d)
  */
 void Arduino_ESP32SPI::writeC8D8(uint8_t c, uint8_t d)
 {
+  WAIT_DMA();
+
   if (_dc == GFX_NOT_DEFINED) // 9-bit SPI
   {
     WRITE9BIT(c);
@@ -525,6 +571,8 @@ void Arduino_ESP32SPI::writeC8D8(uint8_t c, uint8_t d)
  */
 void Arduino_ESP32SPI::writeC8D16(uint8_t c, uint16_t d)
 {
+  WAIT_DMA();
+
   if (_dc == GFX_NOT_DEFINED) // 9-bit SPI
   {
     WRITE9BIT(c);
@@ -560,6 +608,8 @@ void Arduino_ESP32SPI::writeC8D16(uint8_t c, uint16_t d)
  */
 void Arduino_ESP32SPI::writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2)
 {
+  WAIT_DMA();
+
   if (_dc == GFX_NOT_DEFINED) // 9-bit SPI
   {
     WRITE9BIT(c);
@@ -671,8 +721,37 @@ void Arduino_ESP32SPI::writeRepeat(uint16_t p, uint32_t len)
       len -= xferLen;
     }
   }
+#if defined(ESP32SPI_USE_DMA)
+  else if (USE_DMA(len))
+  {
+    // fill one staging buffer and send it as often as needed, the last
+    // transfer is left running
+    uint32_t bufLen = (len >= ESP32SPI_DMA_PIXELS) ? ESP32SPI_DMA_PIXELS : len;
+    uint32_t xferLen, l;
+    uint32_t c32;
+    MSB_32_16_16_SET(c32, p, p);
+
+    uint32_t *p32 = (uint32_t *)_dmabuf[_dmaNext];
+    l = (bufLen + 1) >> 1;
+    for (uint32_t i = 0; i < l; i++)
+    {
+      p32[i] = c32;
+    }
+
+    while (len)
+    {
+      xferLen = (bufLen <= len) ? bufLen : len;
+      WAIT_DMA();
+      startDma(_dmaNext, xferLen << 1);
+      len -= xferLen;
+    }
+    _dmaNext ^= 1;
+  }
+#endif // #if defined(ESP32SPI_USE_DMA)
   else // 8-bit SPI
   {
+    WAIT_DMA();
+
     uint16_t bufLen = (len >= ESP32SPI_MAX_PIXELS_AT_ONCE) ? ESP32SPI_MAX_PIXELS_AT_ONCE : len;
     int16_t xferLen, l;
     uint32_t c32;
@@ -725,8 +804,16 @@ void Arduino_ESP32SPI::writePixels(uint16_t *data, uint32_t len)
       write16(*data++);
     }
   }
+#if defined(ESP32SPI_USE_DMA)
+  else if (USE_DMA(len))
+  {
+    submitPixels(data, len);
+  }
+#endif // #if defined(ESP32SPI_USE_DMA)
   else // 8-bit SPI
   {
+    WAIT_DMA();
+
     if (_data_buf_bit_idx > 0)
     {
       flush_data_buf();
@@ -760,6 +847,8 @@ void Arduino_ESP32SPI::writePixels(uint16_t *data, uint32_t len)
  */
 void Arduino_ESP32SPI::writeBytes(uint8_t *data, uint32_t len)
 {
+  WAIT_DMA();
+
   if (_dc == GFX_NOT_DEFINED) // 9-bit SPI
   {
     while (len--)
@@ -803,6 +892,8 @@ void Arduino_ESP32SPI::writeBytes(uint8_t *data, uint32_t len)
  */
 void Arduino_ESP32SPI::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t len)
 {
+  WAIT_DMA();
+
   if (_dc == GFX_NOT_DEFINED) // 9-bit SPI
   {
     while (len--)
@@ -850,6 +941,8 @@ void Arduino_ESP32SPI::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t
  */
 void Arduino_ESP32SPI::writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uint32_t len)
 {
+  WAIT_DMA();
+
   if (_dc == GFX_NOT_DEFINED) // 9-bit SPI
   {
     uint16_t hi, lo;
@@ -888,12 +981,115 @@ void Arduino_ESP32SPI::writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, ui
   }
 }
 
+#if defined(ESP32SPI_USE_DMA)
+/**
+ * @brief submitPixels
+ *
+ * Converts the pixels into the free staging buffer while the other one is on
+ * the wire, the last transfer is left running when this returns.
+ *
+ * @param data
+ * @param len
+ * @return fence of the last transfer
+ */
+uint32_t Arduino_ESP32SPI::submitPixels(uint16_t *data, uint32_t len)
+{
+  if (!USE_DMA(len))
+  {
+    return Arduino_DataBus::submitPixels(data, len);
+  }
+
+  if (_data_buf_bit_idx > 0)
+  {
+    flush_data_buf();
+  }
+
+  uint32_t l, l2;
+  uint16_t p1, p2;
+  while (len)
+  {
+    l = (len > ESP32SPI_DMA_PIXELS) ? ESP32SPI_DMA_PIXELS : len;
+    l2 = l >> 1;
+    uint32_t *p32 = (uint32_t *)_dmabuf[_dmaNext];
+    for (uint32_t i = 0; i < l2; ++i)
+    {
+      p1 = *data++;
+      p2 = *data++;
+      MSB_32_16_16_SET(p32[i], p1, p2);
+    }
+    if (l & 1)
+    {
+      p1 = *data++;
+      MSB_16_SET(_dmabuf[_dmaNext][l - 1], p1);
+    }
+
+    WAIT_DMA();
+    startDma(_dmaNext, l << 1);
+    _dmaNext ^= 1;
+
+    len -= l;
+  }
+
+  return _fence;
+}
+
+/**
+ * @brief fenceReached
+ *
+ * @param fence
+ * @return true
+ * @return false
+ */
+bool Arduino_ESP32SPI::fenceReached(uint32_t fence)
+{
+  if (_dmaBusy && !_spi->dev->cmd.usr)
+  {
+    WAIT_DMA();
+  }
+  // only the latest transfer can still be on the wire
+  return !_dmaBusy || ((int32_t)(_fence - fence) > 0);
+}
+
+/**
+ * @brief startDma
+ *
+ * @param buf
+ * @param bytes
+ */
+void Arduino_ESP32SPI::startDma(uint8_t buf, uint32_t bytes)
+{
+  dma_descriptor_t *desc = _dmadesc[buf];
+  *(uint32_t *)desc = ((bytes + 3) & (~3)) | bytes << 12 | 0xC0000000;
+  desc->buffer = _dmabuf[buf];
+  desc->next = nullptr;
+
+  _spi->dev->dma_conf.dma_afifo_rst = 1;
+  _spi->dev->dma_conf.dma_afifo_rst = 0;
+  _spi->dev->dma_conf.buf_afifo_rst = 1;
+  _spi->dev->dma_conf.buf_afifo_rst = 0;
+  _spi->dev->dma_conf.dma_tx_ena = 1;
+  gdma_reset(_dma_chan);
+  gdma_start(_dma_chan, (intptr_t)desc);
+
+  _spi->dev->ms_dlen.ms_data_bitlen = (bytes << 3) - 1;
+  _spi->dev->cmd.update = 1;
+  while (_spi->dev->cmd.update)
+    ;
+  _spi->dev->cmd.usr = 1;
+
+  _dmaBusy = true;
+  ++_fence;
+}
+#endif // #if defined(ESP32SPI_USE_DMA)
+
 /**
  * @brief flush_data_buf
  *
  */
 void Arduino_ESP32SPI::flush_data_buf()
 {
+  WAIT_DMA();
+
   uint32_t len = (_data_buf_bit_idx + 31) / 32;
   for (uint32_t i = 0; i < len; i++)
   {
@@ -1027,4 +1223,39 @@ GFX_INLINE void Arduino_ESP32SPI::POLL(uint32_t len)
     ;
 }
 
+/**
+ * @brief USE_DMA
+ *
+ * @return GFX_INLINE
+ */
+GFX_INLINE bool Arduino_ESP32SPI::USE_DMA(uint32_t len)
+{
+#if defined(ESP32SPI_USE_DMA)
+  return _dma_chan && (_dc != GFX_NOT_DEFINED) && (len >= ESP32SPI_DMA_THRESHOLD);
+#else
+  UNUSED(len);
+  return false;
+#endif
+}
+
+/**
+ * @brief WAIT_DMA
+ *
+ * Hand the peripheral back to data_buf once the running DMA transfer is done.
+ *
+ * @return GFX_INLINE
+ */
+GFX_INLINE void Arduino_ESP32SPI::WAIT_DMA(void)
+{
+#if defined(ESP32SPI_USE_DMA)
+  if (_dmaBusy)
+  {
+    while (_spi->dev->cmd.usr)
+      ;
+    _spi->dev->dma_conf.dma_tx_ena = 0;
+    _dmaBusy = false;
+  }
+#endif
+}
+
 #endif // #if defined(ESP32)
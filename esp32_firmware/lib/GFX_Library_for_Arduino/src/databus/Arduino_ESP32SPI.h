@@ -26,6 +26,18 @@
 #define ESP32SPI_MAX_PIXELS_AT_ONCE 32
 #endif
 
+// S3 can feed the SPI peripheral from GDMA instead of the 64 bytes data_buf,
+// longer pixel runs then ping-pong between two staging buffers
+#if CONFIG_IDF_TARGET_ESP32S3 && ((!defined(ESP_ARDUINO_VERSION_MAJOR)) || (ESP_ARDUINO_VERSION_MAJOR < 3))
+#define ESP32SPI_USE_DMA
+#endif
+#ifndef ESP32SPI_DMA_PIXELS
+#define ESP32SPI_DMA_PIXELS 2046 // per staging buffer, must fit one 4095 bytes DMA descriptor
+#endif
+#ifndef ESP32SPI_DMA_THRESHOLD
+#define ESP32SPI_DMA_THRESHOLD 64 // shorter runs stay on data_buf
+#endif
+
 class Arduino_ESP32SPI : public Arduino_DataBus
 {
 public:
@@ -58,6 +70,11 @@ public:
   void writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t len) override;
   void writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uint32_t len) override;
 
+#if defined(ESP32SPI_USE_DMA)
+  uint32_t submitPixels(uint16_t *data, uint32_t len) override;
+  bool fenceReached(uint32_t fence) override;
+#endif // #if defined(ESP32SPI_USE_DMA)
+
 protected:
   void flush_data_buf();
   GFX_INLINE void WRITE8BIT(uint8_t d);
@@ -67,6 +84,11 @@ protected:
   GFX_INLINE void CS_HIGH(void);
   GFX_INLINE void CS_LOW(void);
   GFX_INLINE void POLL(uint32_t len);
+  GFX_INLINE bool USE_DMA(uint32_t len);
+  GFX_INLINE void WAIT_DMA(void);
+#if defined(ESP32SPI_USE_DMA)
+  void startDma(uint8_t buf, uint32_t bytes);
+#endif // #if defined(ESP32SPI_USE_DMA)
 
 private:
   int8_t _dc, _cs;
@@ -93,6 +115,14 @@ private:
   };
 
   uint16_t _data_buf_bit_idx = 0;
+
+#if defined(ESP32SPI_USE_DMA)
+  gdma_channel_handle_t _dma_chan = nullptr;
+  dma_descriptor_t *_dmadesc[2];
+  uint16_t *_dmabuf[2];
+  uint8_t _dmaNext = 0;  // staging buffer the CPU fills next
+  bool _dmaBusy = false; // the other one is on the wire
+#endif // #if defined(ESP32SPI_USE_DMA)
 };
 
 #endif // #if defined(ESP32)
@@ -165,6 +165,7 @@ public:
   void setRotation(uint8_t r) override;
 
   void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override;
+  uint8_t getWindowAlignment() override { return 2; } // even x, y, w and h only
 
   void invertDisplay(bool) override;
   void displayOn() override;
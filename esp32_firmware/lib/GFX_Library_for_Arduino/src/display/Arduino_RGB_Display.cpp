@@ -70,6 +70,11 @@ bool Arduino_RGB_Display::begin(int32_t speed)
   {
     return false;
   }
+  if (_rgbpanel->isBounceBuffered())
+  {
+    // scan-out copies the frame buffer through the cache, nothing to write back
+    _auto_flush = false;
+  }
 
   return true;
 }
@@ -508,7 +513,7 @@ void Arduino_RGB_Display::draw16bitBeRGBBitmap(int16_t x, int16_t y,
 
 void Arduino_RGB_Display::flush(void)
 {
-  if (!_auto_flush)
+  if ((!_auto_flush) && (!_rgbpanel->isBounceBuffered()))
   {
     Cache_WriteBack_Addr((uint32_t)_framebuffer, _framebuffer_size);
   }
@@ -519,5 +524,18 @@ uint16_t *Arduino_RGB_Display::getFramebuffer()
   return _framebuffer;
 }
 
+// with a double buffered panel, shows what was drawn from the next frame on
+// and returns the frame buffer to draw into from now
+uint16_t *Arduino_RGB_Display::swapFramebuffer(bool copy)
+{
+  _framebuffer = _rgbpanel->swapFrameBuffer(copy);
+  return _framebuffer;
+}
+
+bool Arduino_RGB_Display::waitVSync(uint32_t timeout_ms)
+{
+  return _rgbpanel->waitVSync(timeout_ms);
+}
+
 #endif // #if (!defined(ESP_ARDUINO_VERSION_MAJOR)) || (ESP_ARDUINO_VERSION_MAJOR < 3)
 #endif // #if defined(ESP32) && (CONFIG_IDF_TARGET_ESP32S3)
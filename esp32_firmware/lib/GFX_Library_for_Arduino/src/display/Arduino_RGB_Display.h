@@ -2279,6 +2279,8 @@ public:
   void flush(void) override;
 
   uint16_t *getFramebuffer();
+  uint16_t *swapFramebuffer(bool copy = false);
+  bool waitVSync(uint32_t timeout_ms = 100);
 
 protected:
   uint16_t *_framebuffer;
@@ -170,6 +170,7 @@ public:
 
     bool begin(int32_t speed = GFX_NOT_DEFINED) override;
     void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override;
+    uint8_t getWindowAlignment() override { return 2; } // even x, y, w and h only
     void setRotation(uint8_t r) override;
     void invertDisplay(bool) override;
     void displayOn() override;
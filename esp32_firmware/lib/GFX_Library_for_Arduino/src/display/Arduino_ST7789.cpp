@@ -92,6 +92,240 @@ void Arduino_ST7789::displayOff(void)
   delay(ST7789_SLPIN_DELAY);
 }
 
+/**************************************************************************/
+/*!
+    @brief   Turn on the tearing effect output, a pulse at the start of every vertical blank
+    @param   te        GPIO the TE line is wired to, GFX_NOT_DEFINED if not connected
+    @param   scanline  Pulse when the panel scan reaches this line instead, 0 for vertical blank
+*/
+/**************************************************************************/
+void Arduino_ST7789::tearingEffectOn(int8_t te, uint16_t scanline)
+{
+  _te = te;
+  if (_te != GFX_NOT_DEFINED)
+  {
+    pinMode(_te, INPUT);
+  }
+  _bus->beginWrite();
+  _bus->writeC8D16(ST7789_TESCAN, scanline);
+  _bus->writeC8D8(ST7789_TEON, 0x00); // V-blank information only
+  _bus->endWrite();
+}
+
+void Arduino_ST7789::tearingEffectOff()
+{
+  _te = GFX_NOT_DEFINED;
+  _bus->sendCommand(ST7789_TEOFF);
+}
+
+/**************************************************************************/
+/*!
+    @brief   Block until the next TE pulse starts, writes started right after it stay ahead of the scan
+    @return  false if no TE pin is set or no pulse came within ST7789_TE_TIMEOUT
+*/
+/**************************************************************************/
+bool Arduino_ST7789::waitTearingEffect()
+{
+  if (_te == GFX_NOT_DEFINED)
+  {
+    return false;
+  }
+
+  uint32_t start = micros();
+  while (digitalRead(_te)) // let a pulse in progress pass, it may be nearly over
+  {
+    if ((micros() - start) > ST7789_TE_TIMEOUT)
+    {
+      return false;
+    }
+  }
+  while (!digitalRead(_te))
+  {
+    if ((micros() - start) > ST7789_TE_TIMEOUT)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Only refresh a band of panel rows, the rest of the panel is blanked
+    @param   row   First panel row, in rotation 0 coordinates
+    @param   rows  Number of rows
+*/
+/**************************************************************************/
+void Arduino_ST7789::partialDisplayOn(uint16_t row, uint16_t rows)
+{
+  row += ROW_OFFSET1;
+  _bus->beginWrite();
+  _bus->writeC8D16D16(ST7789_PTLAR, row, row + rows - 1);
+  _bus->writeCommand(ST7789_PTLON);
+  _bus->endWrite();
+}
+
+void Arduino_ST7789::partialDisplayOff()
+{
+  _bus->sendCommand(ST7789_NORON);
+}
+
+/**************************************************************************/
+/*!
+    @brief   Idle mode, 8 colors (MSB of each channel) at reduced power, for static screens
+*/
+/**************************************************************************/
+void Arduino_ST7789::idleModeOn()
+{
+  _bus->sendCommand(ST7789_IDMON);
+}
+
+void Arduino_ST7789::idleModeOff()
+{
+  _bus->sendCommand(ST7789_IDMOFF);
+}
+
+#if !defined(LITTLE_FOOT_PRINT)
+/**************************************************************************/
+/*!
+    @brief   Queue a changed area for the next flushDirtyRects().
+             Overlapping or nearby rectangles are merged while one window costs less than two.
+    @param   x   Top left corner x coordinate
+    @param   y   Top left corner y coordinate
+    @param   w   Width in pixels
+    @param   h   Height in pixels
+*/
+/**************************************************************************/
+void Arduino_ST7789::addDirtyRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  DirtyRect r = {max(x, (int16_t)0), max(y, (int16_t)0),
+                 min((int16_t)(x + w - 1), _max_x), min((int16_t)(y + h - 1), _max_y)};
+  if ((r.x1 > r.x2) || (r.y1 > r.y2))
+  {
+    return;
+  }
+
+  int32_t area_r = (int32_t)(r.x2 - r.x1 + 1) * (r.y2 - r.y1 + 1);
+  int32_t best_cost = INT32_MAX;
+  uint8_t best = 0;
+  uint8_t i = 0;
+  while (i < _dirtyCount)
+  {
+    DirtyRect &d = _dirty[i];
+    DirtyRect u = {min(d.x1, r.x1), min(d.y1, r.y1), max(d.x2, r.x2), max(d.y2, r.y2)};
+    int32_t cost = (int32_t)(u.x2 - u.x1 + 1) * (u.y2 - u.y1 + 1) - area_r -
+                   (int32_t)(d.x2 - d.x1 + 1) * (d.y2 - d.y1 + 1);
+    if (cost <= ST7789_RECT_MERGE_SLACK)
+    {
+      // absorb the queued rectangle and look again, the union may now reach others
+      r = u;
+      area_r = (int32_t)(r.x2 - r.x1 + 1) * (r.y2 - r.y1 + 1);
+      _dirty[i] = _dirty[--_dirtyCount];
+      best_cost = INT32_MAX;
+      i = 0;
+      continue;
+    }
+    if (cost < best_cost)
+    {
+      best_cost = cost;
+      best = i;
+    }
+    ++i;
+  }
+
+  if (_dirtyCount < ST7789_DIRTY_RECTS)
+  {
+    _dirty[_dirtyCount++] = r;
+  }
+  else // queue full, grow the rectangle that costs least
+  {
+    DirtyRect &d = _dirty[best];
+    d.x1 = min(d.x1, r.x1);
+    d.y1 = min(d.y1, r.y1);
+    d.x2 = max(d.x2, r.x2);
+    d.y2 = max(d.y2, r.y2);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief   Send the queued rectangles from a framebuffer, one address window each.
+             With a TE pin set, the burst starts on the vertical blank and runs in the panel's scan
+             order so it stays ahead of the scan; the dirty area has to fit in one refresh for that.
+    @param   framebuffer  Framebuffer in the current rotation
+    @param   stride       Framebuffer width in pixels
+*/
+/**************************************************************************/
+void Arduino_ST7789::flushDirtyRects(uint16_t *framebuffer, int16_t stride)
+{
+  if (!_dirtyCount)
+  {
+    return;
+  }
+
+  // scan order, few entries so insertion sort
+  for (uint8_t i = 1; i < _dirtyCount; ++i)
+  {
+    DirtyRect r = _dirty[i];
+    int16_t row = dirtyScanRow(r);
+    uint8_t j = i;
+    while ((j > 0) && (dirtyScanRow(_dirty[j - 1]) > row))
+    {
+      _dirty[j] = _dirty[j - 1];
+      --j;
+    }
+    _dirty[j] = r;
+  }
+
+  waitTearingEffect();
+  startWrite();
+  for (uint8_t i = 0; i < _dirtyCount; ++i)
+  {
+    DirtyRect &r = _dirty[i];
+    int16_t w = r.x2 - r.x1 + 1;
+    int16_t h = r.y2 - r.y1 + 1;
+    uint16_t *row = framebuffer + ((int32_t)r.y1 * stride) + r.x1;
+    writeAddrWindow(r.x1, r.y1, w, h);
+    if (w == stride)
+    {
+      writePixels(row, (uint32_t)w * h);
+    }
+    else
+    {
+      while (h--)
+      {
+        writePixels(row, w);
+        row += stride;
+      }
+    }
+  }
+  endWrite();
+  _dirtyCount = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief   First panel row a rectangle touches. The panel scans its native rows from 0 whatever
+             the rotation, MADCTL MV maps x onto them and MY reverses them (see setRotation()).
+    @param   r  Rectangle in the current rotation
+*/
+/**************************************************************************/
+int16_t Arduino_ST7789::dirtyScanRow(const DirtyRect &r)
+{
+  switch (_rotation)
+  {
+  case 1:
+    return r.x1;
+  case 2:
+    return _max_y - r.y2;
+  case 3:
+    return _max_x - r.x2;
+  default: // case 0:
+    return r.y1;
+  }
+}
+#endif // !defined(LITTLE_FOOT_PRINT)
+
 // Companion code to the above tables.  Reads and issues
 // a series of LCD commands stored in PROGMEM byte array.
 void Arduino_ST7789::tftInit()
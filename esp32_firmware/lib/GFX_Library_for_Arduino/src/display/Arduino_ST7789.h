@@ -37,8 +37,13 @@
 #define ST7789_RAMRD 0x2E
 
 #define ST7789_PTLAR 0x30
+#define ST7789_TEOFF 0x34
+#define ST7789_TEON 0x35
 #define ST7789_COLMOD 0x3A
 #define ST7789_MADCTL 0x36
+#define ST7789_IDMOFF 0x38
+#define ST7789_IDMON 0x39
+#define ST7789_TESCAN 0x44
 
 #define ST7789_MADCTL_MY 0x80
 #define ST7789_MADCTL_MX 0x40
@@ -51,6 +56,12 @@
 #define ST7789_RDID3 0xDC
 #define ST7789_RDID4 0xDD
 
+#define ST7789_TE_TIMEOUT 40000 ///< us to wait for a TE pulse, two frames at 50 Hz
+#ifndef ST7789_DIRTY_RECTS
+#define ST7789_DIRTY_RECTS 8 ///< dirty rectangles queued between flushDirtyRects() calls
+#endif
+#define ST7789_RECT_MERGE_SLACK 256 ///< extra pixels worth sending to save an address window
+
 static const uint8_t st7789_init_operations[] = {
     BEGIN_WRITE,
     WRITE_COMMAND_8, ST7789_SLPOUT, // 2: Out of sleep mode, no args, w/delay
@@ -137,8 +148,32 @@ public:
   void displayOn() override;
   void displayOff() override;
 
+  void tearingEffectOn(int8_t te = GFX_NOT_DEFINED, uint16_t scanline = 0);
+  void tearingEffectOff();
+  bool waitTearingEffect();
+  void partialDisplayOn(uint16_t row, uint16_t rows);
+  void partialDisplayOff();
+  void idleModeOn();
+  void idleModeOff();
+
+#if !defined(LITTLE_FOOT_PRINT)
+  void addDirtyRect(int16_t x, int16_t y, int16_t w, int16_t h);
+  void flushDirtyRects(uint16_t *framebuffer, int16_t stride);
+#endif // !defined(LITTLE_FOOT_PRINT)
+
 protected:
   void tftInit() override;
 
 private:
+  int8_t _te = GFX_NOT_DEFINED;
+#if !defined(LITTLE_FOOT_PRINT)
+  struct DirtyRect
+  {
+    int16_t x1, y1, x2, y2;
+  };
+  DirtyRect _dirty[ST7789_DIRTY_RECTS];
+  uint8_t _dirtyCount = 0;
+
+  int16_t dirtyScanRow(const DirtyRect &r);
+#endif // !defined(LITTLE_FOOT_PRINT)
 };
@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+"""Convert images to Arduino_GFX compressed assets, see src/GFXAsset.h.
+
+    gfx_asset.py logo.png                  writes logo.h with a PROGMEM array
+    gfx_asset.py bg.png -o bg.bin --bin    writes the raw asset
+    gfx_asset.py *.png --format palette    forces the palette format
+
+Every asset is decoded again after encoding and compared with the source
+pixels, a mismatch is an error. Reading images needs Pillow.
+"""
+
+import argparse
+import os
+import re
+import sys
+import time
+
+MAGIC = b"GA"
+VERSION = 1
+FORMAT_RGB565 = 0
+FORMAT_PALETTE = 1
+FORMAT_RAW = 2
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def color_hash(c):
+    return ((c >> 11) * 3 + ((c >> 5) & 0x3F) * 5 + (c & 0x1F) * 7) & 63
+
+
+def split(c):
+    return c >> 11, (c >> 5) & 0x3F, c & 0x1F
+
+
+def header(fmt, w, h):
+    return MAGIC + bytes([VERSION, fmt]) + w.to_bytes(2, "little") + h.to_bytes(2, "little")
+
+
+def encode_rgb565(pixels, w, h):
+    out = bytearray(header(FORMAT_RGB565, w, h))
+    cache = [0] * 64
+    px = 0
+    run = 0
+
+    def flush_run(run):
+        while run > 64:
+            n = min(run, 4160)
+            n -= 65
+            out.append(0xE0 | (n >> 8))
+            out.append(n & 0xFF)
+            run -= n + 65
+        if run > 0:
+            out.append(0x80 | (run - 1))
+
+    for c in pixels:
+        if c == px:
+            run += 1
+            continue
+        flush_run(run)
+        run = 0
+
+        h_ = color_hash(c)
+        if cache[h_] == c:
+            out.append(h_)
+        else:
+            pr, pg, pb = split(px)
+            r, g, b = split(c)
+            dr = ((r - pr + 16) & 0x1F) - 16
+            dg = ((g - pg + 32) & 0x3F) - 32
+            db = ((b - pb + 16) & 0x1F) - 16
+            dg2 = dg >> 1
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -16 <= dg <= 15 and -8 <= dr - dg2 <= 7 and -8 <= db - dg2 <= 7:
+                out.append(0xC0 | (dg + 16))
+                out.append(((dr - dg2 + 8) << 4) | (db - dg2 + 8))
+            else:
+                out.append(0xFF)
+                out += c.to_bytes(2, "little")
+        cache[h_] = c
+        px = c
+    flush_run(run)
+    return bytes(out)
+
+
+def encode_palette(pixels, w, h, palette):
+    out = bytearray(header(FORMAT_PALETTE, w, h))
+    out.append(len(palette) - 1)
+    for c in palette:
+        out += c.to_bytes(2, "little")
+    lookup = {c: i for i, c in enumerate(palette)}
+    indices = [lookup[c] for c in pixels]
+
+    prev = 0
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:128]
+            del literals[:128]
+            out.append(0x80 | (len(chunk) - 1))
+            out.extend(chunk)
+
+    i = 0
+    n = len(indices)
+    while i < n:
+        j = i
+        while j < n and indices[j] == prev:
+            j += 1
+        # runs of the previous index, a run of 1 only pays off between
+        # literals if it saves starting a new literal block
+        if j - i >= 2 or (j > i and not literals):
+            flush_literals()
+            run = j - i
+            while run > 0:
+                k = min(run, 128)
+                out.append(k - 1)
+                run -= k
+            i = j
+            continue
+        prev = indices[i]
+        literals.append(prev)
+        i += 1
+    flush_literals()
+    return bytes(out)
+
+
+def encode_raw(pixels, w, h):
+    return header(FORMAT_RAW, w, h) + b"".join(c.to_bytes(2, "little") for c in pixels)
+
+
+def decode(data):
+    """Reference decoder, the same algorithm as src/GFXAsset.cpp."""
+    if data[:2] != MAGIC or data[2] != VERSION:
+        raise ValueError("not an asset")
+    fmt = data[3]
+    w = int.from_bytes(data[4:6], "little")
+    h = int.from_bytes(data[6:8], "little")
+    total = w * h
+    pixels = []
+    p = 8
+    if fmt == FORMAT_RAW:
+        pixels = [int.from_bytes(data[p + 2 * i:p + 2 * i + 2], "little") for i in range(total)]
+    elif fmt == FORMAT_PALETTE:
+        count = data[p] + 1
+        palette = [int.from_bytes(data[p + 1 + 2 * i:p + 3 + 2 * i], "little") for i in range(count)]
+        p += 1 + 2 * count
+        index = 0
+        while len(pixels) < total:
+            op = data[p]
+            p += 1
+            if op & 0x80:
+                for _ in range((op & 0x7F) + 1):
+                    index = data[p]
+                    p += 1
+                    pixels.append(palette[index])
+            else:
+                pixels.extend([palette[index]] * (op + 1))
+    elif fmt == FORMAT_RGB565:
+        cache = [0] * 64
+        px = 0
+        while len(pixels) < total:
+            op = data[p]
+            p += 1
+            kind = op >> 6
+            if kind == 0:
+                px = cache[op]
+            elif kind == 1:
+                r, g, b = split(px)
+                r = (r + ((op >> 4) & 3) - 2) & 0x1F
+                g = (g + ((op >> 2) & 3) - 2) & 0x3F
+                b = (b + (op & 3) - 2) & 0x1F
+                px = (r << 11) | (g << 5) | b
+            elif kind == 2:
+                pixels.extend([px] * ((op & 0x3F) + 1))
+                continue
+            elif (op & 0xE0) == 0xC0:
+                op2 = data[p]
+                p += 1
+                dg = (op & 0x1F) - 16
+                r, g, b = split(px)
+                r = (r + (op2 >> 4) - 8 + (dg >> 1)) & 0x1F
+                g = (g + dg) & 0x3F
+                b = (b + (op2 & 0x0F) - 8 + (dg >> 1)) & 0x1F
+                px = (r << 11) | (g << 5) | b
+            elif (op & 0xF0) == 0xE0:
+                n = (((op & 0x0F) << 8) | data[p]) + 65
+                p += 1
+                pixels.extend([px] * n)
+                continue
+            elif op == 0xFF:
+                px = int.from_bytes(data[p:p + 2], "little")
+                p += 2
+            else:
+                raise ValueError("reserved op 0x%02X" % op)
+            cache[color_hash(px)] = px
+            pixels.append(px)
+    else:
+        raise ValueError("unknown format %d" % fmt)
+    return w, h, pixels[:total]
+
+
+def load_image(path, background):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("gfx_asset.py needs Pillow to read images: pip install pillow")
+    img = Image.open(path)
+    if img.mode in ("RGBA", "LA", "P"):
+        img = img.convert("RGBA")
+        bg = Image.new("RGBA", img.size, background + (255,))
+        img = Image.alpha_composite(bg, img)
+    img = img.convert("RGB")
+    w, h = img.size
+    pixels = [rgb565(r, g, b) for r, g, b in img.getdata()]
+    return w, h, pixels
+
+
+def encode(pixels, w, h, fmt):
+    palette = sorted(set(pixels))
+    candidates = []
+    if fmt in ("auto", "rgb565"):
+        candidates.append(encode_rgb565(pixels, w, h))
+    if fmt in ("auto", "raw"):
+        # noisy photos can grow under the RLE ops, store them as they are
+        candidates.append(encode_raw(pixels, w, h))
+    if fmt in ("auto", "palette"):
+        if len(palette) > 256:
+            if fmt == "palette":
+                raise ValueError("%d colors, the palette format holds 256" % len(palette))
+        else:
+            candidates.append(encode_palette(pixels, w, h, palette))
+    return min(candidates, key=len)
+
+
+def c_name(path):
+    name = re.sub(r"[^0-9A-Za-z_]", "_", os.path.splitext(os.path.basename(path))[0])
+    return "_" + name if name[0].isdigit() else name
+
+
+def write_header(path, name, data, w, h):
+    with open(path, "w") as f:
+        f.write("// %dx%d, %d bytes, made by gfx_asset.py\n" % (w, h, len(data)))
+        f.write("#pragma once\n\n")
+        f.write("#define %s_WIDTH %d\n" % (name.upper(), w))
+        f.write("#define %s_HEIGHT %d\n\n" % (name.upper(), h))
+        f.write("const uint8_t %s[] PROGMEM = {\n" % name)
+        for i in range(0, len(data), 16):
+            f.write("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",\n")
+        f.write("};\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("images", nargs="+")
+    ap.add_argument("-o", "--output", help="output file, only with one image")
+    ap.add_argument("--bin", action="store_true", help="write the raw asset instead of a C header")
+    ap.add_argument("--format", choices=("auto", "rgb565", "palette", "raw"), default="auto")
+    ap.add_argument("--name", help="C array name, default from the file name")
+    ap.add_argument("--background", default="000000", help="RRGGBB behind transparent pixels")
+    args = ap.parse_args()
+    if args.output and len(args.images) > 1:
+        ap.error("-o needs a single image")
+    background = tuple(int(args.background[i:i + 2], 16) for i in (0, 2, 4))
+
+    for path in args.images:
+        w, h, pixels = load_image(path, background)
+        start = time.perf_counter()
+        data = encode(pixels, w, h, args.format)
+        encoded = time.perf_counter()
+        if decode(data) != (w, h, pixels):
+            sys.exit("%s: round trip mismatch" % path)
+        decoded = time.perf_counter()
+
+        out = args.output or os.path.splitext(path)[0] + (".bin" if args.bin else ".h")
+        if args.bin:
+            with open(out, "wb") as f:
+                f.write(data)
+        else:
+            write_header(out, args.name or c_name(path), data, w, h)
+        print("%s: %dx%d %s, %d bytes (raw RGB565 %d, %.1f%%), encode %.0f ms, check %.0f ms" % (
+            out, w, h, ("rgb565", "palette", "raw")[data[3]], len(data), w * h * 2,
+            100.0 * len(data) / (w * h * 2), (encoded - start) * 1000, (decoded - encoded) * 1000))
+
+
+if __name__ == "__main__":
+    main()
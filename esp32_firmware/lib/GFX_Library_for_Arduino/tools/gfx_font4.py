@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Turn a 1 bpp GFXfont header into a 4 bpp anti-aliased one, for
+Arduino_GFX::setFont(font, 4).
+
+    gfx_font4.py FreeSans48pt7b.h --scale 4     writes FreeSans12pt4b.h
+    gfx_font4.py Big.h --scale 2 -o Small.h --name Small
+
+Make the source with Adafruit fontconvert at scale times the wanted size:
+every scale x scale block of it becomes one pixel whose coverage is the
+share of set bits, 17 levels at --scale 4 rounded to the 16 of a nibble.
+Offsets and advances are divided by scale and rounded down, so glyphs keep
+their place on the baseline.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+
+def parse_font(text):
+    bitmaps = re.search(r"Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    glyphs = re.search(r"Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    font = re.search(r"GFXfont\s+(\w+)\s+PROGMEM\s*=\s*\{[^}]*?,\s*[^,]*?,\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*"
+                     r"(0x[0-9A-Fa-f]+|\d+)\s*,\s*(\d+)\s*\}", text, re.S)
+    if not (bitmaps and glyphs and font):
+        sys.exit("not a GFXfont header")
+    data = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", bitmaps.group(1))]
+    entries = [tuple(int(v) for v in g) for g in
+               re.findall(r"\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", glyphs.group(1))]
+    return font.group(1), data, entries, int(font.group(2), 0), int(font.group(3), 0), int(font.group(4))
+
+
+def scale_glyph(data, glyph, s):
+    offset, w, h, advance, xo, yo = glyph
+    bits = set()
+    for i in range(w * h):
+        if data[offset + (i >> 3)] & (0x80 >> (i & 7)):
+            bits.add((xo + i % w, yo + i // w))
+    if not bits:
+        return [], 0, 0, advance // s, 0, 0
+    x0 = min(x for x, _ in bits) // s
+    y0 = min(y for _, y in bits) // s
+    x1 = max(x for x, _ in bits) // s
+    y1 = max(y for _, y in bits) // s
+    nw, nh = x1 - x0 + 1, y1 - y0 + 1
+    pixels = []
+    for y in range(y0, y1 + 1):
+        for x in range(x0, x1 + 1):
+            n = sum((x * s + i, y * s + j) in bits for j in range(s) for i in range(s))
+            pixels.append((n * 15 + (s * s) // 2) // (s * s))
+    return pixels, nw, nh, advance // s, x0, y0
+
+
+def out_name(name, s):
+    m = re.match(r"(.*?)(\d+)pt7b$", name)
+    if m:
+        return "%s%dpt4b" % (m.group(1), max(1, int(m.group(2)) // s))
+    return name + "4b"
+
+
+def write_header(path, name, data, glyphs, first, last, y_advance):
+    with open(path, "w") as f:
+        f.write("// 4 bpp anti-aliased GFXfont, made by gfx_font4.py, use with setFont(&%s, 4)\n" % name)
+        f.write("#pragma once\n\n")
+        f.write("const uint8_t %sBitmaps[] PROGMEM = {\n" % name)
+        for i in range(0, len(data), 12):
+            f.write("  " + ", ".join("0x%02X" % b for b in data[i:i + 12]) + ",\n")
+        f.write("};\n\n")
+        f.write("const GFXglyph %sGlyphs[] PROGMEM = {\n" % name)
+        for i, g in enumerate(glyphs):
+            c = first + i
+            f.write("  { %5d, %3d, %3d, %3d, %4d, %4d },   // 0x%02X %s\n" % (g + (c, repr(chr(c)))))
+        f.write("};\n\n")
+        f.write("const GFXfont %s PROGMEM = {\n" % name)
+        f.write("  (uint8_t  *)%sBitmaps,\n" % name)
+        f.write("  (GFXglyph *)%sGlyphs,\n" % name)
+        f.write("  0x%02X, 0x%02X, %d };\n\n" % (first, last, y_advance))
+        f.write("// Approx. %d bytes\n" % (len(data) + len(glyphs) * 7 + 7))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("font", help="1 bpp GFXfont header")
+    ap.add_argument("--scale", type=int, choices=(2, 3, 4), default=4, help="source pixels per output pixel")
+    ap.add_argument("-o", "--output", help="output file, default from the font name")
+    ap.add_argument("--name", help="C name of the font, default from the source name")
+    args = ap.parse_args()
+
+    with open(args.font) as f:
+        src_name, data, entries, first, last, y_advance = parse_font(f.read())
+    if len(entries) != last - first + 1:
+        sys.exit("%s: %d glyphs for 0x%02X to 0x%02X" % (args.font, len(entries), first, last))
+    name = args.name or out_name(src_name, args.scale)
+
+    out = []
+    glyphs = []
+    for g in entries:
+        pixels, w, h, advance, xo, yo = scale_glyph(data, g, args.scale)
+        if len(pixels) & 1:
+            pixels.append(0)
+        glyphs.append((len(out), w, h, advance, xo, yo))
+        out += [(pixels[i] << 4) | pixels[i + 1] for i in range(0, len(pixels), 2)]
+        if len(out) > 0xFFFF:
+            sys.exit("%s: more than 64 KB of bitmaps, the 16-bit glyph offsets cannot reach" % args.font)
+
+    path = args.output or os.path.join(os.path.dirname(args.font), name + ".h")
+    write_header(path, name, out, glyphs, first, last, (y_advance + args.scale // 2) // args.scale)
+    print("%s: %s, %d glyphs, %d bytes of bitmaps" % (path, name, len(glyphs), len(out)))
+
+
+if __name__ == "__main__":
+    main()
@@ -172,6 +172,27 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*Render the invalidated areas on more threads, e.g. on both cores of an ESP32-S3.
+ *The areas are cut into bands and every thread renders and flushes its bands in its own slice of the draw buffer(s).
+ *`flush_cb`, `wait_cb` and the widgets' draw events are called from the worker threads too,
+ *while the thread of `lv_timer_handler()` renders as well and waits for the frame to finish.
+ *The workers use a copy of the driver's draw context. Not used with `full_refresh`, `direct_mode`,
+ *software rotation and on displays with `single_thread_refr` set in their driver.*/
+#define LV_USE_PARALLEL_REFR 0
+#if LV_USE_PARALLEL_REFR
+    /*Number of rendering threads, including the thread of `lv_timer_handler()`*/
+    #define LV_PARALLEL_REFR_THREADS 2
+
+    /*Threads to use: LV_OS_PTHREAD or LV_OS_FREERTOS*/
+    #define LV_PARALLEL_REFR_OS LV_OS_FREERTOS
+
+    /*Stack size of a worker thread in bytes*/
+    #define LV_PARALLEL_REFR_STACK_SIZE (8 * 1024)
+
+    /*Storage class of thread local variables*/
+    #define LV_PARALLEL_REFR_THREAD_LOCAL __thread
+#endif
+
 /*-------------
  * GPU
  *-----------*/
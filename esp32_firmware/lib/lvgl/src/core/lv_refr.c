@@ -15,6 +15,7 @@
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_thread.h"
 #include "../draw/lv_draw.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../extra/others/snapshot/lv_snapshot.h"
@@ -26,6 +27,12 @@
 /*********************
  *      DEFINES
  *********************/
+/*Join two areas if drawing them as one costs at most this many extra pixels.
+ *Every area has a fixed cost too: finding its top object, walking the tree and a flush.*/
+#define JOIN_EXTRA_PX_MAX   256
+
+/*Rectangles `lv_refr_join_area()` can collect before it has to join some*/
+#define JOIN_RECT_MAX       (LV_INV_BUF_SIZE * 2)
 
 /**********************
  *      TYPEDEFS
@@ -48,18 +55,59 @@ typedef struct {
 #endif
 } mem_monitor_t;
 
+#if LV_USE_PARALLEL_REFR
+typedef struct {
+    lv_disp_t disp;             /*Copy of the display being refreshed, its `driver` is `drv`*/
+    lv_disp_drv_t drv;          /*Copy of the driver with `draw_ctx` as draw context*/
+    lv_draw_ctx_t * draw_ctx;   /*Copy of the driver's draw context*/
+    uint32_t draw_ctx_size;
+    lv_thread_t thread;
+    lv_thread_sync_t start;
+    lv_thread_sync_t done;
+    bool running;
+} refr_worker_t;
+
+typedef struct {
+    lv_mutex_t band_lock;       /*Protects `area_i` and `row`*/
+    lv_mutex_t flush_lock;      /*Protects the fields below it and the flushing of the draw buffer*/
+    uint32_t area_i;            /*Index of the area in `inv_areas` and the first row of the next band*/
+    lv_coord_t row;
+    lv_coord_t max_rows[LV_INV_BUF_SIZE];   /*Height of the bands of each area*/
+    uint32_t slice_size;        /*Pixels of a thread's slice of the draw buffer(s)*/
+    uint32_t buf_cnt;
+    uint32_t worker_max;        /*Workers which could be started*/
+    lv_disp_drv_t * drv;        /*The real driver, passed to `flush_cb` and `wait_cb`*/
+    uint32_t bands_left;        /*Bands not flushed yet, the flush of the last one is the last of the refresh*/
+    uint32_t flush_cnt;         /*Flushes started in this refresh*/
+    uint32_t slice_flush[LV_THREAD_CNT];    /*`flush_cnt` of the last flush from each thread's slice*/
+    void * last_buf;            /*The buffer of the last flush*/
+    bool inited;
+} refr_parallel_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static uint32_t join_extra_px(const lv_area_t * a1, const lv_area_t * a2);
+static uint32_t join_cheapest(lv_area_t * areas, uint32_t cnt, uint32_t extra_max);
+static uint32_t join_above(lv_area_t * rects, uint32_t cnt, lv_coord_t y);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_draw_ctx_t * draw_ctx);
+static void refr_area_content(lv_draw_ctx_t * draw_ctx);
+#if LV_USE_PARALLEL_REFR
+    static bool refr_parallel(void);
+    static lv_res_t refr_worker_start(refr_worker_t * w, uint8_t id);
+    static void refr_worker_cb(void * user_data);
+    static void refr_bands(lv_draw_ctx_t * draw_ctx);
+    static bool refr_next_band(lv_area_t * band);
+#endif
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
-static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
+static uint32_t get_max_row(lv_disp_t * disp, uint32_t buf_size, lv_coord_t area_w, lv_coord_t area_h);
 static void draw_buf_flush(lv_disp_t * disp);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
 
@@ -74,7 +122,12 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
  *  STATIC VARIABLES
  **********************/
 static uint32_t px_num;
-static lv_disp_t * disp_refr; /*Display being refreshed*/
+static LV_THREAD_LOCAL lv_disp_t * disp_refr; /*Display being refreshed, a copy of it on the workers*/
+
+#if LV_USE_PARALLEL_REFR
+    static refr_parallel_t par = {.worker_max = LV_THREAD_CNT - 1};
+    static refr_worker_t workers[LV_THREAD_CNT];   /*Indexed by `LV_THREAD_ID`, the first is not used*/
+#endif
 
 #if LV_USE_PERF_MONITOR
     static perf_monitor_t   perf_monitor;
@@ -250,12 +303,17 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Save the area*/
     if(disp->inv_p < LV_INV_BUF_SIZE) {
         lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
     }
-    else {   /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        lv_area_copy(&disp->inv_areas[disp->inv_p], &scr_area);
+    else {   /*If no place for the area join the two areas, the new one too, which are the cheapest to draw as one.
+              *It tries all the C(LV_INV_BUF_SIZE + 1, 2) pairs (528 by default) for every further area. Only joining
+              *the new one is cheaper, but then it keeps growing the same area and draws several times more.*/
+        lv_area_t areas[LV_INV_BUF_SIZE + 1];
+        lv_memcpy(areas, disp->inv_areas, sizeof(disp->inv_areas));
+        areas[LV_INV_BUF_SIZE] = com_area;
+        disp->inv_p = join_cheapest(areas, LV_INV_BUF_SIZE + 1, UINT32_MAX);
+        lv_memcpy(disp->inv_areas, areas, sizeof(lv_area_t) * disp->inv_p);
     }
-    disp->inv_p++;
     if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
 }
 
@@ -471,40 +529,217 @@ uint32_t lv_refr_get_fps_avg(void)
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Cover the invalidated areas with a few areas.
+ * The areas are cut into horizontal slabs at their top and bottom edges. In each slab the x ranges
+ * of the areas crossing it are merged, and a range continues the rectangle right above it if
+ * that has the same x range. These rectangles don't overlap. Then rectangles are joined while it
+ * draws only a few extra pixels, and the cheapest ones until they fit into `inv_areas`. A joined
+ * rectangle can overlap a third one, the common pixels are drawn twice.
+ * Also counts the invalidated pixels into `inv_px`.
+ *
+ * Cost: the final joins try every pair of the remaining rectangles, at most C(JOIN_RECT_MAX + 1, 3)
+ * `join_extra_px()` calls in total (43680 with the default 32 `LV_INV_BUF_SIZE`). If the slabs make more
+ * than JOIN_RECT_MAX rectangles, each further one first joins a pair of the finished ones, at most
+ * C(JOIN_RECT_MAX, 2) calls each. That needs areas which keep cutting each other into new x ranges;
+ * areas side by side or far apart make one rectangle each.
  */
 static void lv_refr_join_area(void)
 {
-    uint32_t join_from;
-    uint32_t join_in;
-    lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
+    uint32_t in_cnt = disp_refr->inv_p;
+    lv_area_t * in = disp_refr->inv_areas;
+    uint32_t i;
+
+    disp_refr->inv_px = 0;
+    if(in_cnt == 0) return;
+
+    lv_coord_t * ys = lv_mem_buf_get(sizeof(lv_coord_t) * in_cnt * 2);
+    lv_area_t * spans = lv_mem_buf_get(sizeof(lv_area_t) * in_cnt);
+    lv_area_t * rects = lv_mem_buf_get(sizeof(lv_area_t) * JOIN_RECT_MAX);
+    if(ys == NULL || spans == NULL || rects == NULL) {
+        /*Refresh the areas as they are*/
+        for(i = 0; i < in_cnt; i++) disp_refr->inv_px += lv_area_get_size(&in[i]);
+        if(ys) lv_mem_buf_release(ys);
+        if(spans) lv_mem_buf_release(spans);
+        if(rects) lv_mem_buf_release(rects);
+        return;
+    }
+
+    /*The top edges and the rows below the bottom edges, sorted and unique*/
+    uint32_t y_cnt = 0;
+    for(i = 0; i < in_cnt * 2; i++) {
+        lv_coord_t y = (i & 1) ? in[i >> 1].y2 + 1 : in[i >> 1].y1;
+        uint32_t k = y_cnt;
+        while(k > 0 && ys[k - 1] > y) k--;
+        if(k > 0 && ys[k - 1] == y) continue;
+
+        uint32_t m;
+        for(m = y_cnt; m > k; m--) ys[m] = ys[m - 1];
+        ys[k] = y;
+        y_cnt++;
+    }
+
+    uint32_t rect_cnt = 0;
+    uint32_t s;
+    for(s = 0; s + 1 < y_cnt; s++) {
+        lv_coord_t y1 = ys[s];
+        lv_coord_t y2 = ys[s + 1] - 1;
+
+        /*The x ranges of the areas in this slab sorted by x1, merged where they overlap or touch*/
+        uint32_t span_cnt = 0;
+        for(i = 0; i < in_cnt; i++) {
+            if(in[i].y1 > y1 || in[i].y2 < y2) continue;
+            uint32_t k = span_cnt;
+            while(k > 0 && spans[k - 1].x1 > in[i].x1) {
+                spans[k] = spans[k - 1];
+                k--;
+            }
+            spans[k].x1 = in[i].x1;
+            spans[k].x2 = in[i].x2;
+            span_cnt++;
+        }
+
+        uint32_t merged_cnt = 0;
+        for(i = 0; i < span_cnt; i++) {
+            if(merged_cnt > 0 && spans[i].x1 <= spans[merged_cnt - 1].x2 + 1) {
+                spans[merged_cnt - 1].x2 = LV_MAX(spans[merged_cnt - 1].x2, spans[i].x2);
+            }
+            else {
+                spans[merged_cnt++] = spans[i];
+            }
+        }
+
+        for(i = 0; i < merged_cnt; i++) {
+            disp_refr->inv_px += (uint32_t)(spans[i].x2 - spans[i].x1 + 1) * (y2 - y1 + 1);
+
+            /*Continue the rectangle ending right above it with the same x range*/
+            uint32_t r;
+            for(r = 0; r < rect_cnt; r++) {
+                if(rects[r].y2 == y1 - 1 && rects[r].x1 == spans[i].x1 && rects[r].x2 == spans[i].x2) break;
             }
 
-            /*Check if the areas are on each other*/
-            if(_lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
+            if(r < rect_cnt) {
+                rects[r].y2 = y2;
+            }
+            else {
+                if(rect_cnt == JOIN_RECT_MAX) rect_cnt = join_above(rects, rect_cnt, y1);
+                rects[rect_cnt].x1 = spans[i].x1;
+                rects[rect_cnt].y1 = y1;
+                rects[rect_cnt].x2 = spans[i].x2;
+                rects[rect_cnt].y2 = y2;
+                rect_cnt++;
             }
+        }
+    }
+
+    /*Join the rectangles while it's cheap or there are too many of them*/
+    while(rect_cnt > 1) {
+        uint32_t new_cnt = join_cheapest(rects, rect_cnt, rect_cnt > LV_INV_BUF_SIZE ? UINT32_MAX : JOIN_EXTRA_PX_MAX);
+        if(new_cnt == rect_cnt) break;
+        rect_cnt = new_cnt;
+    }
+
+    lv_memcpy(disp_refr->inv_areas, rects, sizeof(lv_area_t) * rect_cnt);
+    lv_memset_00(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
+    disp_refr->inv_p = rect_cnt;
+
+    /*The edges of joined areas can be anywhere, round them again*/
+    if(disp_refr->driver->rounder_cb) {
+        for(i = 0; i < rect_cnt; i++) disp_refr->driver->rounder_cb(disp_refr->driver, &disp_refr->inv_areas[i]);
+    }
+
+    lv_mem_buf_release(rects);
+    lv_mem_buf_release(spans);
+    lv_mem_buf_release(ys);
+}
 
-            _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+/**
+ * Get how many pixels would be drawn in vain if two areas were drawn as one
+ * @param a1    an area
+ * @param a2    an other area
+ * @return      pixels of the joined area not covered by any of them
+ */
+static uint32_t join_extra_px(const lv_area_t * a1, const lv_area_t * a2)
+{
+    lv_area_t joined;
+    _lv_area_join(&joined, a1, a2);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+    uint32_t covered = lv_area_get_size(a1) + lv_area_get_size(a2);
+    lv_area_t common;
+    if(_lv_area_intersect(&common, a1, a2)) covered -= lv_area_get_size(&common);
+
+    return lv_area_get_size(&joined) - covered;
+}
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+/**
+ * Join the two areas which are the cheapest to draw as one and drop the areas the result covers
+ * @param areas     array of areas, the order of the others is kept
+ * @param cnt       number of areas
+ * @param extra_max join only if it costs at most this many extra pixels
+ * @return          the new number of areas, `cnt` if nothing was joined
+ */
+static uint32_t join_cheapest(lv_area_t * areas, uint32_t cnt, uint32_t extra_max)
+{
+    uint32_t best_extra = UINT32_MAX;
+    uint32_t best_i = 0;
+    uint32_t best_j = 0;
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < cnt; i++) {
+        for(j = i + 1; j < cnt; j++) {
+            uint32_t extra = join_extra_px(&areas[i], &areas[j]);
+            if(extra < best_extra) {
+                best_extra = extra;
+                best_i = i;
+                best_j = j;
             }
         }
     }
+
+    if(cnt < 2 || best_extra > extra_max) return cnt;
+
+    lv_area_t joined;
+    _lv_area_join(&joined, &areas[best_i], &areas[best_j]);
+    areas[best_i] = joined;
+
+    uint32_t new_cnt = 0;
+    for(i = 0; i < cnt; i++) {
+        if(i != best_i && _lv_area_is_in(&areas[i], &joined, 0)) continue;
+        areas[new_cnt++] = areas[i];
+    }
+
+    return new_cnt;
+}
+
+/**
+ * Make room among the rectangles of `lv_refr_join_area()` by joining two which end above a slab.
+ * The ones reaching into the slab can still grow in it, and joined with an other one they could cover
+ * a range of the slab which gets its own rectangle later. They are at most as many as the ranges of
+ * a slab, so at most `LV_INV_BUF_SIZE`, and the others are enough to join.
+ * @param rects     array of rectangles, reordered
+ * @param cnt       number of rectangles
+ * @param y         first row of the slab
+ * @return          the new number of rectangles
+ */
+static uint32_t join_above(lv_area_t * rects, uint32_t cnt, lv_coord_t y)
+{
+    /*Move the rectangles above the slab to the front*/
+    uint32_t above_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(rects[i].y2 >= y) continue;
+        lv_area_t tmp = rects[above_cnt];
+        rects[above_cnt] = rects[i];
+        rects[i] = tmp;
+        above_cnt++;
+    }
+
+    /*Can't happen with JOIN_RECT_MAX above LV_INV_BUF_SIZE, but joining any two is still better than losing one*/
+    if(above_cnt < 2) return join_cheapest(rects, cnt, UINT32_MAX);
+
+    uint32_t new_cnt = join_cheapest(rects, above_cnt, UINT32_MAX);
+    for(i = above_cnt; i < cnt; i++) rects[new_cnt++] = rects[i];
+
+    return new_cnt;
 }
 
 /**
@@ -607,13 +842,21 @@ static void refr_invalid_areas(void)
     disp_refr->driver->draw_buf->last_part = 0;
     disp_refr->rendering_in_progress = true;
 
+#if LV_USE_PARALLEL_REFR
+    bool parallel = refr_parallel();
+#else
+    bool parallel = false;
+#endif
+
     for(i = 0; i < disp_refr->inv_p; i++) {
         /*Refresh the unjoined areas*/
         if(disp_refr->inv_area_joined[i] == 0) {
 
-            if(i == last_i) disp_refr->driver->draw_buf->last_area = 1;
-            disp_refr->driver->draw_buf->last_part = 0;
-            refr_area(&disp_refr->inv_areas[i]);
+            if(!parallel) {
+                if(i == last_i) disp_refr->driver->draw_buf->last_area = 1;
+                disp_refr->driver->draw_buf->last_part = 0;
+                refr_area(&disp_refr->inv_areas[i]);
+            }
 
             px_num += lv_area_get_size(&disp_refr->inv_areas[i]);
         }
@@ -658,7 +901,7 @@ static void refr_area(const lv_area_t * area_p)
     lv_coord_t y2 = area_p->y2 >= lv_disp_get_ver_res(disp_refr) ?
                     lv_disp_get_ver_res(disp_refr) - 1 : area_p->y2;
 
-    int32_t max_row = get_max_row(disp_refr, w, h);
+    int32_t max_row = get_max_row(disp_refr, disp_refr->driver->draw_buf->size, w, h);
 
     lv_coord_t row;
     lv_coord_t row_last = 0;
@@ -723,6 +966,17 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
 #endif
     }
 
+    refr_area_content(draw_ctx);
+
+    draw_buf_flush(disp_refr);
+}
+
+/**
+ * Draw the screens and layers on the area of `draw_ctx`
+ * @param draw_ctx  draw context with the buffer and area to draw
+ */
+static void refr_area_content(lv_draw_ctx_t * draw_ctx)
+{
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
@@ -792,10 +1046,245 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     /*Also refresh top and sys layer unconditionally*/
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_top(disp_refr));
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp_refr));
+}
 
-    draw_buf_flush(disp_refr);
+#if LV_USE_PARALLEL_REFR
+/**
+ * Refresh the invalidated areas on all the rendering threads if the display allows it.
+ * The areas are cut into bands, each thread renders bands into its own slice of the draw buffer(s)
+ * and flushes them as soon as they are ready. The calling thread renders too and returns when all bands are done,
+ * so the object tree is not modified while the workers read it.
+ * @return true: the areas are refreshed; false: refresh them with `refr_area()`
+ */
+static bool refr_parallel(void)
+{
+    lv_disp_drv_t * drv = disp_refr->driver;
+    lv_disp_draw_buf_t * draw_buf = drv->draw_buf;
+
+    if(drv->single_thread_refr || drv->full_refresh || drv->direct_mode) return false;
+    if(drv->sw_rotate && drv->rotated != LV_DISP_ROT_NONE) return false;
+    if(draw_buf->buf1 == NULL || drv->draw_ctx == NULL || drv->draw_ctx_size == 0) return false;
+
+    if(!par.inited) {
+        if(lv_mutex_init(&par.band_lock) != LV_RES_OK) return false;
+        if(lv_mutex_init(&par.flush_lock) != LV_RES_OK) {
+            lv_mutex_delete(&par.band_lock);
+            return false;
+        }
+        par.inited = true;
+    }
+
+    /*Start the workers on the first use and give them a draw context like the driver's*/
+    uint32_t thread_cnt = 1;
+    uint32_t i;
+    for(i = 1; i <= par.worker_max; i++) {
+        refr_worker_t * w = &workers[i];
+        if(!w->running) {
+            if(refr_worker_start(w, i) != LV_RES_OK) {
+                LV_LOG_WARN("Couldn't start rendering thread %d, using %d threads", (int)i, (int)i);
+                par.worker_max = i - 1;
+                break;
+            }
+            w->running = true;
+        }
+
+        if(w->draw_ctx_size != drv->draw_ctx_size) {
+            lv_mem_free(w->draw_ctx);
+            w->draw_ctx = lv_mem_alloc(drv->draw_ctx_size);
+            w->draw_ctx_size = w->draw_ctx ? drv->draw_ctx_size : 0;
+            if(w->draw_ctx == NULL) break;
+        }
+        thread_cnt++;
+    }
+
+    /*Each thread gets an equal slice of a buffer*/
+    par.buf_cnt = draw_buf->buf2 ? 2 : 1;
+    par.slice_size = draw_buf->size / ((thread_cnt + par.buf_cnt - 1) / par.buf_cnt);
+
+    /*Count the bands to know which flush is the last one*/
+    uint32_t band_cnt = 0;
+    lv_coord_t ver_res = lv_disp_get_ver_res(disp_refr);
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i]) continue;
+
+        const lv_area_t * area = &disp_refr->inv_areas[i];
+        lv_coord_t h = LV_MIN(area->y2, ver_res - 1) - area->y1 + 1;
+        int32_t max_row = get_max_row(disp_refr, par.slice_size, lv_area_get_width(area), h);
+        if(max_row <= 0) return false;
+
+        par.max_rows[i] = max_row;
+        band_cnt += (h + max_row - 1) / max_row;
+    }
+    if(thread_cnt < 2 || band_cnt < 2) return false;
+
+    /*The slices can overlap the buffer of the previous refresh's last flush*/
+    while(draw_buf->flushing) {
+        if(drv->wait_cb) drv->wait_cb(drv);
+    }
+
+    par.drv = drv;
+    par.area_i = 0;
+    par.row = disp_refr->inv_areas[0].y1;
+    par.bands_left = band_cnt;
+    par.flush_cnt = 0;
+    lv_memset_00(par.slice_flush, sizeof(par.slice_flush));
+    par.last_buf = NULL;
+
+    for(i = 1; i < thread_cnt; i++) {
+        refr_worker_t * w = &workers[i];
+        w->disp = *disp_refr;
+        w->drv = *drv;
+        lv_memcpy(w->draw_ctx, drv->draw_ctx, drv->draw_ctx_size);
+        w->drv.draw_ctx = w->draw_ctx;
+        w->disp.driver = &w->drv;
+        lv_thread_sync_signal(&w->start);
+    }
+
+    refr_bands(drv->draw_ctx);
+
+    for(i = 1; i < thread_cnt; i++) {
+        lv_thread_sync_wait(&workers[i].done);
+    }
+
+    /*Continue in the buffer which is not being flushed*/
+    if(draw_buf->buf2) {
+        draw_buf->buf_act = par.last_buf == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+    }
+
+    return true;
 }
 
+/**
+ * Create the events of a worker and start its thread. Nothing is kept if any of them fails.
+ * @param w     the worker
+ * @param id    its `LV_THREAD_ID`
+ * @return      LV_RES_OK: the worker is waiting for its first band; LV_RES_INV: it couldn't be started
+ */
+static lv_res_t refr_worker_start(refr_worker_t * w, uint8_t id)
+{
+    if(lv_thread_sync_init(&w->start) != LV_RES_OK) return LV_RES_INV;
+    if(lv_thread_sync_init(&w->done) != LV_RES_OK) {
+        lv_thread_sync_delete(&w->start);
+        return LV_RES_INV;
+    }
+    if(lv_thread_init(&w->thread, refr_worker_cb, w, id) != LV_RES_OK) {
+        lv_thread_sync_delete(&w->done);
+        lv_thread_sync_delete(&w->start);
+        return LV_RES_INV;
+    }
+    return LV_RES_OK;
+}
+
+static void refr_worker_cb(void * user_data)
+{
+    refr_worker_t * w = user_data;
+
+    while(1) {
+        lv_thread_sync_wait(&w->start);
+
+        disp_refr = &w->disp;
+        refr_bands(w->draw_ctx);
+
+        /*Free what this thread used for rendering*/
+        lv_mem_buf_free_all();
+        _lv_font_clean_up_fmt_txt();
+#if LV_DRAW_COMPLEX
+        _lv_draw_mask_cleanup();
+#endif
+
+        lv_thread_sync_signal(&w->done);
+    }
+}
+
+/**
+ * Render and flush bands in the slice of the calling thread until all bands are taken
+ * @param draw_ctx  the draw context of the calling thread
+ */
+static void refr_bands(lv_draw_ctx_t * draw_ctx)
+{
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
+    uint32_t id = LV_THREAD_ID;
+    void * slice_buf = id % par.buf_cnt == 0 ? draw_buf->buf1 : draw_buf->buf2;
+    lv_color_t * buf = (lv_color_t *)slice_buf + (id / par.buf_cnt) * par.slice_size;
+
+    lv_area_t band;
+    while(refr_next_band(&band)) {
+        /*Wait until the previous band of this slice is flushed*/
+        lv_mutex_lock(&par.flush_lock);
+        while(draw_buf->flushing && par.flush_cnt == par.slice_flush[id]) {
+            if(par.drv->wait_cb) par.drv->wait_cb(par.drv);
+        }
+        lv_mutex_unlock(&par.flush_lock);
+
+        draw_ctx->buf = buf;
+        draw_ctx->buf_area = &band;
+        draw_ctx->clip_area = &band;
+        if(draw_ctx->init_buf) draw_ctx->init_buf(draw_ctx);
+
+#if LV_COLOR_SCREEN_TRANSP
+        if(disp_refr->driver->screen_transp) {
+            uint32_t size = lv_area_get_size(&band);
+            if(par.drv->clear_cb) par.drv->clear_cb(par.drv, (uint8_t *)buf, size);
+            else lv_memset_00(buf, size * LV_IMG_PX_SIZE_ALPHA_BYTE);
+        }
+#endif
+
+        refr_area_content(draw_ctx);
+        if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
+
+        /*Flush one band at a time as `flushing` can't tell which one is ready*/
+        lv_mutex_lock(&par.flush_lock);
+        while(draw_buf->flushing) {
+            if(par.drv->wait_cb) par.drv->wait_cb(par.drv);
+        }
+
+        par.bands_left--;
+        bool last = par.bands_left == 0;
+        draw_buf->last_area = last;
+        draw_buf->last_part = last;
+        draw_buf->flushing = 1;
+        draw_buf->flushing_last = last;
+        par.flush_cnt++;
+        par.slice_flush[id] = par.flush_cnt;
+        par.last_buf = slice_buf;
+        if(par.drv->flush_cb) call_flush_cb(par.drv, &band, buf);
+        lv_mutex_unlock(&par.flush_lock);
+    }
+}
+
+/**
+ * Take the next band to render
+ * @param band  store the area of the band here
+ * @return      true: `band` is set; false: all bands are taken
+ */
+static bool refr_next_band(lv_area_t * band)
+{
+    bool res = false;
+    lv_coord_t ver_res = lv_disp_get_ver_res(disp_refr);
+
+    lv_mutex_lock(&par.band_lock);
+    while(par.area_i < disp_refr->inv_p) {
+        const lv_area_t * area = &disp_refr->inv_areas[par.area_i];
+        lv_coord_t y2 = LV_MIN(area->y2, ver_res - 1);
+        if(disp_refr->inv_area_joined[par.area_i] == 0 && par.row <= y2) {
+            band->x1 = area->x1;
+            band->x2 = area->x2;
+            band->y1 = par.row;
+            band->y2 = LV_MIN(par.row + par.max_rows[par.area_i] - 1, y2);
+            par.row = band->y2 + 1;
+            res = true;
+            break;
+        }
+
+        par.area_i++;
+        if(par.area_i < disp_refr->inv_p) par.row = disp_refr->inv_areas[par.area_i].y1;
+    }
+    lv_mutex_unlock(&par.band_lock);
+
+    return res;
+}
+#endif /*LV_USE_PARALLEL_REFR*/
+
 /**
  * Search the most top object which fully covers an area
  * @param area_p pointer to an area
@@ -1046,14 +1535,14 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     }
 }
 
-static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h)
+static uint32_t get_max_row(lv_disp_t * disp, uint32_t buf_size, lv_coord_t area_w, lv_coord_t area_h)
 {
-    int32_t max_row = (uint32_t)disp->driver->draw_buf->size / area_w;
+    int32_t max_row = buf_size / area_w;
 
     if(max_row > area_h) max_row = area_h;
 
     /*Round down the lines of draw_buf if rounding is added*/
-    if(disp_refr->driver->rounder_cb) {
+    if(disp->driver->rounder_cb) {
         lv_area_t tmp;
         tmp.x1 = 0;
         tmp.x2 = 0;
@@ -1062,7 +1551,7 @@ static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area
         lv_coord_t h_tmp = max_row;
         do {
             tmp.y2 = h_tmp - 1;
-            disp_refr->driver->rounder_cb(disp_refr->driver, &tmp);
+            disp->driver->rounder_cb(disp->driver, &tmp);
 
             /*If this height fits into `max_row` then fine*/
             if(lv_area_get_height(&tmp) <= max_row) break;
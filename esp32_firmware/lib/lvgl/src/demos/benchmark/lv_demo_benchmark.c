@@ -58,6 +58,10 @@ typedef struct {
     uint32_t time_sum_opa;
     uint32_t refr_cnt_normal;
     uint32_t refr_cnt_opa;
+    uint32_t px_refr_normal;    /*Pixels rendered*/
+    uint32_t px_refr_opa;
+    uint32_t px_inv_normal;     /*Pixels invalidated, i.e. which could have changed*/
+    uint32_t px_inv_opa;
     uint32_t fps_normal;
     uint32_t fps_opa;
     uint8_t weight;
@@ -75,20 +79,21 @@ static uint32_t disp_ori_timer_period;
 static uint32_t anim_ori_timer_period;
 
 #if LV_DEMO_BENCHMARK_RGB565A8 && LV_COLOR_DEPTH == 16
-    LV_IMG_DECLARE(img_benchmark_cogwheel_rgb565a8);
+    LV_IMG_DECLARE(img_benchmark_cogwheel_rgb565a8)
 #else
-    LV_IMG_DECLARE(img_benchmark_cogwheel_argb);
+    LV_IMG_DECLARE(img_benchmark_cogwheel_argb)
 #endif
-LV_IMG_DECLARE(img_benchmark_cogwheel_rgb);
-LV_IMG_DECLARE(img_benchmark_cogwheel_chroma_keyed);
-LV_IMG_DECLARE(img_benchmark_cogwheel_indexed16);
-LV_IMG_DECLARE(img_benchmark_cogwheel_alpha16);
+LV_IMG_DECLARE(img_benchmark_cogwheel_rgb)
+LV_IMG_DECLARE(img_benchmark_cogwheel_chroma_keyed)
+LV_IMG_DECLARE(img_benchmark_cogwheel_indexed16)
+LV_IMG_DECLARE(img_benchmark_cogwheel_alpha16)
 
-LV_FONT_DECLARE(lv_font_benchmark_montserrat_12_compr_az);
-LV_FONT_DECLARE(lv_font_benchmark_montserrat_16_compr_az);
-LV_FONT_DECLARE(lv_font_benchmark_montserrat_28_compr_az);
+LV_FONT_DECLARE(lv_font_benchmark_montserrat_12_compr_az)
+LV_FONT_DECLARE(lv_font_benchmark_montserrat_16_compr_az)
+LV_FONT_DECLARE(lv_font_benchmark_montserrat_28_compr_az)
 
 static void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px);
+static void log_px(uint32_t px_refr, uint32_t px_inv, uint32_t refr_cnt);
 static void next_scene_timer_cb(lv_timer_t * timer);
 static void rect_create(lv_style_t * style);
 static void img_create(lv_style_t * style, const void * src, bool rotate, bool zoom, bool aa);
@@ -718,7 +723,7 @@ void lv_demo_benchmark_run_scene(int_fast16_t scene_no)
 {
     benchmark_init();
 
-    if(((scene_no >> 1) >= dimof(scenes))) {
+    if(scene_no < 0 || (size_t)(scene_no >> 1) >= dimof(scenes)) {
         /* invalid scene number */
         return ;
     }
@@ -757,19 +762,33 @@ void lv_demo_benchmark_set_max_speed(bool en)
 static void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px)
 {
     LV_UNUSED(drv);
-    LV_UNUSED(px);
+    uint32_t px_inv = _lv_refr_get_disp_refreshing()->inv_px;
     if(opa_mode) {
         scenes[scene_act].refr_cnt_opa ++;
         scenes[scene_act].time_sum_opa += time;
+        scenes[scene_act].px_refr_opa += px;
+        scenes[scene_act].px_inv_opa += px_inv;
     }
     else {
         scenes[scene_act].refr_cnt_normal ++;
         scenes[scene_act].time_sum_normal += time;
+        scenes[scene_act].px_refr_normal += px;
+        scenes[scene_act].px_inv_normal += px_inv;
     }
 
     //    lv_obj_invalidate(lv_scr_act());
 }
 
+/*Pixels rendered per frame and how many of them were invalidated, the rest is overdraw of the joined areas*/
+static void log_px(uint32_t px_refr, uint32_t px_inv, uint32_t refr_cnt)
+{
+    LV_UNUSED(px_refr); /*Used only with logging*/
+    LV_UNUSED(px_inv);
+    if(refr_cnt == 0) return;
+    LV_LOG("Rendered %"LV_PRIu32" px/frame, %"LV_PRIu32"%% of them invalidated", px_refr / refr_cnt,
+           px_refr ? (uint32_t)(((uint64_t)px_inv * 100) / px_refr) : 100);
+}
+
 static void generate_report(void)
 {
     uint32_t weight_sum = 0;
@@ -944,6 +963,8 @@ static void generate_report(void)
 
 static void report_cb(lv_timer_t * timer)
 {
+    LV_UNUSED(timer);
+
     if(NULL != benchmark_finished_cb) {
         (*benchmark_finished_cb)();
     }
@@ -958,6 +979,7 @@ static void report_cb(lv_timer_t * timer)
                               scenes[scene_act].fps_opa);
         LV_LOG("Result of \"%s + opa\": %"LV_PRId32" FPS", scenes[scene_act].name,
                scenes[scene_act].fps_opa);
+        log_px(scenes[scene_act].px_refr_opa, scenes[scene_act].px_inv_opa, scenes[scene_act].refr_cnt_opa);
     }
     else {
         if(scenes[scene_act].time_sum_normal == 0) scenes[scene_act].time_sum_normal = 1;
@@ -967,6 +989,7 @@ static void report_cb(lv_timer_t * timer)
                               scenes[scene_act].fps_normal);
         LV_LOG("Result of \"%s\": %"LV_PRId32" FPS", scenes[scene_act].name,
                scenes[scene_act].fps_normal);
+        log_px(scenes[scene_act].px_refr_normal, scenes[scene_act].px_inv_normal, scenes[scene_act].refr_cnt_normal);
     }
 }
 
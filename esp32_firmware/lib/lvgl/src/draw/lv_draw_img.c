@@ -368,6 +368,8 @@ static void draw_cleanup(_lv_img_cache_entry_t * cache)
     /*Automatically close images with no caching*/
 #if LV_IMG_CACHE_DEF_SIZE == 0
     lv_img_decoder_close(&cache->dec_dsc);
+#elif LV_USE_PARALLEL_REFR
+    if(LV_THREAD_ID != 0) lv_img_decoder_close(&cache->dec_dsc);
 #else
     LV_UNUSED(cache);
 #endif
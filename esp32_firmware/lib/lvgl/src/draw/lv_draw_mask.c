@@ -83,7 +83,7 @@ int16_t lv_draw_mask_add(void * param, void * custom_id)
     /*Look for a free entry*/
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        if(LV_GC_ROOT(_lv_draw_mask_list[i]).param == NULL) break;
+        if(LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][i]).param == NULL) break;
     }
 
     if(i >= _LV_MASK_MAX_NUM) {
@@ -91,8 +91,8 @@ int16_t lv_draw_mask_add(void * param, void * custom_id)
         return LV_MASK_ID_INV;
     }
 
-    LV_GC_ROOT(_lv_draw_mask_list[i]).param = param;
-    LV_GC_ROOT(_lv_draw_mask_list[i]).custom_id = custom_id;
+    LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][i]).param = param;
+    LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][i]).custom_id = custom_id;
 
     return i;
 }
@@ -114,7 +114,7 @@ lv_draw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_mask_apply(lv_opa_t * mask_buf,
     bool changed = false;
     _lv_draw_mask_common_dsc_t * dsc;
 
-    _lv_draw_mask_saved_t * m = LV_GC_ROOT(_lv_draw_mask_list);
+    _lv_draw_mask_saved_t * m = LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID]);
 
     while(m->param) {
         dsc = m->param;
@@ -152,7 +152,7 @@ lv_draw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_mask_apply_ids(lv_opa_t * mask_
     for(int i = 0; i < ids_count; i++) {
         int16_t id = ids[i];
         if(id == LV_MASK_ID_INV) continue;
-        dsc = LV_GC_ROOT(_lv_draw_mask_list[id]).param;
+        dsc = LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][id]).param;
         if(!dsc) continue;
         lv_draw_mask_res_t res = LV_DRAW_MASK_RES_FULL_COVER;
         res = dsc->cb(mask_buf, abs_x, abs_y, len, dsc);
@@ -174,9 +174,9 @@ void * lv_draw_mask_remove_id(int16_t id)
     _lv_draw_mask_common_dsc_t * p = NULL;
 
     if(id != LV_MASK_ID_INV) {
-        p = LV_GC_ROOT(_lv_draw_mask_list[id]).param;
-        LV_GC_ROOT(_lv_draw_mask_list[id]).param = NULL;
-        LV_GC_ROOT(_lv_draw_mask_list[id]).custom_id = NULL;
+        p = LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][id]).param;
+        LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][id]).param = NULL;
+        LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][id]).custom_id = NULL;
     }
 
     return p;
@@ -193,8 +193,8 @@ void * lv_draw_mask_remove_custom(void * custom_id)
     _lv_draw_mask_common_dsc_t * p = NULL;
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        if(LV_GC_ROOT(_lv_draw_mask_list[i]).custom_id == custom_id) {
-            p = LV_GC_ROOT(_lv_draw_mask_list[i]).param;
+        if(LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][i]).custom_id == custom_id) {
+            p = LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][i]).param;
             lv_draw_mask_remove_id(i);
         }
     }
@@ -233,10 +233,10 @@ void _lv_draw_mask_cleanup(void)
 {
     uint8_t i;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).buf) {
-            lv_mem_free(LV_GC_ROOT(_lv_circle_cache[i]).buf);
+        if(LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i]).buf) {
+            lv_mem_free(LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i]).buf);
         }
-        lv_memset_00(&LV_GC_ROOT(_lv_circle_cache[i]), sizeof(LV_GC_ROOT(_lv_circle_cache[i])));
+        lv_memset_00(&LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i]), sizeof(LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i])));
     }
 }
 
@@ -249,21 +249,21 @@ uint8_t LV_ATTRIBUTE_FAST_MEM lv_draw_mask_get_cnt(void)
     uint8_t cnt = 0;
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        if(LV_GC_ROOT(_lv_draw_mask_list[i]).param) cnt++;
+        if(LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][i]).param) cnt++;
     }
     return cnt;
 }
 
 bool lv_draw_mask_is_any(const lv_area_t * a)
 {
-    if(a == NULL) return LV_GC_ROOT(_lv_draw_mask_list[0]).param ? true : false;
+    if(a == NULL) return LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][0]).param ? true : false;
 
     uint8_t i;
     for(i = 0; i < _LV_MASK_MAX_NUM; i++) {
-        _lv_draw_mask_common_dsc_t * comm_param = LV_GC_ROOT(_lv_draw_mask_list[i]).param;
+        _lv_draw_mask_common_dsc_t * comm_param = LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][i]).param;
         if(comm_param == NULL) continue;
         if(comm_param->type == LV_DRAW_MASK_TYPE_RADIUS) {
-            lv_draw_mask_radius_param_t * radius_param = LV_GC_ROOT(_lv_draw_mask_list[i]).param;
+            lv_draw_mask_radius_param_t * radius_param = LV_GC_ROOT(_lv_draw_mask_list[LV_THREAD_ID][i]).param;
             if(radius_param->cfg.outer) {
                 if(!_lv_area_is_out(a, &radius_param->cfg.rect, radius_param->cfg.radius)) return true;
             }
@@ -495,10 +495,10 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
 
     /*Try to reuse a circle cache entry*/
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).radius == radius) {
-            LV_GC_ROOT(_lv_circle_cache[i]).used_cnt++;
-            CIRCLE_CACHE_AGING(LV_GC_ROOT(_lv_circle_cache[i]).life, radius);
-            param->circle = &LV_GC_ROOT(_lv_circle_cache[i]);
+        if(LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i]).radius == radius) {
+            LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i]).used_cnt++;
+            CIRCLE_CACHE_AGING(LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i]).life, radius);
+            param->circle = &LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i]);
             return;
         }
     }
@@ -506,9 +506,9 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
     /*If not found find a free entry with lowest life*/
     _lv_draw_mask_radius_circle_dsc_t * entry = NULL;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).used_cnt == 0) {
-            if(!entry) entry = &LV_GC_ROOT(_lv_circle_cache[i]);
-            else if(LV_GC_ROOT(_lv_circle_cache[i]).life < entry->life) entry = &LV_GC_ROOT(_lv_circle_cache[i]);
+        if(LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i]).used_cnt == 0) {
+            if(!entry) entry = &LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i]);
+            else if(LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i]).life < entry->life) entry = &LV_GC_ROOT(_lv_circle_cache[LV_THREAD_ID][i]);
         }
     }
 
@@ -17,6 +17,7 @@ extern "C" {
 #include "../misc/lv_area.h"
 #include "../misc/lv_color.h"
 #include "../misc/lv_math.h"
+#include "../misc/lv_thread.h"
 
 /*********************
  *      DEFINES
@@ -46,7 +47,7 @@ typedef struct {
     void * custom_id;
 } _lv_draw_mask_saved_t;
 
-typedef _lv_draw_mask_saved_t _lv_draw_mask_saved_arr_t[_LV_MASK_MAX_NUM];
+typedef _lv_draw_mask_saved_t _lv_draw_mask_saved_arr_t[LV_THREAD_CNT][_LV_MASK_MAX_NUM];
 
 #if LV_DRAW_COMPLEX == 0
 static inline  uint8_t lv_draw_mask_get_cnt(void)
@@ -160,7 +161,7 @@ typedef struct  {
     lv_coord_t radius;          /*The radius of the entry*/
 } _lv_draw_mask_radius_circle_dsc_t;
 
-typedef _lv_draw_mask_radius_circle_dsc_t _lv_draw_mask_radius_circle_dsc_arr_t[LV_CIRCLE_CACHE_SIZE];
+typedef _lv_draw_mask_radius_circle_dsc_t _lv_draw_mask_radius_circle_dsc_arr_t[LV_THREAD_CNT][LV_CIRCLE_CACHE_SIZE];
 
 typedef struct {
     /*The first element must be the common descriptor*/
@@ -284,7 +285,7 @@ void lv_draw_mask_free_param(void * p);
 
 /**
  * Called by LVGL the rendering of a screen is ready to clean up
- * the temporal (cache) data of the masks
+ * the temporal (cache) data of the masks of the calling thread
  */
 void _lv_draw_mask_cleanup(void);
 
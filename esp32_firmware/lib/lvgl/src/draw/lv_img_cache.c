@@ -36,6 +36,8 @@
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
 #endif
+static _lv_img_cache_entry_t * open_entry(_lv_img_cache_entry_t * cached_src, const void * src, lv_color_t color,
+                                          int32_t frame_id);
 
 /**********************
  *  STATIC VARIABLES
@@ -66,6 +68,11 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     _lv_img_cache_entry_t * cached_src = NULL;
 
 #if LV_IMG_CACHE_DEF_SIZE
+#if LV_USE_PARALLEL_REFR
+    /*The cache belongs to the thread of `lv_timer_handler()`, the other rendering threads open the images uncached*/
+    if(LV_THREAD_ID != 0) return open_entry(&LV_GC_ROOT(_lv_img_cache_single)[LV_THREAD_ID], src, color, frame_id);
+#endif
+
     if(entry_cnt == 0) {
         LV_LOG_WARN("lv_img_cache_open: the cache size is 0");
         return NULL;
@@ -116,28 +123,10 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
         LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
     }
 #else
-    cached_src = &LV_GC_ROOT(_lv_img_cache_single);
+    cached_src = &LV_GC_ROOT(_lv_img_cache_single)[LV_THREAD_ID];
 #endif
-    /*Open the image and measure the time to open*/
-    uint32_t t_start  = lv_tick_get();
-    lv_res_t open_res = lv_img_decoder_open(&cached_src->dec_dsc, src, color, frame_id);
-    if(open_res == LV_RES_INV) {
-        LV_LOG_WARN("Image draw cannot open the image resource");
-        lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
-        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its us*/
-        return NULL;
-    }
 
-    cached_src->life = 0;
-
-    /*If `time_to_open` was not set in the open function set it here*/
-    if(cached_src->dec_dsc.time_to_open == 0) {
-        cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
-    }
-
-    if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
-
-    return cached_src;
+    return open_entry(cached_src, src, color, frame_id);
 }
 
 /**
@@ -181,6 +170,11 @@ void lv_img_cache_invalidate_src(const void * src)
 {
     LV_UNUSED(src);
 #if LV_IMG_CACHE_DEF_SIZE
+#if LV_USE_PARALLEL_REFR
+    /*The other rendering threads don't put images into the cache*/
+    if(LV_THREAD_ID != 0) return;
+#endif
+
     _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
 
     uint16_t i;
@@ -213,3 +207,28 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
     return strcmp(src1, src2) == 0;
 }
 #endif
+
+static _lv_img_cache_entry_t * open_entry(_lv_img_cache_entry_t * cached_src, const void * src, lv_color_t color,
+                                          int32_t frame_id)
+{
+    /*Open the image and measure the time to open*/
+    uint32_t t_start  = lv_tick_get();
+    lv_res_t open_res = lv_img_decoder_open(&cached_src->dec_dsc, src, color, frame_id);
+    if(open_res == LV_RES_INV) {
+        LV_LOG_WARN("Image draw cannot open the image resource");
+        lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
+        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its us*/
+        return NULL;
+    }
+
+    cached_src->life = 0;
+
+    /*If `time_to_open` was not set in the open function set it here*/
+    if(cached_src->dec_dsc.time_to_open == 0) {
+        cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
+    }
+
+    if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
+
+    return cached_src;
+}
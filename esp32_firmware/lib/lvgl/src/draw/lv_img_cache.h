@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "lv_img_decoder.h"
+#include "../misc/lv_thread.h"
 
 /*********************
  *      DEFINES
@@ -37,6 +38,9 @@ typedef struct {
     int32_t life;
 } _lv_img_cache_entry_t;
 
+/*An entry for every rendering thread, used for the images opened without caching*/
+typedef _lv_img_cache_entry_t _lv_img_cache_single_arr_t[LV_THREAD_CNT];
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
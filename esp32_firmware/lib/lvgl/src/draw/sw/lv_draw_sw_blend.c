@@ -8,6 +8,7 @@
  *********************/
 #include "lv_draw_sw.h"
 #include "../../misc/lv_math.h"
+#include "../../misc/lv_thread.h"
 #include "../../hal/lv_hal_disp.h"
 #include "../../core/lv_refr.h"
 
@@ -404,10 +405,10 @@ static inline void set_px_argb(uint8_t * buf, lv_color_t color, lv_opa_t opa)
 static inline void set_px_argb_blend(uint8_t * buf, lv_color_t color, lv_opa_t opa, lv_color_t (*blend_fp)(lv_color_t,
                                                                                                            lv_color_t, lv_opa_t))
 {
-    static lv_color_t last_dest_color;
-    static lv_color_t last_src_color;
-    static lv_color_t last_res_color;
-    static uint32_t last_opa = 0xffff; /*Set to an invalid value for first*/
+    static LV_THREAD_LOCAL lv_color_t last_dest_color;
+    static LV_THREAD_LOCAL lv_color_t last_src_color;
+    static LV_THREAD_LOCAL lv_color_t last_res_color;
+    static LV_THREAD_LOCAL uint32_t last_opa = 0xffff; /*Set to an invalid value for first*/
 
     lv_color_t bg_color;
 
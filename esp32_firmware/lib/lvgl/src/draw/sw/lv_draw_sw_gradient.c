@@ -9,6 +9,7 @@
 #include "lv_draw_sw_gradient.h"
 #include "../../misc/lv_gc.h"
 #include "../../misc/lv_types.h"
+#include "../../misc/lv_thread.h"
 
 /*********************
  *      DEFINES
@@ -168,15 +169,15 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord
 #endif
 #endif
 
-    size_t act_size = (size_t)(grad_cache_end - LV_GC_ROOT(_lv_grad_cache_mem));
+    size_t act_size = LV_THREAD_ID == 0 ? (size_t)(grad_cache_end - LV_GC_ROOT(_lv_grad_cache_mem)) : 0;
     lv_grad_t * item = NULL;
-    if(req_size + act_size < grad_cache_size) {
+    if(LV_THREAD_ID == 0 && req_size + act_size < grad_cache_size) {
         item = (lv_grad_t *)grad_cache_end;
         item->not_cached = 0;
     }
     else {
         /*Need to evict items from cache until we find enough space to allocate this one */
-        if(req_size <= grad_cache_size) {
+        if(LV_THREAD_ID == 0 && req_size <= grad_cache_size) {
             while(act_size + req_size > grad_cache_size) {
                 uint32_t oldest_life = UINT32_MAX;
                 iterate_cache(&find_oldest_item_life, &oldest_life, NULL);
@@ -251,9 +252,10 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
-    /* Step 0: Check if the cache exist (else create it) */
+    /* Step 0: Check if the cache exist (else create it).
+     * The cache is used only by the thread of `lv_timer_handler()`, the others allocate a map for every draw*/
     static bool inited = false;
-    if(!inited) {
+    if(LV_THREAD_ID == 0 && !inited) {
         lv_gradient_set_cache_size(LV_GRAD_CACHE_DEF_SIZE);
         inited = true;
     }
@@ -262,7 +264,7 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
     lv_coord_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
     uint32_t key = compute_key(g, size, w);
     lv_grad_t * item = NULL;
-    if(iterate_cache(&find_item, &key, &item) == LV_RES_OK) {
+    if(LV_THREAD_ID == 0 && iterate_cache(&find_item, &key, &item) == LV_RES_OK) {
         item->life++; /* Don't forget to bump the counter */
         return item;
     }
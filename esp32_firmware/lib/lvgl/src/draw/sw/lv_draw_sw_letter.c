@@ -11,6 +11,7 @@
 #include "../../misc/lv_math.h"
 #include "../../misc/lv_assert.h"
 #include "../../misc/lv_area.h"
+#include "../../misc/lv_thread.h"
 #include "../../misc/lv_style.h"
 #include "../../font/lv_font.h"
 #include "../../core/lv_refr.h"
@@ -217,19 +218,22 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
             return; /*Invalid bpp. Can't render the letter*/
     }
 
-    static lv_opa_t opa_table[256];
-    static lv_opa_t prev_opa = LV_OPA_TRANSP;
-    static uint32_t prev_bpp = 0;
+    static struct {
+        lv_opa_t table[256];
+        lv_opa_t prev_opa;
+        uint32_t prev_bpp;
+    } opa_tables[LV_THREAD_CNT];    /*Zero initialized: LV_OPA_TRANSP and no bpp*/
+    lv_opa_t * opa_table = opa_tables[LV_THREAD_ID].table;
     if(opa < LV_OPA_MAX) {
-        if(prev_opa != opa || prev_bpp != bpp) {
+        if(opa_tables[LV_THREAD_ID].prev_opa != opa || opa_tables[LV_THREAD_ID].prev_bpp != bpp) {
             uint32_t i;
             for(i = 0; i < shades; i++) {
                 opa_table[i] = bpp_opa_table_p[i] == LV_OPA_COVER ? opa : ((bpp_opa_table_p[i] * opa) >> 8);
             }
         }
         bpp_opa_table_p = opa_table;
-        prev_opa = opa;
-        prev_bpp = bpp;
+        opa_tables[LV_THREAD_ID].prev_opa = opa;
+        opa_tables[LV_THREAD_ID].prev_bpp = bpp;
     }
 
     int32_t col, row;
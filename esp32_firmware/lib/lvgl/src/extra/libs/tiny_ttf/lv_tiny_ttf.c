@@ -3,6 +3,7 @@
 #if LV_USE_TINY_TTF
 #include <stdio.h>
 #include "../../../misc/lv_lru.h"
+#include "../../../misc/lv_thread.h"
 
 #define STB_RECT_PACK_IMPLEMENTATION
 #define STBRP_STATIC
@@ -75,6 +76,13 @@ typedef struct ttf_font_desc {
     int ascent;
     int descent;
     lv_lru_t * bitmap_cache;
+#if LV_USE_PARALLEL_REFR
+    /*The rendering threads take turns on the stream and the cache. Only the thread of `lv_timer_handler()`
+     *adds bitmaps to the cache, the others copy them to their own buffer, so a bitmap being drawn stays valid*/
+    lv_mutex_t lock;
+    uint8_t * thread_bufs[LV_THREAD_CNT];
+    size_t thread_buf_sizes[LV_THREAD_CNT];
+#endif
 } ttf_font_desc_t;
 
 typedef struct ttf_bitmap_cache_key {
@@ -149,6 +157,26 @@ static const uint8_t * ttf_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t
     cache_key.line_height = font->line_height;
     uint8_t * buffer = NULL;
     lv_lru_get(dsc->bitmap_cache, &cache_key, sizeof(cache_key), (void **)&buffer);
+#if LV_USE_PARALLEL_REFR
+    if(LV_THREAD_ID != 0) {
+        size_t size = h * stride;
+        uint8_t id = LV_THREAD_ID;
+        if(dsc->thread_buf_sizes[id] < size) {
+            lv_mem_free(dsc->thread_bufs[id]);
+            dsc->thread_bufs[id] = lv_mem_alloc(size);
+            dsc->thread_buf_sizes[id] = dsc->thread_bufs[id] ? size : 0;
+            if(dsc->thread_bufs[id] == NULL) return NULL;
+        }
+        if(buffer) {
+            lv_memcpy(dsc->thread_bufs[id], buffer, size);
+        }
+        else {
+            lv_memset(dsc->thread_bufs[id], 0, size);
+            stbtt_MakeGlyphBitmap(info, dsc->thread_bufs[id], w, h, stride, dsc->scale, dsc->scale, g1);
+        }
+        return dsc->thread_bufs[id];
+    }
+#endif
     if(buffer) {
         return buffer;
     }
@@ -171,6 +199,27 @@ static const uint8_t * ttf_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t
     return buffer;
 }
 
+#if LV_USE_PARALLEL_REFR
+static bool ttf_get_glyph_dsc_locked_cb(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                                        uint32_t unicode_letter_next)
+{
+    ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
+    lv_mutex_lock(&dsc->lock);
+    bool res = ttf_get_glyph_dsc_cb(font, dsc_out, unicode_letter, unicode_letter_next);
+    lv_mutex_unlock(&dsc->lock);
+    return res;
+}
+
+static const uint8_t * ttf_get_glyph_bitmap_locked_cb(const lv_font_t * font, uint32_t unicode_letter)
+{
+    ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
+    lv_mutex_lock(&dsc->lock);
+    const uint8_t * res = ttf_get_glyph_bitmap_cb(font, unicode_letter);
+    lv_mutex_unlock(&dsc->lock);
+    return res;
+}
+#endif
+
 static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size_t data_size, lv_coord_t font_size,
                                       size_t cache_size)
 {
@@ -223,8 +272,20 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
         goto err_after_bitmap_cache;
     }
     lv_memset(out_font, 0, sizeof(lv_font_t));
+#if LV_USE_PARALLEL_REFR
+    if(lv_mutex_init(&dsc->lock) != LV_RES_OK) {
+        LV_LOG_ERROR("tiny_ttf: couldn't create the lock\n");
+        TTF_FREE(out_font);
+        goto err_after_bitmap_cache;
+    }
+    lv_memset_00(dsc->thread_bufs, sizeof(dsc->thread_bufs));
+    lv_memset_00(dsc->thread_buf_sizes, sizeof(dsc->thread_buf_sizes));
+    out_font->get_glyph_dsc = ttf_get_glyph_dsc_locked_cb;
+    out_font->get_glyph_bitmap = ttf_get_glyph_bitmap_locked_cb;
+#else
     out_font->get_glyph_dsc = ttf_get_glyph_dsc_cb;
     out_font->get_glyph_bitmap = ttf_get_glyph_bitmap_cb;
+#endif
     out_font->dsc = dsc;
     lv_tiny_ttf_set_size(out_font, font_size);
     return out_font;
@@ -276,6 +337,11 @@ void lv_tiny_ttf_destroy(lv_font_t * font)
             }
 #endif
             lv_lru_del(ttf->bitmap_cache);
+#if LV_USE_PARALLEL_REFR
+            uint32_t i;
+            for(i = 0; i < LV_THREAD_CNT; i++) lv_mem_free(ttf->thread_bufs[i]);
+            lv_mutex_delete(&ttf->lock);
+#endif
             TTF_FREE(ttf);
         }
         TTF_FREE(font);
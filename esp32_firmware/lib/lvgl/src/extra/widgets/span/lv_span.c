@@ -66,7 +66,7 @@ static lv_coord_t convert_indent_pct(lv_obj_t * spans, lv_coord_t width);
 /**********************
  *  STATIC VARIABLES
  **********************/
-static struct _snippet_stack snippet_stack;
+static struct _snippet_stack snippet_stacks[LV_THREAD_CNT];   /*Used while drawing, one for every rendering thread*/
 
 const lv_obj_class_t lv_spangroup_class  = {
     .base_class = &lv_obj_class,
@@ -619,9 +619,10 @@ static bool lv_txt_get_snippet(const char * txt, const lv_font_t * font,
 
 static void lv_snippet_push(lv_snippet_t * item)
 {
-    if(snippet_stack.index < LV_SPAN_SNIPPET_STACK_SIZE) {
-        memcpy(&snippet_stack.stack[snippet_stack.index], item, sizeof(lv_snippet_t));
-        snippet_stack.index++;
+    struct _snippet_stack * snippet_stack = &snippet_stacks[LV_THREAD_ID];
+    if(snippet_stack->index < LV_SPAN_SNIPPET_STACK_SIZE) {
+        memcpy(&snippet_stack->stack[snippet_stack->index], item, sizeof(lv_snippet_t));
+        snippet_stack->index++;
     }
     else {
         LV_LOG_ERROR("span draw stack overflow, please set LV_SPAN_SNIPPET_STACK_SIZE too larger");
@@ -630,17 +631,17 @@ static void lv_snippet_push(lv_snippet_t * item)
 
 static uint16_t lv_get_snippet_cnt(void)
 {
-    return snippet_stack.index;
+    return snippet_stacks[LV_THREAD_ID].index;
 }
 
 static lv_snippet_t * lv_get_snippet(uint16_t index)
 {
-    return &snippet_stack.stack[index];
+    return &snippet_stacks[LV_THREAD_ID].stack[index];
 }
 
 static void lv_snippet_clear(void)
 {
-    snippet_stack.index = 0;
+    snippet_stacks[LV_THREAD_ID].index = 0;
 }
 
 static const lv_font_t * lv_span_get_style_text_font(lv_obj_t * par, lv_span_t * span)
@@ -17,6 +17,7 @@ extern "C" {
 #include <stddef.h>
 #include <stdbool.h>
 #include "lv_font.h"
+#include "../misc/lv_thread.h"
 
 /*********************
  *      DEFINES
@@ -197,6 +198,9 @@ typedef struct {
     lv_font_fmt_txt_glyph_cache_t * cache;
 } lv_font_fmt_txt_dsc_t;
 
+/*Every rendering thread decompresses the glyphs into its own buffer*/
+typedef uint8_t * _lv_font_decompr_buf_arr_t[LV_THREAD_CNT];
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -221,7 +225,7 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
                                    uint32_t unicode_letter_next);
 
 /**
- * Free the allocated memories.
+ * Free the allocated memories of the calling thread.
  */
 void _lv_font_clean_up_fmt_txt(void);
 
@@ -101,6 +101,8 @@ typedef struct _lv_disp_drv_t {
                                        * Use only if required because it's slower.*/
 
     uint32_t dpi : 10;              /** DPI (dot per inch) of the display. Default value is `LV_DPI_DEF`.*/
+    uint32_t single_thread_refr : 1; /**< 1: render only on the thread of `lv_timer_handler()` even with
+                                       * `LV_USE_PARALLEL_REFR`, e.g. if `flush_cb` can't be called from other threads*/
 
     /** MANDATORY: Write the internal buffer (draw_buf) to the display. 'lv_disp_flush_ready()' has to be
      * called when finished*/
@@ -186,6 +188,7 @@ typedef struct _lv_disp_t {
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint16_t inv_p;
     int32_t inv_en_cnt;
+    uint32_t inv_px;    /**< Invalidated pixels of the last refresh, once where the areas overlap*/
 
     /** Double buffer sync areas */
     lv_ll_t sync_areas;
@@ -412,6 +412,57 @@
     #endif
 #endif
 
+/*Render the invalidated areas on more threads, e.g. on both cores of an ESP32-S3.
+ *The areas are cut into bands and every thread renders and flushes its bands in its own slice of the draw buffer(s).
+ *`flush_cb`, `wait_cb` and the widgets' draw events are called from the worker threads too,
+ *while the thread of `lv_timer_handler()` renders as well and waits for the frame to finish.
+ *The workers use a copy of the driver's draw context. Not used with `full_refresh`, `direct_mode`,
+ *software rotation and on displays with `single_thread_refr` set in their driver.*/
+#ifndef LV_USE_PARALLEL_REFR
+    #ifdef CONFIG_LV_USE_PARALLEL_REFR
+        #define LV_USE_PARALLEL_REFR CONFIG_LV_USE_PARALLEL_REFR
+    #else
+        #define LV_USE_PARALLEL_REFR 0
+    #endif
+#endif
+#if LV_USE_PARALLEL_REFR
+    /*Number of rendering threads, including the thread of `lv_timer_handler()`*/
+    #ifndef LV_PARALLEL_REFR_THREADS
+        #ifdef CONFIG_LV_PARALLEL_REFR_THREADS
+            #define LV_PARALLEL_REFR_THREADS CONFIG_LV_PARALLEL_REFR_THREADS
+        #else
+            #define LV_PARALLEL_REFR_THREADS 2
+        #endif
+    #endif
+
+    /*Threads to use: LV_OS_PTHREAD or LV_OS_FREERTOS*/
+    #ifndef LV_PARALLEL_REFR_OS
+        #ifdef CONFIG_LV_PARALLEL_REFR_OS
+            #define LV_PARALLEL_REFR_OS CONFIG_LV_PARALLEL_REFR_OS
+        #else
+            #define LV_PARALLEL_REFR_OS LV_OS_FREERTOS
+        #endif
+    #endif
+
+    /*Stack size of a worker thread in bytes*/
+    #ifndef LV_PARALLEL_REFR_STACK_SIZE
+        #ifdef CONFIG_LV_PARALLEL_REFR_STACK_SIZE
+            #define LV_PARALLEL_REFR_STACK_SIZE CONFIG_LV_PARALLEL_REFR_STACK_SIZE
+        #else
+            #define LV_PARALLEL_REFR_STACK_SIZE (8 * 1024)
+        #endif
+    #endif
+
+    /*Storage class of thread local variables*/
+    #ifndef LV_PARALLEL_REFR_THREAD_LOCAL
+        #ifdef CONFIG_LV_PARALLEL_REFR_THREAD_LOCAL
+            #define LV_PARALLEL_REFR_THREAD_LOCAL CONFIG_LV_PARALLEL_REFR_THREAD_LOCAL
+        #else
+            #define LV_PARALLEL_REFR_THREAD_LOCAL __thread
+        #endif
+    #endif
+#endif
+
 /*-------------
  * GPU
  *-----------*/
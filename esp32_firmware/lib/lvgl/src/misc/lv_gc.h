@@ -22,6 +22,7 @@ extern "C" {
 #include "../draw/lv_img_cache.h"
 #include "../draw/lv_draw_mask.h"
 #include "../core/lv_obj_pos.h"
+#include "../font/lv_font_fmt_txt.h"
 
 /*********************
  *      DEFINES
@@ -32,6 +33,14 @@ extern "C" {
 #    define LV_IMG_CACHE_DEF            0
 #endif
 
+/*Entries for images opened without the cache: every image without LV_IMG_CACHE_DEF_SIZE,
+ *else only the images of the parallel rendering threads*/
+#if LV_IMG_CACHE_DEF_SIZE == 0 || LV_USE_PARALLEL_REFR
+#    define LV_IMG_CACHE_SINGLE         1
+#else
+#    define LV_IMG_CACHE_SINGLE         0
+#endif
+
 #define LV_DISPATCH(f, t, n)            f(t, n)
 #define LV_DISPATCH_COND(f, t, n, m, v) LV_CONCAT3(LV_DISPATCH, m, v)(f, t, n)
 
@@ -51,14 +60,14 @@ extern "C" {
     LV_DISPATCH(f, lv_ll_t, _lv_obj_style_trans_ll)                                                    \
     LV_DISPATCH(f, lv_layout_dsc_t *, _lv_layout_list)                                                 \
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t*, _lv_img_cache_array, LV_IMG_CACHE_DEF, 1)              \
-    LV_DISPATCH_COND(f, _lv_img_cache_entry_t, _lv_img_cache_single, LV_IMG_CACHE_DEF, 0)              \
+    LV_DISPATCH_COND(f, _lv_img_cache_single_arr_t, _lv_img_cache_single, LV_IMG_CACHE_SINGLE, 1)     \
     LV_DISPATCH(f, lv_timer_t*, _lv_timer_act)                                                         \
     LV_DISPATCH(f, lv_mem_buf_arr_t , lv_mem_buf)                                                      \
     LV_DISPATCH_COND(f, _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1)  \
     LV_DISPATCH_COND(f, _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1)            \
     LV_DISPATCH(f, void * , _lv_theme_default_styles)                                                  \
     LV_DISPATCH(f, void * , _lv_theme_basic_styles)                                                  \
-    LV_DISPATCH_COND(f, uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)                    \
+    LV_DISPATCH_COND(f, _lv_font_decompr_buf_arr_t, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)   \
     LV_DISPATCH(f, uint8_t * , _lv_grad_cache_mem)                                                     \
     LV_DISPATCH(f, uint8_t * , _lv_style_custom_prop_flag_lookup_table)
 
@@ -12,6 +12,7 @@
 #include "lv_gc.h"
 #include "lv_assert.h"
 #include "lv_log.h"
+#include "lv_thread.h"
 
 #if LV_MEM_CUSTOM != 0
     #include LV_MEM_CUSTOM_INCLUDE
@@ -61,6 +62,11 @@
 
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
+#if LV_MEM_CUSTOM == 0 && LV_USE_PARALLEL_REFR
+    static lv_mutex_t tlsf_lock;    /*The rendering threads allocate too*/
+    static bool tlsf_lock_inited;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -76,6 +82,14 @@ static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variabl
 #define SET8(x) *d8 = x; d8++;
 #define REPEAT8(expr) expr expr expr expr expr expr expr expr
 
+#if LV_MEM_CUSTOM == 0 && LV_USE_PARALLEL_REFR
+    #define TLSF_LOCK()     lv_mutex_lock(&tlsf_lock)
+    #define TLSF_UNLOCK()   lv_mutex_unlock(&tlsf_lock)
+#else
+    #define TLSF_LOCK()
+    #define TLSF_UNLOCK()
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -98,6 +112,13 @@ void lv_mem_init(void)
 #else
     tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_ADR, LV_MEM_SIZE);
 #endif
+
+#if LV_USE_PARALLEL_REFR
+    if(!tlsf_lock_inited) {
+        tlsf_lock_inited = lv_mutex_init(&tlsf_lock) == LV_RES_OK;
+        LV_ASSERT_MSG(tlsf_lock_inited, "Couldn't create the lock of the heap");
+    }
+#endif
 #endif
 
 #if LV_MEM_ADD_JUNK
@@ -131,7 +152,13 @@ void * lv_mem_alloc(size_t size)
     }
 
 #if LV_MEM_CUSTOM == 0
+    TLSF_LOCK();
     void * alloc = lv_tlsf_malloc(tlsf, size);
+    if(alloc) {
+        cur_used += size;
+        max_used = LV_MAX(cur_used, max_used);
+    }
+    TLSF_UNLOCK();
 #else
     void * alloc = LV_MEM_CUSTOM_ALLOC(size);
 #endif
@@ -153,10 +180,6 @@ void * lv_mem_alloc(size_t size)
 #endif
 
     if(alloc) {
-#if LV_MEM_CUSTOM == 0
-        cur_used += size;
-        max_used = LV_MAX(cur_used, max_used);
-#endif
         MEM_TRACE("allocated at %p", alloc);
     }
     return alloc;
@@ -176,9 +199,11 @@ void lv_mem_free(void * data)
 #  if LV_MEM_ADD_JUNK
     lv_memset(data, 0xbb, lv_tlsf_block_size(data));
 #  endif
+    TLSF_LOCK();
     size_t size = lv_tlsf_free(tlsf, data);
     if(cur_used > size) cur_used -= size;
     else cur_used = 0;
+    TLSF_UNLOCK();
 #else
     LV_MEM_CUSTOM_FREE(data);
 #endif
@@ -203,7 +228,9 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
 #if LV_MEM_CUSTOM == 0
+    TLSF_LOCK();
     void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
+    TLSF_UNLOCK();
 #else
     void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
 #endif
@@ -224,12 +251,17 @@ lv_res_t lv_mem_test(void)
     }
 
 #if LV_MEM_CUSTOM == 0
-    if(lv_tlsf_check(tlsf)) {
+    TLSF_LOCK();
+    int tlsf_res = lv_tlsf_check(tlsf);
+    int pool_res = lv_tlsf_check_pool(lv_tlsf_get_pool(tlsf));
+    TLSF_UNLOCK();
+
+    if(tlsf_res) {
         LV_LOG_WARN("failed");
         return LV_RES_INV;
     }
 
-    if(lv_tlsf_check_pool(lv_tlsf_get_pool(tlsf))) {
+    if(pool_res) {
         LV_LOG_WARN("pool failed");
         return LV_RES_INV;
     }
@@ -250,7 +282,9 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 #if LV_MEM_CUSTOM == 0
     MEM_TRACE("begin");
 
+    TLSF_LOCK();
     lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
+    TLSF_UNLOCK();
 
     mon_p->total_size = LV_MEM_SIZE;
     mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
@@ -281,41 +315,41 @@ void * lv_mem_buf_get(uint32_t size)
     /*Try to find a free buffer with suitable size*/
     int8_t i_guess = -1;
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0 && LV_GC_ROOT(lv_mem_buf[i]).size >= size) {
-            if(LV_GC_ROOT(lv_mem_buf[i]).size == size) {
-                LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-                return LV_GC_ROOT(lv_mem_buf[i]).p;
+        if(LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).used == 0 && LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).size >= size) {
+            if(LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).size == size) {
+                LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).used = 1;
+                return LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).p;
             }
             else if(i_guess < 0) {
                 i_guess = i;
             }
             /*If size of `i` is closer to `size` prefer it*/
-            else if(LV_GC_ROOT(lv_mem_buf[i]).size < LV_GC_ROOT(lv_mem_buf[i_guess]).size) {
+            else if(LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).size < LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i_guess]).size) {
                 i_guess = i;
             }
         }
     }
 
     if(i_guess >= 0) {
-        LV_GC_ROOT(lv_mem_buf[i_guess]).used = 1;
+        LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i_guess]).used = 1;
         MEM_TRACE("returning already allocated buffer (buffer id: %d, address: %p)", i_guess,
-                  LV_GC_ROOT(lv_mem_buf[i_guess]).p);
-        return LV_GC_ROOT(lv_mem_buf[i_guess]).p;
+                  LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i_guess]).p);
+        return LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i_guess]).p;
     }
 
     /*Reallocate a free buffer*/
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0) {
+        if(LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).used == 0) {
             /*if this fails you probably need to increase your LV_MEM_SIZE/heap size*/
-            void * buf = lv_mem_realloc(LV_GC_ROOT(lv_mem_buf[i]).p, size);
+            void * buf = lv_mem_realloc(LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).p, size);
             LV_ASSERT_MSG(buf != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
             if(buf == NULL) return NULL;
 
-            LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-            LV_GC_ROOT(lv_mem_buf[i]).size = size;
-            LV_GC_ROOT(lv_mem_buf[i]).p    = buf;
-            MEM_TRACE("allocated (buffer id: %d, address: %p)", i, LV_GC_ROOT(lv_mem_buf[i]).p);
-            return LV_GC_ROOT(lv_mem_buf[i]).p;
+            LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).used = 1;
+            LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).size = size;
+            LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).p    = buf;
+            MEM_TRACE("allocated (buffer id: %d, address: %p)", i, LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).p);
+            return LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).p;
         }
     }
 
@@ -333,8 +367,8 @@ void lv_mem_buf_release(void * p)
     MEM_TRACE("begin (address: %p)", p);
 
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).p == p) {
-            LV_GC_ROOT(lv_mem_buf[i]).used = 0;
+        if(LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).p == p) {
+            LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).used = 0;
             return;
         }
     }
@@ -343,16 +377,16 @@ void lv_mem_buf_release(void * p)
 }
 
 /**
- * Free all memory buffers
+ * Free all memory buffers of the calling thread
  */
 void lv_mem_buf_free_all(void)
 {
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).p) {
-            lv_mem_free(LV_GC_ROOT(lv_mem_buf[i]).p);
-            LV_GC_ROOT(lv_mem_buf[i]).p = NULL;
-            LV_GC_ROOT(lv_mem_buf[i]).used = 0;
-            LV_GC_ROOT(lv_mem_buf[i]).size = 0;
+        if(LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).p) {
+            lv_mem_free(LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).p);
+            LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).p = NULL;
+            LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).used = 0;
+            LV_GC_ROOT(lv_mem_buf[LV_THREAD_ID][i]).size = 0;
         }
     }
 }
@@ -20,6 +20,7 @@ extern "C" {
 #include <string.h>
 
 #include "lv_types.h"
+#include "lv_thread.h"
 
 /*********************
  *      DEFINES
@@ -49,7 +50,8 @@ typedef struct {
     uint8_t used : 1;
 } lv_mem_buf_t;
 
-typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_MEM_BUF_MAX_NUM];
+/*Every rendering thread has its own set of buffers*/
+typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_THREAD_CNT][LV_MEM_BUF_MAX_NUM];
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -114,7 +116,7 @@ void * lv_mem_buf_get(uint32_t size);
 void lv_mem_buf_release(void * p);
 
 /**
- * Free all memory buffers
+ * Free all memory buffers of the calling thread
  */
 void lv_mem_buf_free_all(void);
 
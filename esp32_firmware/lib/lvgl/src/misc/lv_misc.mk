@@ -14,6 +14,7 @@ CSRCS += lv_mem.c
 CSRCS += lv_printf.c
 CSRCS += lv_style.c
 CSRCS += lv_style_gen.c
+CSRCS += lv_thread.c
 CSRCS += lv_timer.c
 CSRCS += lv_tlsf.c
 CSRCS += lv_txt.c
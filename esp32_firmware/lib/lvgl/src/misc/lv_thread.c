@@ -0,0 +1,216 @@
+/**
+ * @file lv_thread.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_thread.h"
+
+#if LV_USE_PARALLEL_REFR
+
+#include "lv_assert.h"
+#include "lv_log.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_PARALLEL_REFR_OS == LV_OS_PTHREAD
+    static void * thread_entry(void * p);
+#else
+    static void thread_entry(void * p);
+#endif
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+LV_THREAD_LOCAL uint8_t _lv_thread_id;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+#if LV_PARALLEL_REFR_OS == LV_OS_PTHREAD
+
+lv_res_t lv_thread_init(lv_thread_t * thread, lv_thread_cb_t cb, void * user_data, uint8_t id)
+{
+    thread->cb = cb;
+    thread->user_data = user_data;
+    thread->id = id;
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, LV_PARALLEL_REFR_STACK_SIZE);
+    int res = pthread_create(&thread->thread, &attr, thread_entry, thread);
+    pthread_attr_destroy(&attr);
+    if(res != 0) {
+        LV_LOG_WARN("couldn't create rendering thread %d (error %d)", id, res);
+        return LV_RES_INV;
+    }
+
+    pthread_detach(thread->thread);
+    return LV_RES_OK;
+}
+
+lv_res_t lv_mutex_init(lv_mutex_t * mutex)
+{
+    return pthread_mutex_init(mutex, NULL) == 0 ? LV_RES_OK : LV_RES_INV;
+}
+
+void lv_mutex_lock(lv_mutex_t * mutex)
+{
+    pthread_mutex_lock(mutex);
+}
+
+void lv_mutex_unlock(lv_mutex_t * mutex)
+{
+    pthread_mutex_unlock(mutex);
+}
+
+void lv_mutex_delete(lv_mutex_t * mutex)
+{
+    pthread_mutex_destroy(mutex);
+}
+
+lv_res_t lv_thread_sync_init(lv_thread_sync_t * sync)
+{
+    sync->v = false;
+    if(pthread_mutex_init(&sync->mutex, NULL) != 0) return LV_RES_INV;
+    if(pthread_cond_init(&sync->cond, NULL) != 0) {
+        pthread_mutex_destroy(&sync->mutex);
+        return LV_RES_INV;
+    }
+    return LV_RES_OK;
+}
+
+void lv_thread_sync_wait(lv_thread_sync_t * sync)
+{
+    pthread_mutex_lock(&sync->mutex);
+    while(!sync->v) {
+        pthread_cond_wait(&sync->cond, &sync->mutex);
+    }
+    sync->v = false;
+    pthread_mutex_unlock(&sync->mutex);
+}
+
+void lv_thread_sync_signal(lv_thread_sync_t * sync)
+{
+    pthread_mutex_lock(&sync->mutex);
+    sync->v = true;
+    pthread_cond_signal(&sync->cond);
+    pthread_mutex_unlock(&sync->mutex);
+}
+
+void lv_thread_sync_delete(lv_thread_sync_t * sync)
+{
+    pthread_cond_destroy(&sync->cond);
+    pthread_mutex_destroy(&sync->mutex);
+}
+
+#else /*LV_OS_FREERTOS*/
+
+lv_res_t lv_thread_init(lv_thread_t * thread, lv_thread_cb_t cb, void * user_data, uint8_t id)
+{
+    thread->cb = cb;
+    thread->user_data = user_data;
+    thread->id = id;
+
+    UBaseType_t prio = uxTaskPriorityGet(NULL);
+    BaseType_t res;
+#if defined(ESP_PLATFORM) && portNUM_PROCESSORS > 1
+    /*Put the workers next to the core of lv_timer_handler(). The ESP-IDF stack size is in bytes.*/
+    BaseType_t core = (xPortGetCoreID() + id) % portNUM_PROCESSORS;
+    res = xTaskCreatePinnedToCore(thread_entry, "lv_refr", LV_PARALLEL_REFR_STACK_SIZE, thread, prio, &thread->task, core);
+#elif defined(ESP_PLATFORM)
+    res = xTaskCreate(thread_entry, "lv_refr", LV_PARALLEL_REFR_STACK_SIZE, thread, prio, &thread->task);
+#else
+    res = xTaskCreate(thread_entry, "lv_refr", LV_PARALLEL_REFR_STACK_SIZE / sizeof(StackType_t), thread, prio,
+                      &thread->task);
+#endif
+    if(res != pdPASS) {
+        LV_LOG_WARN("couldn't create rendering thread %d", id);
+        return LV_RES_INV;
+    }
+
+    return LV_RES_OK;
+}
+
+lv_res_t lv_mutex_init(lv_mutex_t * mutex)
+{
+    *mutex = xSemaphoreCreateMutex();
+    return *mutex ? LV_RES_OK : LV_RES_INV;
+}
+
+void lv_mutex_lock(lv_mutex_t * mutex)
+{
+    xSemaphoreTake(*mutex, portMAX_DELAY);
+}
+
+void lv_mutex_unlock(lv_mutex_t * mutex)
+{
+    xSemaphoreGive(*mutex);
+}
+
+void lv_mutex_delete(lv_mutex_t * mutex)
+{
+    vSemaphoreDelete(*mutex);
+}
+
+lv_res_t lv_thread_sync_init(lv_thread_sync_t * sync)
+{
+    *sync = xSemaphoreCreateBinary();
+    return *sync ? LV_RES_OK : LV_RES_INV;
+}
+
+void lv_thread_sync_wait(lv_thread_sync_t * sync)
+{
+    xSemaphoreTake(*sync, portMAX_DELAY);
+}
+
+void lv_thread_sync_signal(lv_thread_sync_t * sync)
+{
+    xSemaphoreGive(*sync);
+}
+
+void lv_thread_sync_delete(lv_thread_sync_t * sync)
+{
+    vSemaphoreDelete(*sync);
+}
+
+#endif /*LV_PARALLEL_REFR_OS*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_PARALLEL_REFR_OS == LV_OS_PTHREAD
+static void * thread_entry(void * p)
+#else
+static void thread_entry(void * p)
+#endif
+{
+    lv_thread_t * thread = p;
+    _lv_thread_id = thread->id;
+    thread->cb(thread->user_data);
+
+#if LV_PARALLEL_REFR_OS == LV_OS_PTHREAD
+    return NULL;
+#else
+    vTaskDelete(NULL);
+#endif
+}
+
+#endif /*LV_USE_PARALLEL_REFR*/
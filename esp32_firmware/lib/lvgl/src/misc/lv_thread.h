@@ -0,0 +1,148 @@
+/**
+ * @file lv_thread.h
+ * Minimal threading layer for the parallel refresh (`LV_USE_PARALLEL_REFR`).
+ * Without it every macro below resolves to the single thread case.
+ */
+
+#ifndef LV_THREAD_H
+#define LV_THREAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Values of `LV_PARALLEL_REFR_OS`*/
+#define LV_OS_PTHREAD   1
+#define LV_OS_FREERTOS  2
+
+#if LV_USE_PARALLEL_REFR
+#  if LV_PARALLEL_REFR_THREADS < 1 || LV_PARALLEL_REFR_THREADS > 8
+#    error "LV_PARALLEL_REFR_THREADS should be in 1..8"
+#  endif
+#  if LV_PARALLEL_REFR_OS == LV_OS_PTHREAD
+#    include <pthread.h>
+#  elif LV_PARALLEL_REFR_OS == LV_OS_FREERTOS
+#    ifdef ESP_PLATFORM
+#      include "freertos/FreeRTOS.h"
+#      include "freertos/task.h"
+#      include "freertos/semphr.h"
+#    else
+#      include "FreeRTOS.h"
+#      include "task.h"
+#      include "semphr.h"
+#    endif
+#  else
+#    error "Unknown LV_PARALLEL_REFR_OS"
+#  endif
+
+/*Number of threads which can render at the same time. Use it to size the per thread state.*/
+#  define LV_THREAD_CNT     LV_PARALLEL_REFR_THREADS
+
+/*Index of the calling thread: 0 for the thread of `lv_timer_handler()`, 1.. for the rendering workers*/
+#  define LV_THREAD_ID      _lv_thread_id
+
+/*Storage class for small static state which should be private to each rendering thread*/
+#  define LV_THREAD_LOCAL   LV_PARALLEL_REFR_THREAD_LOCAL
+#else
+#  define LV_THREAD_CNT     1
+#  define LV_THREAD_ID      0
+#  define LV_THREAD_LOCAL
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+#if LV_USE_PARALLEL_REFR
+
+typedef void (*lv_thread_cb_t)(void *);
+
+#if LV_PARALLEL_REFR_OS == LV_OS_PTHREAD
+typedef struct {
+    pthread_t thread;
+    lv_thread_cb_t cb;
+    void * user_data;
+    uint8_t id;
+} lv_thread_t;
+
+typedef pthread_mutex_t lv_mutex_t;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool v;
+} lv_thread_sync_t;
+#else
+typedef struct {
+    TaskHandle_t task;
+    lv_thread_cb_t cb;
+    void * user_data;
+    uint8_t id;
+} lv_thread_t;
+
+typedef SemaphoreHandle_t lv_mutex_t;
+
+typedef SemaphoreHandle_t lv_thread_sync_t;
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+extern LV_THREAD_LOCAL uint8_t _lv_thread_id;
+
+/**
+ * Start a rendering thread. It runs `cb(user_data)` with `LV_THREAD_ID == id`
+ * and with the priority of the caller. It never returns.
+ * @param thread    the thread to start, has to stay valid while the thread runs
+ * @param cb        the function to run
+ * @param user_data parameter of `cb`
+ * @param id        1..`LV_THREAD_CNT - 1`, also selects the core on multi core FreeRTOS
+ * @return          LV_RES_OK: the thread is running; LV_RES_INV: couldn't be created
+ */
+lv_res_t lv_thread_init(lv_thread_t * thread, lv_thread_cb_t cb, void * user_data, uint8_t id);
+
+lv_res_t lv_mutex_init(lv_mutex_t * mutex);
+
+void lv_mutex_lock(lv_mutex_t * mutex);
+
+void lv_mutex_unlock(lv_mutex_t * mutex);
+
+void lv_mutex_delete(lv_mutex_t * mutex);
+
+/**
+ * Initialize a one shot event: `lv_thread_sync_signal()` lets one `lv_thread_sync_wait()` through,
+ * also if the signal came first.
+ * @param sync  the event to initialize
+ * @return      LV_RES_OK or LV_RES_INV if the OS object couldn't be created
+ */
+lv_res_t lv_thread_sync_init(lv_thread_sync_t * sync);
+
+void lv_thread_sync_wait(lv_thread_sync_t * sync);
+
+void lv_thread_sync_signal(lv_thread_sync_t * sync);
+
+void lv_thread_sync_delete(lv_thread_sync_t * sync);
+
+#endif /*LV_USE_PARALLEL_REFR*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_THREAD_H*/
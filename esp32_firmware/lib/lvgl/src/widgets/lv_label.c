@@ -832,6 +832,8 @@ static void draw_main(lv_event_t * e)
     lv_draw_label_hint_t * hint = &label->hint;
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR || lv_area_get_height(&txt_coords) < LV_LABEL_HINT_HEIGHT_LIMIT)
         hint = NULL;
+    /*The hint is written while drawing so only the thread of `lv_timer_handler()` uses it*/
+    if(LV_THREAD_ID != 0) hint = NULL;
 
 #else
     /*Just for compatibility*/
@@ -66,10 +66,14 @@ static void hal_init(void)
 
 static void dummy_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
 {
-    LV_UNUSED(area);
-    LV_UNUSED(color_p);
-
-    memcpy(test_fb, color_p, lv_area_get_size(area) * sizeof(lv_color_t));
+    /*Copy every row to its place: with LV_USE_PARALLEL_REFR an area is flushed in bands, one call
+     *each. For the whole screen areas of the screenshot tests it's the same as one copy to test_fb.*/
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        memcpy(&test_fb[y * HOR_RES + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
 
     lv_disp_flush_ready(disp_drv);
 }
@@ -0,0 +1,257 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+#define HOR_RES         800
+#define VER_RES         480
+#define SCR_PX          (HOR_RES * VER_RES)
+
+extern lv_color_t test_fb[];
+
+static void (*flush_cb_ori)(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+static uint32_t px_refr;
+static uint32_t px_inv;
+static uint32_t px_flushed;
+static uint32_t px_changed;
+static uint32_t rnd_seed;
+
+static void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(time);
+    px_refr = px;
+    px_inv = lv_disp_get_default()->inv_px;
+}
+
+/*Count the flushed pixels and the ones which are different from the frame buffer*/
+static void counting_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    lv_color_t * c = color_p;
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        for(x = area->x1; x <= area->x2; x++) {
+            if(lv_color_to32(*c) != lv_color_to32(test_fb[y * HOR_RES + x])) px_changed++;
+            c++;
+        }
+    }
+    px_flushed += lv_area_get_size(area);
+
+    flush_cb_ori(drv, area, color_p);
+}
+
+static int32_t rnd_next(int32_t min, int32_t max)
+{
+    rnd_seed = rnd_seed * 1103515245 + 12345;
+    return min + (int32_t)((rnd_seed >> 8) % (uint32_t)(max - min + 1));
+}
+
+static void inv_area(lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2)
+{
+    lv_area_t a;
+    lv_area_set(&a, x1, y1, x2, y2);
+    _lv_inv_area(NULL, &a);
+}
+
+void setUp(void)
+{
+    lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+    flush_cb_ori = drv->flush_cb;
+    drv->flush_cb = counting_flush_cb;
+    drv->monitor_cb = monitor_cb;
+
+    /*Start from a clean screen with nothing to refresh*/
+    lv_obj_invalidate(lv_scr_act());
+    _lv_disp_refr_timer(NULL);
+    px_refr = 0;
+    px_inv = 0;
+    px_flushed = 0;
+    px_changed = 0;
+    rnd_seed = 0x1234;
+}
+
+void tearDown(void)
+{
+    lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+    drv->flush_cb = flush_cb_ori;
+    drv->monitor_cb = NULL;
+    lv_obj_clean(lv_scr_act());
+    lv_obj_remove_local_style_prop(lv_scr_act(), LV_STYLE_BG_COLOR, 0);
+}
+
+void test_inv_area_overlap_drawn_once(void)
+{
+    inv_area(0, 0, 99, 99);
+    inv_area(50, 50, 149, 149);
+    _lv_disp_refr_timer(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(17500, px_inv);
+    TEST_ASSERT_EQUAL_UINT32(17500, px_refr);
+    TEST_ASSERT_EQUAL_UINT32(17500, px_flushed);
+}
+
+void test_inv_area_neighbours_joined(void)
+{
+    /*Only 2 rows of 10 pixels between them, cheaper as one area*/
+    inv_area(10, 10, 109, 29);
+    inv_area(10, 32, 109, 51);
+    _lv_disp_refr_timer(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(4000, px_inv);
+    TEST_ASSERT_EQUAL_UINT32(4200, px_refr);
+}
+
+void test_inv_area_overflow_is_not_full_screen(void)
+{
+    /*Many more small areas than LV_INV_BUF_SIZE, like the values of a dashboard*/
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 20; y < VER_RES; y += 80) {
+        for(x = 20; x < HOR_RES; x += 80) {
+            inv_area(x, y, x + 39, y + 15);
+        }
+    }
+    _lv_disp_refr_timer(NULL);
+
+    TEST_PRINTF("60 areas of 640 px: %d px invalidated, %d px rendered", (int)px_inv, (int)px_refr);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(60 * 640, px_inv);
+    TEST_ASSERT_LESS_THAN_UINT32(SCR_PX / 4, px_refr);
+}
+
+/*Invalidate the areas on a black screen which turns white, then only they and the joined gaps may be white*/
+static void refresh_check_covered(const lv_area_t * areas, uint32_t cnt)
+{
+    lv_obj_t * scr = lv_scr_act();
+    lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
+    lv_obj_invalidate(scr);
+    _lv_disp_refr_timer(NULL);
+
+    /*Change the color without invalidating, only the invalidated areas should get it*/
+    lv_disp_enable_invalidation(NULL, false);
+    lv_obj_set_style_bg_color(scr, lv_color_white(), 0);
+    lv_disp_enable_invalidation(NULL, true);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) _lv_inv_area(NULL, &areas[i]);
+    px_flushed = 0;
+    _lv_disp_refr_timer(NULL);
+
+    uint32_t white = lv_color_to32(lv_color_white());
+    uint32_t white_cnt = 0;
+    for(i = 0; i < SCR_PX; i++) {
+        if(lv_color_to32(test_fb[i]) == white) white_cnt++;
+    }
+
+    for(i = 0; i < cnt; i++) {
+        lv_coord_t x;
+        lv_coord_t y;
+        for(y = areas[i].y1; y <= LV_MIN(areas[i].y2, VER_RES - 1); y++) {
+            for(x = areas[i].x1; x <= LV_MIN(areas[i].x2, HOR_RES - 1); x++) {
+                TEST_ASSERT_EQUAL_UINT32_MESSAGE(white, lv_color_to32(test_fb[y * HOR_RES + x]), "not refreshed");
+            }
+        }
+    }
+
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(px_inv, white_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(px_refr, white_cnt);
+    TEST_ASSERT_EQUAL_UINT32(px_refr, px_flushed);
+}
+
+void test_inv_area_covered(void)
+{
+    lv_area_t areas[48];
+    uint32_t i;
+    for(i = 0; i < 48; i++) {
+        lv_coord_t x1 = rnd_next(0, HOR_RES - 1);
+        lv_coord_t y1 = rnd_next(0, VER_RES - 1);
+        lv_area_set(&areas[i], x1, y1, x1 + rnd_next(0, 60), y1 + rnd_next(0, 60));
+    }
+
+    refresh_check_covered(areas, 48);
+}
+
+void test_inv_area_grid(void)
+{
+    /*The bars join the columns, between them each column starts a new rectangle:
+     *many more than fit while cutting the slabs, so they are joined meanwhile too*/
+    lv_area_t areas[32];
+    uint32_t i;
+    for(i = 0; i < 16; i++) {
+        lv_area_set(&areas[i], i * 50, 0, i * 50 + 9, VER_RES - 1);
+        lv_area_set(&areas[16 + i], 0, i * 30, HOR_RES - 41, i * 30 + 4);
+    }
+
+    refresh_check_covered(areas, 32);
+
+    TEST_PRINTF("16 x 16 grid: %d px invalidated, %d px rendered", (int)px_inv, (int)px_refr);
+    TEST_ASSERT_EQUAL_UINT32(16 * 10 * VER_RES + 16 * 5 * (HOR_RES - 40 - 16 * 10), px_inv);
+    TEST_ASSERT_LESS_THAN_UINT32(SCR_PX / 2, px_refr);
+}
+
+void test_inv_area_dashboard(void)
+{
+    lv_obj_t * labels[48];
+    uint32_t i;
+    for(i = 0; i < 48; i++) {
+        labels[i] = lv_label_create(lv_scr_act());
+        lv_obj_set_pos(labels[i], (i % 8) * 100 + 10, (i / 8) * 80 + 10);
+        lv_label_set_text_fmt(labels[i], "%d.0 V", (int)i);
+    }
+    _lv_disp_refr_timer(NULL);
+
+    for(i = 0; i < 48; i++) {
+        lv_label_set_text_fmt(labels[i], "%d.5 V", (int)i);
+    }
+    px_changed = 0;
+    _lv_disp_refr_timer(NULL);
+
+    TEST_PRINTF("48 labels: %d px changed, %d px invalidated, %d px rendered", (int)px_changed, (int)px_inv,
+                (int)px_refr);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(px_inv, px_changed);
+    TEST_ASSERT_LESS_THAN_UINT32(SCR_PX / 2, px_refr);
+}
+
+#if LV_USE_DEMO_BENCHMARK
+
+/*Pixels rendered versus pixels really changed while the benchmark scenes animate*/
+void test_inv_area_benchmark(void)
+{
+    uint32_t refr_sum = 0;
+    uint32_t changed_sum = 0;
+    int_fast16_t scene;
+    for(scene = 0; scene < 48 * 2; scene += 7) {
+        lv_demo_benchmark_run_scene(scene);
+        lv_obj_invalidate(lv_scr_act());
+        _lv_disp_refr_timer(NULL);
+
+        px_flushed = 0;
+        px_changed = 0;
+        uint32_t i;
+        for(i = 0; i < 10; i++) {
+            lv_tick_inc(33);
+            lv_timer_handler();
+        }
+        lv_demo_benchmark_close();
+
+        TEST_PRINTF("scene %d: %d px/frame rendered, %d px/frame changed", (int)scene, (int)(px_flushed / 10),
+                    (int)(px_changed / 10));
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(px_flushed, px_changed);
+        refr_sum += px_flushed;
+        changed_sum += px_changed;
+    }
+
+    TEST_PRINTF("benchmark: %d%% of the rendered pixels changed", (int)(((uint64_t)changed_sum * 100) / refr_sum));
+}
+
+#else
+
+void test_inv_area_benchmark(void)
+{
+
+}
+
+#endif
+
+#endif
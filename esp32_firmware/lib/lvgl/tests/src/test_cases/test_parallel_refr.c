@@ -0,0 +1,117 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+#include <sys/time.h>
+
+#if LV_USE_PARALLEL_REFR && LV_USE_DEMO_BENCHMARK
+
+#define HOR_RES         800
+#define VER_RES         480
+#define SCENE_CNT       (48 * 2)    /*Every benchmark scene with and without opa*/
+#define BAND_ROWS       40
+
+extern lv_color_t test_fb[];
+
+static lv_color_t fb_single[HOR_RES * VER_RES];
+static lv_color_t band_buf1[HOR_RES * BAND_ROWS];
+static lv_color_t band_buf2[HOR_RES * BAND_ROWS];
+
+void setUp(void)
+{
+    lv_disp_get_default()->driver->single_thread_refr = 0;
+}
+
+void tearDown(void)
+{
+    lv_demo_benchmark_close();
+    lv_disp_get_default()->driver->single_thread_refr = 0;
+}
+
+/*Redraw the whole screen and return the time it took in us*/
+static uint32_t render(bool parallel)
+{
+    lv_disp_get_default()->driver->single_thread_refr = parallel ? 0 : 1;
+    lv_obj_invalidate(lv_scr_act());
+
+    struct timeval start;
+    struct timeval end;
+    gettimeofday(&start, NULL);
+    _lv_disp_refr_timer(NULL);
+    gettimeofday(&end, NULL);
+    return (end.tv_sec - start.tv_sec) * 1000000 + (end.tv_usec - start.tv_usec);
+}
+
+/*Render every scene on one thread and on all threads and compare the frames*/
+static void compare_scenes(uint32_t scene_step, uint32_t * single_us, uint32_t * parallel_us)
+{
+    uint32_t i;
+    for(i = 0; i < SCENE_CNT; i += scene_step) {
+        lv_demo_benchmark_run_scene(i);
+
+        *single_us += render(false);
+        lv_memcpy(fb_single, test_fb, sizeof(fb_single));
+
+        *parallel_us += render(true);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(fb_single, test_fb, sizeof(fb_single), "parallel frame differs");
+
+        lv_demo_benchmark_close();
+    }
+}
+
+void test_parallel_refr_same_as_single_thread(void)
+{
+    uint32_t single_us = 0;
+    uint32_t parallel_us = 0;
+    compare_scenes(1, &single_us, &parallel_us);
+
+    /*Only reported: the sanitized build shares the cores with the other tests run in parallel,
+     *so the wall time says little about the speed up*/
+    TEST_PRINTF("benchmark scenes: %d ms on 1 thread, %d ms on %d threads", (int)(single_us / 1000),
+                (int)(parallel_us / 1000), LV_PARALLEL_REFR_THREADS);
+}
+
+void test_parallel_refr_double_band_buffer(void)
+{
+    lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+    lv_disp_draw_buf_t * draw_buf_ori = drv->draw_buf;
+
+    /*Many bands in two small buffers, all of them flushed from their own slice*/
+    lv_disp_draw_buf_t draw_buf;
+    lv_disp_draw_buf_init(&draw_buf, band_buf1, band_buf2, HOR_RES * BAND_ROWS);
+    drv->draw_buf = &draw_buf;
+
+    uint32_t single_us = 0;
+    uint32_t parallel_us = 0;
+    compare_scenes(7, &single_us, &parallel_us);
+
+    drv->draw_buf = draw_buf_ori;
+}
+
+#else /*LV_USE_PARALLEL_REFR && LV_USE_DEMO_BENCHMARK*/
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_parallel_refr_same_as_single_thread(void)
+{
+
+}
+
+void test_parallel_refr_double_band_buffer(void)
+{
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,75 @@
+#include "alert_fsm.h"
+
+struct AlertTransition
+{
+  AlertState from;
+  AlertEvent event;
+  AlertState to;
+  uint8_t actions;
+};
+
+static const AlertTransition transitions[] = {
+    {ALERT_IDLE, ALERT_EV_SUSPECT, ALERT_SUSPECTED, ALERT_ACT_NONE},
+    {ALERT_IDLE, ALERT_EV_TRIGGER, ALERT_COUNTDOWN, ALERT_ACT_START_COUNTDOWN},
+
+    {ALERT_SUSPECTED, ALERT_EV_TRIGGER, ALERT_COUNTDOWN, ALERT_ACT_START_COUNTDOWN},
+    {ALERT_SUSPECTED, ALERT_EV_CLEAR, ALERT_IDLE, ALERT_ACT_NONE},
+    {ALERT_SUSPECTED, ALERT_EV_TIMEOUT, ALERT_IDLE, ALERT_ACT_NONE},
+
+    {ALERT_COUNTDOWN, ALERT_EV_CANCEL, ALERT_RESOLVED, ALERT_ACT_SEND_CANCEL},
+    {ALERT_COUNTDOWN, ALERT_EV_TIMEOUT, ALERT_SOS, ALERT_ACT_SEND_SOS},
+
+    {ALERT_SOS, ALERT_EV_CANCEL, ALERT_RESOLVED, ALERT_ACT_SEND_CANCEL},
+
+    {ALERT_RESOLVED, ALERT_EV_TRIGGER, ALERT_COUNTDOWN, ALERT_ACT_START_COUNTDOWN},
+    {ALERT_RESOLVED, ALERT_EV_TIMEOUT, ALERT_IDLE, ALERT_ACT_CLEAR},
+};
+
+uint8_t AlertFsm::dispatch(AlertEvent event, uint32_t nowMs, uint32_t countdownMs)
+{
+  // A timer may fire late or after the state it was armed for has been left
+  if (event == ALERT_EV_TIMEOUT && (!_hasDeadline || (int32_t)(nowMs - _deadlineMs) < 0))
+    return ALERT_ACT_NONE;
+
+  for (const AlertTransition &t : transitions)
+  {
+    if (t.from != _state || t.event != event)
+      continue;
+
+    _state = t.to;
+    _enteredAtMs = nowMs;
+    uint32_t timeout = timeoutFor(t.to, countdownMs);
+    _hasDeadline = timeout > 0;
+    _deadlineMs = nowMs + timeout;
+    return t.actions;
+  }
+  return ALERT_ACT_NONE;
+}
+
+uint32_t AlertFsm::timeoutFor(AlertState state, uint32_t countdownMs) const
+{
+  switch (state)
+  {
+  case ALERT_SUSPECTED:
+    return _config.suspectWindowMs;
+  case ALERT_COUNTDOWN:
+    return countdownMs > 0 ? countdownMs : _config.defaultCountdownMs;
+  case ALERT_RESOLVED:
+    return _config.resolvedHoldMs;
+  default:
+    return 0;
+  }
+}
+
+uint32_t AlertFsm::remainingMs(uint32_t nowMs) const
+{
+  if (!_hasDeadline || (int32_t)(_deadlineMs - nowMs) <= 0)
+    return 0;
+  return _deadlineMs - nowMs;
+}
+
+const char *AlertFsm::stateName(AlertState state)
+{
+  static const char *const names[ALERT_STATE_COUNT] = {"idle", "suspected", "countdown", "sos", "resolved"};
+  return state < ALERT_STATE_COUNT ? names[state] : "?";
+}
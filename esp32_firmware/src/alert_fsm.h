@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stdint.h>
+
+// Emergency alert state machine.
+//
+//   IDLE --suspect--> SUSPECTED --trigger--> COUNTDOWN --timeout--> SOS
+//     |                  |  clear/timeout        |  cancel           | cancel
+//     +----trigger-------+--> IDLE               +--> RESOLVED <-----+
+//                                                     | timeout
+//                                                     +--> IDLE
+//
+// Transitions come from a fixed table and depend only on the current state,
+// the event and the time passed in, so the machine is deterministic and has
+// no Arduino dependencies. Each timed state arms a single deadline; a
+// TIMEOUT event is accepted only once that deadline has passed, which makes
+// a late or stale timer harmless. The deadline is exact (entry time plus the
+// configured duration), so the only latency on top is how quickly the owner
+// delivers the TIMEOUT event.
+
+enum AlertState : uint8_t
+{
+  ALERT_IDLE = 0,
+  ALERT_SUSPECTED,
+  ALERT_COUNTDOWN,
+  ALERT_SOS,
+  ALERT_RESOLVED,
+  ALERT_STATE_COUNT
+};
+
+enum AlertEvent : uint8_t
+{
+  ALERT_EV_SUSPECT = 0, // on-device detector saw something
+  ALERT_EV_CLEAR,       // detector withdrew the suspicion
+  ALERT_EV_TRIGGER,     // confirmed: start the countdown
+  ALERT_EV_CANCEL,      // user says they are safe
+  ALERT_EV_TIMEOUT,     // the armed deadline expired
+  ALERT_EVENT_COUNT
+};
+
+// Side effects requested by a transition, as a bit mask
+enum AlertAction : uint8_t
+{
+  ALERT_ACT_NONE = 0,
+  ALERT_ACT_START_COUNTDOWN = 1 << 0,
+  ALERT_ACT_SEND_SOS = 1 << 1,
+  ALERT_ACT_SEND_CANCEL = 1 << 2,
+  ALERT_ACT_CLEAR = 1 << 3, // back to the normal dashboard
+};
+
+struct AlertConfig
+{
+  uint32_t suspectWindowMs;    // how long a suspicion waits for confirmation
+  uint32_t defaultCountdownMs; // countdown when the trigger doesn't give one
+  uint32_t resolvedHoldMs;     // how long the resolved screen stays up
+};
+
+class AlertFsm
+{
+public:
+  explicit AlertFsm(const AlertConfig &config) : _config(config) {}
+
+  // Apply one event at nowMs and return the actions of the transition taken,
+  // ALERT_ACT_NONE when the event doesn't apply in the current state.
+  // countdownMs overrides the default countdown for ALERT_EV_TRIGGER.
+  uint8_t dispatch(AlertEvent event, uint32_t nowMs, uint32_t countdownMs = 0);
+
+  AlertState state() const { return _state; }
+  bool active() const { return _state == ALERT_COUNTDOWN || _state == ALERT_SOS; }
+  uint32_t enteredAtMs() const { return _enteredAtMs; }
+
+  bool hasDeadline() const { return _hasDeadline; }
+  uint32_t deadlineMs() const { return _deadlineMs; }
+  uint32_t remainingMs(uint32_t nowMs) const;
+
+  static const char *stateName(AlertState state);
+
+private:
+  uint32_t timeoutFor(AlertState state, uint32_t countdownMs) const;
+
+  AlertConfig _config;
+  AlertState _state = ALERT_IDLE;
+  uint32_t _enteredAtMs = 0;
+  uint32_t _deadlineMs = 0;
+  bool _hasDeadline = false;
+};
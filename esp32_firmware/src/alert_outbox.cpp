@@ -0,0 +1,52 @@
+#include "alert_outbox.h"
+#include <stdio.h>
+#include <string.h>
+
+void AlertOutbox::push(const char *response)
+{
+  if (_count == ALERT_OUTBOX_LENGTH)
+    pop();
+  _entries[_count].response = response;
+  _entries[_count].seq = _nextSeq++;
+  _count++;
+}
+
+size_t AlertOutbox::next(char *out, size_t outSize, uint32_t nowMs) const
+{
+  if (_count == 0 || (_awaitingAck && nowMs - _sentMs < ALERT_ACK_TIMEOUT_MS))
+    return 0;
+  int len = snprintf(out, outSize, "{\"emergency_response\":\"%s\",\"seq\":%lu}", _entries[0].response,
+                     (unsigned long)_entries[0].seq);
+  if (len <= 0 || (size_t)len >= outSize)
+    return 0;
+  return len;
+}
+
+void AlertOutbox::sent(bool confirmed, uint32_t nowMs)
+{
+  if (_count == 0)
+    return;
+  if (confirmed)
+  {
+    pop();
+    return;
+  }
+  _awaitingAck = true;
+  _sentMs = nowMs;
+}
+
+bool AlertOutbox::acknowledge(uint32_t seq)
+{
+  // Only the first response has been sent, anything else is stale or bogus
+  if (_count == 0 || _entries[0].seq != seq)
+    return false;
+  pop();
+  return true;
+}
+
+void AlertOutbox::pop()
+{
+  _count--;
+  memmove(_entries, _entries + 1, _count * sizeof(_entries[0]));
+  _awaitingAck = false;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Emergency responses not yet delivered to the phone, with no Arduino or BLE
+// dependency so it runs in the native tests.
+//
+// Each response goes out as {"emergency_response":"sos","seq":S}, in order
+// and one at a time. It leaves the outbox only once its delivery is
+// confirmed: the phone confirmed the indication on the control
+// characteristic, or it answered {"type":"alert_ack","seq":S}. A notify is
+// confirmed by nothing, so an unacknowledged response is sent again every
+// ALERT_ACK_TIMEOUT_MS. A response raised while the link is down waits here;
+// when full the oldest entry makes room.
+
+#define ALERT_OUTBOX_LENGTH 4
+#define ALERT_ACK_TIMEOUT_MS 3000
+#define ALERT_MESSAGE_MAX sizeof("{\"emergency_response\":\"cancel\",\"seq\":4294967295}")
+
+class AlertOutbox
+{
+public:
+  // Queue a response; `response` is a string literal such as "sos"
+  void push(const char *response);
+
+  // Format the first response into out when it is due: never sent, or sent
+  // without confirmation ALERT_ACK_TIMEOUT_MS ago. Returns the message
+  // length, 0 when nothing is due or out is too small.
+  size_t next(char *out, size_t outSize, uint32_t nowMs) const;
+  // The message from next() went out; a confirmed one leaves the outbox,
+  // any other waits for its ack
+  void sent(bool confirmed, uint32_t nowMs);
+  // The phone got response seq; returns true when that was the one waiting
+  bool acknowledge(uint32_t seq);
+  // The link came back: send the first response again at once
+  void resend() { _awaitingAck = false; }
+
+  uint8_t count() const { return _count; }
+  const char *front() const { return _count ? _entries[0].response : NULL; }
+
+private:
+  struct Entry
+  {
+    const char *response;
+    uint32_t seq;
+  };
+
+  void pop();
+
+  Entry _entries[ALERT_OUTBOX_LENGTH];
+  uint8_t _count = 0;
+  uint32_t _nextSeq = 1;
+  bool _awaitingAck = false;
+  uint32_t _sentMs = 0;
+};
@@ -0,0 +1,241 @@
+#include "ble_link.h"
+#include <esp_gap_ble_api.h>
+
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+// The GAP handler is a plain function, it reaches the link through this
+static BleLink *gapLink = NULL;
+#endif
+
+void BleLink::begin(const char *deviceName, const char *serviceUuid, const char *dataUuid,
+                    const char *controlUuid, BLECharacteristicCallbacks *commandHandler)
+{
+  _commandHandler = commandHandler;
+
+  BLEDevice::init(deviceName);
+  BLEDevice::setMTU(BLE_LINK_MTU);
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+  gapLink = this;
+  BLEDevice::setCustomGapHandler(onGapEvent);
+#endif
+
+  _server = BLEDevice::createServer();
+  _server->setCallbacks(this);
+
+  BLEService *service = _server->createService(serviceUuid);
+
+  _data = service->createCharacteristic(
+      dataUuid,
+      BLECharacteristic::PROPERTY_READ |
+          BLECharacteristic::PROPERTY_WRITE |
+          BLECharacteristic::PROPERTY_NOTIFY);
+  _data->setCallbacks(this);
+  _data->addDescriptor(new BLE2902());
+
+  _control = service->createCharacteristic(
+      controlUuid,
+      BLECharacteristic::PROPERTY_WRITE |
+          BLECharacteristic::PROPERTY_WRITE_NR |
+          BLECharacteristic::PROPERTY_NOTIFY |
+          BLECharacteristic::PROPERTY_INDICATE);
+  _control->setCallbacks(this);
+  _controlCccd = new BLE2902();
+  _control->addDescriptor(_controlCccd);
+
+  service->start();
+
+  BLEAdvertising *advertising = BLEDevice::getAdvertising();
+  advertising->addServiceUUID(serviceUuid);
+  advertising->setScanResponse(false);
+  // Preferred connection interval hint, same units as the intervals above
+  advertising->setMinPreferred(BLE_LOW_LATENCY_MIN_INTERVAL);
+  advertising->setMaxPreferred(BLE_LOW_LATENCY_MAX_INTERVAL);
+  BLEDevice::startAdvertising();
+}
+
+void BleLink::startAdvertising()
+{
+  if (_server)
+    _server->startAdvertising();
+}
+
+void BleLink::setMode(BleLinkMode mode)
+{
+  if (mode == _mode)
+    return;
+  _mode = mode;
+  _stats.mode = mode;
+  if (_connected)
+    applyConnParams();
+}
+
+void BleLink::applyConnParams()
+{
+  if (_mode == LINK_LOW_LATENCY)
+  {
+    _server->updateConnParams(_peer, BLE_LOW_LATENCY_MIN_INTERVAL, BLE_LOW_LATENCY_MAX_INTERVAL,
+                              BLE_LOW_LATENCY_LATENCY, BLE_LOW_LATENCY_TIMEOUT);
+  }
+  else
+  {
+    _server->updateConnParams(_peer, BLE_POWER_SAVE_MIN_INTERVAL, BLE_POWER_SAVE_MAX_INTERVAL,
+                              BLE_POWER_SAVE_LATENCY, BLE_POWER_SAVE_TIMEOUT);
+  }
+}
+
+bool BleLink::stream(const uint8_t *data, size_t len)
+{
+  if (!_connected || !_data)
+    return false;
+
+  // The stack silently cuts notifies to MTU - 3 bytes; count it so the
+  // phone side can tell a short MTU from a broken sender, and tell the caller
+  bool whole = len <= maxPayload();
+  if (!whole)
+    _stats.truncated++;
+
+  _lastNotifyLen = min(len, maxPayload());
+  _dataStatus = ERROR_NO_CLIENT;
+  _data->setValue((uint8_t *)data, len);
+  _data->notify();
+  return whole && _dataStatus == SUCCESS_NOTIFY;
+}
+
+bool BleLink::sendControl(const char *message)
+{
+  _controlStatus = ERROR_NO_CLIENT;
+  if (!_connected || !_control)
+    return false;
+
+  if (!_controlCccd->getIndications() && !_controlCccd->getNotifications())
+    return stream(message);
+
+  size_t len = strlen(message);
+  bool whole = len <= maxPayload();
+  if (!whole)
+    _stats.truncated++;
+
+  _lastNotifyLen = min(len, maxPayload());
+  _control->setValue((uint8_t *)message, len);
+  if (_controlCccd->getIndications())
+  {
+    _control->indicate();
+    return whole && _controlStatus == SUCCESS_INDICATE;
+  }
+  _control->notify();
+  return whole && _controlStatus == SUCCESS_NOTIFY;
+}
+
+uint32_t BleLink::throughput(uint32_t nowMs) const
+{
+  uint32_t elapsed = nowMs - _stats.connectedAtMs;
+  if (!_connected || elapsed == 0)
+    return 0;
+  return (uint32_t)((uint64_t)_stats.bytes * 1000 / elapsed);
+}
+
+static const char *phyName(uint8_t phy)
+{
+  switch (phy)
+  {
+  case LINK_PHY_1M:
+    return "1M";
+  case LINK_PHY_2M:
+    return "2M";
+  case LINK_PHY_CODED:
+    return "coded";
+  default:
+    return "unknown";
+  }
+}
+
+size_t BleLink::formatStats(char *buf, size_t size, uint32_t nowMs) const
+{
+  int len = snprintf(buf, size,
+                     "{\"link\":{\"mtu\":%u,\"mode\":\"%s\",\"phy\":\"%s\",\"notifies\":%u,\"bytes\":%u,"
+                     "\"dropped\":%u,\"truncated\":%u,\"bps\":%u}}",
+                     _stats.mtu, _mode == LINK_LOW_LATENCY ? "low_latency" : "power_save", phyName(_stats.phy),
+                     (unsigned)_stats.notifies, (unsigned)_stats.bytes, (unsigned)_stats.dropped,
+                     (unsigned)_stats.truncated, (unsigned)throughput(nowMs));
+  return len > 0 ? min((size_t)len, size - 1) : 0;
+}
+
+void BleLink::onConnect(BLEServer *server, esp_ble_gatts_cb_param_t *param)
+{
+  memcpy(_peer, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+  _stats = {};
+  _stats.connectedAtMs = millis();
+  _stats.mtu = 23;
+  _stats.mode = _mode;
+  _connected = true;
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+  // Every connection starts on 1M, updates arrive in onGapEvent()
+  _stats.phy = LINK_PHY_1M;
+#endif
+
+  applyConnParams();
+
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+  // Prefer 2M PHY both ways; the controller falls back to 1M if the peer can't.
+  // Compiled out with the 4.2-only SDK of the ESP32-S3 boards, see ble_link.h
+  esp_ble_gap_set_preferred_phy(_peer, ESP_BLE_GAP_PHY_OPTIONS_NO_PREF,
+                                ESP_BLE_GAP_PHY_2M_PREF_MASK, ESP_BLE_GAP_PHY_2M_PREF_MASK,
+                                ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+#endif
+
+  Serial.println("Device Connected");
+}
+
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+void BleLink::onGapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param)
+{
+  if (event != ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT || !gapLink || !gapLink->_connected)
+    return;
+  if (param->phy_update.status == ESP_BT_STATUS_SUCCESS &&
+      memcmp(param->phy_update.bda, gapLink->_peer, sizeof(esp_bd_addr_t)) == 0)
+  {
+    gapLink->_stats.phy = param->phy_update.tx_phy;
+    Serial.printf("PHY updated: tx %u, rx %u\n", param->phy_update.tx_phy, param->phy_update.rx_phy);
+  }
+}
+#endif
+
+void BleLink::onDisconnect(BLEServer *server)
+{
+  _connected = false;
+  char buf[192];
+  formatStats(buf, sizeof(buf), millis());
+  Serial.print("Device Disconnected, ");
+  Serial.println(buf);
+}
+
+void BleLink::onMtuChanged(BLEServer *server, esp_ble_gatts_cb_param_t *param)
+{
+  _stats.mtu = param->mtu.mtu;
+  Serial.printf("MTU negotiated: %u\n", _stats.mtu);
+}
+
+void BleLink::onWrite(BLECharacteristic *characteristic)
+{
+  if (_commandHandler)
+    _commandHandler->onWrite(characteristic);
+}
+
+void BleLink::onStatus(BLECharacteristic *characteristic, Status status, uint32_t code)
+{
+  if (characteristic == _data)
+    _dataStatus = status;
+  else if (characteristic == _control)
+    _controlStatus = status;
+  else
+    return;
+
+  if (status == SUCCESS_NOTIFY || status == SUCCESS_INDICATE)
+  {
+    _stats.notifies++;
+    _stats.bytes += _lastNotifyLen;
+  }
+  else
+  {
+    _stats.dropped++;
+  }
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <Arduino.h>
+#include <BLEDevice.h>
+#include <BLEServer.h>
+#include <BLE2902.h>
+
+// BLE connection management for the Nirbhay GATT service.
+//
+// The service exposes two characteristics:
+//   - data    (original UUID): READ | NOTIFY, streamed telemetry and journal
+//             records. Still accepts WRITE so older app builds keep working.
+//   - control (new UUID):      WRITE | WRITE_NR | NOTIFY | INDICATE, commands
+//             from the phone and low-rate replies such as emergency responses.
+//
+// Only the client can start an ATT MTU exchange, so we advertise the largest
+// local MTU and let the phone negotiate up to it. The connection interval is
+// requested from our side on connect and whenever the link mode changes.
+//
+// 2M PHY is only requested when the SDK is built with the BLE 5.0 features
+// (CONFIG_BT_BLE_50_FEATURES_SUPPORTED). The arduino-esp32 2.x ESP32-S3 SDK
+// enables only the 4.2 features, so on this board the link stays on whatever
+// PHY the phone picks. That build also never reports a PHY update, so the link
+// stats show the PHY as unknown.
+
+#define BLE_LINK_MTU 517
+
+// Connection intervals are in 1.25 ms units, supervision timeout in 10 ms
+#define BLE_LOW_LATENCY_MIN_INTERVAL 6   // 7.5 ms
+#define BLE_LOW_LATENCY_MAX_INTERVAL 12  // 15 ms
+#define BLE_LOW_LATENCY_LATENCY 0
+#define BLE_LOW_LATENCY_TIMEOUT 400      // 4 s
+#define BLE_POWER_SAVE_MIN_INTERVAL 80   // 100 ms
+#define BLE_POWER_SAVE_MAX_INTERVAL 160  // 200 ms
+#define BLE_POWER_SAVE_LATENCY 4
+#define BLE_POWER_SAVE_TIMEOUT 600       // 6 s
+
+enum BleLinkMode : uint8_t
+{
+  LINK_POWER_SAVE = 0,
+  LINK_LOW_LATENCY = 1,
+};
+
+enum BleLinkPhy : uint8_t
+{
+  LINK_PHY_UNKNOWN = 0,
+  LINK_PHY_1M = 1, // same values as ESP_BLE_GAP_PHY_1M and friends
+  LINK_PHY_2M = 2,
+  LINK_PHY_CODED = 3,
+};
+
+struct BleLinkStats
+{
+  uint32_t connectedAtMs;
+  uint16_t mtu;
+  uint8_t mode;
+  uint8_t phy; // BleLinkPhy we transmit on
+  uint32_t notifies;  // notifies and indications confirmed by the stack
+  uint32_t bytes;     // payload bytes of confirmed notifies and indications
+  uint32_t dropped;   // rejected or failed (congested, no client, not subscribed,
+                      // indication not confirmed)
+  uint32_t truncated; // payloads longer than the negotiated MTU allows
+};
+
+class BleLink : public BLEServerCallbacks, public BLECharacteristicCallbacks
+{
+public:
+  void begin(const char *deviceName, const char *serviceUuid, const char *dataUuid,
+             const char *controlUuid, BLECharacteristicCallbacks *commandHandler);
+
+  bool connected() const { return _connected; }
+  void setMode(BleLinkMode mode);
+  BleLinkMode mode() const { return _mode; }
+  void startAdvertising();
+
+  // Notify on the data characteristic; true only when the stack reported
+  // SUCCESS_NOTIFY for the whole payload. False when the client is not
+  // subscribed, the stack rejected it or the payload was cut to the MTU. A
+  // notify is not acknowledged, so even true does not prove the phone got it.
+  bool stream(const uint8_t *data, size_t len);
+  bool stream(const char *message) { return stream((const uint8_t *)message, strlen(message)); }
+
+  // Indicate on the control characteristic, falling back to the data
+  // characteristic for clients that never subscribed to control; false as
+  // for stream(), and when an indication was not confirmed in time
+  bool sendControl(const char *message);
+  // The last sendControl() went out as an indication the phone confirmed
+  bool controlConfirmed() const { return _controlStatus == SUCCESS_INDICATE; }
+
+  // Largest payload one notify or indication carries whole, MTU - 3
+  size_t maxPayload() const { return _stats.mtu > 3 ? _stats.mtu - 3 : 0; }
+
+  const BleLinkStats &stats() const { return _stats; }
+  // Payload bytes per second since the connection was established
+  uint32_t throughput(uint32_t nowMs) const;
+  size_t formatStats(char *buf, size_t size, uint32_t nowMs) const;
+
+  // BLEServerCallbacks
+  void onConnect(BLEServer *server, esp_ble_gatts_cb_param_t *param) override;
+  void onDisconnect(BLEServer *server) override;
+  void onMtuChanged(BLEServer *server, esp_ble_gatts_cb_param_t *param) override;
+
+  // BLECharacteristicCallbacks, shared by both characteristics
+  void onWrite(BLECharacteristic *characteristic) override;
+  void onStatus(BLECharacteristic *characteristic, Status status, uint32_t code) override;
+
+private:
+  void applyConnParams();
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+  static void onGapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param);
+#endif
+
+  BLEServer *_server = NULL;
+  BLECharacteristic *_data = NULL;
+  BLECharacteristic *_control = NULL;
+  BLE2902 *_controlCccd = NULL;
+  BLECharacteristicCallbacks *_commandHandler = NULL;
+
+  volatile bool _connected = false;
+  esp_bd_addr_t _peer;
+  BleLinkMode _mode = LINK_POWER_SAVE;
+  BleLinkStats _stats = {};
+  size_t _lastNotifyLen = 0;
+  // Outcome of the last notify or indication on each characteristic. The
+  // stack calls onStatus() before notify() and indicate() return, so it is
+  // read right after the call.
+  Status _dataStatus = ERROR_NO_CLIENT;
+  Status _controlStatus = ERROR_NO_CLIENT;
+};
@@ -0,0 +1,238 @@
+#include "command_decode.h"
+#include <string.h>
+
+struct CommandSpec
+{
+  CommandOpcode opcode;
+  const char *name;  // "type" value in the JSON form
+  uint8_t argBytes;  // bytes after the opcode in the binary form
+};
+
+static const CommandSpec commandTable[] = {
+    {CMD_EMERGENCY_TIMER, "emergency_timer", 1},
+    {CMD_LINK_STATS, "link_stats", 0},
+    {CMD_JOURNAL_ACK, "journal_ack", 4},
+    {CMD_ALERT_ACK, "alert_ack", 4},
+};
+
+static const CommandSpec *findByOpcode(uint8_t opcode)
+{
+  for (const CommandSpec &spec : commandTable)
+  {
+    if (spec.opcode == opcode)
+      return &spec;
+  }
+  return NULL;
+}
+
+static const CommandSpec *findByName(const char *name, size_t len)
+{
+  for (const CommandSpec &spec : commandTable)
+  {
+    if (strlen(spec.name) == len && memcmp(spec.name, name, len) == 0)
+      return &spec;
+  }
+  return NULL;
+}
+
+const char *commandName(uint8_t opcode)
+{
+  const CommandSpec *spec = findByOpcode(opcode);
+  return spec ? spec->name : "?";
+}
+
+static bool decodeBinary(const uint8_t *data, size_t len, Command &command)
+{
+  const CommandSpec *spec = findByOpcode(data[0]);
+  if (!spec || len != 1u + spec->argBytes)
+    return false;
+
+  command.opcode = spec->opcode;
+  if (spec->opcode == CMD_EMERGENCY_TIMER)
+  {
+    if (data[1] == 0)
+      return false;
+    command.emergencyTimer.countdown = data[1];
+  }
+  else if (spec->opcode == CMD_JOURNAL_ACK || spec->opcode == CMD_ALERT_ACK)
+  {
+    uint32_t seq = data[1] | (uint32_t)data[2] << 8 | (uint32_t)data[3] << 16 | (uint32_t)data[4] << 24;
+    if (seq == 0)
+      return false;
+    if (spec->opcode == CMD_JOURNAL_ACK)
+      command.journalAck.seq = seq;
+    else
+      command.alertAck.seq = seq;
+  }
+  return true;
+}
+
+// Minimal scanner for flat JSON objects. Nested values are skipped, string
+// escapes are stepped over but not decoded, so an escaped "type" value never
+// matches a command name. Every loop advances the cursor, so the cost is
+// linear in the (bounded) write length.
+
+static size_t skipSpace(const char *s, size_t i, size_t len)
+{
+  while (i < len && (s[i] == ' ' || s[i] == '\t' || s[i] == '\r' || s[i] == '\n'))
+    i++;
+  return i;
+}
+
+// s[i] is the opening quote; returns the index just past the closing quote,
+// or len + 1 when the string is not closed
+static size_t skipString(const char *s, size_t i, size_t len)
+{
+  for (i++; i < len; i++)
+  {
+    if (s[i] == '\\')
+      i++;
+    else if (s[i] == '"')
+      return i + 1;
+  }
+  return len + 1;
+}
+
+// Returns the index just past the value, or len + 1 when it is not closed
+static size_t skipValue(const char *s, size_t i, size_t len)
+{
+  if (s[i] == '"')
+    return skipString(s, i, len);
+
+  int depth = 0;
+  while (i < len)
+  {
+    char c = s[i];
+    if (c == '"')
+    {
+      i = skipString(s, i, len);
+      continue;
+    }
+    if (c == '{' || c == '[')
+      depth++;
+    else if (c == '}' || c == ']')
+    {
+      if (depth == 0)
+        return i;
+      if (--depth == 0)
+        return i + 1;
+    }
+    else if (depth == 0 && (c == ',' || c == ' ' || c == '\t' || c == '\r' || c == '\n'))
+      return i;
+    i++;
+  }
+  return depth == 0 ? i : len + 1;
+}
+
+// A decimal 1..max with no sign, fraction or leading zeros
+static bool parseNumber(const char *s, size_t len, uint32_t max, uint32_t &value)
+{
+  if (len == 0 || len > 10 || s[0] == '0')
+    return false;
+  uint64_t result = 0;
+  for (size_t i = 0; i < len; i++)
+  {
+    if (s[i] < '0' || s[i] > '9')
+      return false;
+    result = result * 10 + (s[i] - '0');
+  }
+  if (result > max)
+    return false;
+  value = (uint32_t)result;
+  return true;
+}
+
+static bool decodeJson(const char *json, size_t len, Command &command)
+{
+  const CommandSpec *spec = NULL;
+  uint32_t countdown = DEFAULT_EMERGENCY_COUNTDOWN;
+  uint32_t seq = 0;
+
+  size_t i = skipSpace(json, 1, len);
+  bool closed = i < len && json[i] == '}';
+  while (!closed)
+  {
+    if (i >= len || json[i] != '"')
+      return false;
+    size_t keyStart = i + 1;
+    i = skipString(json, i, len);
+    if (i > len)
+      return false;
+    size_t keyLen = i - 1 - keyStart;
+
+    i = skipSpace(json, i, len);
+    if (i >= len || json[i] != ':')
+      return false;
+    i = skipSpace(json, i + 1, len);
+    if (i >= len)
+      return false;
+
+    size_t valueStart = i;
+    bool quoted = json[i] == '"';
+    i = skipValue(json, i, len);
+    if (i > len || i == valueStart)
+      return false;
+    const char *value = json + valueStart + (quoted ? 1 : 0);
+    size_t valueLen = i - valueStart - (quoted ? 2 : 0);
+
+    if (keyLen == 4 && memcmp(json + keyStart, "type", 4) == 0)
+    {
+      if (!quoted)
+        return false;
+      spec = findByName(value, valueLen);
+    }
+    else if (keyLen == 9 && memcmp(json + keyStart, "countdown", 9) == 0)
+    {
+      if (quoted || !parseNumber(value, valueLen, UINT8_MAX, countdown))
+        return false;
+    }
+    else if (keyLen == 3 && memcmp(json + keyStart, "seq", 3) == 0)
+    {
+      if (quoted || !parseNumber(value, valueLen, UINT32_MAX, seq))
+        return false;
+    }
+
+    // Either another member or the end of the object
+    i = skipSpace(json, i, len);
+    if (i >= len)
+      return false;
+    if (json[i] == ',')
+      i = skipSpace(json, i + 1, len);
+    else if (json[i] == '}')
+      closed = true;
+    else
+      return false;
+  }
+
+  // Nothing but white space after the object
+  if (skipSpace(json, i + 1, len) != len)
+    return false;
+
+  if (!spec)
+    return false;
+  command.opcode = spec->opcode;
+  if (spec->opcode == CMD_EMERGENCY_TIMER)
+    command.emergencyTimer.countdown = (uint8_t)countdown;
+  else if (spec->opcode == CMD_JOURNAL_ACK || spec->opcode == CMD_ALERT_ACK)
+  {
+    // No default: a missing seq must not acknowledge anything
+    if (seq == 0)
+      return false;
+    if (spec->opcode == CMD_JOURNAL_ACK)
+      command.journalAck.seq = seq;
+    else
+      command.alertAck.seq = seq;
+  }
+  return true;
+}
+
+bool decodeCommand(const uint8_t *data, size_t len, Command &command)
+{
+  if (!data || len == 0 || len > COMMAND_MAX_BYTES)
+    return false;
+
+  memset(&command, 0, sizeof(command));
+  if (data[0] == '{')
+    return decodeJson((const char *)data, len, command);
+  return decodeBinary(data, len, command);
+}
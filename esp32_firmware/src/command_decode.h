@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Wire formats of the commands written by the phone, decoded with no
+// Arduino, BLE or heap dependency so the decoder runs in the native tests.
+//
+// Two formats are accepted:
+//   - binary: [opcode][args...], args laid out as in the Command union
+//   - JSON:   a flat object such as {"type":"emergency_timer","countdown":10}
+//             or {"type":"journal_ack","seq":42}, {"type":"alert_ack","seq":3}
+// Writes longer than COMMAND_MAX_BYTES are rejected, so decoding time is
+// bounded by that size.
+
+#define COMMAND_MAX_BYTES 128
+#define DEFAULT_EMERGENCY_COUNTDOWN 10
+
+enum CommandOpcode : uint8_t
+{
+  CMD_NONE = 0,
+  CMD_EMERGENCY_TIMER = 1,
+  CMD_LINK_STATS = 2,
+  CMD_JOURNAL_ACK = 3,
+  CMD_ALERT_ACK = 4,
+  CMD_COUNT
+};
+
+struct Command
+{
+  uint8_t opcode;
+  union
+  {
+    struct
+    {
+      uint8_t countdown; // seconds, 1..255
+    } emergencyTimer;
+    struct
+    {
+      uint32_t seq; // little endian in the binary form, 1..2^32-1
+    } journalAck;
+    struct
+    {
+      uint32_t seq; // as for journalAck
+    } alertAck;
+  };
+};
+
+// Decode one write; false for unknown, malformed or truncated input and for
+// argument values out of range
+bool decodeCommand(const uint8_t *data, size_t len, Command &command);
+
+// "type" value of the JSON form, "?" for an unknown opcode
+const char *commandName(uint8_t opcode);
@@ -0,0 +1,36 @@
+#include "command_dispatch.h"
+
+bool CommandDispatcher::begin()
+{
+  _queue = xQueueCreate(COMMAND_QUEUE_LENGTH, sizeof(Command));
+  return _queue != NULL;
+}
+
+void CommandDispatcher::on(CommandOpcode opcode, CommandHandler handler)
+{
+  if (opcode < CMD_COUNT)
+    _handlers[opcode] = handler;
+}
+
+void CommandDispatcher::onWrite(BLECharacteristic *characteristic)
+{
+  Command command;
+  if (!decodeCommand(characteristic->getData(), characteristic->getLength(), command))
+  {
+    _rejected++;
+    return;
+  }
+  if (!_queue || xQueueSend(_queue, &command, 0) != pdTRUE)
+    _dropped++;
+}
+
+void CommandDispatcher::poll()
+{
+  Command command;
+  while (_queue && xQueueReceive(_queue, &command, 0) == pdTRUE)
+  {
+    Serial.printf("Command received: %s\n", commandName(command.opcode));
+    if (_handlers[command.opcode])
+      _handlers[command.opcode](command);
+  }
+}
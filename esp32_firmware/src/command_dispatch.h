@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Arduino.h>
+#include <BLEDevice.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include "command_decode.h"
+
+// Commands written by the phone, decoded inside the BLE stack's callback and
+// handed to the application task through a queue. Decoding (see
+// command_decode.h) works straight from the characteristic's buffer with no
+// heap allocation, so the time spent in the stack's thread is bounded by
+// COMMAND_MAX_BYTES.
+
+#define COMMAND_QUEUE_LENGTH 8
+
+typedef void (*CommandHandler)(const Command &command);
+
+class CommandDispatcher : public BLECharacteristicCallbacks
+{
+public:
+  bool begin();
+  void on(CommandOpcode opcode, CommandHandler handler);
+
+  // Run queued commands on the calling task; call from loop()
+  void poll();
+
+  uint32_t rejected() const { return _rejected; }
+  uint32_t dropped() const { return _dropped; }
+
+  // BLE stack context
+  void onWrite(BLECharacteristic *characteristic) override;
+
+private:
+  QueueHandle_t _queue = NULL;
+  CommandHandler _handlers[CMD_COUNT] = {};
+  volatile uint32_t _rejected = 0;
+  volatile uint32_t _dropped = 0;
+};
@@ -0,0 +1,369 @@
+#include "event_journal.h"
+#include <LittleFS.h>
+
+#define JOURNAL_CURSOR_PATH "/journal.cur"
+
+static void segmentPath(char *path, size_t size, uint8_t segment)
+{
+  snprintf(path, size, "/journal_%u.bin", segment);
+}
+
+static int16_t clampScaled(float value, float scale)
+{
+  float scaled = value * scale;
+  if (scaled > 32767.0f)
+    return 32767;
+  if (scaled < -32768.0f)
+    return -32768;
+  return (int16_t)scaled;
+}
+
+bool EventJournal::begin()
+{
+  if (!LittleFS.begin(true))
+  {
+    Serial.println("Journal: LittleFS mount failed");
+    return false;
+  }
+
+  _staging = xRingbufferCreate(JOURNAL_STAGING_BYTES, RINGBUF_TYPE_NOSPLIT);
+  _outbox = xRingbufferCreate(JOURNAL_OUTBOX_BYTES, RINGBUF_TYPE_NOSPLIT);
+  if (!_staging || !_outbox)
+  {
+    Serial.println("Journal: out of memory");
+    return false;
+  }
+
+  File cursor = LittleFS.exists(JOURNAL_CURSOR_PATH) ? LittleFS.open(JOURNAL_CURSOR_PATH, FILE_READ) : File();
+  if (cursor)
+  {
+    cursor.read((uint8_t *)&_uploadedSeq, sizeof(_uploadedSeq));
+    cursor.close();
+  }
+  _cursor.reset(_uploadedSeq);
+
+  recoverSegments();
+  Serial.printf("Journal: segment %u, %u bytes, last seq %u, uploaded %u\n",
+                _segment, (unsigned)_segmentBytes, (unsigned)_seq, (unsigned)_uploadedSeq);
+
+  // Core 0 next to the BLE stack; the Arduino loop owns core 1
+  xTaskCreatePinnedToCore(writerTask, "journal", 4096, this, 1, &_task, 0);
+  return _task != NULL;
+}
+
+void EventJournal::recordSample(uint32_t nowMs, const float acc[3], const float gyr[3], int heartRate, bool fingerPresent)
+{
+  JournalSample sample;
+  sample.dtMs = 0;
+  for (int i = 0; i < 3; i++)
+  {
+    sample.acc[i] = clampScaled(acc[i], 1000.0f);
+    sample.gyr[i] = clampScaled(gyr[i], 10.0f);
+  }
+  sample.heartRate = (uint8_t)constrain(heartRate, 0, 255);
+  sample.flags = fingerPresent ? 0x01 : 0x00;
+
+  if (_postRemaining > 0)
+  {
+    appendPending(nowMs, sample);
+    if (--_postRemaining == 0)
+      flushSampleRecord();
+    return;
+  }
+
+  _history[_historyHead] = sample;
+  _historyTime[_historyHead] = nowMs;
+  _historyHead = (_historyHead + 1) % JOURNAL_PRE_SAMPLES;
+  if (_historyCount < JOURNAL_PRE_SAMPLES)
+    _historyCount++;
+}
+
+void EventJournal::recordAlert(uint32_t nowMs, JournalAlertKind kind, int heartRate, int countdown)
+{
+  JournalAlert alert;
+  alert.kind = kind;
+  alert.heartRate = (uint8_t)constrain(heartRate, 0, 255);
+  alert.countdown = (uint8_t)constrain(countdown, 0, 255);
+  alert.flags = 0;
+  stage(JOURNAL_ALERT, nowMs, &alert, sizeof(alert));
+
+  if (kind != ALERT_EMERGENCY_STARTED)
+    return;
+
+  // Dump the pre-trigger history oldest first, then keep capturing
+  uint8_t index = (_historyHead + JOURNAL_PRE_SAMPLES - _historyCount) % JOURNAL_PRE_SAMPLES;
+  for (uint8_t i = 0; i < _historyCount; i++)
+  {
+    appendPending(_historyTime[index], _history[index]);
+    index = (index + 1) % JOURNAL_PRE_SAMPLES;
+  }
+  _historyCount = 0;
+  _postRemaining = JOURNAL_POST_SAMPLES;
+}
+
+void EventJournal::appendPending(uint32_t timeMs, const JournalSample &sample)
+{
+  if (_pendingCount > 0 && timeMs - _pendingStart > 0xFFFF)
+    flushSampleRecord();
+  if (_pendingCount == 0)
+    _pendingStart = timeMs;
+
+  _pending[_pendingCount] = sample;
+  _pending[_pendingCount].dtMs = (uint16_t)(timeMs - _pendingStart);
+  if (++_pendingCount == JOURNAL_SAMPLES_PER_RECORD)
+    flushSampleRecord();
+}
+
+void EventJournal::flushSampleRecord()
+{
+  if (_pendingCount == 0)
+    return;
+  stage(JOURNAL_SAMPLES, _pendingStart, _pending, _pendingCount * sizeof(JournalSample));
+  _pendingCount = 0;
+}
+
+bool EventJournal::stage(JournalRecordType type, uint32_t timestampMs, const void *payload, uint8_t length)
+{
+  if (!_staging)
+    return false;
+
+  // The CRC is appended by the writer task to keep this path short
+  uint8_t rec[sizeof(JournalRecordHeader) + JOURNAL_MAX_PAYLOAD];
+  JournalRecordHeader *header = (JournalRecordHeader *)rec;
+  header->magic = JOURNAL_MAGIC;
+  header->type = type;
+  header->length = length;
+  header->seq = ++_seq;
+  header->timestampMs = timestampMs;
+  memcpy(rec + sizeof(JournalRecordHeader), payload, length);
+
+  if (xRingbufferSend(_staging, rec, sizeof(JournalRecordHeader) + length, 0) != pdTRUE)
+  {
+    _dropped++;
+    return false;
+  }
+  return true;
+}
+
+void EventJournal::requestUpload()
+{
+  _cursor.rewind();
+  _uploadRequested = true;
+}
+
+size_t EventJournal::nextUploadRecord(uint8_t *buf, size_t bufSize)
+{
+  if (!_outbox)
+    return 0;
+
+  size_t size = 0;
+  uint8_t *item = (uint8_t *)xRingbufferReceive(_outbox, &size, 0);
+  if (!item)
+    return 0;
+
+  size_t copied = 0;
+  if (size <= bufSize)
+  {
+    memcpy(buf, item, size);
+    copied = size;
+  }
+  vRingbufferReturnItem(_outbox, item);
+  return copied;
+}
+
+void EventJournal::writerTask(void *arg)
+{
+  ((EventJournal *)arg)->writerLoop();
+}
+
+void EventJournal::writerLoop()
+{
+  for (;;)
+  {
+    // The timeout bounds how long upload and cursor requests wait
+    drainStaging(pdMS_TO_TICKS(200));
+
+    uint32_t acknowledged = _cursor.acknowledged();
+    if (acknowledged > _uploadedSeq)
+      saveCursor(acknowledged);
+
+    if (_uploadRequested)
+    {
+      _uploadRequested = false;
+      upload();
+    }
+  }
+}
+
+void EventJournal::drainStaging(TickType_t wait)
+{
+  bool wrote = false;
+  size_t size = 0;
+  uint8_t *item;
+  while ((item = (uint8_t *)xRingbufferReceive(_staging, &size, wait)) != NULL)
+  {
+    writeRecord(item, size);
+    vRingbufferReturnItem(_staging, item);
+    wrote = true;
+    wait = 0;
+  }
+  if (wrote)
+    _file.flush();
+}
+
+void EventJournal::writeRecord(const uint8_t *rec, size_t len)
+{
+  if (_segmentBytes + len + sizeof(uint32_t) > JOURNAL_SEGMENT_BYTES)
+    openSegment((_segment + 1) % JOURNAL_SEGMENT_COUNT, true);
+  if (!_file)
+    return;
+
+  uint32_t checksum = crc(rec, len);
+  _file.write(rec, len);
+  _file.write((const uint8_t *)&checksum, sizeof(checksum));
+  _segmentBytes += len + sizeof(checksum);
+}
+
+void EventJournal::openSegment(uint8_t segment, bool truncate)
+{
+  char path[24];
+  segmentPath(path, sizeof(path), segment);
+  if (_file)
+    _file.close();
+  _file = LittleFS.open(path, truncate ? FILE_WRITE : FILE_APPEND);
+  _segment = segment;
+  _segmentBytes = truncate ? 0 : _file.size();
+}
+
+void EventJournal::recoverSegments()
+{
+  // The active segment is the one whose first record is the newest
+  uint32_t newestFirstSeq = 0;
+  uint8_t active = 0;
+  for (uint8_t i = 0; i < JOURNAL_SEGMENT_COUNT; i++)
+  {
+    char path[24];
+    segmentPath(path, sizeof(path), i);
+    if (!LittleFS.exists(path))
+      continue;
+    File f = LittleFS.open(path, FILE_READ);
+    JournalRecordHeader header;
+    if (f && f.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+        header.magic == JOURNAL_MAGIC && header.seq > newestFirstSeq)
+    {
+      newestFirstSeq = header.seq;
+      active = i;
+    }
+  }
+
+  // Walk it to find the last intact record
+  char path[24];
+  segmentPath(path, sizeof(path), active);
+  File f = LittleFS.exists(path) ? LittleFS.open(path, FILE_READ) : File();
+  uint32_t validBytes = 0;
+  bool torn = false;
+  if (f)
+  {
+    uint8_t rec[JOURNAL_MAX_RECORD];
+    JournalRecordHeader *header = (JournalRecordHeader *)rec;
+    while (f.read(rec, sizeof(JournalRecordHeader)) == sizeof(JournalRecordHeader))
+    {
+      size_t rest = header->length + sizeof(uint32_t);
+      if (header->magic != JOURNAL_MAGIC || header->length > JOURNAL_MAX_PAYLOAD ||
+          f.read(rec + sizeof(JournalRecordHeader), rest) != rest ||
+          !validRecord(rec, sizeof(JournalRecordHeader) + rest))
+      {
+        torn = true;
+        break;
+      }
+      _seq = header->seq;
+      validBytes += sizeof(JournalRecordHeader) + rest;
+    }
+    torn = torn || validBytes != f.size();
+    f.close();
+  }
+
+  if (_seq < _uploadedSeq)
+    _seq = _uploadedSeq;
+
+  // A torn tail from a power cut can't be truncated in place; start fresh
+  if (torn)
+    openSegment((active + 1) % JOURNAL_SEGMENT_COUNT, true);
+  else
+    openSegment(active, false);
+}
+
+void EventJournal::upload()
+{
+  _file.flush();
+
+  uint8_t rec[JOURNAL_MAX_RECORD];
+  JournalRecordHeader *header = (JournalRecordHeader *)rec;
+
+  // Oldest segment first; the active one is read last
+  for (uint8_t n = 1; n <= JOURNAL_SEGMENT_COUNT; n++)
+  {
+    char path[24];
+    segmentPath(path, sizeof(path), (_segment + n) % JOURNAL_SEGMENT_COUNT);
+    if (!LittleFS.exists(path))
+      continue;
+    File f = LittleFS.open(path, FILE_READ);
+    if (!f)
+      continue;
+
+    while (f.read(rec, sizeof(JournalRecordHeader)) == sizeof(JournalRecordHeader))
+    {
+      size_t rest = header->length + sizeof(uint32_t);
+      size_t len = sizeof(JournalRecordHeader) + rest;
+      if (header->magic != JOURNAL_MAGIC || header->length > JOURNAL_MAX_PAYLOAD ||
+          f.read(rec + sizeof(JournalRecordHeader), rest) != rest || !validRecord(rec, len))
+        break;
+      if (header->seq <= _uploadedSeq)
+        continue;
+
+      // Keep journaling while the loop drains the outbox
+      while (xRingbufferSend(_outbox, rec, len, pdMS_TO_TICKS(20)) != pdTRUE)
+      {
+        drainStaging(0);
+        if (_uploadRequested)
+        {
+          // Reconnected mid-upload; restart from the cursor
+          f.close();
+          return;
+        }
+      }
+      drainStaging(0);
+    }
+    f.close();
+  }
+}
+
+void EventJournal::saveCursor(uint32_t seq)
+{
+  File cursor = LittleFS.open(JOURNAL_CURSOR_PATH, FILE_WRITE);
+  if (cursor)
+  {
+    cursor.write((const uint8_t *)&seq, sizeof(seq));
+    cursor.close();
+  }
+  _uploadedSeq = seq;
+}
+
+bool EventJournal::validRecord(const uint8_t *rec, size_t len)
+{
+  uint32_t stored;
+  memcpy(&stored, rec + len - sizeof(uint32_t), sizeof(stored));
+  return crc(rec, len - sizeof(uint32_t)) == stored;
+}
+
+uint32_t EventJournal::crc(const uint8_t *data, size_t len)
+{
+  uint32_t crc = 0xFFFFFFFF;
+  while (len--)
+  {
+    crc ^= *data++;
+    for (int i = 0; i < 8; i++)
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/ringbuf.h>
+#include <freertos/task.h>
+#include "journal_upload.h"
+
+// Append-only event journal kept in LittleFS.
+//
+// Records are staged in a RAM ring buffer by the sampling loop and written to
+// flash by a background task, so a slow flash write never stalls sensing. The
+// journal is split into JOURNAL_SEGMENT_COUNT segment files used round-robin:
+// when the active segment is full the oldest one is recycled, which spreads
+// erases across the whole partition (LittleFS does the block-level levelling).
+//
+// Sizing: an alert is one ALERT record plus a pre/post-trigger window of
+// JOURNAL_PRE_SAMPLES + JOURNAL_POST_SAMPLES samples, about 2 KB on flash.
+// The 1 MB ring holds ~500 alerts, a week at ~70 alerts per day.
+
+#define JOURNAL_MAGIC 0x4A4E // "NJ"
+#define JOURNAL_SEGMENT_COUNT 8
+#define JOURNAL_SEGMENT_BYTES (128 * 1024)
+#define JOURNAL_STAGING_BYTES (8 * 1024)
+#define JOURNAL_OUTBOX_BYTES (4 * 1024)
+#define JOURNAL_PRE_SAMPLES 40      // 2 s of history; imuTask reads the IMU at 1 kHz,
+                                    // the journal gets the loop's 20 Hz copy
+#define JOURNAL_POST_SAMPLES 60     // 3 s after the trigger
+#define JOURNAL_SAMPLES_PER_RECORD 12
+#define JOURNAL_MAX_PAYLOAD (JOURNAL_SAMPLES_PER_RECORD * sizeof(JournalSample))
+
+enum JournalRecordType : uint8_t
+{
+  JOURNAL_ALERT = 1,
+  JOURNAL_SAMPLES = 2,
+};
+
+enum JournalAlertKind : uint8_t
+{
+  ALERT_EMERGENCY_STARTED = 1,
+  ALERT_EMERGENCY_CANCELLED = 2,
+  ALERT_SOS_SENT = 3,
+};
+
+#pragma pack(push, 1)
+struct JournalRecordHeader
+{
+  uint16_t magic;
+  uint8_t type;
+  uint8_t length; // payload bytes, followed by a CRC32 over header + payload
+  uint32_t seq;
+  uint32_t timestampMs;
+};
+
+struct JournalAlert
+{
+  uint8_t kind;
+  uint8_t heartRate;
+  uint8_t countdown;
+  uint8_t flags;
+};
+
+struct JournalSample
+{
+  uint16_t dtMs;     // offset from the record timestamp
+  int16_t acc[3];    // milli-g
+  int16_t gyr[3];    // 0.1 dps
+  uint8_t heartRate; // averaged BPM, 0 when unknown
+  uint8_t flags;     // bit 0: finger present
+};
+#pragma pack(pop)
+
+#define JOURNAL_MAX_RECORD (sizeof(JournalRecordHeader) + JOURNAL_MAX_PAYLOAD + sizeof(uint32_t))
+
+class EventJournal
+{
+public:
+  bool begin();
+
+  // Called from the sampling loop; never touches flash and never blocks.
+  void recordSample(uint32_t nowMs, const float acc[3], const float gyr[3], int heartRate, bool fingerPresent);
+  void recordAlert(uint32_t nowMs, JournalAlertKind kind, int heartRate, int countdown);
+
+  // Queue every record newer than the last acknowledged one for delivery to
+  // the phone. The upload functions below are for the loop task only.
+  void requestUpload();
+  // Pop the next record queued for upload into buf; returns its size or 0.
+  size_t nextUploadRecord(uint8_t *buf, size_t bufSize);
+  // The last chunk of record seq went out
+  void uploadSent(uint32_t seq, uint32_t nowMs) { _cursor.sent(seq, nowMs); }
+  // The phone acknowledged every record up to seq; the writer task persists
+  // the cursor, so these records are not uploaded again
+  bool acknowledgeUpload(uint32_t seq, uint32_t nowMs) { return _cursor.acknowledge(seq, nowMs); }
+  bool uploadPending() const { return _cursor.pending(); }
+  bool uploadAckOverdue(uint32_t nowMs) const { return _cursor.ackOverdue(nowMs); }
+
+  uint32_t droppedRecords() const { return _dropped; }
+  uint32_t lastSeq() const { return _seq; }
+
+private:
+  static void writerTask(void *arg);
+  void writerLoop();
+  bool stage(JournalRecordType type, uint32_t timestampMs, const void *payload, uint8_t length);
+  void flushSampleRecord();
+  void writeRecord(const uint8_t *rec, size_t len);
+  void openSegment(uint8_t segment, bool truncate);
+  void recoverSegments();
+  void appendPending(uint32_t timeMs, const JournalSample &sample);
+  void upload();
+  void drainStaging(TickType_t wait);
+  void saveCursor(uint32_t seq);
+  static bool validRecord(const uint8_t *rec, size_t len);
+  static uint32_t crc(const uint8_t *data, size_t len);
+
+  RingbufHandle_t _staging = NULL;
+  RingbufHandle_t _outbox = NULL;
+  TaskHandle_t _task = NULL;
+  volatile bool _uploadRequested = false;
+  volatile uint32_t _dropped = 0;
+  JournalUploadCursor _cursor;
+  uint32_t _seq = 0;
+
+  // Pre-trigger history, owned by the sampling loop
+  JournalSample _history[JOURNAL_PRE_SAMPLES];
+  uint32_t _historyTime[JOURNAL_PRE_SAMPLES];
+  uint8_t _historyHead = 0;
+  uint8_t _historyCount = 0;
+  uint8_t _postRemaining = 0;
+
+  // Sample record being filled, owned by the sampling loop
+  JournalSample _pending[JOURNAL_SAMPLES_PER_RECORD];
+  uint32_t _pendingStart = 0;
+  uint8_t _pendingCount = 0;
+
+  // Flash state, owned by the writer task
+  File _file;
+  uint8_t _segment = 0;
+  uint32_t _segmentBytes = 0;
+  uint32_t _uploadedSeq = 0;
+};
@@ -0,0 +1,227 @@
+#include "fall_detector.h"
+#include <math.h>
+#include <string.h>
+
+static int16_t toMilliG(float g)
+{
+  float mg = g * 1000.0f;
+  if (mg > 32767.0f)
+    return 32767;
+  if (mg < -32768.0f)
+    return -32768;
+  return (int16_t)mg;
+}
+
+FallDetector::FallDetector()
+{
+  const FallDetectorConfig defaults = FALL_DETECTOR_DEFAULTS;
+  begin(defaults);
+}
+
+void FallDetector::begin(const FallDetectorConfig &config)
+{
+  _config = config;
+
+  uint32_t perMs = config.sampleRateHz;
+  _freeFallMinSamples = config.freeFallMinMs * perMs / 1000;
+  _impactWindowSamples = config.impactWindowMs * perMs / 1000;
+  _settleSamples = config.settleMs * perMs / 1000;
+  _confirmSamples = (uint32_t)config.confirmTimeoutMs * perMs / 1000;
+  _decimation = config.sampleRateHz / FALL_DETECTOR_SLOT_HZ;
+  if (_decimation == 0)
+    _decimation = 1;
+
+  _stillSlots = config.stillnessMs * FALL_DETECTOR_SLOT_HZ / 1000;
+  if (_stillSlots < FALL_DETECTOR_ORIENT_SLOTS)
+    _stillSlots = FALL_DETECTOR_ORIENT_SLOTS;
+  if (_stillSlots > FALL_DETECTOR_SLOTS)
+    _stillSlots = FALL_DETECTOR_SLOTS;
+
+  _cosOrientation = cosf(config.orientationChangeDeg * (float)M_PI / 180.0f);
+  int64_t limit = (int64_t)(config.stillnessG * 1000.0f);
+  _stillVarianceLimit = limit * limit;
+
+  _stage = STAGE_MONITOR;
+  _sampleIndex = 0;
+  _freeFallSamples = 0;
+  _accX = _accY = _accZ = _accMag = 0;
+  _accCount = 0;
+  memset(_slots, 0, sizeof(_slots));
+  _head = 0;
+  _filled = 0;
+  _magSum = 0;
+  _magSqSum = 0;
+  memset(_orientSum, 0, sizeof(_orientSum));
+  memset(_preOrient, 0, sizeof(_preOrient));
+}
+
+FallDetectorEvent FallDetector::update(float ax, float ay, float az)
+{
+  float mag = sqrtf(ax * ax + ay * ay + az * az);
+  bool slotDone = pushSample(ax, ay, az, mag);
+  uint32_t index = ++_sampleIndex;
+  uint32_t inStage = index - _stageStart;
+
+  switch (_stage)
+  {
+  case STAGE_MONITOR:
+    if (mag >= _config.blowG)
+    {
+      snapshotOrientation();
+      _lastImpactG = mag;
+      _stage = STAGE_POST_IMPACT;
+      _stageStart = index;
+      return FALL_SUSPECTED;
+    }
+    if (mag < _config.freeFallG)
+    {
+      // Remember where gravity pointed before the drop started
+      if (_freeFallSamples++ == 0)
+        snapshotOrientation();
+      if (_freeFallSamples >= _freeFallMinSamples)
+      {
+        _stage = STAGE_FREE_FALL;
+        _stageStart = index;
+      }
+    }
+    else
+    {
+      _freeFallSamples = 0;
+    }
+    break;
+
+  case STAGE_FREE_FALL:
+    if (mag >= _config.impactG)
+    {
+      _lastImpactG = mag;
+      _stage = STAGE_POST_IMPACT;
+      _stageStart = index;
+      return FALL_SUSPECTED;
+    }
+    if (inStage > _impactWindowSamples)
+    {
+      _stage = STAGE_MONITOR;
+      _freeFallSamples = 0;
+    }
+    break;
+
+  case STAGE_POST_IMPACT:
+    if (mag > _lastImpactG)
+      _lastImpactG = mag;
+    if (inStage >= _settleSamples)
+    {
+      _stage = STAGE_STILLNESS;
+      _stageStart = index;
+      _slotsSinceStage = 0;
+    }
+    break;
+
+  case STAGE_STILLNESS:
+    if (slotDone && ++_slotsSinceStage >= _stillSlots && still() &&
+        (orientationChanged() || heartRateRising()))
+    {
+      _stage = STAGE_MONITOR;
+      _freeFallSamples = 0;
+      return FALL_CONFIRMED;
+    }
+    if (inStage > _confirmSamples)
+    {
+      _stage = STAGE_MONITOR;
+      _freeFallSamples = 0;
+      return FALL_CLEARED;
+    }
+    break;
+  }
+  return FALL_NONE;
+}
+
+bool FallDetector::pushSample(float ax, float ay, float az, float mag)
+{
+  _accX += ax;
+  _accY += ay;
+  _accZ += az;
+  _accMag += mag;
+  if (++_accCount < _decimation)
+    return false;
+
+  float scale = 1.0f / _accCount;
+  Slot slot = {toMilliG(_accX * scale), toMilliG(_accY * scale), toMilliG(_accZ * scale),
+               toMilliG(_accMag * scale)};
+  _accX = _accY = _accZ = _accMag = 0;
+  _accCount = 0;
+
+  // Slide both spans: drop the slot that falls out of each, add the new one
+  if (_filled >= _stillSlots)
+  {
+    const Slot &old = _slots[(_head + FALL_DETECTOR_SLOTS - _stillSlots) % FALL_DETECTOR_SLOTS];
+    _magSum -= old.mag;
+    _magSqSum -= (int32_t)old.mag * old.mag;
+  }
+  if (_filled >= FALL_DETECTOR_ORIENT_SLOTS)
+  {
+    const Slot &old = _slots[(_head + FALL_DETECTOR_SLOTS - FALL_DETECTOR_ORIENT_SLOTS) % FALL_DETECTOR_SLOTS];
+    _orientSum[0] -= old.x;
+    _orientSum[1] -= old.y;
+    _orientSum[2] -= old.z;
+  }
+
+  _slots[_head] = slot;
+  _head = (_head + 1) % FALL_DETECTOR_SLOTS;
+  if (_filled < FALL_DETECTOR_SLOTS)
+    _filled++;
+
+  _magSum += slot.mag;
+  _magSqSum += (int32_t)slot.mag * slot.mag;
+  _orientSum[0] += slot.x;
+  _orientSum[1] += slot.y;
+  _orientSum[2] += slot.z;
+  return true;
+}
+
+void FallDetector::snapshotOrientation()
+{
+  memcpy(_preOrient, _orientSum, sizeof(_preOrient));
+}
+
+bool FallDetector::orientationChanged() const
+{
+  // Sums over the same span, so the common scale cancels out
+  float dot = 0, before = 0, after = 0;
+  for (int i = 0; i < 3; i++)
+  {
+    dot += (float)_preOrient[i] * _orientSum[i];
+    before += (float)_preOrient[i] * _preOrient[i];
+    after += (float)_orientSum[i] * _orientSum[i];
+  }
+  if (before <= 0 || after <= 0)
+    return false;
+  return dot < _cosOrientation * sqrtf(before * after);
+}
+
+bool FallDetector::still() const
+{
+  if (_filled < _stillSlots)
+    return false;
+  int64_t n = _stillSlots;
+  int64_t variance = (_magSqSum * n - (int64_t)_magSum * _magSum) / (n * n);
+  return variance <= _stillVarianceLimit;
+}
+
+void FallDetector::updateHeartRate(int bpm)
+{
+  if (bpm <= 0)
+    return;
+  if (_hrBaseline == 0)
+  {
+    _hrBaseline = _hrFast = bpm;
+    return;
+  }
+  // Fed at ~20 Hz: the baseline follows over ~15 s, the fast average over ~1 s
+  _hrBaseline += (bpm - _hrBaseline) / 256.0f;
+  _hrFast += (bpm - _hrFast) / 16.0f;
+}
+
+bool FallDetector::heartRateRising() const
+{
+  return _hrBaseline > 0 && _hrFast - _hrBaseline >= _config.hrRiseBpm;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <stdint.h>
+
+// Streaming fall / assault detector fed with the full-rate accelerometer.
+//
+// Stages, each a few compares per sample:
+//   1. free fall     |a| stays below freeFallG for freeFallMinMs
+//   2. impact        |a| peaks above impactG within impactWindowMs
+//                    (a blow above blowG skips the free-fall stage)
+//   3. settle        the bounce after the impact is ignored for settleMs
+//   4. stillness     std-dev of |a| over stillnessMs stays below stillnessG,
+//                    with the gravity vector tilted by orientationChangeDeg
+//                    from where it was before the event
+// An impact reports FALL_SUSPECTED; stillness within confirmTimeoutMs
+// reports FALL_CONFIRMED, otherwise FALL_CLEARED (the wearer got up).
+// A heart rate that has risen hrRiseBpm over its baseline stands in for the
+// orientation change, since someone who is attacked is not always lying down.
+//
+// Window statistics run on a 50 Hz decimated stream held in a fixed circular
+// buffer with running sums, so update() is O(1) and allocation-free.
+
+#define FALL_DETECTOR_SLOT_HZ 50
+#define FALL_DETECTOR_SLOTS 128 // 2.56 s of decimated history
+#define FALL_DETECTOR_ORIENT_SLOTS 25
+
+struct FallDetectorConfig
+{
+  uint16_t sampleRateHz;      // rate update() is called at
+  float freeFallG;            // |a| below this counts as free fall
+  uint16_t freeFallMinMs;     // shortest free fall that counts
+  uint16_t impactWindowMs;    // impact has to follow the free fall within this
+  float impactG;              // impact peak after a free fall
+  float blowG;                // peak that counts without a free fall
+  uint16_t settleMs;          // time to ignore after the impact
+  float orientationChangeDeg; // tilt between before and after the event
+  uint16_t stillnessMs;       // window that has to stay still, <= 2.56 s
+  float stillnessG;           // max std-dev of |a| over that window
+  uint16_t confirmTimeoutMs;  // give up waiting for stillness after this
+  uint8_t hrRiseBpm;          // heart-rate rise that waives the tilt check
+};
+
+#define FALL_DETECTOR_DEFAULTS {1000, 0.35f, 80, 800, 2.5f, 6.0f, 500, 45.0f, 2000, 0.08f, 10000, 20}
+
+enum FallDetectorEvent : uint8_t
+{
+  FALL_NONE = 0,
+  FALL_SUSPECTED,
+  FALL_CONFIRMED,
+  FALL_CLEARED,
+};
+
+class FallDetector
+{
+public:
+  FallDetector();
+  void begin(const FallDetectorConfig &config);
+
+  // One accelerometer sample in g
+  FallDetectorEvent update(float ax, float ay, float az);
+
+  // Secondary signal; 0 means unknown and is ignored
+  void updateHeartRate(int bpm);
+  bool heartRateRising() const;
+
+  // Not synchronised: read it on the task that calls update()
+  float lastImpactG() const { return _lastImpactG; }
+
+private:
+  enum Stage : uint8_t
+  {
+    STAGE_MONITOR,
+    STAGE_FREE_FALL,
+    STAGE_POST_IMPACT,
+    STAGE_STILLNESS,
+  };
+
+  struct Slot
+  {
+    int16_t x, y, z; // mean acceleration, mg
+    int16_t mag;     // mean |a|, mg
+  };
+
+  bool pushSample(float ax, float ay, float az, float mag);
+  void snapshotOrientation();
+  bool orientationChanged() const;
+  bool still() const;
+
+  FallDetectorConfig _config;
+  Stage _stage = STAGE_MONITOR;
+  uint32_t _sampleIndex = 0;
+  uint32_t _stageStart = 0;
+  uint32_t _freeFallSamples = 0;
+  float _lastImpactG = 0;
+
+  // Thresholds converted to samples / squared units by begin()
+  uint32_t _freeFallMinSamples;
+  uint32_t _impactWindowSamples;
+  uint32_t _settleSamples;
+  uint32_t _confirmSamples;
+  uint16_t _stillSlots;
+  uint16_t _decimation;
+  float _cosOrientation;
+  int64_t _stillVarianceLimit;
+
+  // Decimation accumulator
+  float _accX = 0, _accY = 0, _accZ = 0, _accMag = 0;
+  uint16_t _accCount = 0;
+
+  // Circular window with running sums over the stillness and orientation spans
+  Slot _slots[FALL_DETECTOR_SLOTS];
+  uint16_t _head = 0;
+  uint16_t _filled = 0;
+  uint16_t _slotsSinceStage = 0;
+  int32_t _magSum = 0;
+  int64_t _magSqSum = 0;
+  int32_t _orientSum[3] = {0, 0, 0};
+  int32_t _preOrient[3] = {0, 0, 0};
+
+  float _hrBaseline = 0;
+  float _hrFast = 0;
+};
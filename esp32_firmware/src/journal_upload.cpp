@@ -0,0 +1,69 @@
+#include "journal_upload.h"
+#include <stdio.h>
+
+size_t journalChunkBytes(size_t maxPayload)
+{
+  if (maxPayload < JOURNAL_UPLOAD_MIN_PAYLOAD)
+    return 0;
+  return (maxPayload - JOURNAL_CHUNK_OVERHEAD) / 2;
+}
+
+size_t journalChunkCount(size_t recordLen, size_t chunkBytes)
+{
+  if (chunkBytes == 0)
+    return 0;
+  return (recordLen + chunkBytes - 1) / chunkBytes;
+}
+
+size_t formatJournalChunk(char *out, size_t outSize, const uint8_t *record, size_t recordLen, uint32_t seq,
+                          size_t chunkBytes, size_t part)
+{
+  static const char hex[] = "0123456789abcdef";
+  size_t parts = journalChunkCount(recordLen, chunkBytes);
+  if (part >= parts || parts > 255)
+    return 0;
+
+  size_t start = part * chunkBytes;
+  size_t len = recordLen - start < chunkBytes ? recordLen - start : chunkBytes;
+  if (outSize < JOURNAL_CHUNK_OVERHEAD + 2 * len + 1)
+    return 0;
+
+  int pos = snprintf(out, outSize, "{\"journal\":\"");
+  for (size_t i = start; i < start + len; i++)
+  {
+    out[pos++] = hex[record[i] >> 4];
+    out[pos++] = hex[record[i] & 0x0F];
+  }
+  pos += snprintf(out + pos, outSize - pos, "\",\"seq\":%lu,\"part\":%u,\"parts\":%u}", (unsigned long)seq,
+                  (unsigned)part, (unsigned)parts);
+  return pos;
+}
+
+void JournalUploadCursor::reset(uint32_t seq)
+{
+  _acked = seq;
+  _sent = seq;
+}
+
+void JournalUploadCursor::sent(uint32_t seq, uint32_t nowMs)
+{
+  if (seq > _sent)
+    _sent = seq;
+  _lastMs = nowMs;
+}
+
+bool JournalUploadCursor::acknowledge(uint32_t seq, uint32_t nowMs)
+{
+  if (seq > _sent)
+    seq = _sent;
+  if (seq <= _acked)
+    return false;
+  _acked = seq;
+  _lastMs = nowMs;
+  return true;
+}
+
+void JournalUploadCursor::rewind()
+{
+  _sent = _acked;
+}
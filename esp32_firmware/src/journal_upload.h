@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Delivery of journal records to the phone, with no Arduino or BLE
+// dependency so it runs in the native tests.
+//
+// A record is hex encoded and split into chunks that each fit one notify:
+//   {"journal":"<hex>","seq":S,"part":P,"parts":N}
+// The phone reassembles the N parts of record S and answers with
+// {"type":"journal_ack","seq":S} once it holds every record up to S. Only
+// an acknowledged sequence number is written to the upload cursor, so a
+// record lost to a disconnect or a dropped notify is sent again on the next
+// upload instead of being skipped for good.
+
+#define JOURNAL_ACK_TIMEOUT_MS 5000
+// Smallest notify payload worth uploading on: 21 record bytes per chunk,
+// at most 10 chunks per record. The 20 bytes of the default 23 byte MTU
+// don't even hold the JSON wrapper, so the upload waits for the exchange.
+#define JOURNAL_UPLOAD_MIN_PAYLOAD 96
+#define JOURNAL_CHUNK_OVERHEAD (sizeof("{\"journal\":\"\",\"seq\":4294967295,\"part\":255,\"parts\":255}") - 1)
+
+// Record bytes carried by each chunk at this notify payload size, 0 when the
+// payload is below JOURNAL_UPLOAD_MIN_PAYLOAD
+size_t journalChunkBytes(size_t maxPayload);
+size_t journalChunkCount(size_t recordLen, size_t chunkBytes);
+
+// Format chunk `part` of the record into out; returns the message length, 0
+// when the part does not exist or out is too small
+size_t formatJournalChunk(char *out, size_t outSize, const uint8_t *record, size_t recordLen, uint32_t seq,
+                          size_t chunkBytes, size_t part);
+
+// Upload cursor: the highest record sent to the phone and the highest one it
+// acknowledged. Only the loop task calls the mutators; acknowledged() may be
+// read from the journal's writer task.
+class JournalUploadCursor
+{
+public:
+  // Start from the cursor persisted in flash
+  void reset(uint32_t seq);
+
+  // Every chunk of record seq has been sent
+  void sent(uint32_t seq, uint32_t nowMs);
+  // The phone holds every record up to seq; an ack beyond the last record
+  // sent is clamped to it. Returns true when the cursor advanced.
+  bool acknowledge(uint32_t seq, uint32_t nowMs);
+  // Forget unacknowledged sends, the next upload starts after acknowledged()
+  void rewind();
+
+  bool pending() const { return _sent > _acked; }
+  // Records sent but nothing acknowledged for JOURNAL_ACK_TIMEOUT_MS
+  bool ackOverdue(uint32_t nowMs) const { return pending() && nowMs - _lastMs >= JOURNAL_ACK_TIMEOUT_MS; }
+  uint32_t acknowledged() const { return _acked; }
+  uint32_t lastSent() const { return _sent; }
+
+private:
+  volatile uint32_t _acked = 0;
+  uint32_t _sent = 0;
+  uint32_t _lastMs = 0;
+};
@@ -12,21 +12,30 @@
 #include <BLE2902.h>
 #include "SensorQMI8658.hpp"
 #include "Arduino_DriveBus_Library.h"
-#include <ArduinoJson.h>
+#include "event_journal.h"
+#include "ble_link.h"
+#include "command_dispatch.h"
+#include "alert_fsm.h"
+#include "alert_outbox.h"
+#include "fall_detector.h"
+#include <esp_timer.h>
 // Device and service identifiers
 #define DEVICE_NAME "Nirbhay_Device"
 #define SERVICE_UUID "12345678-1234-1234-1234-123456789abc"
 #define CHARACTERISTIC_UUID "87654321-4321-4321-4321-cba987654321"
+#define CONTROL_CHARACTERISTIC_UUID "87654321-4321-4321-4321-cba987654322"
 
 // Initialize MAX30102 sensor
 MAX30105 particleSensor;
 
 // BLE variables
-BLEServer *pServer = NULL;
-BLECharacteristic *pCharacteristic = NULL;
-bool deviceConnected = false;
+BleLink bleLink;
 bool oldDeviceConnected = false;
+bool linkStatsRequested = false;
 bool emergencyButton = false;
+
+// On-device record of alerts and the sensor data around them
+EventJournal journal;
 // Display setup
 Arduino_DataBus *bus = new Arduino_ESP32SPI(LCD_DC, LCD_CS, LCD_SCK, LCD_MOSI);
 Arduino_GFX *gfx = new Arduino_ST7789(bus, LCD_RST /* RST */,
@@ -85,6 +94,52 @@ IMUdata gyr; // Gyroscope data
 bool imuInitialized = false;
 unsigned long lastIMUCheck = 0;
 
+// Full-rate IMU sampling and on-device fall detection, run by imuTask
+FallDetector fallDetector;
+QueueHandle_t detectorEvents = NULL;
+portMUX_TYPE imuMux = portMUX_INITIALIZER_UNLOCKED;
+IMUdata latestAcc, latestGyr; // guarded by imuMux
+float latestImpactG = 0;        // guarded by imuMux
+volatile int detectorHeartRate = 0;
+
+void imuTask(void *arg)
+{
+  TickType_t lastWake = xTaskGetTickCount();
+  uint32_t samples = 0;
+  IMUdata a, g = {0, 0, 0};
+
+  for (;;)
+  {
+    // One tick is 1 ms, matching the 1 kHz accelerometer ODR
+    vTaskDelayUntil(&lastWake, 1);
+
+    if (!qmi.getAccelerometer(a.x, a.y, a.z))
+      continue;
+
+    FallDetectorEvent event = fallDetector.update(a.x, a.y, a.z);
+    if (event != FALL_NONE)
+    {
+      // The detector belongs to this task; the loop reads a copy
+      portENTER_CRITICAL(&imuMux);
+      latestImpactG = fallDetector.lastImpactG();
+      portEXIT_CRITICAL(&imuMux);
+      xQueueSend(detectorEvents, &event, 0);
+    }
+
+    // Gyro, heart rate and the loop's copy only need the 20 Hz rate
+    if (++samples % 50 == 0)
+    {
+      qmi.getGyroscope(g.x, g.y, g.z);
+      fallDetector.updateHeartRate(detectorHeartRate);
+
+      portENTER_CRITICAL(&imuMux);
+      latestAcc = a;
+      latestGyr = g;
+      portEXIT_CRITICAL(&imuMux);
+    }
+  }
+}
+
 bool demoMode = false;
 unsigned long demoStartTime = 0;
 unsigned long demoDuration = 20000; // 15 seconds of demo
@@ -131,10 +186,17 @@ bool isTouchInDemoButton(int32_t x, int32_t y)
   return (x >= DEMO_BUTTON_X && x <= DEMO_BUTTON_X + DEMO_BUTTON_W &&
           y >= DEMO_BUTTON_Y && y <= DEMO_BUTTON_Y + DEMO_BUTTON_H);
 }
-bool emergencyActive = false;
-unsigned long emergencyStartTime = 0;
-const unsigned long EMERGENCY_TIMEOUT = 10000; // 10 seconds timeout
-bool sosTriggered = false;
+const unsigned long EMERGENCY_TIMEOUT = 10000; // Default SOS countdown
+
+// Alert state machine; its deadlines are driven by a one-shot esp_timer
+const AlertConfig ALERT_CONFIG = {
+    12000,             // outlasts the fall detector's 10 s confirmation wait
+    EMERGENCY_TIMEOUT, // countdown when the phone doesn't give one
+    2000,              // "marked safe" screen hold
+};
+AlertFsm alertFsm(ALERT_CONFIG);
+esp_timer_handle_t alertTimer = NULL;
+volatile bool alertTimerFired = false;
 
 // Safety button definitions
 #define SAFETY_BUTTON_X 60
@@ -167,10 +229,8 @@ bool isTouchInSafetyButton(int32_t x, int32_t y)
 }
 void sendSensorData()
 {
-  if (!pCharacteristic || emergencyActive)
-    return; // Don't send data during emergency
-
   String data = "{";
+  data += "\"alert\":\"" + String(AlertFsm::stateName(alertFsm.state())) + "\",";
   // Add demo mode status
   data += "\"demo\":" + String(demoMode ? "true" : "false") + ",";
   data += "\"heartRate\":" + String(beatAvg > 0 ? beatAvg : 0) + ",";
@@ -192,57 +252,173 @@ void sendSensorData()
   }
   data += "}";
 
-  pCharacteristic->setValue(data.c_str());
-  pCharacteristic->notify();
+  bleLink.stream(data.c_str());
 }
 
-// BLE callbacks
-class MyServerCallbacks : public BLEServerCallbacks
+// Journal record being uploaded, sent one MTU-sized chunk at a time
+uint8_t journalRecord[JOURNAL_MAX_RECORD];
+size_t journalRecordLen = 0;
+size_t journalChunkSize = 0;
+size_t journalPart = 0;
+
+// Start the journal upload over from the last acknowledged record
+void restartJournalUpload()
 {
-  void onConnect(BLEServer *pServer)
+  journalRecordLen = 0;
+  journal.requestUpload();
+}
+
+// Stream journal chunks queued for upload, a few per loop pass. The upload
+// cursor only advances when the phone acknowledges, see journal_upload.h.
+void sendJournalRecords(unsigned long now)
+{
+  if (journal.uploadAckOverdue(now))
   {
-    deviceConnected = true;
-    Serial.println("Device Connected");
-  };
+    Serial.println("Journal: no ack from the phone, uploading again");
+    restartJournalUpload();
+    return;
+  }
+
+  // Hold the upload until the MTU exchange leaves room for a useful chunk
+  size_t chunkSize = journalChunkBytes(bleLink.maxPayload());
+  if (chunkSize == 0)
+    return;
 
-  void onDisconnect(BLEServer *pServer)
+  char message[JOURNAL_CHUNK_OVERHEAD + 2 * JOURNAL_MAX_RECORD + 1];
+  for (int i = 0; i < 4; i++)
   {
-    deviceConnected = false;
-    Serial.println("Device Disconnected");
+    if (journalRecordLen == 0)
+    {
+      journalRecordLen = journal.nextUploadRecord(journalRecord, sizeof(journalRecord));
+      if (journalRecordLen == 0)
+        break;
+      // Keep the chunk size of the first part for the whole record
+      journalChunkSize = chunkSize;
+      journalPart = 0;
+    }
+
+    uint32_t seq = ((const JournalRecordHeader *)journalRecord)->seq;
+    size_t len = formatJournalChunk(message, sizeof(message), journalRecord, journalRecordLen, seq, journalChunkSize,
+                                    journalPart);
+    // Not sent whole: retry the same chunk on a later pass
+    if (len == 0 || !bleLink.stream((const uint8_t *)message, len))
+      break;
+
+    if (++journalPart == journalChunkCount(journalRecordLen, journalChunkSize))
+    {
+      journal.uploadSent(seq, now);
+      journalRecordLen = 0;
+    }
   }
-};
+}
 
-int emergencyCountdown = 10; // Default countdown in seconds
+// Emergency responses not yet delivered to the phone, see alert_outbox.h.
+// An SOS raised while the link is down or before the MTU exchange waits here
+// and goes out as soon as it fits.
+AlertOutbox alertOutbox;
 
-// Replace your existing MyCallbacks class
-class MyCallbacks : public BLECharacteristicCallbacks
+void sendAlertOutbox(unsigned long now)
 {
-  void onWrite(BLECharacteristic *pCharacteristic)
+  char message[ALERT_MESSAGE_MAX];
+  size_t len;
+  while (bleLink.connected() && (len = alertOutbox.next(message, sizeof(message), now)) > 0 &&
+         len <= bleLink.maxPayload())
   {
-    std::string rxValueStd = pCharacteristic->getValue();
+    // Not sent: retry on a later pass
+    if (!bleLink.sendControl(message))
+      return;
+    bool confirmed = bleLink.controlConfirmed();
+    alertOutbox.sent(confirmed, now);
+    if (confirmed)
+      Serial.printf("Alert: delivered %s\n", message);
+    else
+      Serial.printf("Alert: sent %s, waiting for the phone's ack\n", message);
+  }
+}
 
-    if (rxValueStd.length() > 0)
-    {
-      String rxValue = String(rxValueStd.c_str());
-      Serial.println("Received Value: " + rxValue);
+void queueAlertMessage(const char *response)
+{
+  alertOutbox.push(response);
+  sendAlertOutbox(millis());
+  if (alertOutbox.count() > 0)
+    Serial.printf("Alert: %u message(s) held until the phone confirms\n", alertOutbox.count());
+}
+
+void alertTimerCallback(void *arg)
+{
+  alertTimerFired = true;
+}
 
-      StaticJsonDocument<200> doc;
-      DeserializationError error = deserializeJson(doc, rxValue);
+// Feed one event to the alert state machine and carry out its actions
+void dispatchAlert(AlertEvent event, unsigned long now, uint32_t countdownMs = 0)
+{
+  AlertState before = alertFsm.state();
+  uint8_t actions = alertFsm.dispatch(event, now, countdownMs);
+  if (alertFsm.state() == before && actions == ALERT_ACT_NONE)
+    return;
 
-      if (!error)
-      {
-        // Check if this is an emergency timer message
-        if (doc["type"] == "emergency_timer")
-        {
-          emergencyActive = true;
-          emergencyStartTime = millis();
-          emergencyCountdown = doc["countdown"] | 10;
-          Serial.println("Emergency countdown started: " + String(emergencyCountdown) + " seconds");
-        }
-      }
-    }
+  Serial.printf("Alert: %s -> %s\n", AlertFsm::stateName(before), AlertFsm::stateName(alertFsm.state()));
+
+  esp_timer_stop(alertTimer);
+  if (alertFsm.hasDeadline())
+  {
+    esp_timer_start_once(alertTimer, (uint64_t)alertFsm.remainingMs(now) * 1000);
   }
-};
+
+  if (actions & ALERT_ACT_START_COUNTDOWN)
+  {
+    journal.recordAlert(now, ALERT_EMERGENCY_STARTED, beatAvg, alertFsm.remainingMs(now) / 1000);
+    lastDisplay = 0;
+  }
+  if (actions & ALERT_ACT_SEND_SOS)
+  {
+    journal.recordAlert(now, ALERT_SOS_SENT, beatAvg, 0);
+    queueAlertMessage("sos");
+    lastDisplay = 0;
+  }
+  if (actions & ALERT_ACT_SEND_CANCEL)
+  {
+    journal.recordAlert(now, ALERT_EMERGENCY_CANCELLED, beatAvg, 0);
+    queueAlertMessage("cancel");
+
+    gfx->fillScreen(BLACK);
+    gfx->setTextColor(GREEN);
+    gfx->setTextSize(3);
+    gfx->setCursor(20, 100);
+    gfx->println("MARKED SAFE");
+  }
+  if (actions & ALERT_ACT_CLEAR)
+  {
+    gfx->fillScreen(BLACK);
+    lastDisplay = 0;
+  }
+}
+
+// Command handlers, run on the loop task by CommandDispatcher::poll()
+CommandDispatcher commands;
+
+void onEmergencyTimer(const Command &command)
+{
+  Serial.printf("Emergency countdown requested: %d seconds\n", command.emergencyTimer.countdown);
+  dispatchAlert(ALERT_EV_TRIGGER, millis(), (uint32_t)command.emergencyTimer.countdown * 1000);
+}
+
+void onLinkStats(const Command &command)
+{
+  linkStatsRequested = true;
+}
+
+void onJournalAck(const Command &command)
+{
+  if (journal.acknowledgeUpload(command.journalAck.seq, millis()))
+    Serial.printf("Journal: phone holds records up to %u\n", (unsigned)command.journalAck.seq);
+}
+
+void onAlertAck(const Command &command)
+{
+  if (alertOutbox.acknowledge(command.alertAck.seq))
+    Serial.printf("Alert: phone acknowledged message %u\n", (unsigned)command.alertAck.seq);
+}
 
 void setup()
 {
@@ -328,7 +504,7 @@ void setup()
     // Configure accelerometer
 
     qmi.configAccelerometer(
-        SensorQMI8658::ACC_RANGE_4G,
+        SensorQMI8658::ACC_RANGE_16G, // fall impacts clip at 4G
         SensorQMI8658::ACC_ODR_1000Hz,
         SensorQMI8658::LPF_MODE_0,
         true);
@@ -342,6 +518,10 @@ void setup()
     qmi.enableGyroscope();
     qmi.enableAccelerometer();
 
+    // Sample at the full ODR on core 1, above the loop task
+    detectorEvents = xQueueCreate(8, sizeof(FallDetectorEvent));
+    xTaskCreatePinnedToCore(imuTask, "imu", 4096, NULL, 2, NULL, 1);
+
     gfx->setCursor(10, 160);
     gfx->setTextColor(GREEN);
     gfx->println("IMU Ready!");
@@ -358,36 +538,25 @@ void setup()
   gfx->setCursor(10, 40);
   gfx->println("Starting BLE...");
 
-  // Create the BLE Device
-  BLEDevice::init(DEVICE_NAME);
-
-  // Create the BLE Server
-  pServer = BLEDevice::createServer();
-  pServer->setCallbacks(new MyServerCallbacks());
-
-  // Create the BLE Service
-  BLEService *pService = pServer->createService(SERVICE_UUID);
-
-  // Create a BLE Characteristic
-  pCharacteristic = pService->createCharacteristic(
-      CHARACTERISTIC_UUID,
-      BLECharacteristic::PROPERTY_READ |
-          BLECharacteristic::PROPERTY_WRITE |
-          BLECharacteristic::PROPERTY_NOTIFY |
-          BLECharacteristic::PROPERTY_INDICATE);
-
-  pCharacteristic->setCallbacks(new MyCallbacks());
-  pCharacteristic->addDescriptor(new BLE2902());
-
-  // Start the service
-  pService->start();
-
-  // Start advertising
-  BLEAdvertising *pAdvertising = BLEDevice::getAdvertising();
-  pAdvertising->addServiceUUID(SERVICE_UUID);
-  pAdvertising->setScanResponse(false);
-  pAdvertising->setMinPreferred(0x0);
-  BLEDevice::startAdvertising();
+  const esp_timer_create_args_t alertTimerArgs = {
+      .callback = alertTimerCallback,
+      .name = "alert",
+  };
+  esp_timer_create(&alertTimerArgs, &alertTimer);
+
+  // Create the BLE service and start advertising
+  commands.begin();
+  commands.on(CMD_EMERGENCY_TIMER, onEmergencyTimer);
+  commands.on(CMD_LINK_STATS, onLinkStats);
+  commands.on(CMD_JOURNAL_ACK, onJournalAck);
+  commands.on(CMD_ALERT_ACK, onAlertAck);
+  bleLink.begin(DEVICE_NAME, SERVICE_UUID, CHARACTERISTIC_UUID, CONTROL_CHARACTERISTIC_UUID,
+                &commands);
+
+  if (!journal.begin())
+  {
+    Serial.println("Event journal unavailable");
+  }
 
   gfx->setCursor(10, 70);
   gfx->println("BLE Ready!");
@@ -489,7 +658,36 @@ void simulateDemoData(unsigned long currentMillis)
 
 void loop()
 {
+  commands.poll();
+
   unsigned long currentMillis = millis();
+  if (alertTimerFired)
+  {
+    alertTimerFired = false;
+    dispatchAlert(ALERT_EV_TIMEOUT, currentMillis);
+  }
+
+  FallDetectorEvent detectorEvent;
+  while (detectorEvents && xQueueReceive(detectorEvents, &detectorEvent, 0) == pdTRUE)
+  {
+    if (detectorEvent == FALL_SUSPECTED)
+    {
+      portENTER_CRITICAL(&imuMux);
+      float impactG = latestImpactG;
+      portEXIT_CRITICAL(&imuMux);
+      Serial.printf("Impact detected: %.1f g\n", impactG);
+      dispatchAlert(ALERT_EV_SUSPECT, currentMillis);
+    }
+    else if (detectorEvent == FALL_CONFIRMED)
+    {
+      dispatchAlert(ALERT_EV_TRIGGER, currentMillis);
+    }
+    else if (detectorEvent == FALL_CLEARED)
+    {
+      dispatchAlert(ALERT_EV_CLEAR, currentMillis);
+    }
+  }
+
   int32_t touchX = CST816T->IIC_Read_Device_Value(CST816T->Arduino_IIC_Touch::Value_Information::TOUCH_COORDINATE_X);
   int32_t touchY = CST816T->IIC_Read_Device_Value(CST816T->Arduino_IIC_Touch::Value_Information::TOUCH_COORDINATE_Y);
   bool currentTouch = (touchX > 0 && touchY > 0);
@@ -511,7 +709,16 @@ void loop()
                     DEMO_BUTTON_Y, DEMO_BUTTON_Y + DEMO_BUTTON_H);
     }
 
-    if (isTouchInDemoButton(touchX, touchY))
+    if (alertFsm.active())
+    {
+      // Only the safety button is live while the alert screen is up
+      if (isTouchInSafetyButton(touchX, touchY))
+      {
+        Serial.println("Emergency cancelled by user");
+        dispatchAlert(ALERT_EV_CANCEL, currentMillis);
+      }
+    }
+    else if (isTouchInDemoButton(touchX, touchY))
     {
       // Toggle demo mode
       demoMode = !demoMode;
@@ -572,7 +779,7 @@ void loop()
     lastDisplay = 0;
 
     // Send data immediately to report finger removed
-    if (deviceConnected)
+    if (bleLink.connected())
     {
       sendSensorData();
     }
@@ -581,30 +788,30 @@ void loop()
   {
     lastIMUCheck = currentMillis;
 
-    if (qmi.getDataReady())
-    {
-      // Read accelerometer data
-      if (qmi.getAccelerometer(acc.x, acc.y, acc.z))
-      {
-        Serial.print("ACCEL: x=");
-        Serial.print(acc.x);
-        Serial.print(", y=");
-        Serial.print(acc.y);
-        Serial.print(", z=");
-        Serial.println(acc.z);
-      }
-
-      // Read gyroscope data
-      if (qmi.getGyroscope(gyr.x, gyr.y, gyr.z))
-      {
-        Serial.print("GYRO: x=");
-        Serial.print(gyr.x);
-        Serial.print(", y=");
-        Serial.print(gyr.y);
-        Serial.print(", z=");
-        Serial.println(gyr.z);
-      }
-    }
+    // Latest sample from imuTask, which owns the IMU
+    portENTER_CRITICAL(&imuMux);
+    acc = latestAcc;
+    gyr = latestGyr;
+    portEXIT_CRITICAL(&imuMux);
+    detectorHeartRate = fingerPresent ? beatAvg : 0;
+
+    Serial.print("ACCEL: x=");
+    Serial.print(acc.x);
+    Serial.print(", y=");
+    Serial.print(acc.y);
+    Serial.print(", z=");
+    Serial.println(acc.z);
+
+    Serial.print("GYRO: x=");
+    Serial.print(gyr.x);
+    Serial.print(", y=");
+    Serial.print(gyr.y);
+    Serial.print(", z=");
+    Serial.println(gyr.z);
+
+    float accValues[3] = {acc.x, acc.y, acc.z};
+    float gyrValues[3] = {gyr.x, gyr.y, gyr.z};
+    journal.recordSample(currentMillis, accValues, gyrValues, beatAvg, fingerPresent);
   }
 
   if (fingerPresent)
@@ -725,88 +932,45 @@ void loop()
   //   spo2Index = 0;
   //   Serial.println("Collection canceled - finger removed");
   // }
-  if (emergencyActive)
+  // Short connection interval while an alert is up, long one otherwise
+  bleLink.setMode(alertFsm.active() ? LINK_LOW_LATENCY : LINK_POWER_SAVE);
+
+  // Emergency screen; sensing and telemetry keep running underneath
+  if (alertFsm.active() && currentMillis - lastDisplay > 100)
   {
-    unsigned long currentMillis = millis();
+    lastDisplay = currentMillis;
 
-    // Get fresh touch coordinates
-    int32_t touchX = CST816T->IIC_Read_Device_Value(CST816T->Arduino_IIC_Touch::Value_Information::TOUCH_COORDINATE_X);
-    int32_t touchY = CST816T->IIC_Read_Device_Value(CST816T->Arduino_IIC_Touch::Value_Information::TOUCH_COORDINATE_Y);
-    bool currentTouch = (touchX > 0 && touchY > 0);
+    // Clear screen with red background
+    gfx->fillScreen(RED);
 
-    // Debug touch coordinates
-    if (currentTouch)
-    {
-      Serial.printf("Emergency Screen Touch: X=%d, Y=%d\n", touchX, touchY);
-    }
+    // Draw emergency text
+    gfx->setTextColor(WHITE);
+    gfx->setTextSize(3);
+    gfx->setCursor(20, 40);
+    gfx->println("EMERGENCY!");
 
-    // Handle touch for safety button
-    if (currentTouch && !touchInProgress)
+    gfx->setTextSize(2);
+    gfx->setCursor(20, 90);
+    if (alertFsm.state() == ALERT_COUNTDOWN)
     {
-      touchInProgress = true;
-
-      if (isTouchInSafetyButton(touchX, touchY))
-      {
-        // User confirmed they are safe
-        emergencyActive = false;
-        sosTriggered = false;
-        Serial.println("Emergency cancelled by user");
-
-        // Send cancellation to app
-        String response = "{\"emergency_response\":\"cancel\"}";
-        pCharacteristic->setValue(response.c_str());
-        pCharacteristic->notify();
-
-        // Debug print
-        Serial.println("Sent to phone: " + response);
-
-        // Reset display
-        gfx->fillScreen(BLACK);
-        lastDisplay = 0;
-
-        return; // Exit emergency mode
-      }
+      // Show countdown, rounded up so it never reads 0 before the SOS
+      gfx->print("SOS in: ");
+      gfx->print((alertFsm.remainingMs(currentMillis) + 999) / 1000);
+      gfx->println("s");
     }
-    else if (!currentTouch)
+    else
     {
-      touchInProgress = false; // Reset touch state when no touch detected
+      gfx->println("SOS SENT");
     }
 
-    // Update emergency screen
-    if (currentMillis - lastDisplay > 100)
-    {
-      lastDisplay = currentMillis;
-
-      // Clear screen with red background
-      gfx->fillScreen(RED);
-
-      // Draw emergency text
-      gfx->setTextColor(WHITE);
-      gfx->setTextSize(3);
-      gfx->setCursor(20, 40);
-      gfx->println("EMERGENCY!");
-
-      // Calculate and show countdown
-      int secondsLeft = emergencyCountdown - ((currentMillis - emergencyStartTime) / 1000);
-      if (secondsLeft > 0)
-      {
-        // Show countdown
-        gfx->setTextSize(2);
-        gfx->setCursor(20, 90);
-        gfx->print("SOS in: ");
-        gfx->print(secondsLeft);
-        gfx->println("s");
-
-        // Draw the safety button
-        drawSafetyButton();
-      }
-
-      return; // Skip normal display update
-    }
+    // Draw the safety button
+    drawSafetyButton();
   }
+  bool alertScreen = alertFsm.active() || alertFsm.state() == ALERT_RESOLVED;
+
   // Updating display
   bool forceUpdate = fingerStatusChanged;
-  if (currentMillis - lastDisplay > 500 || fingerStatusChanged)
+  if (!alertScreen && (currentMillis - lastDisplay > 500 || fingerStatusChanged))
   {
     lastDisplay = currentMillis;
     gfx->fillScreen(BLACK);
@@ -900,7 +1064,7 @@ void loop()
     }
     // Display BLE connection status
     gfx->setCursor(10, 170);
-    if (deviceConnected)
+    if (bleLink.connected())
     {
       gfx->setTextColor(GREEN);
       gfx->println("BLE: Connected");
@@ -922,7 +1086,7 @@ void loop()
   }
 
   // Send data via BLE every 500ms when connected
-  if (deviceConnected && (currentMillis - lastBLEUpdate > 500 || fingerStatusChanged))
+  if (bleLink.connected() && (currentMillis - lastBLEUpdate > 500 || fingerStatusChanged))
   {
     lastBLEUpdate = currentMillis;
 
@@ -943,10 +1107,11 @@ void loop()
   }
 
   // Handle BLE connection changes
+  bool deviceConnected = bleLink.connected();
   if (!deviceConnected && oldDeviceConnected)
   {
     delay(500);
-    pServer->startAdvertising();
+    bleLink.startAdvertising();
     Serial.println("Start advertising");
     oldDeviceConnected = deviceConnected;
   }
@@ -954,5 +1119,21 @@ void loop()
   if (deviceConnected && !oldDeviceConnected)
   {
     oldDeviceConnected = deviceConnected;
+    restartJournalUpload();
+    alertOutbox.resend();
+  }
+
+  if (deviceConnected)
+  {
+    sendAlertOutbox(currentMillis);
+    sendJournalRecords(currentMillis);
+  }
+
+  if (deviceConnected && linkStatsRequested)
+  {
+    linkStatsRequested = false;
+    char stats[192];
+    bleLink.formatStats(stats, sizeof(stats), currentMillis);
+    bleLink.sendControl(stats);
   }
 }
\ No newline at end of file
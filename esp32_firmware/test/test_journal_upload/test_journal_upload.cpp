@@ -0,0 +1,205 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "journal_upload.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_cursor_starts_from_persisted(void)
+{
+  JournalUploadCursor cursor;
+  cursor.reset(7);
+  TEST_ASSERT_EQUAL_UINT32(7, cursor.acknowledged());
+  TEST_ASSERT_FALSE(cursor.pending());
+  TEST_ASSERT_FALSE(cursor.ackOverdue(100000));
+}
+
+void test_cursor_advances_only_on_ack(void)
+{
+  JournalUploadCursor cursor;
+  cursor.reset(7);
+  cursor.sent(8, 1000);
+  cursor.sent(9, 1010);
+  TEST_ASSERT_TRUE(cursor.pending());
+  TEST_ASSERT_EQUAL_UINT32(7, cursor.acknowledged());
+
+  TEST_ASSERT_TRUE(cursor.acknowledge(8, 1100));
+  TEST_ASSERT_EQUAL_UINT32(8, cursor.acknowledged());
+  TEST_ASSERT_TRUE(cursor.pending());
+
+  TEST_ASSERT_TRUE(cursor.acknowledge(9, 1200));
+  TEST_ASSERT_EQUAL_UINT32(9, cursor.acknowledged());
+  TEST_ASSERT_FALSE(cursor.pending());
+}
+
+void test_cursor_ignores_stale_and_clamps_future_acks(void)
+{
+  JournalUploadCursor cursor;
+  cursor.reset(7);
+  cursor.sent(9, 1000);
+
+  // Before the persisted cursor or repeated
+  TEST_ASSERT_FALSE(cursor.acknowledge(3, 1100));
+  TEST_ASSERT_FALSE(cursor.acknowledge(7, 1100));
+  TEST_ASSERT_EQUAL_UINT32(7, cursor.acknowledged());
+
+  // Beyond what was sent: the phone can't hold records it never got
+  TEST_ASSERT_TRUE(cursor.acknowledge(500, 1200));
+  TEST_ASSERT_EQUAL_UINT32(9, cursor.acknowledged());
+  TEST_ASSERT_FALSE(cursor.acknowledge(500, 1300));
+
+  // With nothing sent an ack changes nothing
+  JournalUploadCursor idle;
+  idle.reset(4);
+  TEST_ASSERT_FALSE(idle.acknowledge(5, 0));
+  TEST_ASSERT_EQUAL_UINT32(4, idle.acknowledged());
+}
+
+void test_cursor_sent_out_of_order(void)
+{
+  JournalUploadCursor cursor;
+  cursor.reset(0);
+  cursor.sent(5, 0);
+  cursor.sent(3, 0);
+  TEST_ASSERT_EQUAL_UINT32(5, cursor.lastSent());
+}
+
+void test_cursor_ack_timeout(void)
+{
+  JournalUploadCursor cursor;
+  cursor.reset(1);
+  cursor.sent(2, 1000);
+  TEST_ASSERT_FALSE(cursor.ackOverdue(1000 + JOURNAL_ACK_TIMEOUT_MS - 1));
+  TEST_ASSERT_TRUE(cursor.ackOverdue(1000 + JOURNAL_ACK_TIMEOUT_MS));
+
+  // Each send or partial ack restarts the wait
+  cursor.sent(3, 4000);
+  TEST_ASSERT_FALSE(cursor.ackOverdue(1000 + JOURNAL_ACK_TIMEOUT_MS));
+  TEST_ASSERT_TRUE(cursor.acknowledge(2, 8000));
+  TEST_ASSERT_FALSE(cursor.ackOverdue(8000 + JOURNAL_ACK_TIMEOUT_MS - 1));
+  TEST_ASSERT_TRUE(cursor.ackOverdue(8000 + JOURNAL_ACK_TIMEOUT_MS));
+
+  // Wraps with millis()
+  JournalUploadCursor wrap;
+  wrap.reset(0);
+  wrap.sent(1, 0xFFFFFF00u);
+  TEST_ASSERT_FALSE(wrap.ackOverdue(0x100));
+  TEST_ASSERT_TRUE(wrap.ackOverdue(0xFFFFFF00u + JOURNAL_ACK_TIMEOUT_MS));
+
+  // Fully acknowledged is never overdue
+  TEST_ASSERT_TRUE(cursor.acknowledge(3, 8000));
+  TEST_ASSERT_FALSE(cursor.ackOverdue(100000));
+}
+
+void test_cursor_rewind_keeps_acknowledged(void)
+{
+  // A disconnect or ack timeout rewinds; the lost records go out again
+  JournalUploadCursor cursor;
+  cursor.reset(10);
+  cursor.sent(11, 0);
+  cursor.sent(12, 0);
+  TEST_ASSERT_TRUE(cursor.acknowledge(11, 0));
+  cursor.rewind();
+  TEST_ASSERT_FALSE(cursor.pending());
+  TEST_ASSERT_EQUAL_UINT32(11, cursor.acknowledged());
+  TEST_ASSERT_EQUAL_UINT32(11, cursor.lastSent());
+
+  // An ack for the record lost before the rewind waits for its resend
+  TEST_ASSERT_FALSE(cursor.acknowledge(12, 0));
+  cursor.sent(12, 0);
+  TEST_ASSERT_TRUE(cursor.acknowledge(12, 0));
+}
+
+void test_chunk_size_follows_mtu(void)
+{
+  // Default 23 byte MTU: no room, the upload waits for the MTU exchange
+  TEST_ASSERT_EQUAL_UINT(0, journalChunkBytes(20));
+  TEST_ASSERT_EQUAL_UINT(0, journalChunkBytes(JOURNAL_UPLOAD_MIN_PAYLOAD - 1));
+  TEST_ASSERT_EQUAL_UINT(21, journalChunkBytes(JOURNAL_UPLOAD_MIN_PAYLOAD));
+  TEST_ASSERT_EQUAL_UINT(229, journalChunkBytes(512));
+
+  TEST_ASSERT_EQUAL_UINT(0, journalChunkCount(208, 0));
+  TEST_ASSERT_EQUAL_UINT(1, journalChunkCount(208, 229));
+  TEST_ASSERT_EQUAL_UINT(10, journalChunkCount(208, 21));
+  TEST_ASSERT_EQUAL_UINT(2, journalChunkCount(42, 21));
+  TEST_ASSERT_EQUAL_UINT(3, journalChunkCount(43, 21));
+}
+
+// Every chunk fits the payload it was sized for, and the hex of all parts
+// concatenated is the record
+static void checkChunks(size_t maxPayload, size_t recordLen)
+{
+  uint8_t record[208];
+  for (size_t i = 0; i < recordLen; i++)
+    record[i] = (uint8_t)(i * 37 + 5);
+
+  size_t chunkBytes = journalChunkBytes(maxPayload);
+  size_t parts = journalChunkCount(recordLen, chunkBytes);
+  TEST_ASSERT_TRUE(parts > 0);
+
+  char hex[2 * sizeof(record) + 1] = "";
+  size_t hexLen = 0;
+  for (size_t part = 0; part < parts; part++)
+  {
+    char out[JOURNAL_CHUNK_OVERHEAD + 2 * sizeof(record) + 1];
+    size_t len = formatJournalChunk(out, sizeof(out), record, recordLen, 0xFFFFFFFFu, chunkBytes, part);
+    TEST_ASSERT_TRUE(len > 0);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT(maxPayload, len);
+    TEST_ASSERT_EQUAL_UINT(strlen(out), len);
+
+    char tail[64];
+    snprintf(tail, sizeof(tail), "\",\"seq\":4294967295,\"part\":%u,\"parts\":%u}", (unsigned)part, (unsigned)parts);
+    TEST_ASSERT_EQUAL_INT(0, strncmp(out, "{\"journal\":\"", 12));
+    TEST_ASSERT_EQUAL_STRING(tail, out + len - strlen(tail));
+    size_t partHex = len - 12 - strlen(tail);
+    memcpy(hex + hexLen, out + 12, partHex);
+    hexLen += partHex;
+  }
+
+  TEST_ASSERT_EQUAL_UINT(2 * recordLen, hexLen);
+  for (size_t i = 0; i < recordLen; i++)
+  {
+    unsigned byte;
+    char pair[3] = {hex[2 * i], hex[2 * i + 1], 0};
+    sscanf(pair, "%x", &byte);
+    TEST_ASSERT_EQUAL_HEX8(record[i], byte);
+  }
+}
+
+void test_chunks_reassemble(void)
+{
+  checkChunks(JOURNAL_UPLOAD_MIN_PAYLOAD, 208);
+  checkChunks(JOURNAL_UPLOAD_MIN_PAYLOAD + 1, 208);
+  checkChunks(182, 208);
+  checkChunks(244, 208);
+  checkChunks(512, 208);
+  checkChunks(JOURNAL_UPLOAD_MIN_PAYLOAD, 1);
+  checkChunks(JOURNAL_UPLOAD_MIN_PAYLOAD, 21);
+  checkChunks(JOURNAL_UPLOAD_MIN_PAYLOAD, 22);
+}
+
+void test_chunk_bounds(void)
+{
+  uint8_t record[40] = {0};
+  char out[256];
+  TEST_ASSERT_EQUAL_UINT(0, formatJournalChunk(out, sizeof(out), record, sizeof(record), 1, 21, 2));
+  TEST_ASSERT_EQUAL_UINT(0, formatJournalChunk(out, sizeof(out), record, sizeof(record), 1, 0, 0));
+  TEST_ASSERT_EQUAL_UINT(0, formatJournalChunk(out, 40, record, sizeof(record), 1, 21, 0));
+  TEST_ASSERT_TRUE(formatJournalChunk(out, sizeof(out), record, sizeof(record), 1, 21, 1) > 0);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_cursor_starts_from_persisted);
+  RUN_TEST(test_cursor_advances_only_on_ack);
+  RUN_TEST(test_cursor_ignores_stale_and_clamps_future_acks);
+  RUN_TEST(test_cursor_sent_out_of_order);
+  RUN_TEST(test_cursor_ack_timeout);
+  RUN_TEST(test_cursor_rewind_keeps_acknowledged);
+  RUN_TEST(test_chunk_size_follows_mtu);
+  RUN_TEST(test_chunks_reassemble);
+  RUN_TEST(test_chunk_bounds);
+  return UNITY_END();
+}
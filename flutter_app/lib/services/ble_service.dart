@@ -22,6 +22,10 @@ class BLEService {
   StreamSubscription<BluetoothConnectionState>? _connectionSubscription;
   StreamSubscription<List<int>>? _characteristicSubscription;
 
+  // Sequence number of the last emergency response passed on; the device
+  // sends a response again until it gets our ack
+  int? _lastAlertSeq;
+
   // Connection state stream
   final StreamController<BluetoothConnectionState> _connectionStateController =
       StreamController<BluetoothConnectionState>.broadcast();
@@ -253,6 +257,18 @@ class BLEService {
       // Parse JSON data from ESP32
       Map<String, dynamic> parsedData = json.decode(data);
 
+      // Acknowledge emergency responses so the device stops resending them,
+      // and pass each one on only once
+      if (parsedData.containsKey('emergency_response') &&
+          parsedData['seq'] is int) {
+        int seq = parsedData['seq'];
+        sendData({'type': 'alert_ack', 'seq': seq});
+        if (seq == _lastAlertSeq) {
+          return;
+        }
+        _lastAlertSeq = seq;
+      }
+
       // Check for emergency cancel response
       if (parsedData.containsKey('emergency_response') &&
           parsedData['emergency_response'] == 'cancel') {
@@ -294,6 +310,7 @@ class BLEService {
     _characteristicSubscription = null;
     _connectedDevice = null;
     _characteristic = null;
+    _lastAlertSeq = null;
   }
 
   /// Dispose of the service